@@ -10,6 +10,7 @@
 #include "elements/Pair.h"
 // TODO:CN[hpXMGRRenderer/sourcesǉĂBƂŊO
 #include "renderer/BasicDataTypes.h"
+#include "utility/Profiler.h"
 
 namespace mgrphysics
 {
@@ -36,46 +37,60 @@ Pair pairs[2][MAX_PAIRS];
 
 void SimulatePhysics()
 {
+	MGRRENDERER_PROFILE_SCOPE("SimulatePhysics");
+
 	pairSwap = 1 - pairSwap;
 
-	broadPhase(
-		states,
-		collidables,
-		numRigidBodies,
-		pairs[1 - pairSwap],
-		numPairs[1 - pairSwap],
-		pairs[pairSwap],
-		numPairs[pairSwap],
-		MAX_PAIRS,
-		nullptr
-	);
+	{
+		MGRRENDERER_PROFILE_SCOPE("broadPhase");
+		broadPhase(
+			states,
+			collidables,
+			numRigidBodies,
+			pairs[1 - pairSwap],
+			numPairs[1 - pairSwap],
+			pairs[pairSwap],
+			numPairs[pairSwap],
+			MAX_PAIRS,
+			nullptr
+		);
+	}
 
-	detectCollision(
-		states,
-		collidables,
-		numRigidBodies,
-		pairs[pairSwap],
-		numPairs[pairSwap]
-	);
+	{
+		MGRRENDERER_PROFILE_SCOPE("detectCollision");
+		detectCollision(
+			states,
+			collidables,
+			numRigidBodies,
+			pairs[pairSwap],
+			numPairs[pairSwap]
+		);
+	}
 
-	solveConstraint(
-		states,
-		bodies,
-		numRigidBodies,
-		pairs[pairSwap],
-		numPairs[pairSwap],
-		joints,
-		numJoints,
-		ITERATION,
-		CONTACT_BIAS,
-		CONTACT_SLOP,
-		TIME_STEP
-	);
+	{
+		MGRRENDERER_PROFILE_SCOPE("solveConstraint");
+		solveConstraint(
+			states,
+			bodies,
+			numRigidBodies,
+			pairs[pairSwap],
+			numPairs[pairSwap],
+			joints,
+			numJoints,
+			ITERATION,
+			CONTACT_BIAS,
+			CONTACT_SLOP,
+			TIME_STEP
+		);
+	}
 
-	integrate(
-		states,
-		numRigidBodies,
-		TIME_STEP
-	);
+	{
+		MGRRENDERER_PROFILE_SCOPE("integrate");
+		integrate(
+			states,
+			numRigidBodies,
+			TIME_STEP
+		);
+	}
 }
 } // namespace mgrphysics
@@ -84,6 +84,9 @@ Texture2D<float> _shadowMapTex : register(t1);
 SamplerState _linearSampler : register(s0);
 SamplerComparisonState _pcfSampler : register(s1);
 
+// pXɉSHADOW_MAPGBUFFER`ăRpCBALPHA_TEST`ƃeNX`̃At@Ŕ
+static const float ALPHA_TEST_THRESHOLD = 0.5;
+
 struct VS_INPUT
 {
 	float3 position : POSITION;
@@ -96,17 +99,26 @@ struct VS_INPUT
 struct GS_SM_POINT_LIGHT_INPUT
 {
 	float4 position : SV_POSITION;
+#if ALPHA_TEST
+	float2 texCoord : TEX_COORD;
+#endif
 };
 
 struct PS_SM_INPUT
 {
 	float4 lightPosition : SV_POSITION;
+#if ALPHA_TEST
+	float2 texCoord : TEX_COORD;
+#endif
 };
 
 struct PS_SM_POINT_LIGHT_INPUT
 {
 	float4 lightPosition : SV_POSITION;
 	uint cubeMapFaceIndex : SV_RenderTargetArrayIndex;
+#if ALPHA_TEST
+	float2 texCoord : TEX_COORD;
+#endif
 };
 
 struct PS_GBUFFER_INPUT
@@ -141,6 +153,7 @@ float4 getAnimatedPosition(float4 blendWeight, float4 blendIndex, float4 positio
 	return skinnedPosition;
 }
 
+#if SHADOW_MAP
 PS_SM_INPUT VS_SM(VS_INPUT input)
 {
 	PS_SM_INPUT output;
@@ -150,6 +163,9 @@ PS_SM_INPUT VS_SM(VS_INPUT input)
 	position = mul(position, _model);
 	position = mul(position, _view);
 	output.lightPosition = mul(position, _projection);
+#if ALPHA_TEST
+	output.texCoord = input.texCoord;
+#endif
 	return output;
 }
 
@@ -161,9 +177,14 @@ GS_SM_POINT_LIGHT_INPUT VS_SM_POINT_LIGHT(VS_INPUT input)
 
 	position = getAnimatedPosition(input.blendWeight, input.blendIndex, position);
 	output.position = mul(position, _model);
+#if ALPHA_TEST
+	output.texCoord = input.texCoord;
+#endif
 	return output;
 }
+#endif
 
+#if GBUFFER
 PS_GBUFFER_INPUT VS_GBUFFER(VS_INPUT input)
 {
 	PS_GBUFFER_INPUT output;
@@ -180,7 +201,9 @@ PS_GBUFFER_INPUT VS_GBUFFER(VS_INPUT input)
 
 	return output;
 }
+#endif
 
+#if SHADOW_MAP
 [maxvertexcount(18)]
 void GS_SM_POINT_LIGHT(triangle GS_SM_POINT_LIGHT_INPUT input[3], inout TriangleStream<PS_SM_POINT_LIGHT_INPUT> triangleStream)
 {
@@ -193,11 +216,15 @@ void GS_SM_POINT_LIGHT(triangle GS_SM_POINT_LIGHT_INPUT input[3], inout Triangle
 		{
 			float4 position = mul(input[j].position, _pointLightViewMatrices[i]);
 			output.lightPosition = mul(position, _pointLightProjectionMatrix);
+#if ALPHA_TEST
+			output.texCoord = input[j].texCoord;
+#endif
 			triangleStream.Append(output);
 		}
 		triangleStream.RestartStrip();
 	}
 }
+#endif
 
 // gĂȂ̂ŃRgAEg
 //float4 PS_SM(PS_SM_INPUT input) : SV_TARGET
@@ -207,8 +234,27 @@ void GS_SM_POINT_LIGHT(triangle GS_SM_POINT_LIGHT_INPUT input[3], inout Triangle
 //	return float4(z, z, z, 1.0);
 //}
 
+#if SHADOW_MAP && ALPHA_TEST
+// At@eXgƂVhE}bv̕`ɃsNZVF[_gB[x͉Ƃ܂
+void PS_SM_ALPHA_TEST(PS_SM_INPUT input)
+{
+	clip(_texture2d.Sample(_linearSampler, input.texCoord).a - ALPHA_TEST_THRESHOLD);
+}
+
+void PS_SM_POINT_LIGHT_ALPHA_TEST(PS_SM_POINT_LIGHT_INPUT input)
+{
+	clip(_texture2d.Sample(_linearSampler, input.texCoord).a - ALPHA_TEST_THRESHOLD);
+}
+#endif
+
+#if GBUFFER
 PS_GBUFFER_OUT PS_GBUFFER(PS_GBUFFER_INPUT input)
 {
-	float4 color = _texture2d.Sample(_linearSampler, input.texCoord) * _multiplyColor;
+	float4 textureColor = _texture2d.Sample(_linearSampler, input.texCoord);
+#if ALPHA_TEST
+	clip(textureColor.a - ALPHA_TEST_THRESHOLD);
+#endif
+	float4 color = textureColor * _multiplyColor;
 	return packGBuffer(color.rgb, normalize(input.normal), 0.0, 0.0); //TODO: specular͍̂ƂΉĂȂ
 }
+#endif
@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 const int CUBEMAP_FACE_X_POSITIVE = 0;
 const int CUBEMAP_FACE_X_NEGATIVE = 1;
 const int CUBEMAP_FACE_Y_POSITIVE = 2;
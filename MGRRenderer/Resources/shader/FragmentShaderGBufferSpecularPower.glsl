@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 uniform sampler2D u_texture;
 
 varying vec2 v_texCoord;
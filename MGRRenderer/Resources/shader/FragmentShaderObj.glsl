@@ -0,0 +1,56 @@
+// Sprite3D̃VhE}bvւ̐[x`Gobt@ւ̕`ɎgB}`_[^[Qbĝ߂GLSL4.3.0ŏ
+// `悷pXɉSHADOW_MAPGBUFFER̂ǂ炩`BALPHA_TEST`ƃeNX`̃At@Ŕ
+#version 430 compatibility
+
+#if !defined(SHADOW_MAP) && !defined(GBUFFER)
+#error SHADOW_MAP or GBUFFER must be defined
+#endif
+
+const float ALPHA_TEST_THRESHOLD = 0.5;
+
+in vec2 v_texCoord;
+
+uniform sampler2D u_texture;
+
+#ifdef GBUFFER
+float SPECULAR_POWER_RANGE_X = 10.0;
+float SPECULAR_POWER_RANGE_Y = 250.0;
+
+in vec4 v_position;
+in vec4 v_normal;
+
+uniform vec3 u_multipleColor;
+
+layout (location = 0) out vec4 FragColor; // fvXobt@̕
+layout (location = 1) out vec4 ColorSpecularIntensity;
+layout (location = 2) out vec4 Normal;
+layout (location = 3) out vec4 SpecularPower;
+#endif
+
+void main()
+{
+#if defined(ALPHA_TEST) || defined(GBUFFER)
+	vec4 textureColor = texture2D(u_texture, v_texCoord);
+#endif
+
+#ifdef ALPHA_TEST
+	if (textureColor.a < ALPHA_TEST_THRESHOLD)
+	{
+		discard;
+	}
+#endif
+
+#ifdef GBUFFER
+	// Gobt@ւ̃pbLOs
+
+	// specular͍̂ƂΉĂȂ
+	float specularPower = 0.0;
+	float specularIntensity = 0.0;
+	float specularPowerNorm = max(0.0001, (specularPower - SPECULAR_POWER_RANGE_X) / SPECULAR_POWER_RANGE_Y);
+
+	ColorSpecularIntensity = vec4(textureColor.rgb * u_multipleColor.rgb, specularIntensity);
+	Normal = vec4(v_normal.xyz * 0.5 + 0.5, 0.0);
+	SpecularPower = vec4(specularPowerNorm, 0.0, 0.0, 0.0);
+#endif
+	// VhE}bvł͉Ƃ[x͎ŏ܂
+}
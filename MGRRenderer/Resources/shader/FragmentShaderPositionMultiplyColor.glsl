@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 uniform vec3 u_multipleColor;
 void main()
 {
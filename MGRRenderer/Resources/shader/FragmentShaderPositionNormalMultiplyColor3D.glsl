@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 
 const int MAX_NUM_POINT_LIGHT = 4; // ӁFvOƒ萔̈vKv
 const int NUM_FACE_CUBEMAP_TEXTURE = 6;
@@ -170,38 +170,37 @@ void main()
 
 	for (uint i = 0; i < MAX_NUM_SPOT_LIGHT; i++)
 	{
-		if (!u_spotLightIsValid[i])
+		// |CgCg̃[vƗcontinuegƁAMesallvmpipeVF[_̃RpCɗ̂ifň͂
+		if (u_spotLightIsValid[i])
 		{
-			continue;
-		}
-
-		vec3 vertexToSpotLightDirection = v_vertexToSpotLightDirection[i];
-		vec3 dir = vertexToSpotLightDirection * u_spotLightRangeInverse[i];
-		float attenuation = clamp(1.0 - dot(dir, dir), 0.0, 1.0);
-		vertexToSpotLightDirection = normalize(vertexToSpotLightDirection);
-		float spotLightCurrentAngleCos = dot(u_spotLightDirection[i], -vertexToSpotLightDirection);
-		attenuation *= smoothstep(u_spotLightOuterAngleCos[i], u_spotLightInnerAngleCos[i], spotLightCurrentAngleCos);
-		attenuation = clamp(attenuation, 0.0, 1.0);
-
-		shadowAttenuation = 1.0;
-
-		if (u_spotLightHasShadowMap[i]) {
-			vec4 lightPosition = u_depthBiasMatrix * u_spotLightProjectionMatrix[i] * u_spotLightViewMatrix[i] * v_worldPosition;
-			//// zt@CeBO邽߂̔
-			lightPosition.z -= 0.05;
+			vec3 vertexToSpotLightDirection = v_vertexToSpotLightDirection[i];
+			vec3 dir = vertexToSpotLightDirection * u_spotLightRangeInverse[i];
+			float attenuation = clamp(1.0 - dot(dir, dir), 0.0, 1.0);
+			vertexToSpotLightDirection = normalize(vertexToSpotLightDirection);
+			float spotLightCurrentAngleCos = dot(u_spotLightDirection[i], -vertexToSpotLightDirection);
+			attenuation *= smoothstep(u_spotLightOuterAngleCos[i], u_spotLightInnerAngleCos[i], spotLightCurrentAngleCos);
+			attenuation = clamp(attenuation, 0.0, 1.0);
+
+			shadowAttenuation = 1.0;
+
+			if (u_spotLightHasShadowMap[i]) {
+				vec4 lightPosition = u_depthBiasMatrix * u_spotLightProjectionMatrix[i] * u_spotLightViewMatrix[i] * v_worldPosition;
+				//// zt@CeBO邽߂̔
+				lightPosition.z -= 0.05;
+
+				// PCF
+				shadowAttenuation = 0.0;
+				shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(-1, -1));
+				shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(-1, 1));
+				shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(1, 1));
+				shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(1, -1));
+				shadowAttenuation *= 0.25;
 
-			// PCF
-			shadowAttenuation = 0.0;
-			shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(-1, -1));
-			shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(-1, 1));
-			shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(1, 1));
-			shadowAttenuation += textureProjOffset(u_spotLightShadowMap[i], lightPosition, ivec2(1, -1));
-			shadowAttenuation *= 0.25;
+				//shadowAttenuation = textureProj(u_spotLightShadowMap, lightPosition);
+			}
 
-			//shadowAttenuation = textureProj(u_spotLightShadowMap, lightPosition);
+			diffuseSpecularLightColor += shadowAttenuation * computeLightedColor(normal, vertexToSpotLightDirection, u_spotLightColor[i], attenuation);
 		}
-
-		diffuseSpecularLightColor += shadowAttenuation * computeLightedColor(normal, vertexToSpotLightDirection, u_spotLightColor[i], attenuation);
 	}
 
 	switch (u_renderMode)
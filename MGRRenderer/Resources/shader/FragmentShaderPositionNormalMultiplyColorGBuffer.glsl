@@ -1,5 +1,5 @@
 // fBt@[h_OɎĝŁA}`_[^[Qbĝ߂GLSL4.3.0ŏ
-#version 430
+#version 430 compatibility
 
 float SPECULAR_POWER_RANGE_X = 10.0;
 float SPECULAR_POWER_RANGE_Y = 250.0;
@@ -0,0 +1,7 @@
+// VhE}bvւ̐[x`p
+#version 430 compatibility
+
+void main()
+{
+	// Ƃ[x͎ŏ܂
+}
@@ -0,0 +1,45 @@
+// _SpriteBatcherŃ[hWɕϊς݂Ȃ̂Ńfs͎gȂ
+cbuffer ViewMatrix : register(b0)
+{
+	matrix _view;
+};
+
+cbuffer ProjectionMatrix : register(b1)
+{
+	matrix _projection;
+};
+
+Texture2D<float4> _texture2d : register(t0);
+SamplerState _linearSampler : register(s0);
+
+struct VS_INPUT
+{
+	float3 position : POSITION;
+	float2 texCoord : TEX_COORD;
+	float4 color : COLOR;
+};
+
+struct PS_INPUT
+{
+	float4 position : SV_POSITION;
+	float2 texCoord : TEX_COORD;
+	float4 color : COLOR;
+};
+
+PS_INPUT VS(VS_INPUT input)
+{
+	PS_INPUT output;
+
+	float4 position = float4(input.position, 1.0);
+	position = mul(position, _view);
+	output.position = mul(position, _projection);
+
+	output.texCoord = input.texCoord;
+	output.color = input.color;
+	return output;
+}
+
+float4 PS(PS_INPUT input) : SV_TARGET
+{
+	return _texture2d.Sample(_linearSampler, input.texCoord) * input.color;
+}
@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 
 const int MAX_NUM_POINT_LIGHT = 4; // ӁFvOƒ萔̈vKv
 const int MAX_NUM_SPOT_LIGHT = 4; // ӁFvOƒ萔̈vKv
@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 attribute vec2 a_position;
 attribute vec2 a_texCoord;
 varying vec2 v_texCoord;
@@ -1,24 +1,89 @@
-// fBt@[h_OɎĝŁA}`_[^[Qbĝ߂GLSL4.3.0ŏ
-#version 430
+// Sprite3D̃VhE}bvւ̐[x`Gobt@ւ̕`ɎgB}`_[^[Qbĝ߂GLSL4.3.0ŏ
+// `悷pXɉSHADOW_MAPGBUFFER̂ǂ炩`
+// SKINNING`c3b/c3tp̃XLjOAALPHA_TEST`ƃeNX`̃At@ŔoG[VɂȂ
+#version 430 compatibility
 
+#ifdef SKINNING
+const int MAX_SKINNING_JOINT = 60; // ӁFvOƒ萔̈vKv
+
+in vec3 a_position; // ꂪvec3ɂȂĂ̂ɒ TODO:ȂȂ̂H
+in vec3 a_normal;
+in vec4 a_blendWeight;
+in vec4 a_blendIndex;
+uniform mat4 u_matrixPalette[MAX_SKINNING_JOINT];
+#else
 in vec4 a_position;
 in vec4 a_normal;
+#endif
 in vec2 a_texCoord;
 
-out vec4 v_position;
-out vec4 v_normal;
 out vec2 v_texCoord;
 
 uniform mat4 u_modelMatrix;
+
+#ifdef SHADOW_MAP
+uniform mat4 u_lightViewMatrix; // etɎgCgJɌĂr[s
+uniform mat4 u_lightProjectionMatrix;
+#else
+out vec4 v_position;
+out vec4 v_normal;
+
 uniform mat4 u_viewMatrix;
 uniform mat4 u_projectionMatrix;
 uniform mat4 u_normalMatrix;
+#endif
+
+#ifdef SKINNING
+vec4 getPosition()
+{
+	mat4 skinMatrix = u_matrixPalette[int(a_blendIndex[0])] * a_blendWeight[0];
+
+	if (a_blendWeight[1] > 0.0)
+	{
+		skinMatrix += u_matrixPalette[int(a_blendIndex[1])] * a_blendWeight[1];
+
+		if (a_blendWeight[2] > 0.0)
+		{
+			skinMatrix += u_matrixPalette[int(a_blendIndex[2])] * a_blendWeight[2];
+
+			if (a_blendWeight[3] > 0.0)
+			{
+				skinMatrix += u_matrixPalette[int(a_blendIndex[3])] * a_blendWeight[3];
+			}
+		}
+	}
+
+	vec4 position = vec4(a_position, 1.0);
+	vec4 skinnedPosition = skinMatrix * position;
+	skinnedPosition.w = 1.0;
+	return skinnedPosition;
+}
+
+vec4 getNormal()
+{
+	return vec4(a_normal, 1.0);
+}
+#else
+vec4 getPosition()
+{
+	return a_position;
+}
+
+vec4 getNormal()
+{
+	return a_normal;
+}
+#endif
 
 void main()
 {
-	v_position = u_projectionMatrix * u_viewMatrix * u_modelMatrix * a_position;
-	v_normal = vec4(normalize((u_normalMatrix * a_normal).xyz), 1.0);
-	v_texCoord = a_texCoord;
-	v_texCoord.y = 1.0 - v_texCoord.y; // obj̎ɂ
+#ifdef SHADOW_MAP
+	gl_Position = u_lightProjectionMatrix * u_lightViewMatrix * u_modelMatrix * getPosition();
+#else
+	v_position = u_projectionMatrix * u_viewMatrix * u_modelMatrix * getPosition();
+	v_normal = vec4(normalize((u_normalMatrix * getNormal()).xyz), 1.0);
 	gl_Position = v_position;
+#endif
+	v_texCoord = a_texCoord;
+	v_texCoord.y = 1.0 - v_texCoord.y; // objAc3b̎ɂ
 }
@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 attribute vec4 a_position;
 uniform mat4 u_modelMatrix;
 uniform mat4 u_viewMatrix;
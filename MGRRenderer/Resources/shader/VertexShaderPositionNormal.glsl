@@ -1,5 +1,5 @@
 // fBt@[h_OɎĝŁA}`_[^[Qbĝ߂GLSL4.3.0ŏ
-#version 430
+#version 430 compatibility
 
 in vec4 a_position;
 in vec4 a_normal;
@@ -1,5 +1,5 @@
 // fBt@[h_OɎĝŁA}`_[^[Qbĝ߂GLSL4.3.0ŏ
-#version 430
+#version 430 compatibility
 
 const int MAX_NUM_POINT_LIGHT = 4; // ӁFvOƒ萔̈vKv
 const int MAX_NUM_SPOT_LIGHT = 4; // ӁFvOƒ萔̈vKv
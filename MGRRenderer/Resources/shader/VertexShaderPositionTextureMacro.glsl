@@ -1,4 +1,4 @@
-#version 430
+#version 430 compatibility
 
 attribute vec4 a_position;
 attribute vec2 a_texCoord;
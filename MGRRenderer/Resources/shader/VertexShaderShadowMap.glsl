@@ -0,0 +1,13 @@
+// Polygon3D̃VhE}bvւ̐[x`pBSprite3DVertexShaderObj.glslSHADOW_MAP̃oG[Vg
+#version 430 compatibility
+
+attribute vec4 a_position;
+
+uniform mat4 u_modelMatrix;
+uniform mat4 u_lightViewMatrix; // etɎgCgJɌĂr[s
+uniform mat4 u_lightProjectionMatrix;
+
+void main()
+{
+	gl_Position = u_lightProjectionMatrix * u_lightViewMatrix * u_modelMatrix * a_position;
+}
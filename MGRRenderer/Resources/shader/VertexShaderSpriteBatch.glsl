@@ -0,0 +1,15 @@
+#version 430 compatibility
+// _SpriteBatcherŃ[hWɕϊς݂Ȃ̂Ńfs͎gȂ
+attribute vec4 a_position;
+attribute vec2 a_texCoord;
+attribute vec4 a_color;
+uniform mat4 u_viewMatrix;
+uniform mat4 u_projectionMatrix;
+varying vec2 v_texCoord;
+varying vec4 v_color;
+void main()
+{
+	gl_Position = u_projectionMatrix * u_viewMatrix * a_position;
+	v_texCoord = a_texCoord;
+	v_color = a_color;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
-#if !defined(MGRRENDERER_USE_DIRECT3D)
+// rhVXeMGRRENDERER_USE_OPENGLw肳ꂽƂ(LinuxrhȂ)OpenGLg
+#if !defined(MGRRENDERER_USE_DIRECT3D) && !defined(MGRRENDERER_USE_OPENGL)
 	#define MGRRENDERER_USE_DIRECT3D
 
 	#if !defined(MGRRENDERER_USE_OPENGL)
@@ -31,3 +32,13 @@
 //	#undef MGRRENDERER_DEFERRED_RENDERING
 //	#endif // !defined(MGRRENDERER_DEFERRED_RENDERING)
 //#endif // !defined(MGRRENDERER_FOWARD_RENDERING)
+
+// XR[vPʂCPUvt@CBL^RXg͏̂Ń[XrhłLɂĂ
+#if !defined(MGRRENDERER_ENABLE_PROFILER)
+	#define MGRRENDERER_ENABLE_PROFILER
+#endif // !defined(MGRRENDERER_ENABLE_PROFILER)
+
+// OpenGĽĂяot@CɋL^MGRReplayōĐł悤ɂBL^ĂȂƂ̃RXg͌ĂяoƂ̕1
+#if defined(MGRRENDERER_USE_OPENGL) && !defined(MGRRENDERER_ENABLE_GL_CAPTURE)
+	#define MGRRENDERER_ENABLE_GL_CAPTURE
+#endif // defined(MGRRENDERER_USE_OPENGL) && !defined(MGRRENDERER_ENABLE_GL_CAPTURE)
@@ -3,6 +3,7 @@
 //TODO:Macros.h낤
 #include "renderer/BasicDataTypes.h"
 #include "utility/Logger.h"
+#include "utility/Profiler.h"
 #include "renderer/Director.h"
 #include "node/Scene.h"
 #include "renderer/Renderer.h"
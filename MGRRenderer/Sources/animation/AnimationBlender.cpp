@@ -0,0 +1,420 @@
+#include "AnimationBlender.h"
+#include "Skeleton.h"
+#include "utility/Logger.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+// SSE2gł́Ap̔z܂Ƃ߂4vfuh
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define MGRRENDERER_ANIMATION_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace mgrrenderer
+{
+
+// Vec3̔zfloat̔zƂ4vf̂ŁApfBOȂ
+static_assert(sizeof(Vec3) == sizeof(float) * 3, "Vec3 must be tightly packed");
+static_assert(sizeof(Quaternion) == sizeof(float) * 4, "Quaternion must be tightly packed");
+
+// out += in * weightBVec3̔zfloatԂȂł̂ŁA̋؂Cɂ擪܂Ƃ߂ďł
+static void accumulateVec3(const std::vector<Vec3>& in, float weight, std::vector<Vec3>& out)
+{
+	const float* src = &in[0].x;
+	float* dst = &out[0].x;
+	size_t numFloats = in.size() * 3;
+	size_t i = 0;
+
+#if defined(MGRRENDERER_ANIMATION_USE_SSE)
+	__m128 weightVector = _mm_set1_ps(weight);
+	for (; i + 4 <= numFloats; i += 4)
+	{
+		_mm_storeu_ps(dst + i, _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), weightVector)));
+	}
+#endif
+
+	for (; i < numFloats; ++i)
+	{
+		dst[i] += src[i] * weight;
+	}
+}
+
+// out += in * weightB]q  -q Ȃ̂ŁAޑOoutƓɂ낦
+static void accumulateQuaternion(const std::vector<Quaternion>& in, float weight, std::vector<Quaternion>& out)
+{
+	size_t numJoints = in.size();
+
+#if defined(MGRRENDERER_ANIMATION_USE_SSE)
+	__m128 weightVector = _mm_set1_ps(weight);
+	__m128 signBit = _mm_set1_ps(-0.0f);
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		__m128 accumulated = _mm_loadu_ps(&out[i].x);
+		__m128 rotation = _mm_loadu_ps(&in[i].x);
+
+		__m128 dot = _mm_mul_ps(accumulated, rotation);
+		dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+		dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+		rotation = _mm_xor_ps(rotation, _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), signBit));
+
+		_mm_storeu_ps(&out[i].x, _mm_add_ps(accumulated, _mm_mul_ps(rotation, weightVector)));
+	}
+#else
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		Quaternion& accumulated = out[i];
+		const Quaternion& rotation = in[i];
+		float dot = accumulated.x * rotation.x + accumulated.y * rotation.y + accumulated.z * rotation.z + accumulated.w * rotation.w;
+		float signedWeight = (dot < 0.0f) ? -weight : weight;
+		accumulated.x += rotation.x * signedWeight;
+		accumulated.y += rotation.y * signedWeight;
+		accumulated.z += rotation.z * signedWeight;
+		accumulated.w += rotation.w * signedWeight;
+	}
+#endif
+}
+
+static void normalizeQuaternions(std::vector<Quaternion>& rotations)
+{
+	size_t numJoints = rotations.size();
+
+#if defined(MGRRENDERER_ANIMATION_USE_SSE)
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		__m128 rotation = _mm_loadu_ps(&rotations[i].x);
+		__m128 lengthSquared = _mm_mul_ps(rotation, rotation);
+		lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(2, 3, 0, 1)));
+		lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(1, 0, 3, 2)));
+		if (_mm_cvtss_f32(lengthSquared) > 0.0f)
+		{
+			_mm_storeu_ps(&rotations[i].x, _mm_div_ps(rotation, _mm_sqrt_ps(lengthSquared)));
+		}
+		else
+		{
+			rotations[i] = Quaternion::IDENTITY;
+		}
+	}
+#else
+	for (Quaternion& rotation : rotations)
+	{
+		float length = sqrtf(rotation.x * rotation.x + rotation.y * rotation.y + rotation.z * rotation.z + rotation.w * rotation.w);
+		if (length > 0.0f)
+		{
+			rotation = Quaternion(rotation.x / length, rotation.y / length, rotation.z / length, rotation.w / length);
+		}
+		else
+		{
+			rotation = Quaternion::IDENTITY;
+		}
+	}
+#endif
+}
+
+// a * bBb̉]̌ả]
+static Quaternion multiply(const Quaternion& a, const Quaternion& b)
+{
+	return Quaternion(
+		a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+		a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+		a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+		a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z
+	);
+}
+
+// PʃNH[^jIrotationւ̍ŒZoH̐K`
+static Quaternion scaleRotation(const Quaternion& rotation, float weight)
+{
+	float sign = (rotation.w < 0.0f) ? -1.0f : 1.0f;
+	Quaternion ret(rotation.x * sign * weight, rotation.y * sign * weight, rotation.z * sign * weight, 1.0f - weight + rotation.w * sign * weight);
+	float length = sqrtf(ret.x * ret.x + ret.y * ret.y + ret.z * ret.z + ret.w * ret.w);
+	return (length > 0.0f) ? Quaternion(ret.x / length, ret.y / length, ret.z / length, ret.w / length) : Quaternion::IDENTITY;
+}
+
+AnimationBlender::AnimationBlender() : _skeleton(nullptr)
+{
+}
+
+void AnimationBlender::initWithSkeleton(const Skeleton* skeleton)
+{
+	_skeleton = skeleton;
+	_layers.clear();
+
+	size_t numJoints = skeleton->getNumJoints();
+	_sampledTranslations.resize(numJoints);
+	_sampledRotations.resize(numJoints);
+	_sampledScales.resize(numJoints);
+	_blendedTranslations.resize(numJoints);
+	_blendedRotations.resize(numJoints);
+	_blendedScales.resize(numJoints);
+	_isJointAnimated.resize(numJoints);
+}
+
+AnimationBlender::Layer AnimationBlender::createLayer(const AnimationClip* clip, float weight, bool loop, BlendMode mode)
+{
+	Logger::logAssert(clip != nullptr, "Nbvnullptr");
+	Logger::logAssert(clip->getNumBones() == _skeleton->getNumJoints(), "Nbṽ{[XPg̃WCgƈvȂ");
+
+	Layer layer;
+	layer.clip = clip;
+	layer.mode = mode;
+	layer.loop = loop;
+	layer.time = 0.0f;
+	layer.weight = weight;
+	layer.targetWeight = weight;
+	layer.fadeSpeed = 0.0f;
+	clip->resetCursor(layer.cursor);
+
+	if (mode == BlendMode::ADDITIVE)
+	{
+		sampleLayer(layer, 0.0f, UINT_MAX);
+		layer.referenceTranslations = _sampledTranslations;
+		layer.referenceRotations = _sampledRotations;
+		layer.referenceScales = _sampledScales;
+	}
+
+	return layer;
+}
+
+void AnimationBlender::play(const AnimationClip* clip, bool loop)
+{
+	_layers.clear();
+	_layers.push_back(createLayer(clip, 1.0f, loop, BlendMode::NORMAL));
+}
+
+void AnimationBlender::crossFade(const AnimationClip* clip, float duration, bool loop)
+{
+	if (duration <= 0.0f)
+	{
+		_layers.erase(std::remove_if(_layers.begin(), _layers.end(), [](const Layer& layer) { return layer.mode == BlendMode::NORMAL; }), _layers.end());
+		_layers.push_back(createLayer(clip, 1.0f, loop, BlendMode::NORMAL));
+		return;
+	}
+
+	for (Layer& layer : _layers)
+	{
+		if (layer.mode == BlendMode::NORMAL)
+		{
+			// ̏d݂durationb0ɂȂ鑬ɂ
+			layer.targetWeight = 0.0f;
+			layer.fadeSpeed = layer.weight / duration;
+		}
+	}
+
+	Layer layer = createLayer(clip, 0.0f, loop, BlendMode::NORMAL);
+	layer.targetWeight = 1.0f;
+	layer.fadeSpeed = 1.0f / duration;
+	_layers.push_back(layer);
+}
+
+void AnimationBlender::addLayer(const AnimationClip* clip, float weight, bool loop, BlendMode mode)
+{
+	_layers.push_back(createLayer(clip, weight, loop, mode));
+}
+
+void AnimationBlender::setLayerWeight(const AnimationClip* clip, float weight)
+{
+	for (Layer& layer : _layers)
+	{
+		if (layer.clip == clip)
+		{
+			layer.weight = weight;
+			layer.targetWeight = weight;
+			layer.fadeSpeed = 0.0f;
+		}
+	}
+}
+
+void AnimationBlender::stop()
+{
+	_layers.clear();
+}
+
+void AnimationBlender::advance(float dt)
+{
+	bool hasFinishedLayer = false;
+
+	for (Layer& layer : _layers)
+	{
+		layer.time += dt;
+		if (layer.loop && layer.time > layer.clip->getTotalTime())
+		{
+			layer.time = 0.0f;
+		}
+
+		if (layer.fadeSpeed > 0.0f)
+		{
+			float step = layer.fadeSpeed * dt;
+			if (fabsf(layer.targetWeight - layer.weight) <= step)
+			{
+				layer.weight = layer.targetWeight;
+				layer.fadeSpeed = 0.0f;
+				hasFinishedLayer = hasFinishedLayer || (layer.targetWeight <= 0.0f);
+			}
+			else
+			{
+				layer.weight += (layer.targetWeight > layer.weight) ? step : -step;
+			}
+		}
+	}
+
+	if (hasFinishedLayer)
+	{
+		// tF[hAEgIC[OBŏd0ŒǉC[̓tF[hĂȂ̂Ŏc
+		_layers.erase(std::remove_if(_layers.begin(), _layers.end(), [](const Layer& layer) { return layer.weight <= 0.0f && layer.targetWeight <= 0.0f && layer.fadeSpeed == 0.0f && layer.mode == BlendMode::NORMAL; }), _layers.end());
+	}
+}
+
+float AnimationBlender::getAnimationParameter(const Layer& layer, float time) const
+{
+	float totalTime = layer.clip->getTotalTime();
+	if (totalTime <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	if (layer.loop)
+	{
+		time = fmodf(time, totalTime);
+	}
+
+	return std::min(time / totalTime, 1.0f);
+}
+
+void AnimationBlender::sampleLayer(Layer& layer, float t, unsigned int maxJointDepth)
+{
+	const std::vector<Vec3>& bindTranslations = _skeleton->getBindTranslations();
+	const std::vector<Quaternion>& bindRotations = _skeleton->getBindRotations();
+	const std::vector<Vec3>& bindScales = _skeleton->getBindScales();
+
+	size_t numJoints = _skeleton->getNumJoints();
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		if (layer.clip->hasTrack(i) && _skeleton->getJointDepth(i) <= maxJointDepth)
+		{
+			layer.clip->evaluate(i, t, layer.cursor, _sampledTranslations[i], _sampledRotations[i], _sampledScales[i]);
+			_isJointAnimated[i] = 1;
+		}
+		else
+		{
+			_sampledTranslations[i] = bindTranslations[i];
+			_sampledRotations[i] = bindRotations[i];
+			_sampledScales[i] = bindScales[i];
+		}
+	}
+}
+
+void AnimationBlender::evaluate(float lookAheadTime, unsigned int maxJointDepth, Mat4* outLocalPoses)
+{
+	Logger::logAssert(_skeleton != nullptr, "initWithSkeletonĂ΂ĂȂ");
+
+	size_t numJoints = _skeleton->getNumJoints();
+
+	// 1̃Nbv̂܂܍ĐĂƂ́AuhʂɃL[t[璼ڍsɂ
+	if (_layers.size() == 1 && _layers[0].mode == BlendMode::NORMAL && _layers[0].weight >= 1.0f)
+	{
+		Layer& layer = _layers[0];
+		float t = getAnimationParameter(layer, layer.time + lookAheadTime);
+		for (size_t i = 0; i < numJoints; ++i)
+		{
+			if (layer.clip->hasTrack(i) && _skeleton->getJointDepth(i) <= maxJointDepth)
+			{
+				Vec3 translation;
+				Quaternion rotation;
+				Vec3 scale;
+				layer.clip->evaluate(i, t, layer.cursor, translation, rotation, scale);
+				outLocalPoses[i] = Mat4::createTransform(translation, rotation, scale);
+			}
+			else
+			{
+				outLocalPoses[i] = _skeleton->getBindLocalTransform(i);
+			}
+		}
+		return;
+	}
+
+	std::fill(_isJointAnimated.begin(), _isJointAnimated.end(), static_cast<unsigned char>(0));
+
+	//
+	// ʏ̃C[d݂̍vŐKĉdς
+	//
+	float totalWeight = 0.0f;
+	for (const Layer& layer : _layers)
+	{
+		if (layer.mode == BlendMode::NORMAL && layer.weight > 0.0f)
+		{
+			totalWeight += layer.weight;
+		}
+	}
+
+	if (totalWeight > 0.0f)
+	{
+		std::fill(_blendedTranslations.begin(), _blendedTranslations.end(), Vec3(0.0f, 0.0f, 0.0f));
+		std::fill(_blendedRotations.begin(), _blendedRotations.end(), Quaternion(0.0f, 0.0f, 0.0f, 0.0f));
+		std::fill(_blendedScales.begin(), _blendedScales.end(), Vec3(0.0f, 0.0f, 0.0f));
+
+		for (Layer& layer : _layers)
+		{
+			if (layer.mode != BlendMode::NORMAL || layer.weight <= 0.0f)
+			{
+				continue;
+			}
+
+			sampleLayer(layer, getAnimationParameter(layer, layer.time + lookAheadTime), maxJointDepth);
+
+			float weight = layer.weight / totalWeight;
+			accumulateVec3(_sampledTranslations, weight, _blendedTranslations);
+			accumulateQuaternion(_sampledRotations, weight, _blendedRotations);
+			accumulateVec3(_sampledScales, weight, _blendedScales);
+		}
+
+		normalizeQuaternions(_blendedRotations);
+	}
+	else
+	{
+		_blendedTranslations = _skeleton->getBindTranslations();
+		_blendedRotations = _skeleton->getBindRotations();
+		_blendedScales = _skeleton->getBindScales();
+	}
+
+	//
+	// ZC[̓Nbv̐擪̎p̍d݂̕
+	//
+	for (Layer& layer : _layers)
+	{
+		if (layer.mode != BlendMode::ADDITIVE || layer.weight <= 0.0f)
+		{
+			continue;
+		}
+
+		sampleLayer(layer, getAnimationParameter(layer, layer.time + lookAheadTime), maxJointDepth);
+
+		accumulateVec3(_sampledTranslations, layer.weight, _blendedTranslations);
+		accumulateVec3(layer.referenceTranslations, -layer.weight, _blendedTranslations);
+
+		for (size_t i = 0; i < numJoints; ++i)
+		{
+			const Quaternion& reference = layer.referenceRotations[i];
+			Quaternion difference = multiply(Quaternion(-reference.x, -reference.y, -reference.z, reference.w), _sampledRotations[i]);
+			_blendedRotations[i] = multiply(_blendedRotations[i], scaleRotation(difference, layer.weight));
+
+			const Vec3& referenceScale = layer.referenceScales[i];
+			const Vec3& scale = _sampledScales[i];
+			_blendedScales[i] = Vec3(
+				_blendedScales[i].x * (1.0f + layer.weight * ((referenceScale.x != 0.0f) ? scale.x / referenceScale.x - 1.0f : 0.0f)),
+				_blendedScales[i].y * (1.0f + layer.weight * ((referenceScale.y != 0.0f) ? scale.y / referenceScale.y - 1.0f : 0.0f)),
+				_blendedScales[i].z * (1.0f + layer.weight * ((referenceScale.z != 0.0f) ? scale.z / referenceScale.z - 1.0f : 0.0f))
+			);
+		}
+	}
+
+	//
+	// uhpŌ1񂾂sɂ
+	//
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		outLocalPoses[i] = _isJointAnimated[i] ? Mat4::createTransform(_blendedTranslations[i], _blendedRotations[i], _blendedScales[i]) : _skeleton->getBindLocalTransform(i);
+	}
+}
+
+} // namespace mgrrenderer
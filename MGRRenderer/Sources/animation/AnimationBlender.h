@@ -0,0 +1,81 @@
+#pragma once
+#include "Config.h"
+#include "renderer/BasicDataTypes.h"
+#include "AnimationClip.h"
+#include <vector>
+
+namespace mgrrenderer
+{
+class Skeleton;
+
+// AnimationClipC[ƂďdˁA1̃[JpɃuh
+// ʏ̃C[͏d݂ŉdςAZC[̓Nbv̐擪̎p̍d݂ɉďɑ
+// p͕sړA]AXP[ʁX̔zɎAC[ƂɑSWCg܂Ƃ߂ăuh
+// }gbNXpbgւ̕ϊ̓uhʂɑ΂čŌ1񂾂ŝŁANbv𑝂₵Ă̂̓L[t[̕]ƃuh̕
+class AnimationBlender final
+{
+public:
+	enum class BlendMode : int
+	{
+		NORMAL,
+		ADDITIVE,
+	};
+
+	AnimationBlender();
+	// XPg̃WCg̍Ɨ̈mۂBXPg͂̃CX^X蒷Ă邱
+	void initWithSkeleton(const Skeleton* skeleton);
+
+	// SẴC[OAclipĐ
+	void play(const AnimationClip* clip, bool loop);
+	// ʏ̃C[durationbătF[hAEgAcliptF[hCBZC[͂̂܂܎c
+	void crossFade(const AnimationClip* clip, float duration, bool loop);
+	void addLayer(const AnimationClip* clip, float weight, bool loop, BlendMode mode);
+	// clipĐĂ郌C[̏d݂ςBtF[hȂtF[h͎~߂
+	void setLayerWeight(const AnimationClip* clip, float weight);
+	void stop();
+	bool isPlaying() const { return !_layers.empty(); }
+	// eC[̎ƃtF[h̏d݂i߂BtF[hAEgIC[͊O
+	void advance(float dt);
+	// eC[̎lookAheadTimebi߂̎p߁AWCgԍ̃[Jp̍soutLocalPosesɓ
+	// maxJointDepth[WCg̓oCh|[Ŷ܂܂ɂ
+	void evaluate(float lookAheadTime, unsigned int maxJointDepth, Mat4* outLocalPoses);
+
+private:
+	struct Layer
+	{
+		const AnimationClip* clip;
+		AnimationClip::Cursor cursor;
+		BlendMode mode;
+		bool loop;
+		float time;
+		float weight;
+		float targetWeight;
+		// 1b̏d݂̕ωʁBtF[hĂȂƂ0
+		float fadeSpeed;
+		// ZC[̍̊ɂNbv̐擪̎p
+		std::vector<Vec3> referenceTranslations;
+		std::vector<Quaternion> referenceRotations;
+		std::vector<Vec3> referenceScales;
+	};
+
+	const Skeleton* _skeleton;
+	std::vector<Layer> _layers;
+
+	// 1C[̎pƁAuh̎p
+	std::vector<Vec3> _sampledTranslations;
+	std::vector<Quaternion> _sampledRotations;
+	std::vector<Vec3> _sampledScales;
+	std::vector<Vec3> _blendedTranslations;
+	std::vector<Quaternion> _blendedRotations;
+	std::vector<Vec3> _blendedScales;
+	// ǂꂩ̃C[ŃAj[VWCgBĂȂWCg̓oCh|[Y̍ŝ܂܎g
+	std::vector<unsigned char> _isJointAnimated;
+
+	// ZC[͊̎p߂̂ɍƗ̈ĝconstɂȂ
+	Layer createLayer(const AnimationClip* clip, float weight, bool loop, BlendMode mode);
+	float getAnimationParameter(const Layer& layer, float time) const;
+	// 1C[̎p_sampled`ɋ߂BgbN̂ȂWCg̓oCh|[Yɂ
+	void sampleLayer(Layer& layer, float t, unsigned int maxJointDepth);
+};
+
+} // namespace mgrrenderer
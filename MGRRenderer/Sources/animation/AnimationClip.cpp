@@ -0,0 +1,626 @@
+#include "AnimationClip.h"
+#include "loader/BinaryReader.h"
+#include "loader/BinaryWriter.h"
+#include "utility/Logger.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define MGRRENDERER_ANIMATION_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace mgrrenderer
+{
+
+// 1/sqrt(2)BNH[^jI̐ΒlőłȂ͈͂̔͂ɓ
+static const float SMALLEST_THREE_RANGE = 0.70710678f;
+static const float QUATERNION_COMPONENT_MAX = 32767.0f; // 15bit
+static const float VEC3_COMPONENT_MAX = 65535.0f; // 16bit
+
+// times[key]times[key + 1]̊ԂɓkeyTBkeyɂ͑Ǒʂn
+// times2ȏ゠Atime͐擪Ɩ̎̊Ԃɂ邱
+static unsigned int findKey(const std::vector<float>& times, float time, unsigned int key)
+{
+	unsigned int lastKey = static_cast<unsigned int>(times.size()) - 2;
+
+	if (key > lastKey || time < times[key])
+	{
+		// [vʂ̃Aj[V̊JnŎ߂Ƃ͓񕪒T
+		key = static_cast<unsigned int>(std::upper_bound(times.begin(), times.end(), time) - times.begin()) - 1;
+		return std::min(key, lastKey);
+	}
+
+	while (key < lastKey && times[key + 1] < time)
+	{
+		++key;
+	}
+
+	return key;
+}
+
+// gbN̂ǂ2̃L[t[ǂ̊ŕԂ邩߂BL[t[1͈͊OȂ瓯L[t[2Ԃ
+static void findInterpolationKeys(const std::vector<float>& times, float time, unsigned int& key, unsigned int& outFrom, unsigned int& outTo, float& outT)
+{
+	outT = 0.0f;
+
+	if (times.size() == 1 || time <= times.front())
+	{
+		key = 0;
+		outFrom = outTo = 0;
+		return;
+	}
+	else if (time >= times.back())
+	{
+		key = static_cast<unsigned int>(times.size()) - 2;
+		outFrom = outTo = static_cast<unsigned int>(times.size()) - 1;
+		return;
+	}
+
+	key = findKey(times, time, key);
+	outFrom = key;
+	outTo = key + 1;
+
+	// ⊮p[^
+	float duration = times[key + 1] - times[key];
+	outT = (duration > 0.0f) ? (time - times[key]) / duration : 0.0f;
+}
+
+//
+// 
+//
+static Vec3 lerp(const Vec3& from, const Vec3& to, float t)
+{
+	return from + (to - from) * t;
+}
+
+// ŒZoHƂ鐳K`ԁBL[t[̊ԊuZAj[VłslerpƂ̍͌덷͈̔͂Ɏ܂
+static Quaternion nlerp(const Quaternion& from, const Quaternion& to, float t)
+{
+	float dot = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w;
+	float toSign = (dot < 0.0f) ? -1.0f : 1.0f;
+	float fromRatio = 1.0f - t;
+	float toRatio = t * toSign;
+
+	Quaternion ret(
+		from.x * fromRatio + to.x * toRatio,
+		from.y * fromRatio + to.y * toRatio,
+		from.z * fromRatio + to.z * toRatio,
+		from.w * fromRatio + to.w * toRatio
+	);
+
+	float length = sqrtf(ret.x * ret.x + ret.y * ret.y + ret.z * ret.z + ret.w * ret.w);
+	if (length > 0.0f)
+	{
+		float inverseLength = 1.0f / length;
+		ret.x *= inverseLength;
+		ret.y *= inverseLength;
+		ret.z *= inverseLength;
+		ret.w *= inverseLength;
+	}
+	return ret;
+}
+
+//
+// 덷
+//
+static float distance(const Vec3& a, const Vec3& b)
+{
+	Vec3 diff = a - b;
+	return sqrtf(diff.x * diff.x + diff.y * diff.y + diff.z * diff.z);
+}
+
+// 2̉]̊Ԃ̊pxBq  -q ͓]Ȃ̂œςɂȂŔׂ
+// pxłacos()̐xȂ̂ŁA̒d4asin(d/2)ŋ߂
+static float angleBetween(const Quaternion& a, const Quaternion& b)
+{
+	float lengthA = sqrtf(a.x * a.x + a.y * a.y + a.z * a.z + a.w * a.w);
+	float lengthB = sqrtf(b.x * b.x + b.y * b.y + b.z * b.z + b.w * b.w);
+	if (lengthA <= 0.0f || lengthB <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	float dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+	float scaleA = 1.0f / lengthA;
+	float scaleB = ((dot < 0.0f) ? -1.0f : 1.0f) / lengthB;
+	float dx = a.x * scaleA - b.x * scaleB;
+	float dy = a.y * scaleA - b.y * scaleB;
+	float dz = a.z * scaleA - b.z * scaleB;
+	float dw = a.w * scaleA - b.w * scaleB;
+	float halfDistance = 0.5f * sqrtf(dx * dx + dy * dy + dz * dz + dw * dw);
+	return 4.0f * asinf(std::min(halfDistance, 1.0f));
+}
+
+//
+// ʎq
+//
+static unsigned short quantize(float value, float minimum, float step, float maximum)
+{
+	if (step <= 0.0f)
+	{
+		return 0;
+	}
+
+	float quantized = floorf((value - minimum) / step + 0.5f);
+	return static_cast<unsigned short>(std::max(0.0f, std::min(quantized, maximum)));
+}
+
+static void encodeVec3(const Vec3& value, const Vec3& minimum, const Vec3& step, unsigned short* outValues)
+{
+	outValues[0] = quantize(value.x, minimum.x, step.x, VEC3_COMPONENT_MAX);
+	outValues[1] = quantize(value.y, minimum.y, step.y, VEC3_COMPONENT_MAX);
+	outValues[2] = quantize(value.z, minimum.z, step.z, VEC3_COMPONENT_MAX);
+}
+
+static Vec3 decodeVec3(const AnimationClip::Vec3Track& track, unsigned int key)
+{
+	const unsigned short* values = &track.values[key * 3];
+	return Vec3(
+		track.minimum.x + values[0] * track.step.x,
+		track.minimum.y + values[1] * track.step.y,
+		track.minimum.z + values[2] * track.step.z
+	);
+}
+
+// smallest threeBΒlő̐𐳂ɂ낦ďȂA̔ԍ2rbgɓ
+static void encodeQuaternion(const Quaternion& rotation, unsigned short* outValues)
+{
+	float components[4] = {rotation.x, rotation.y, rotation.z, rotation.w};
+
+	float length = sqrtf(components[0] * components[0] + components[1] * components[1] + components[2] * components[2] + components[3] * components[3]);
+	if (length <= 0.0f)
+	{
+		components[0] = components[1] = components[2] = 0.0f;
+		components[3] = length = 1.0f;
+	}
+
+	unsigned int largestIndex = 0;
+	for (unsigned int i = 1; i < 4; ++i)
+	{
+		if (fabsf(components[i]) > fabsf(components[largestIndex]))
+		{
+			largestIndex = i;
+		}
+	}
+
+	float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+	float scale = sign / length;
+	float step = 2.0f * SMALLEST_THREE_RANGE / QUATERNION_COMPONENT_MAX;
+
+	unsigned int outIndex = 0;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		if (i != largestIndex)
+		{
+			outValues[outIndex] = quantize(components[i] * scale, -SMALLEST_THREE_RANGE, step, QUATERNION_COMPONENT_MAX);
+			++outIndex;
+		}
+	}
+
+	outValues[0] |= static_cast<unsigned short>((largestIndex >> 1) << 15);
+	outValues[1] |= static_cast<unsigned short>((largestIndex & 1) << 15);
+}
+
+static Quaternion decodeQuaternion(const AnimationClip::QuaternionTrack& track, unsigned int key)
+{
+	const unsigned short* values = &track.values[key * 3];
+	unsigned int largestIndex = ((values[0] >> 15) << 1) | (values[1] >> 15);
+	float step = 2.0f * SMALLEST_THREE_RANGE / QUATERNION_COMPONENT_MAX;
+
+	float smallest[3] = {
+		(values[0] & 0x7fff) * step - SMALLEST_THREE_RANGE,
+		(values[1] & 0x7fff) * step - SMALLEST_THREE_RANGE,
+		(values[2] & 0x7fff) * step - SMALLEST_THREE_RANGE,
+	};
+
+	float components[4];
+	unsigned int smallestIndex = 0;
+	for (unsigned int i = 0; i < 4; ++i)
+	{
+		if (i != largestIndex)
+		{
+			components[i] = smallest[smallestIndex];
+			++smallestIndex;
+		}
+	}
+	components[largestIndex] = sqrtf(std::max(0.0f, 1.0f - smallest[0] * smallest[0] - smallest[1] * smallest[1] - smallest[2] * smallest[2]));
+
+	return Quaternion(components[0], components[1], components[2], components[3]);
+}
+
+//
+// L[t[폜
+//
+// 擪Ɩ̃L[t[͕KcAԂ̃L[t[͎cL[t[m̕Ԃŋe덷ɍČł폜
+// SẴL[t[擪ƓƂ݂ȂgbN̓L[t[1ɂ
+// Ԃɂ͗ʎqĖ߂lgA̒lƔׂ̂ŁA폜L[t[̎ł͗ʎq̌덷܂߂ċe덷Ɏ܂
+// cL[t[̌덷͗ʎq̌덷̂̂ŁAe덷Ƃׂ͔ĂȂ
+template<typename T, typename Interpolate, typename Error>
+static std::vector<size_t> reduceKeys(const std::vector<float>& times, const std::vector<T>& values, const std::vector<T>& quantizedValues, float tolerance, Interpolate interpolate, Error error)
+{
+	std::vector<size_t> ret;
+	size_t numKeys = times.size();
+	if (numKeys == 0)
+	{
+		return ret;
+	}
+
+	bool isConstant = true;
+	for (size_t i = 1; i < numKeys; ++i)
+	{
+		if (error(quantizedValues[0], values[i]) > tolerance)
+		{
+			isConstant = false;
+			break;
+		}
+	}
+
+	ret.push_back(0);
+	if (isConstant)
+	{
+		return ret;
+	}
+
+	size_t anchor = 0;
+	for (size_t candidate = anchor + 2; candidate < numKeys; ++candidate)
+	{
+		// anchorcandidate܂ł̕ԂŁAԂ̃L[t[SčČł邩
+		bool canSkip = true;
+		float duration = times[candidate] - times[anchor];
+		for (size_t i = anchor + 1; i < candidate; ++i)
+		{
+			float t = (duration > 0.0f) ? (times[i] - times[anchor]) / duration : 0.0f;
+			if (error(interpolate(quantizedValues[anchor], quantizedValues[candidate], t), values[i]) > tolerance)
+			{
+				canSkip = false;
+				break;
+			}
+		}
+
+		if (!canSkip)
+		{
+			anchor = candidate - 1;
+			ret.push_back(anchor);
+		}
+	}
+
+	ret.push_back(numKeys - 1);
+	return ret;
+}
+
+static void compressVec3Track(const std::vector<C3bLoader::AnimationData::Vec3KeyFrame>& keyFrames, float tolerance, AnimationClip::Vec3Track& outTrack)
+{
+	std::vector<float> times;
+	std::vector<Vec3> values;
+	times.reserve(keyFrames.size());
+	values.reserve(keyFrames.size());
+	for (const C3bLoader::AnimationData::Vec3KeyFrame& keyFrame : keyFrames)
+	{
+		times.push_back(keyFrame.time);
+		values.push_back(keyFrame.value);
+	}
+
+	// gbN̒l͈̔͂16bitɊ蓖ĂBʎq̌덷͊estep̔܂
+	Vec3 minimum = values.empty() ? Vec3(0.0f, 0.0f, 0.0f) : values.front();
+	Vec3 maximum = minimum;
+	for (const Vec3& value : values)
+	{
+		minimum = Vec3(std::min(minimum.x, value.x), std::min(minimum.y, value.y), std::min(minimum.z, value.z));
+		maximum = Vec3(std::max(maximum.x, value.x), std::max(maximum.y, value.y), std::max(maximum.z, value.z));
+	}
+
+	outTrack.minimum = minimum;
+	outTrack.step = (maximum - minimum) * (1.0f / VEC3_COMPONENT_MAX);
+
+	// SL[t[ʎqĂAL[t[폜ł͎ĉl߂
+	outTrack.values.resize(values.size() * 3);
+	std::vector<Vec3> quantizedValues;
+	quantizedValues.reserve(values.size());
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		encodeVec3(values[i], outTrack.minimum, outTrack.step, &outTrack.values[i * 3]);
+		quantizedValues.push_back(decodeVec3(outTrack, static_cast<unsigned int>(i)));
+	}
+
+	std::vector<size_t> keptKeys = reduceKeys(times, values, quantizedValues, tolerance, lerp, distance);
+
+	outTrack.times.reserve(keptKeys.size());
+	for (size_t i = 0; i < keptKeys.size(); ++i)
+	{
+		outTrack.times.push_back(times[keptKeys[i]]);
+		for (size_t component = 0; component < 3; ++component)
+		{
+			outTrack.values[i * 3 + component] = outTrack.values[keptKeys[i] * 3 + component];
+		}
+	}
+	outTrack.values.resize(keptKeys.size() * 3);
+}
+
+static void compressQuaternionTrack(const std::vector<C3bLoader::AnimationData::QuaternionKeyFrame>& keyFrames, float tolerance, AnimationClip::QuaternionTrack& outTrack)
+{
+	std::vector<float> times;
+	std::vector<Quaternion> values;
+	times.reserve(keyFrames.size());
+	values.reserve(keyFrames.size());
+	for (const C3bLoader::AnimationData::QuaternionKeyFrame& keyFrame : keyFrames)
+	{
+		times.push_back(keyFrame.time);
+		values.push_back(keyFrame.value);
+	}
+
+	outTrack.values.resize(values.size() * 3);
+	std::vector<Quaternion> quantizedValues;
+	quantizedValues.reserve(values.size());
+	for (size_t i = 0; i < values.size(); ++i)
+	{
+		encodeQuaternion(values[i], &outTrack.values[i * 3]);
+		quantizedValues.push_back(decodeQuaternion(outTrack, static_cast<unsigned int>(i)));
+	}
+
+	std::vector<size_t> keptKeys = reduceKeys(times, values, quantizedValues, tolerance, nlerp, angleBetween);
+
+	outTrack.times.reserve(keptKeys.size());
+	for (size_t i = 0; i < keptKeys.size(); ++i)
+	{
+		outTrack.times.push_back(times[keptKeys[i]]);
+		for (size_t component = 0; component < 3; ++component)
+		{
+			outTrack.values[i * 3 + component] = outTrack.values[keptKeys[i] * 3 + component];
+		}
+	}
+	outTrack.values.resize(keptKeys.size() * 3);
+}
+
+//
+// WJ
+//
+static Vec3 sampleVec3Track(const AnimationClip::Vec3Track& track, float time, unsigned int& key, const Vec3& defaultValue)
+{
+	if (track.times.empty())
+	{
+		return defaultValue;
+	}
+
+	unsigned int from, to;
+	float t;
+	findInterpolationKeys(track.times, time, key, from, to, t);
+
+#if defined(MGRRENDERER_ANIMATION_USE_SSE)
+	// 2̃L[t[̓WJƕԂ4܂Ƃ߂čs
+	const unsigned short* fromValues = &track.values[from * 3];
+	const unsigned short* toValues = &track.values[to * 3];
+	__m128 minimum = _mm_setr_ps(track.minimum.x, track.minimum.y, track.minimum.z, 0.0f);
+	__m128 step = _mm_setr_ps(track.step.x, track.step.y, track.step.z, 0.0f);
+	__m128 fromVector = _mm_add_ps(minimum, _mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(fromValues[0], fromValues[1], fromValues[2], 0)), step));
+	__m128 toVector = _mm_add_ps(minimum, _mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(toValues[0], toValues[1], toValues[2], 0)), step));
+	__m128 result = _mm_add_ps(fromVector, _mm_mul_ps(_mm_sub_ps(toVector, fromVector), _mm_set1_ps(t)));
+
+	float components[4];
+	_mm_storeu_ps(components, result);
+	return Vec3(components[0], components[1], components[2]);
+#else
+	return lerp(decodeVec3(track, from), decodeVec3(track, to), t);
+#endif
+}
+
+static Quaternion sampleQuaternionTrack(const AnimationClip::QuaternionTrack& track, float time, unsigned int& key)
+{
+	if (track.times.empty())
+	{
+		return Quaternion::IDENTITY;
+	}
+
+	unsigned int from, to;
+	float t;
+	findInterpolationKeys(track.times, time, key, from, to, t);
+
+	Quaternion fromRotation = decodeQuaternion(track, from);
+	if (from == to)
+	{
+		return fromRotation;
+	}
+
+	Quaternion toRotation = decodeQuaternion(track, to);
+
+#if defined(MGRRENDERER_ANIMATION_USE_SSE)
+	__m128 fromVector = _mm_setr_ps(fromRotation.x, fromRotation.y, fromRotation.z, fromRotation.w);
+	__m128 toVector = _mm_setr_ps(toRotation.x, toRotation.y, toRotation.z, toRotation.w);
+
+	// ςSvfɍsn点AȂŒZoHɂȂ悤to̕𔽓]
+	__m128 dot = _mm_mul_ps(fromVector, toVector);
+	dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+	dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 signMask = _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), _mm_set1_ps(-0.0f));
+	toVector = _mm_xor_ps(toVector, signMask);
+
+	__m128 result = _mm_add_ps(fromVector, _mm_mul_ps(_mm_sub_ps(toVector, fromVector), _mm_set1_ps(t)));
+
+	__m128 lengthSquared = _mm_mul_ps(result, result);
+	lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(2, 3, 0, 1)));
+	lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(1, 0, 3, 2)));
+	result = _mm_div_ps(result, _mm_sqrt_ps(lengthSquared));
+
+	float components[4];
+	_mm_storeu_ps(components, result);
+	return Quaternion(components[0], components[1], components[2], components[3]);
+#else
+	return nlerp(fromRotation, toRotation, t);
+#endif
+}
+
+// cookedt@C̃gbŃAL[t[A̔zAʎql̔z̏ɕׂ
+static void writeTrackKeys(BinaryWriter& writer, const std::vector<float>& times, const std::vector<unsigned short>& values)
+{
+	unsigned int numKeys = static_cast<unsigned int>(times.size());
+	writer.write(&numKeys, 4, 1);
+	writer.write(times.data(), sizeof(float), times.size());
+	writer.write(values.data(), sizeof(unsigned short), values.size());
+}
+
+static bool readTrackKeys(BinaryReader& reader, std::vector<float>& outTimes, std::vector<unsigned short>& outValues)
+{
+	unsigned int numKeys = 0;
+	if (reader.read(&numKeys, 4, 1) != 1)
+	{
+		return false;
+	}
+
+	// ꂽt@ČŋȊmۂȂ悤Ac̃f[^Ɏ܂Ɋm߂
+	static const size_t KEY_BYTE_SIZE = sizeof(float) + sizeof(unsigned short) * 3;
+	if (numKeys > reader.getRemainingLength() / KEY_BYTE_SIZE)
+	{
+		return false;
+	}
+
+	outTimes.resize(numKeys);
+	outValues.resize(static_cast<size_t>(numKeys) * 3);
+	return reader.read(outTimes.data(), sizeof(float), outTimes.size()) == outTimes.size()
+		&& reader.read(outValues.data(), sizeof(unsigned short), outValues.size()) == outValues.size();
+}
+
+static void writeVec3Track(BinaryWriter& writer, const AnimationClip::Vec3Track& track)
+{
+	writeTrackKeys(writer, track.times, track.values);
+	writer.write(&track.minimum, sizeof(float), 3);
+	writer.write(&track.step, sizeof(float), 3);
+}
+
+static bool readVec3Track(BinaryReader& reader, AnimationClip::Vec3Track& outTrack)
+{
+	return readTrackKeys(reader, outTrack.times, outTrack.values)
+		&& reader.read(&outTrack.minimum, sizeof(float), 3) == 3
+		&& reader.read(&outTrack.step, sizeof(float), 3) == 3;
+}
+
+AnimationClip::AnimationClip() : _totalTime(0.0f)
+{
+}
+
+bool AnimationClip::initWithAnimationData(const C3bLoader::AnimationData& animationData, const std::vector<std::string>& boneNames, const CompressionSettings& settings)
+{
+	_totalTime = animationData.totalTime;
+	_compressionStats = CompressionStats();
+
+	size_t numBones = boneNames.size();
+	_translationTracks.assign(numBones, Vec3Track());
+	_rotationTracks.assign(numBones, QuaternionTrack());
+	_scaleTracks.assign(numBones, Vec3Track());
+
+	for (size_t i = 0; i < numBones; ++i)
+	{
+		unsigned int key = 0;
+
+		auto translationIt = animationData.translationKeyFrames.find(boneNames[i]);
+		if (translationIt != animationData.translationKeyFrames.end())
+		{
+			compressVec3Track(translationIt->second, settings.translationTolerance, _translationTracks[i]);
+
+			_compressionStats.numSourceKeys += translationIt->second.size();
+			_compressionStats.numKeys += _translationTracks[i].times.size();
+			_compressionStats.sourceByteSize += translationIt->second.size() * (sizeof(float) + sizeof(Vec3));
+			_compressionStats.byteSize += _translationTracks[i].times.size() * (sizeof(float) + sizeof(unsigned short) * 3) + sizeof(Vec3) * 2;
+			for (const C3bLoader::AnimationData::Vec3KeyFrame& keyFrame : translationIt->second)
+			{
+				float error = distance(sampleVec3Track(_translationTracks[i], keyFrame.time, key, Vec3(0.0f, 0.0f, 0.0f)), keyFrame.value);
+				_compressionStats.maxTranslationError = std::max(_compressionStats.maxTranslationError, error);
+			}
+		}
+
+		auto rotationIt = animationData.rotationKeyFrames.find(boneNames[i]);
+		if (rotationIt != animationData.rotationKeyFrames.end())
+		{
+			compressQuaternionTrack(rotationIt->second, settings.rotationTolerance, _rotationTracks[i]);
+
+			_compressionStats.numSourceKeys += rotationIt->second.size();
+			_compressionStats.numKeys += _rotationTracks[i].times.size();
+			_compressionStats.sourceByteSize += rotationIt->second.size() * (sizeof(float) + sizeof(Quaternion));
+			_compressionStats.byteSize += _rotationTracks[i].times.size() * (sizeof(float) + sizeof(unsigned short) * 3);
+			for (const C3bLoader::AnimationData::QuaternionKeyFrame& keyFrame : rotationIt->second)
+			{
+				float error = angleBetween(sampleQuaternionTrack(_rotationTracks[i], keyFrame.time, key), keyFrame.value);
+				_compressionStats.maxRotationError = std::max(_compressionStats.maxRotationError, error);
+			}
+		}
+
+		auto scaleIt = animationData.scaleKeyFrames.find(boneNames[i]);
+		if (scaleIt != animationData.scaleKeyFrames.end())
+		{
+			compressVec3Track(scaleIt->second, settings.scaleTolerance, _scaleTracks[i]);
+
+			_compressionStats.numSourceKeys += scaleIt->second.size();
+			_compressionStats.numKeys += _scaleTracks[i].times.size();
+			_compressionStats.sourceByteSize += scaleIt->second.size() * (sizeof(float) + sizeof(Vec3));
+			_compressionStats.byteSize += _scaleTracks[i].times.size() * (sizeof(float) + sizeof(unsigned short) * 3) + sizeof(Vec3) * 2;
+			for (const C3bLoader::AnimationData::Vec3KeyFrame& keyFrame : scaleIt->second)
+			{
+				float error = distance(sampleVec3Track(_scaleTracks[i], keyFrame.time, key, Vec3(1.0f, 1.0f, 1.0f)), keyFrame.value);
+				_compressionStats.maxScaleError = std::max(_compressionStats.maxScaleError, error);
+			}
+		}
+	}
+
+	return true;
+}
+
+bool AnimationClip::initWithCookedData(BinaryReader& reader)
+{
+	_compressionStats = CompressionStats();
+
+	// {[ƂɏȂƂ3gbÑL[t[̂ŁAꂪcɎ܂ȂȂĂ
+	unsigned int numBones = 0;
+	if (reader.read(&_totalTime, sizeof(float), 1) != 1 || reader.read(&numBones, 4, 1) != 1 || numBones > reader.getRemainingLength() / (4 * 3))
+	{
+		return false;
+	}
+
+	_translationTracks.assign(numBones, Vec3Track());
+	_rotationTracks.assign(numBones, QuaternionTrack());
+	_scaleTracks.assign(numBones, Vec3Track());
+	for (size_t i = 0; i < numBones; ++i)
+	{
+		if (!readVec3Track(reader, _translationTracks[i])
+			|| !readTrackKeys(reader, _rotationTracks[i].times, _rotationTracks[i].values)
+			|| !readVec3Track(reader, _scaleTracks[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void AnimationClip::writeCookedData(BinaryWriter& writer) const
+{
+	// kς݂̃gbN̂܂܏̂ŁA[hɃL[t[폜Ɨʎq蒼ȂĂ悢
+	unsigned int numBones = static_cast<unsigned int>(getNumBones());
+	writer.write(&_totalTime, sizeof(float), 1);
+	writer.write(&numBones, 4, 1);
+	for (size_t i = 0; i < numBones; ++i)
+	{
+		writeVec3Track(writer, _translationTracks[i]);
+		writeTrackKeys(writer, _rotationTracks[i].times, _rotationTracks[i].values);
+		writeVec3Track(writer, _scaleTracks[i]);
+	}
+}
+
+void AnimationClip::resetCursor(Cursor& cursor) const
+{
+	size_t numBones = getNumBones();
+	cursor.translationKeys.assign(numBones, 0);
+	cursor.rotationKeys.assign(numBones, 0);
+	cursor.scaleKeys.assign(numBones, 0);
+}
+
+void AnimationClip::evaluate(size_t boneIndex, float time, Cursor& cursor, Vec3& outTranslation, Quaternion& outRotation, Vec3& outScale) const
+{
+	Logger::logAssert(boneIndex < getNumBones(), "{[ԍ͈͊O boneIndex=%d", static_cast<int>(boneIndex));
+	Logger::logAssert(cursor.translationKeys.size() == getNumBones(), "J[\̃Aj[VpɏĂȂ");
+
+	// L[t[̂ȂgbN͕ϊȂƂĈBc3t/c3b̃GNX|[^̓Aj[V{[3Ƃo͂
+	outTranslation = sampleVec3Track(_translationTracks[boneIndex], time, cursor.translationKeys[boneIndex], Vec3(0.0f, 0.0f, 0.0f));
+	outRotation = sampleQuaternionTrack(_rotationTracks[boneIndex], time, cursor.rotationKeys[boneIndex]);
+	outScale = sampleVec3Track(_scaleTracks[boneIndex], time, cursor.scaleKeys[boneIndex], Vec3(1.0f, 1.0f, 1.0f));
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,95 @@
+#pragma once
+#include "Config.h"
+#include "renderer/BasicDataTypes.h"
+#include "loader/C3bLoader.h"
+#include <string>
+#include <vector>
+
+namespace mgrrenderer
+{
+class BinaryReader;
+class BinaryWriter;
+
+// C3bLoader::AnimationDataA[hɃ{[ԍňzɕϊAj[V
+// t[̃{[̕rȂ߁AgbN̓XPg̃{[ԍ̏ɕׂĎ
+// ϊɕԂōČłL[t[폜Alʎqď풓炷
+class AnimationClip final
+{
+public:
+	// L[t[폜̋e덷BʎqĖ߂ÕL[t[̕Ԃƌ̒lƂ̍ȓȂ폜
+	// ۏ؂͍̂폜L[t[̎ł̌덷ŁAcL[t[̌덷͗ʎq̌덷ɂȂ
+	// sړƃXP[̗ʎq̌덷͍őstep̒̔Ȃ̂ŁAl͈̔͂LgbNł͋e덷𒴂
+	struct CompressionSettings
+	{
+		float translationTolerance; // 
+		float rotationTolerance; // WA
+		float scaleTolerance;
+
+		CompressionSettings() : translationTolerance(0.001f), rotationTolerance(0.001f), scaleTolerance(0.001f) {}
+	};
+
+	// ǩʁBő덷͌̑SL[t[̎ŁAkO̒lƈkɕ]lׂ
+	struct CompressionStats
+	{
+		size_t numSourceKeys;
+		size_t numKeys;
+		size_t sourceByteSize;
+		size_t byteSize;
+		float maxTranslationError;
+		float maxRotationError;
+		float maxScaleError;
+
+		CompressionStats() : numSourceKeys(0), numKeys(0), sourceByteSize(0), byteSize(0), maxTranslationError(0.0f), maxRotationError(0.0f), maxScaleError(0.0f) {}
+		float getCompressionRatio() const { return (byteSize > 0) ? static_cast<float>(sourceByteSize) / byteSize : 0.0f; }
+	};
+
+	// sړƃXP[̃gbNBegbNƂ̒l͈̔͂16bitɗʎq
+	// 0<=time<=1ŁAtotalTimeƏZƕbɂȂ
+	struct Vec3Track
+	{
+		std::vector<float> times;
+		std::vector<unsigned short> values; // L[t[Ƃ3
+		Vec3 minimum;
+		Vec3 step; // ʎq1P
+	};
+
+	// ]̃gbNBΒlő̐ȂAc315bitɗʎqďȂ̔ԍƍ킹48bitɂ
+	struct QuaternionTrack
+	{
+		std::vector<float> times;
+		std::vector<unsigned short> values; // L[t[Ƃ3
+	};
+
+	// e{[̊egbNőOgL[t[̔ԍBĐCX^XƂɎ
+	// Oɐiޒʏ̍ĐȂA琔邾ŃL[t[
+	struct Cursor
+	{
+		std::vector<unsigned int> translationKeys;
+		std::vector<unsigned int> rotationKeys;
+		std::vector<unsigned int> scaleKeys;
+	};
+
+	AnimationClip();
+	// boneNames̏Ԃ{[ԍɂȂBAj[Vf[^ɂȂ{[̓gbNȂɂȂ
+	bool initWithAnimationData(const C3bLoader::AnimationData& animationData, const std::vector<std::string>& boneNames, const CompressionSettings& settings = CompressionSettings());
+	// ModelAssetcookedt@Cɏkς݂̃gbNBk̓vcookɂȂ̂0̂܂܂ɂȂ
+	bool initWithCookedData(BinaryReader& reader);
+	void writeCookedData(BinaryWriter& writer) const;
+	float getTotalTime() const { return _totalTime; }
+	size_t getNumBones() const { return _translationTracks.size(); }
+	const CompressionStats& getCompressionStats() const { return _compressionStats; }
+	// sړ̃L[t[{[Aj[VBȂ{[͌̎pg
+	bool hasTrack(size_t boneIndex) const { return !_translationTracks[boneIndex].times.empty(); }
+	void resetCursor(Cursor& cursor) const;
+	// {[̃[Jp߂Bcursor͕]ɎgL[t[̔ԍɍXV
+	void evaluate(size_t boneIndex, float time, Cursor& cursor, Vec3& outTranslation, Quaternion& outRotation, Vec3& outScale) const;
+
+private:
+	float _totalTime;
+	std::vector<Vec3Track> _translationTracks;
+	std::vector<QuaternionTrack> _rotationTracks;
+	std::vector<Vec3Track> _scaleTracks;
+	CompressionStats _compressionStats;
+};
+
+} // namespace mgrrenderer
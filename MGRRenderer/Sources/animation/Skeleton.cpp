@@ -0,0 +1,244 @@
+#include "Skeleton.h"
+#include "loader/BinaryReader.h"
+#include "loader/BinaryWriter.h"
+#include "utility/Logger.h"
+#include <cmath>
+
+namespace mgrrenderer
+{
+
+// f̂Ȃϊs𕽍sړA]AXP[ɕBm[][s]Ȃ̂ŉ]srscm[c][r]
+static void decomposeTransform(const Mat4& transform, Vec3& outTranslation, Quaternion& outRotation, Vec3& outScale)
+{
+	outTranslation = Vec3(transform.m[3][0], transform.m[3][1], transform.m[3][2]);
+
+	float scales[3];
+	for (int column = 0; column < 3; ++column)
+	{
+		const float* axis = transform.m[column];
+		scales[column] = sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+	}
+	outScale = Vec3(scales[0], scales[1], scales[2]);
+
+	float rotation[3][3]; // [s][]
+	for (int column = 0; column < 3; ++column)
+	{
+		float inverseScale = (scales[column] > 0.0f) ? 1.0f / scales[column] : 0.0f;
+		for (int row = 0; row < 3; ++row)
+		{
+			rotation[row][column] = transform.m[column][row] * inverseScale;
+		}
+	}
+
+	float trace = rotation[0][0] + rotation[1][1] + rotation[2][2];
+	if (trace > 0.0f)
+	{
+		float s = 0.5f / sqrtf(trace + 1.0f);
+		outRotation = Quaternion((rotation[2][1] - rotation[1][2]) * s, (rotation[0][2] - rotation[2][0]) * s, (rotation[1][0] - rotation[0][1]) * s, 0.25f / s);
+	}
+	else if (rotation[0][0] > rotation[1][1] && rotation[0][0] > rotation[2][2])
+	{
+		float s = 2.0f * sqrtf(1.0f + rotation[0][0] - rotation[1][1] - rotation[2][2]);
+		outRotation = Quaternion(0.25f * s, (rotation[0][1] + rotation[1][0]) / s, (rotation[0][2] + rotation[2][0]) / s, (rotation[2][1] - rotation[1][2]) / s);
+	}
+	else if (rotation[1][1] > rotation[2][2])
+	{
+		float s = 2.0f * sqrtf(1.0f + rotation[1][1] - rotation[0][0] - rotation[2][2]);
+		outRotation = Quaternion((rotation[0][1] + rotation[1][0]) / s, 0.25f * s, (rotation[1][2] + rotation[2][1]) / s, (rotation[0][2] - rotation[2][0]) / s);
+	}
+	else
+	{
+		float s = 2.0f * sqrtf(1.0f + rotation[2][2] - rotation[0][0] - rotation[1][1]);
+		outRotation = Quaternion((rotation[0][2] + rotation[2][0]) / s, (rotation[1][2] + rotation[2][1]) / s, 0.25f * s, (rotation[1][0] - rotation[0][1]) / s);
+	}
+}
+
+Skeleton::Skeleton()
+{
+}
+
+bool Skeleton::initWithNodeDatas(const C3bLoader::NodeDatas& nodeDatas, const std::vector<std::string>& skinBoneNames, const std::vector<Mat4>& inverseBindPoses)
+{
+	Logger::logAssert(skinBoneNames.size() == inverseBindPoses.size(), "WCg͈v͂");
+
+	_jointNames.clear();
+	_parentIndices.clear();
+	_jointDepths.clear();
+	_bindLocalTransforms.clear();
+
+	// [DőO珇ɔԍ̂ŁAe͕KqOɕ
+	for (const C3bLoader::NodeData* root : nodeDatas.skeleton)
+	{
+		addJoint(*root, NO_PARENT, 0);
+	}
+
+	size_t numJoints = _jointNames.size();
+	computeBindPoseData();
+
+	_jointSkinBoneIndices.assign(numJoints, -1);
+	_inverseBindPoses.assign(numJoints, Mat4::IDENTITY);
+	_skinBoneJointIndices.assign(skinBoneNames.size(), 0);
+
+	for (size_t i = 0; i < skinBoneNames.size(); ++i)
+	{
+		size_t jointIndex = 0;
+		while (jointIndex < numJoints && _jointNames[jointIndex] != skinBoneNames[i])
+		{
+			++jointIndex;
+		}
+
+		if (jointIndex == numJoints)
+		{
+			Logger::logAssert(false, "nodes̕ɂ̂skeletons{[ŌȂBboneName=%s", skinBoneNames[i].c_str());
+			return false;
+		}
+
+		_skinBoneJointIndices[i] = jointIndex;
+		_jointSkinBoneIndices[jointIndex] = static_cast<int>(i);
+		_inverseBindPoses[jointIndex] = inverseBindPoses[i];
+	}
+
+	return true;
+}
+
+bool Skeleton::initWithCookedData(BinaryReader& reader)
+{
+	// WCgƂɖO̒Ae̔ԍAs񂪂̂ŁAꂪcɎ܂ȂȂĂ
+	static const size_t MIN_JOINT_BYTE_SIZE = 4 + 4 + sizeof(float) * 16;
+	unsigned int numJoints = 0;
+	if (reader.read(&numJoints, 4, 1) != 1 || numJoints > reader.getRemainingLength() / MIN_JOINT_BYTE_SIZE)
+	{
+		return false;
+	}
+
+	_jointNames.resize(numJoints);
+	_parentIndices.resize(numJoints);
+	_jointDepths.resize(numJoints);
+	_bindLocalTransforms.resize(numJoints);
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		_jointNames[i] = reader.readString();
+		if (reader.read(&_parentIndices[i], 4, 1) != 1 || !reader.readMatrix(&_bindLocalTransforms[i].m[0][0]))
+		{
+			return false;
+		}
+
+		// eqOɕł邱Ƃcookedf[^̓ǂݍ݂łOɂ̂ŊmF
+		int parentIndex = _parentIndices[i];
+		if (parentIndex != NO_PARENT && (parentIndex < 0 || static_cast<size_t>(parentIndex) >= i))
+		{
+			Logger::logAssert(false, "WCg̐eqɂBjoint=%s", _jointNames[i].c_str());
+			return false;
+		}
+		_jointDepths[i] = (parentIndex == NO_PARENT) ? 0 : _jointDepths[parentIndex] + 1;
+	}
+
+	computeBindPoseData();
+
+	unsigned int numSkinBones = 0;
+	if (reader.read(&numSkinBones, 4, 1) != 1 || numSkinBones > reader.getRemainingLength() / (4 + sizeof(float) * 16))
+	{
+		return false;
+	}
+
+	_jointSkinBoneIndices.assign(numJoints, -1);
+	_inverseBindPoses.assign(numJoints, Mat4::IDENTITY);
+	_skinBoneJointIndices.assign(numSkinBones, 0);
+	for (size_t i = 0; i < numSkinBones; ++i)
+	{
+		unsigned int jointIndex = 0;
+		Mat4 inverseBindPose;
+		if (reader.read(&jointIndex, 4, 1) != 1 || !reader.readMatrix(&inverseBindPose.m[0][0]) || jointIndex >= numJoints)
+		{
+			return false;
+		}
+
+		_skinBoneJointIndices[i] = jointIndex;
+		_jointSkinBoneIndices[jointIndex] = static_cast<int>(i);
+		_inverseBindPoses[jointIndex] = inverseBindPose;
+	}
+
+	return true;
+}
+
+void Skeleton::writeCookedData(BinaryWriter& writer) const
+{
+	// p[̓[hɋߒ̂ŁAɂȂ̂
+	unsigned int numJoints = static_cast<unsigned int>(getNumJoints());
+	writer.write(&numJoints, 4, 1);
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		writer.writeString(_jointNames[i]);
+		writer.write(&_parentIndices[i], 4, 1);
+		writer.writeMatrix(&_bindLocalTransforms[i].m[0][0]);
+	}
+
+	unsigned int numSkinBones = static_cast<unsigned int>(getNumSkinBones());
+	writer.write(&numSkinBones, 4, 1);
+	for (size_t i = 0; i < numSkinBones; ++i)
+	{
+		unsigned int jointIndex = static_cast<unsigned int>(_skinBoneJointIndices[i]);
+		writer.write(&jointIndex, 4, 1);
+		writer.writeMatrix(&_inverseBindPoses[jointIndex].m[0][0]);
+	}
+}
+
+void Skeleton::computeBindPoseData()
+{
+	size_t numJoints = _jointNames.size();
+
+	_bindTranslations.resize(numJoints);
+	_bindRotations.resize(numJoints);
+	_bindScales.resize(numJoints);
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		decomposeTransform(_bindLocalTransforms[i], _bindTranslations[i], _bindRotations[i], _bindScales[i]);
+	}
+
+	_numJointsWithinDepth.clear();
+	for (unsigned int depth : _jointDepths)
+	{
+		if (depth >= _numJointsWithinDepth.size())
+		{
+			_numJointsWithinDepth.resize(depth + 1, 0);
+		}
+		++_numJointsWithinDepth[depth];
+	}
+	for (size_t depth = 1; depth < _numJointsWithinDepth.size(); ++depth)
+	{
+		_numJointsWithinDepth[depth] += _numJointsWithinDepth[depth - 1];
+	}
+}
+
+void Skeleton::addJoint(const C3bLoader::NodeData& node, int parentIndex, unsigned int depth)
+{
+	int jointIndex = static_cast<int>(_jointNames.size());
+	_jointNames.push_back(node.id);
+	_parentIndices.push_back(parentIndex);
+	_jointDepths.push_back(depth);
+	_bindLocalTransforms.push_back(node.transform);
+
+	for (const C3bLoader::NodeData* child : node.children)
+	{
+		addJoint(*child, jointIndex, depth + 1);
+	}
+}
+
+void Skeleton::computeMatrixPalette(const Mat4* localPoses, Mat4* outModelPoses, Mat4* outMatrixPalette) const
+{
+	size_t numJoints = getNumJoints();
+	for (size_t i = 0; i < numJoints; ++i)
+	{
+		// e͐ɌvZς݂Ȃ̂ŁAẽfԂ̎pɎ̃[Jp邾ł悢
+		int parentIndex = _parentIndices[i];
+		outModelPoses[i] = (parentIndex == NO_PARENT) ? localPoses[i] : outModelPoses[parentIndex] * localPoses[i];
+
+		int skinBoneIndex = _jointSkinBoneIndices[i];
+		if (skinBoneIndex >= 0)
+		{
+			outMatrixPalette[skinBoneIndex] = outModelPoses[i] * _inverseBindPoses[i];
+		}
+	}
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,66 @@
+#pragma once
+#include "Config.h"
+#include "renderer/BasicDataTypes.h"
+#include "loader/C3bLoader.h"
+#include <string>
+#include <vector>
+
+namespace mgrrenderer
+{
+class BinaryReader;
+class BinaryWriter;
+
+// C3bLoader::NodeDatas::skeletoñc[A[hɐeqɕԔzɕRXPg
+// e̓WCgԍŎ̂ŁAfԂ̎p͐擪1Ȃ߂邾ŋ܂
+class Skeleton final
+{
+public:
+	static const int NO_PARENT = -1;
+
+	Skeleton();
+	// skinBoneNamesinverseBindPoses̓XL̃{[ԍBXL̃{[Sskeletonɂ邱
+	bool initWithNodeDatas(const C3bLoader::NodeDatas& nodeDatas, const std::vector<std::string>& skinBoneNames, const std::vector<Mat4>& inverseBindPoses);
+	// ModelAssetcookedt@Cɏ̂Bǂݍ߂ȂƂfalseԂ
+	bool initWithCookedData(BinaryReader& reader);
+	void writeCookedData(BinaryWriter& writer) const;
+	size_t getNumJoints() const { return _parentIndices.size(); }
+	size_t getNumSkinBones() const { return _skinBoneJointIndices.size(); }
+	// WCgԍ̖OBAnimationClip̃{[ԍWCgԍɍ킹̂Ɏg
+	const std::vector<std::string>& getJointNames() const { return _jointNames; }
+	const Mat4& getBindLocalTransform(size_t jointIndex) const { return _bindLocalTransforms[jointIndex]; }
+	// oCh|[Ỹ[Jp𕽍sړA]AXP[ɕ́BAj[ṼuhŃgbN̂ȂWCgɎg
+	const std::vector<Vec3>& getBindTranslations() const { return _bindTranslations; }
+	const std::vector<Quaternion>& getBindRotations() const { return _bindRotations; }
+	const std::vector<Vec3>& getBindScales() const { return _bindScales; }
+	// [g0ƂKw̐[B̃CX^XŎwȂǐ[WCg̃Aj[VȂ̂Ɏg
+	unsigned int getJointDepth(size_t jointIndex) const { return _jointDepths[jointIndex]; }
+	// [maxDepthȉ̃WCg̐
+	size_t getNumJointsWithinDepth(unsigned int maxDepth) const { return (maxDepth < _numJointsWithinDepth.size()) ? _numJointsWithinDepth[maxDepth] : getNumJoints(); }
+	// WCgԍ̃[JpXL̃{[ԍ̃}gbNXpbg߂
+	// outModelPosesgetNumJoints()AoutMatrixPalettegetNumSkinBones()mۂēnƁBŃmۂ͂Ȃ
+	void computeMatrixPalette(const Mat4* localPoses, Mat4* outModelPoses, Mat4* outMatrixPalette) const;
+
+private:
+	std::vector<std::string> _jointNames;
+	// ẽWCgԍBK菬ԍɂȂĂB[gNO_PARENT
+	std::vector<int> _parentIndices;
+	std::vector<unsigned int> _jointDepths;
+	// [Ƃ́A̐[ȉ̃WCg̐
+	std::vector<size_t> _numJointsWithinDepth;
+	std::vector<Mat4> _bindLocalTransforms;
+	std::vector<Vec3> _bindTranslations;
+	std::vector<Quaternion> _bindRotations;
+	std::vector<Vec3> _bindScales;
+	// WCgԍXL̃{[ԍւ̑ΉBXL̃{[łȂWCg-1
+	std::vector<int> _jointSkinBoneIndices;
+	// XL̃{[ԍWCgԍւ̑Ή
+	std::vector<size_t> _skinBoneJointIndices;
+	// WCgԍɕבւoCh|[Y̋tsBXL̃{[łȂWCg͎gȂ
+	std::vector<Mat4> _inverseBindPoses;
+
+	void addJoint(const C3bLoader::NodeData& node, int parentIndex, unsigned int depth);
+	// WCg̕тƃoCh|[Ỹ[JpApƐ[Ƃ̃WCg߂
+	void computeBindPoseData();
+};
+
+} // namespace mgrrenderer
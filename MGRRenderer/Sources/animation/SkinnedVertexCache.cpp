@@ -0,0 +1,252 @@
+#include "SkinnedVertexCache.h"
+#include "utility/JobScheduler.h"
+#include "utility/Logger.h"
+#include "utility/Profiler.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "renderer/D3DProgram.h"
+#endif
+#include <algorithm>
+#include <cmath>
+
+// SSE2gł͍s14vf܂Ƃ߂ăuh
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define MGRRENDERER_SKINNING_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace mgrrenderer
+{
+
+enum class SkinningAttribute : int
+{
+	NONE,
+	POSITION,
+	NORMAL,
+	TEXTURE_COORDINATE,
+	BLEND_WEIGHT,
+	BLEND_INDEX,
+};
+
+static SkinningAttribute getSkinningAttribute(const C3bLoader::MeshVertexAttribute& attrib)
+{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	if (attrib.semantic == D3DProgram::SEMANTIC_POSITION)
+	{
+		return SkinningAttribute::POSITION;
+	}
+	else if (attrib.semantic == D3DProgram::SEMANTIC_NORMAL)
+	{
+		return SkinningAttribute::NORMAL;
+	}
+	else if (attrib.semantic == D3DProgram::SEMANTIC_TEXTURE_COORDINATE)
+	{
+		return SkinningAttribute::TEXTURE_COORDINATE;
+	}
+	else if (attrib.semantic == D3DProgram::SEMANTIC_BLEND_WEIGHT)
+	{
+		return SkinningAttribute::BLEND_WEIGHT;
+	}
+	else if (attrib.semantic == D3DProgram::SEMANTIC_BLEND_INDEX)
+	{
+		return SkinningAttribute::BLEND_INDEX;
+	}
+#elif defined(MGRRENDERER_USE_OPENGL)
+	switch (attrib.location)
+	{
+	case GLProgram::AttributeLocation::POSITION:
+		return SkinningAttribute::POSITION;
+	case GLProgram::AttributeLocation::NORMAL:
+		return SkinningAttribute::NORMAL;
+	case GLProgram::AttributeLocation::TEXTURE_COORDINATE:
+		return SkinningAttribute::TEXTURE_COORDINATE;
+	case GLProgram::AttributeLocation::BLEND_WEIGHT:
+		return SkinningAttribute::BLEND_WEIGHT;
+	case GLProgram::AttributeLocation::BLEND_INDEX:
+		return SkinningAttribute::BLEND_INDEX;
+	default:
+		break;
+	}
+#endif
+
+	return SkinningAttribute::NONE;
+}
+
+SkinnedVertexCache::SkinnedVertexCache() : _numSkinBones(0)
+{
+}
+
+bool SkinnedVertexCache::initWithVertices(const std::vector<C3bLoader::MeshVertexAttribute>& attributes, const float* vertices, size_t numVertices, size_t numSkinBones)
+{
+	_numSkinBones = numSkinBones;
+
+	// Ƃ̒_擪floatPʂ̃ItZbgBȂ-1
+	int offsets[static_cast<size_t>(SkinningAttribute::BLEND_INDEX) + 1] = {-1, -1, -1, -1, -1, -1};
+	size_t vertexSizeInFloat = 0;
+	for (const C3bLoader::MeshVertexAttribute& attrib : attributes)
+	{
+		offsets[static_cast<size_t>(getSkinningAttribute(attrib))] = static_cast<int>(vertexSizeInFloat);
+		vertexSizeInFloat += attrib.attributeSizeBytes / sizeof(float);
+	}
+
+	int positionOffset = offsets[static_cast<size_t>(SkinningAttribute::POSITION)];
+	int normalOffset = offsets[static_cast<size_t>(SkinningAttribute::NORMAL)];
+	int textureCoordinateOffset = offsets[static_cast<size_t>(SkinningAttribute::TEXTURE_COORDINATE)];
+	int blendWeightOffset = offsets[static_cast<size_t>(SkinningAttribute::BLEND_WEIGHT)];
+	int blendIndexOffset = offsets[static_cast<size_t>(SkinningAttribute::BLEND_INDEX)];
+	if (vertexSizeInFloat == 0 || positionOffset < 0 || blendWeightOffset < 0 || blendIndexOffset < 0)
+	{
+		Logger::logAssert(false, "XLjOɕKvȒ_Ȃ");
+		return false;
+	}
+
+	if (numSkinBones == 0)
+	{
+		Logger::logAssert(false, "XLjOWCgȂ");
+		return false;
+	}
+
+	_sourceVertices.resize(numVertices);
+	_skinnedVertices.resize(numVertices);
+
+	for (size_t i = 0; i < numVertices; ++i)
+	{
+		const float* vertex = &vertices[i * vertexSizeInFloat];
+		SourceVertex& source = _sourceVertices[i];
+
+		source.position = Vec3(vertex[positionOffset], vertex[positionOffset + 1], vertex[positionOffset + 2]);
+		source.normal = (normalOffset >= 0) ? Vec3(vertex[normalOffset], vertex[normalOffset + 1], vertex[normalOffset + 2]) : Vec3(0.0f, 0.0f, 1.0f);
+
+		for (size_t j = 0; j < MAX_NUM_BLEND; ++j)
+		{
+			source.blendWeights[j] = vertex[blendWeightOffset + j];
+
+			// skinRange1ڂEFCgɊ֌WȂpbgǂނ̂ŁA4Ƃ͈͓Ɏ߂Ă
+			float blendIndex = vertex[blendIndexOffset + j];
+			if (blendIndex < 0.0f || blendIndex >= static_cast<float>(numSkinBones))
+			{
+				if (source.blendWeights[j] > 0.0f)
+				{
+					Logger::logAssert(false, "uhCfbNXWCg𒴂Ă blendIndex=%f", blendIndex);
+					return false;
+				}
+
+				// EFCg0Ȃ猋ʂɊ^Ȃ̂ŁAǂ̃WCgwĂĂ悢
+				blendIndex = 0.0f;
+			}
+
+			source.blendIndices[j] = static_cast<unsigned int>(blendIndex);
+		}
+
+		if (textureCoordinateOffset >= 0)
+		{
+			_skinnedVertices[i].textureCoordinate = Vec2(vertex[textureCoordinateOffset], vertex[textureCoordinateOffset + 1]);
+		}
+	}
+
+	return true;
+}
+
+void SkinnedVertexCache::skin(const std::vector<Mat4>& matrixPalette)
+{
+	MGRRENDERER_PROFILE_SCOPE("SkinnedVertexCache::skin");
+	Logger::logAssert(matrixPalette.size() == _numSkinBones, "}gbNXpbǧWCgƈvȂ");
+
+	size_t numVertices = _sourceVertices.size();
+	size_t numJobs = (numVertices + NUM_VERTICES_PER_JOB - 1) / NUM_VERTICES_PER_JOB;
+	const Mat4* palette = matrixPalette.data();
+
+	// _ƂɓƗďݐdȂȂ̂ŁA͈͂ŕăbNȂɕ񉻂ł
+	JobScheduler::getInstance()->parallelFor(numJobs, [this, palette, numVertices](size_t jobIndex)
+	{
+		size_t begin = jobIndex * NUM_VERTICES_PER_JOB;
+		skinRange(palette, begin, std::min(begin + NUM_VERTICES_PER_JOB, numVertices));
+	});
+}
+
+void SkinnedVertexCache::skinRange(const Mat4* matrixPalette, size_t begin, size_t end)
+{
+	for (size_t i = begin; i < end; ++i)
+	{
+		const SourceVertex& source = _sourceVertices[i];
+		Position3DNormalTextureCoordinates& skinned = _skinnedVertices[i];
+
+		// VF[_̃XLjOƓA1ڈȊO̓EFCg0ɂȂƂőł؂
+#if defined(MGRRENDERER_SKINNING_USE_SSE)
+		__m128 columns[4];
+		__m128 weight = _mm_set1_ps(source.blendWeights[0]);
+		const Mat4& first = matrixPalette[source.blendIndices[0]];
+		for (size_t column = 0; column < 4; ++column)
+		{
+			columns[column] = _mm_mul_ps(_mm_loadu_ps(first.m[column]), weight);
+		}
+
+		for (size_t j = 1; j < MAX_NUM_BLEND && source.blendWeights[j] > 0.0f; ++j)
+		{
+			weight = _mm_set1_ps(source.blendWeights[j]);
+			const Mat4& matrix = matrixPalette[source.blendIndices[j]];
+			for (size_t column = 0; column < 4; ++column)
+			{
+				columns[column] = _mm_add_ps(columns[column], _mm_mul_ps(_mm_loadu_ps(matrix.m[column]), weight));
+			}
+		}
+
+		__m128 position = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(columns[0], _mm_set1_ps(source.position.x)), _mm_mul_ps(columns[1], _mm_set1_ps(source.position.y))),
+			_mm_add_ps(_mm_mul_ps(columns[2], _mm_set1_ps(source.position.z)), columns[3])
+		);
+		__m128 normal = _mm_add_ps(
+			_mm_add_ps(_mm_mul_ps(columns[0], _mm_set1_ps(source.normal.x)), _mm_mul_ps(columns[1], _mm_set1_ps(source.normal.y))),
+			_mm_mul_ps(columns[2], _mm_set1_ps(source.normal.z))
+		);
+
+		float result[4];
+		_mm_storeu_ps(result, position);
+		skinned.position = Vec3(result[0], result[1], result[2]);
+		_mm_storeu_ps(result, normal);
+		skinned.normal = Vec3(result[0], result[1], result[2]);
+#else
+		float columns[4][4];
+		const Mat4& first = matrixPalette[source.blendIndices[0]];
+		for (size_t column = 0; column < 4; ++column)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				columns[column][row] = first.m[column][row] * source.blendWeights[0];
+			}
+		}
+
+		for (size_t j = 1; j < MAX_NUM_BLEND && source.blendWeights[j] > 0.0f; ++j)
+		{
+			const Mat4& matrix = matrixPalette[source.blendIndices[j]];
+			for (size_t column = 0; column < 4; ++column)
+			{
+				for (size_t row = 0; row < 4; ++row)
+				{
+					columns[column][row] += matrix.m[column][row] * source.blendWeights[j];
+				}
+			}
+		}
+
+		const Vec3& p = source.position;
+		const Vec3& n = source.normal;
+		skinned.position = Vec3(
+			columns[0][0] * p.x + columns[1][0] * p.y + columns[2][0] * p.z + columns[3][0],
+			columns[0][1] * p.x + columns[1][1] * p.y + columns[2][1] * p.z + columns[3][1],
+			columns[0][2] * p.x + columns[1][2] * p.y + columns[2][2] * p.z + columns[3][2]
+		);
+		skinned.normal = Vec3(
+			columns[0][0] * n.x + columns[1][0] * n.y + columns[2][0] * n.z,
+			columns[0][1] * n.x + columns[1][1] * n.y + columns[2][1] * n.z,
+			columns[0][2] * n.x + columns[1][2] * n.y + columns[2][2] * n.z
+		);
+#endif
+		// @͕sړ̉e󂯂Ȃ悤ɏ3x3ŕϊAuhŏk񂾒߂
+		float length = std::sqrt(skinned.normal.x * skinned.normal.x + skinned.normal.y * skinned.normal.y + skinned.normal.z * skinned.normal.z);
+		if (length > 0.0f)
+		{
+			skinned.normal = skinned.normal * (1.0f / length);
+		}
+	}
+}
+
+} // namespace mgrrenderer
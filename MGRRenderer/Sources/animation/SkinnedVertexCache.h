@@ -0,0 +1,46 @@
+#pragma once
+#include "Config.h"
+#include "renderer/BasicDataTypes.h"
+#include "loader/C3bLoader.h"
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// c3t/c3b̃bVCPUŃXLjOʂێLbV
+// t[ɈxXLjOĂ΁AGobt@AtH[hAeVhE}bṽpX̓XLjOȂobjƓ_Ƃĕ`ł
+// _͈萔ƂJobSchedulerŕɃXLjOASSE2gł̓uhs񂲂Ƃ4vf܂Ƃ߂ČvZ
+class SkinnedVertexCache final
+{
+public:
+	SkinnedVertexCache();
+	// verticesattributes̑C^[[unumVertices̒_BRs[ĂĝŁǍĂяo̊ԂLł΂悢
+	// numSkinBones̓}gbNXpbǧBuhCfbNXꖢł邱ƂŊmFĂ
+	bool initWithVertices(const std::vector<C3bLoader::MeshVertexAttribute>& attributes, const float* vertices, size_t numVertices, size_t numSkinBones);
+	// matrixPaletteDirect3Dpɓ]uÔ
+	void skin(const std::vector<Mat4>& matrixPalette);
+	const std::vector<Position3DNormalTextureCoordinates>& getSkinnedVertices() const { return _skinnedVertices; }
+
+private:
+	// 1WuŃXLjO钸_
+	static const size_t NUM_VERTICES_PER_JOB = 512;
+	static const size_t MAX_NUM_BLEND = 4;
+
+	// XLjOɎgC^[[uꂽc3t/c3b̒_甲o
+	struct SourceVertex
+	{
+		Vec3 position;
+		Vec3 normal;
+		float blendWeights[MAX_NUM_BLEND];
+		unsigned int blendIndices[MAX_NUM_BLEND];
+	};
+
+	size_t _numSkinBones;
+	std::vector<SourceVertex> _sourceVertices;
+	// eNX`W̓XLjOŕςȂ̂ŁAɏ̂̂܂܎g
+	std::vector<Position3DNormalTextureCoordinates> _skinnedVertices;
+
+	void skinRange(const Mat4* matrixPalette, size_t begin, size_t end);
+};
+
+} // namespace mgrrenderer
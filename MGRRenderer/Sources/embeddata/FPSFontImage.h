@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 
 namespace mgrrenderer
 {
@@ -6,7 +7,7 @@ namespace mgrrenderer
 //萔Ȃ̂ŃNXĂȂ
 namespace FPSFontImage
 {
-	unsigned char PNG_DATA[];
+	extern unsigned char PNG_DATA[];
 	size_t getPngDataSize();
 } // namespace FPSFontImage
 
@@ -1,6 +1,7 @@
 #include "BinaryReader.h"
 #include "utility/Logger.h"
-#include <ShlObj.h>
+#include <algorithm>
+#include <string.h>
 
 namespace mgrrenderer
 {
@@ -14,7 +15,7 @@ BinaryReader::~BinaryReader()
 	_buffer = nullptr;
 }
 
-void BinaryReader::init(unsigned char* buffer, size_t length)
+void BinaryReader::init(const unsigned char* buffer, size_t length)
 {
 	Logger::logAssert(buffer != nullptr, "obt@nullptreȂB");
 	Logger::logAssert(length > 0, "0ȉ͋eȂB");
@@ -39,7 +40,7 @@ size_t BinaryReader::read(void* outResult, size_t size, size_t count)
 	}
 
 	size_t validCount = validLength / size;
-	size_t readCount = min(validCount, count);
+	size_t readCount = std::min(validCount, count);
 
 	memcpy(outResult, _buffer + _position, size * readCount);
 	_position += size * readCount;
@@ -51,6 +52,11 @@ size_t BinaryReader::tell() const
 	return _position;
 }
 
+size_t BinaryReader::getRemainingLength() const
+{
+	return (_position < _length) ? _length - _position : 0;
+}
+
 void BinaryReader::seek(long int offset, int origin)
 {
 	Logger::logAssert(_buffer != nullptr, "obt@nullptreȂB");
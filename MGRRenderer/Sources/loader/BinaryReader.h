@@ -8,9 +8,11 @@ namespace mgrrenderer
 class BinaryReader final
 {
 public:
-	void init(unsigned char* buffer, size_t length);
+	void init(const unsigned char* buffer, size_t length);
 	size_t read(void* outResult, size_t size, size_t count);
 	size_t tell() const;
+	// ǂݏIĂȂc̃oCgBt@CɏꂽMĊmۂOɔׂ
+	size_t getRemainingLength() const;
 	void seek(long int offset, int origin); // cocos̐^
 	void rewind();
 	std::string readString();
@@ -21,7 +23,7 @@ public:
 	~BinaryReader();
 
 private:
-	unsigned char* _buffer;
+	const unsigned char* _buffer;
 	size_t _length;
 	size_t _position;
 };
@@ -0,0 +1,37 @@
+#include "BinaryWriter.h"
+#include <string.h>
+
+namespace mgrrenderer
+{
+
+void BinaryWriter::write(const void* data, size_t size, size_t count)
+{
+	size_t byteSize = size * count;
+	if (byteSize == 0)
+	{
+		return;
+	}
+
+	size_t position = _buffer.size();
+	_buffer.resize(position + byteSize);
+	memcpy(&_buffer[position], data, byteSize);
+}
+
+void BinaryWriter::writeString(const std::string& str)
+{
+	unsigned int length = static_cast<unsigned int>(str.size());
+	write(&length, 4, 1); // BinaryReaderɍ킹Ē4oCgŏ
+	write(str.data(), 1, str.size());
+}
+
+void BinaryWriter::writeMatrix(const float* m) // m[4][4]
+{
+	write(m, 4, 16);
+}
+
+void BinaryWriter::align(size_t alignment)
+{
+	_buffer.resize((_buffer.size() + alignment - 1) / alignment * alignment, 0);
+}
+
+} // namespace mgrrenderer
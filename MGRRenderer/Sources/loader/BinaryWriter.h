@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// BinaryReaderœǂ߂`Ń̃obt@ɏo
+class BinaryWriter final
+{
+public:
+	void write(const void* data, size_t size, size_t count);
+	// 4oCg̒Acharž`BBinaryReader::readStringœǂ߂
+	void writeString(const std::string& str);
+	void writeMatrix(const float* m); // m[4][4]
+	// ̈ʒualignment̔{܂0Ŗ߂
+	void align(size_t alignment);
+	size_t tell() const { return _buffer.size(); }
+	const std::vector<unsigned char>& getBuffer() const { return _buffer; }
+
+private:
+	std::vector<unsigned char> _buffer;
+};
+
+} // namespace mgrrenderer
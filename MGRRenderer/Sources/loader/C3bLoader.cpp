@@ -1,7 +1,12 @@
 #include "C3bLoader.h"
 #include "utility/FileUtility.h"
 #include "json/document.h"
+#include "json/reader.h"
 #include "BinaryReader.h"
+#include "utility/Profiler.h"
+#include <stdio.h>
+#include <string.h>
+#include <deque>
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "renderer/D3DProgram.h"
 #endif
@@ -243,6 +248,12 @@ namespace C3bLoader
 		}
 	}
 
+	// c3t1.20.2meshesanimatioň`ÂBDOMœǂނƂSAXœǂނƂŔ肷
+	static bool isOldC3tLayoutVersion(const std::string& version)
+	{
+		return version == "1.2" || version == "0.2";
+	}
+
 	static std::string loadMeshDatasFromJson_0_1(const rapidjson::Document& json, MeshDatas& outMeshDatas)
 	{
 		const rapidjson::Value& meshesVal = json["meshes"];
@@ -287,14 +298,14 @@ namespace C3bLoader
 		}
 			
 		unsigned int numIndex = meshBodyVal0["indexnum"].GetUint();
-		std::vector<unsigned short> indexArray;
+		MeshData::IndexArray indexArray;
 		indexArray.resize(numIndex);
 			
 		const rapidjson::Value& indicesVal = meshBodyVal0["indices"];
 		rapidjson::SizeType indicesValSize = indicesVal.Size();
 		for (rapidjson::SizeType j = 0; j < indicesValSize; ++j)
 		{
-			indexArray[j] = (unsigned short)indicesVal[j].GetUint();
+			indexArray[j] = indicesVal[j].GetUint();
 		}
 		mesh->subMeshIndices.push_back(indexArray);
 		//TODO:aabbsɂĂ͂Ƃ肠u
@@ -452,7 +463,8 @@ namespace C3bLoader
 				return "warning: Failed to read meshdata: indices";
 			}
 
-			mesh->subMeshIndices.push_back(indices);
+			// t@C16bitȂ̂32bitɍLĎ
+			mesh->subMeshIndices.push_back(MeshData::IndexArray(indices.begin(), indices.end()));
 		}
 
 		outMeshDatas.meshDatas.push_back(mesh);
@@ -507,7 +519,7 @@ namespace C3bLoader
 			size_t numParts = partsVal.Size();
 			for (rapidjson::SizeType j = 0; j < numParts; ++j)
 			{
-				std::vector<unsigned short> indexArray;
+				MeshData::IndexArray indexArray;
 				const rapidjson::Value& partVal = partsVal[j];
 				mesh->subMeshIds.push_back(partVal["id"].GetString());
 				
@@ -644,7 +656,8 @@ namespace C3bLoader
 					return "warning: Failed to read meshdata: indices";
 				}
 
-				mesh->subMeshIndices.push_back(indices);
+				// t@C16bitȂ̂32bitɍLĎ
+				mesh->subMeshIndices.push_back(MeshData::IndexArray(indices.begin(), indices.end()));
 				mesh->numSubMesh = indexCount;
 
 				// subMeshAABB͏ȗ
@@ -1527,7 +1540,7 @@ namespace C3bLoader
 	static bool loadAnimationDataFromJson(const rapidjson::Document& json, AnimationDatas& outAnimationDatas, const std::string& version)
 	{
 		std::string anim;
-		if (version == "1.2" || version == "0.2")
+		if (isOldC3tLayoutVersion(version))
 		{
 			anim = "animation";
 		}
@@ -1601,7 +1614,7 @@ namespace C3bLoader
 			}
 
 			const std::string& timelineName = animationVal["id"].GetString();
-			outAnimationDatas.animations[timelineName] = animationData;
+			outAnimationDatas.setAnimation(timelineName, animationData);
 		}
 
 		return true;
@@ -1776,19 +1789,667 @@ namespace C3bLoader
 				}
 			}
 
-			outAnimationDatas.animations[animId] = animation;
+			outAnimationDatas.setAnimation(animId, animation);
 		}
 
 		return true;
 	}
 
-	std::string loadC3t(const std::string& fileName, MeshDatas& outMeshDatas, MaterialDatas& outMaterialDatas, NodeDatas& outNodeDatas, AnimationDatas& outAnimationDatas)
+	// c3tJSONSAXœǂރnh
+	// DOMɂƒ_L[t[̐l1ƂValuełAt@C̐{̃ƎԂĝŁA
+	// meshesanimations͓ǂ݂ȂMeshDataAnimationDataɒڏށB_ƃCfbNX̔z͓ǂޑOɗvf𐔂ĊmۂĂ
+	// ȊȌȗvf́ADOMp̊֐ł̂܂ܓǂ߂悤_documentDOMƂđgݗĂ
+	class C3tSaxHandler
 	{
-		const std::string& json = FileUtility::getInstance()->getStringFromFile(fileName);
+	public:
+		C3tSaxHandler(rapidjson::InsituStringStream& stream, MeshDatas& outMeshDatas, AnimationDatas& outAnimationDatas) :
+		_stream(stream),
+		_meshDatas(outMeshDatas),
+		_animationDatas(outAnimationDatas),
+		_key(KeyName::OTHER),
+		_hasVersion(false),
+		_hasStreamedMeshes(false),
+		_hasStreamedAnimations(false),
+		_mesh(nullptr),
+		_attributeSize(0),
+		_animationData(nullptr),
+		_hasKeyFrames(false),
+		_keyTime(0.0f),
+		_hasTranslation(false),
+		_hasRotation(false),
+		_hasScale(false),
+		_floatTarget(nullptr),
+		_indexTarget(nullptr)
+		{
+		}
+
+		~C3tSaxHandler()
+		{
+			// p[XG[œrɂȂAj[V͂܂_animationDatasɓnĂȂ̂łŏ
+			delete _animationData;
+		}
+
+		// meshesanimationsDOM
+		const rapidjson::Document& getDocument() const { return _document; }
+		bool hasStreamedMeshes() const { return _hasStreamedMeshes; }
+		bool hasStreamedAnimations() const { return _hasStreamedAnimations; }
+
+		bool Null() { rapidjson::Value value; return scalar(value); }
+		bool Bool(bool b) { rapidjson::Value value(b); return scalar(value); }
+		bool Int(int i) { return number(static_cast<double>(i), rapidjson::Value(i)); }
+		bool Uint(unsigned int u) { return number(static_cast<double>(u), rapidjson::Value(u)); }
+		bool Int64(int64_t i) { return number(static_cast<double>(i), rapidjson::Value(i)); }
+		bool Uint64(uint64_t u) { return number(static_cast<double>(u), rapidjson::Value(u)); }
+		bool Double(double d) { return number(d, rapidjson::Value(d)); }
+
+		bool String(const char* str, rapidjson::SizeType length, bool copy)
+		{
+			(void)copy; // insituŃp[X̂ŕ͏Ƀobt@wĂ
+			rapidjson::Value value(str, length);
+			return scalar(value);
+		}
+
+		bool Key(const char* str, rapidjson::SizeType length, bool copy)
+		{
+			(void)copy;
+			switch (_contexts.back())
+			{
+			case Context::ROOT:
+				_key = findKeyName(str, length);
+				_domKeys.emplace_back(str, length);
+				break;
+			case Context::DOM:
+				_domKeys.emplace_back(str, length);
+				break;
+			case Context::IGNORED:
+				break;
+			default:
+				_key = findKeyName(str, length);
+				break;
+			}
+
+			return true;
+		}
+
+		bool StartObject()
+		{
+			if (_contexts.empty())
+			{
+				_document.SetObject();
+				_contexts.push_back(Context::ROOT);
+				return true;
+			}
+
+			switch (_contexts.back())
+			{
+			case Context::ROOT:
+			case Context::DOM:
+				startDomContainer(rapidjson::kObjectType);
+				break;
+			case Context::MESHES:
+				_mesh = new (std::nothrow)MeshData();
+				_mesh->vertexSizeInFloat = 0;
+				_mesh->numSubMesh = 0;
+				_mesh->numAttribute = 0;
+				_meshDatas.meshDatas.push_back(_mesh);
+				_contexts.push_back(Context::MESH);
+				break;
+			case Context::ATTRIBUTES:
+				_attributeSize = 0;
+				_attributeType.clear();
+				_attributeName.clear();
+				_contexts.push_back(Context::ATTRIBUTE);
+				break;
+			case Context::PARTS:
+				_mesh->subMeshIndices.push_back(MeshData::IndexArray());
+				_contexts.push_back(Context::PART);
+				break;
+			case Context::ANIMATIONS:
+				_animationData = new AnimationData();
+				_animationData->totalTime = 0.0f;
+				_animationId.clear();
+				_contexts.push_back(Context::ANIMATION);
+				break;
+			case Context::BONES:
+				_boneId.clear();
+				_hasKeyFrames = false;
+				_boneTranslationKeyFrames.clear();
+				_boneRotationKeyFrames.clear();
+				_boneScaleKeyFrames.clear();
+				_contexts.push_back(Context::BONE);
+				break;
+			case Context::KEYFRAMES:
+				_keyTime = 0.0f;
+				_hasTranslation = false;
+				_hasRotation = false;
+				_hasScale = false;
+				_contexts.push_back(Context::KEYFRAME);
+				break;
+			default:
+				_contexts.push_back(Context::IGNORED);
+				break;
+			}
+
+			return true;
+		}
+
+		bool EndObject(rapidjson::SizeType memberCount)
+		{
+			(void)memberCount;
+			Context context = _contexts.back();
+			_contexts.pop_back();
 
-		rapidjson::Document jsonReader;
-		auto& doc = jsonReader.ParseInsitu<0>((char*)json.c_str()); // ^̈̂autoň
-		if (doc.HasParseError())
+			switch (context)
+			{
+			case Context::DOM:
+				endDomContainer();
+				break;
+			case Context::MESH:
+				_mesh->vertexSizeInFloat = _mesh->vertices.size();
+				_mesh->numAttribute = _mesh->attributes.size();
+				_mesh->numSubMesh = _mesh->subMeshIndices.size();
+				_mesh = nullptr;
+				break;
+			case Context::ATTRIBUTE:
+				addAttribute();
+				break;
+			case Context::ANIMATION:
+				_animationDatas.setAnimation(_animationId, _animationData);
+				_animationData = nullptr;
+				break;
+			case Context::BONE:
+				if (_hasKeyFrames)
+				{
+					moveKeyFrames(_boneTranslationKeyFrames, _animationData->translationKeyFrames[_boneId]);
+					moveKeyFrames(_boneRotationKeyFrames, _animationData->rotationKeyFrames[_boneId]);
+					moveKeyFrames(_boneScaleKeyFrames, _animationData->scaleKeyFrames[_boneId]);
+				}
+				break;
+			case Context::KEYFRAME:
+				if (_hasTranslation)
+				{
+					_boneTranslationKeyFrames.push_back(AnimationData::Vec3KeyFrame(_keyTime, _translation));
+				}
+
+				if (_hasRotation)
+				{
+					_boneRotationKeyFrames.push_back(AnimationData::QuaternionKeyFrame(_keyTime, _rotation));
+				}
+
+				if (_hasScale)
+				{
+					_boneScaleKeyFrames.push_back(AnimationData::Vec3KeyFrame(_keyTime, _scale));
+				}
+				break;
+			default:
+				break;
+			}
+
+			return true;
+		}
+
+		bool StartArray()
+		{
+			if (_contexts.empty())
+			{
+				// [gIuWFNgłȂ̂c3tł͂Ȃ
+				return false;
+			}
+
+			switch (_contexts.back())
+			{
+			case Context::ROOT:
+				if (_key == KeyName::MESHES && canStream())
+				{
+					_domKeys.pop_back();
+					_hasStreamedMeshes = true;
+					_contexts.push_back(Context::MESHES);
+				}
+				else if (_key == KeyName::ANIMATIONS && canStream())
+				{
+					_domKeys.pop_back();
+					_hasStreamedAnimations = true;
+					_contexts.push_back(Context::ANIMATIONS);
+				}
+				else
+				{
+					startDomContainer(rapidjson::kArrayType);
+				}
+				break;
+			case Context::DOM:
+				startDomContainer(rapidjson::kArrayType);
+				break;
+			case Context::MESH:
+				if (_key == KeyName::ATTRIBUTES)
+				{
+					_contexts.push_back(Context::ATTRIBUTES);
+				}
+				else if (_key == KeyName::VERTICES)
+				{
+					_mesh->vertices.reserve(countArrayElements());
+					_floatTarget = &_mesh->vertices;
+					_contexts.push_back(Context::VERTICES);
+				}
+				else if (_key == KeyName::PARTS)
+				{
+					_contexts.push_back(Context::PARTS);
+				}
+				else
+				{
+					_contexts.push_back(Context::IGNORED);
+				}
+				break;
+			case Context::PART:
+				if (_key == KeyName::INDICES)
+				{
+					_indexTarget = &_mesh->subMeshIndices.back();
+					_indexTarget->reserve(countArrayElements());
+					_contexts.push_back(Context::INDICES);
+				}
+				else
+				{
+					_contexts.push_back(Context::IGNORED);
+				}
+				break;
+			case Context::ANIMATION:
+				_contexts.push_back((_key == KeyName::BONES) ? Context::BONES : Context::IGNORED);
+				break;
+			case Context::BONE:
+				if (_key == KeyName::KEYFRAMES)
+				{
+					_hasKeyFrames = true;
+					_contexts.push_back(Context::KEYFRAMES);
+				}
+				else
+				{
+					_contexts.push_back(Context::IGNORED);
+				}
+				break;
+			case Context::KEYFRAME:
+				_keyFrameValues.clear();
+				_floatTarget = &_keyFrameValues;
+				_contexts.push_back(Context::KEYFRAME_VALUES);
+				break;
+			default:
+				_contexts.push_back(Context::IGNORED);
+				break;
+			}
+
+			return true;
+		}
+
+		bool EndArray(rapidjson::SizeType elementCount)
+		{
+			(void)elementCount;
+			Context context = _contexts.back();
+			_contexts.pop_back();
+
+			switch (context)
+			{
+			case Context::DOM:
+				endDomContainer();
+				break;
+			case Context::VERTICES:
+				_floatTarget = nullptr;
+				break;
+			case Context::INDICES:
+				_indexTarget = nullptr;
+				break;
+			case Context::KEYFRAME_VALUES:
+				_floatTarget = nullptr;
+				setKeyFrameValue();
+				break;
+			default:
+				break;
+			}
+
+			return true;
+		}
+
+	private:
+		enum class Context : int
+		{
+			ROOT,
+			// DOMɑgݗĂvf̒
+			DOM,
+			MESHES,
+			MESH,
+			ATTRIBUTES,
+			ATTRIBUTE,
+			VERTICES,
+			PARTS,
+			PART,
+			INDICES,
+			ANIMATIONS,
+			ANIMATION,
+			BONES,
+			BONE,
+			KEYFRAMES,
+			KEYFRAME,
+			KEYFRAME_VALUES,
+			// ǂ܂Ȃvf̒
+			IGNORED,
+		};
+
+		// ǂݕɎgL[B̂܂܎Ɣrl1̃p[XdȂ̂ŁAǂ񂾂ƂɈxϊ
+		enum class KeyName : int
+		{
+			OTHER,
+			VERSION,
+			MESHES,
+			ANIMATIONS,
+			ATTRIBUTES,
+			SIZE,
+			TYPE,
+			ATTRIBUTE,
+			VERTICES,
+			PARTS,
+			ID,
+			INDICES,
+			LENGTH,
+			BONES,
+			BONE_ID,
+			KEYFRAMES,
+			KEYTIME,
+			TRANSLATION,
+			ROTATION,
+			SCALE,
+		};
+
+		rapidjson::InsituStringStream& _stream;
+		MeshDatas& _meshDatas;
+		AnimationDatas& _animationDatas;
+		std::vector<Context> _contexts;
+		// Oɓǂ񂾃L[BROOTƒڏޗvf̒łg
+		KeyName _key;
+		std::string _version;
+		bool _hasVersion;
+		bool _hasStreamedMeshes;
+		bool _hasStreamedAnimations;
+
+		// DOMƂđgݗĂ镔Binsitũobt@QƂ̂ŁAobt@蒷gȂ
+		rapidjson::Document _document;
+		// gݗĒ̃IuWFNgƔzBdequeȂ̂ŒǉĂ̗vf͓Ȃ
+		std::deque<rapidjson::Value> _domValues;
+		// gݗĒ̃IuWFNgɒǉL[Blǉ菜
+		std::deque<rapidjson::Value> _domKeys;
+
+		MeshData* _mesh;
+		int _attributeSize;
+		std::string _attributeType;
+		std::string _attributeName;
+
+		AnimationData* _animationData;
+		std::string _animationId;
+		std::string _boneId;
+		bool _hasKeyFrames;
+		std::vector<AnimationData::Vec3KeyFrame> _boneTranslationKeyFrames;
+		std::vector<AnimationData::QuaternionKeyFrame> _boneRotationKeyFrames;
+		std::vector<AnimationData::Vec3KeyFrame> _boneScaleKeyFrames;
+		float _keyTime;
+		bool _hasTranslation;
+		bool _hasRotation;
+		bool _hasScale;
+		Vec3 _translation;
+		Quaternion _rotation;
+		Vec3 _scale;
+		std::vector<float> _keyFrameValues;
+
+		// l̂܂ܒǉB_ƃL[t[̒l̔z̒łnullptrłȂ
+		std::vector<float>* _floatTarget;
+		// CfbNX̔z̒łnullptrłȂ
+		MeshData::IndexArray* _indexTarget;
+
+		static KeyName findKeyName(const char* str, rapidjson::SizeType length)
+		{
+			static const struct
+			{
+				const char* str;
+				rapidjson::SizeType length;
+				KeyName name;
+			} KEY_NAMES[] = {
+				{"version", 7, KeyName::VERSION},
+				{"meshes", 6, KeyName::MESHES},
+				{"animations", 10, KeyName::ANIMATIONS},
+				{"attributes", 10, KeyName::ATTRIBUTES},
+				{"size", 4, KeyName::SIZE},
+				{"type", 4, KeyName::TYPE},
+				{"attribute", 9, KeyName::ATTRIBUTE},
+				{"vertices", 8, KeyName::VERTICES},
+				{"parts", 5, KeyName::PARTS},
+				{"id", 2, KeyName::ID},
+				{"indices", 7, KeyName::INDICES},
+				{"length", 6, KeyName::LENGTH},
+				{"bones", 5, KeyName::BONES},
+				{"boneId", 6, KeyName::BONE_ID},
+				{"keyframes", 9, KeyName::KEYFRAMES},
+				{"keytime", 7, KeyName::KEYTIME},
+				{"translation", 11, KeyName::TRANSLATION},
+				{"rotation", 8, KeyName::ROTATION},
+				{"scale", 5, KeyName::SCALE},
+			};
+
+			for (const auto& keyName : KEY_NAMES)
+			{
+				if (keyName.length == length && memcmp(keyName.str, str, length) == 0)
+				{
+					return keyName.name;
+				}
+			}
+
+			return KeyName::OTHER;
+		}
+
+		// Âo[Wmeshesanimationš`Ⴄ̂ŁADOMɑgݗĂĊ̊֐œǂ
+		// versionmeshesɏĂƂADOMł1.2ƂĈẑƂǂ̌`Ȃ̂DOMɂ
+		bool canStream() const
+		{
+			return _hasVersion && !isOldC3tLayoutVersion(_version);
+		}
+
+		// Jʂǂ񂾒ɌĂсAʂ܂ł̗vf𐔂Bq̂Ȃl̔zɂg
+		size_t countArrayElements() const
+		{
+			const char* begin = _stream.src_;
+			while (*begin == ' ' || *begin == '\t' || *begin == '\n' || *begin == '\r')
+			{
+				++begin;
+			}
+
+			if (*begin == ']')
+			{
+				return 0;
+			}
+
+			const char* end = strchr(begin, ']');
+			if (end == nullptr)
+			{
+				// ĂȂz̓p[XG[ɂȂ̂ŊmۂȂ
+				return 0;
+			}
+
+			return static_cast<size_t>(std::count(begin, end, ',')) + 1;
+		}
+
+		bool number(double d, rapidjson::Value&& value)
+		{
+			if (_floatTarget != nullptr)
+			{
+				_floatTarget->push_back(static_cast<float>(d));
+				return true;
+			}
+
+			if (_indexTarget != nullptr)
+			{
+				_indexTarget->push_back(static_cast<unsigned int>(d));
+				return true;
+			}
+
+			return scalar(value);
+		}
+
+		bool scalar(rapidjson::Value& value)
+		{
+			if (_contexts.empty())
+			{
+				// [gIuWFNgłȂ̂c3tł͂Ȃ
+				return false;
+			}
+
+			switch (_contexts.back())
+			{
+			case Context::ROOT:
+				if (_key == KeyName::VERSION && value.IsString())
+				{
+					_version.assign(value.GetString(), value.GetStringLength());
+					_hasVersion = true;
+				}
+				addDomValue(value);
+				break;
+			case Context::DOM:
+				addDomValue(value);
+				break;
+			case Context::ATTRIBUTE:
+				if (_key == KeyName::SIZE && value.IsNumber())
+				{
+					_attributeSize = static_cast<int>(value.GetDouble());
+				}
+				else if (_key == KeyName::TYPE && value.IsString())
+				{
+					_attributeType.assign(value.GetString(), value.GetStringLength());
+				}
+				else if (_key == KeyName::ATTRIBUTE && value.IsString())
+				{
+					_attributeName.assign(value.GetString(), value.GetStringLength());
+				}
+				break;
+			case Context::PART:
+				if (_key == KeyName::ID && value.IsString())
+				{
+					_mesh->subMeshIds.push_back(std::string(value.GetString(), value.GetStringLength()));
+				}
+				break;
+			case Context::ANIMATION:
+				if (_key == KeyName::ID && value.IsString())
+				{
+					_animationId.assign(value.GetString(), value.GetStringLength());
+				}
+				else if (_key == KeyName::LENGTH && value.IsNumber())
+				{
+					_animationData->totalTime = static_cast<float>(value.GetDouble());
+				}
+				break;
+			case Context::BONE:
+				if (_key == KeyName::BONE_ID && value.IsString()) // ȂL[啶
+				{
+					_boneId.assign(value.GetString(), value.GetStringLength());
+				}
+				break;
+			case Context::KEYFRAME:
+				if (_key == KeyName::KEYTIME && value.IsNumber())
+				{
+					_keyTime = static_cast<float>(value.GetDouble());
+				}
+				break;
+			default:
+				break;
+			}
+
+			return true;
+		}
+
+		void addDomValue(rapidjson::Value& value)
+		{
+			rapidjson::Value& parent = _domValues.empty() ? _document : _domValues.back();
+			if (parent.IsObject())
+			{
+				parent.AddMember(_domKeys.back(), value, _document.GetAllocator());
+				_domKeys.pop_back();
+			}
+			else
+			{
+				parent.PushBack(value, _document.GetAllocator());
+			}
+		}
+
+		void startDomContainer(rapidjson::Type type)
+		{
+			_domValues.emplace_back(type);
+			_contexts.push_back(Context::DOM);
+		}
+
+		void endDomContainer()
+		{
+			// eɒǉvalue̒g͈ڂ̂ŁAɂȂ̂菜
+			rapidjson::Value value;
+			value.Swap(_domValues.back());
+			_domValues.pop_back();
+			addDomValue(value);
+		}
+
+		void addAttribute()
+		{
+			MeshVertexAttribute attrib;
+			attrib.size = _attributeSize;
+			attrib.attributeSizeBytes = sizeof(float) * _attributeSize;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+			attrib.semantic = parseD3DProgramAttributeString(_attributeName);
+#elif defined(MGRRENDERER_USE_OPENGL)
+			attrib.type = parseGLTypeString(_attributeType);
+			attrib.location = parseGLProgramAttributeString(_attributeName);
+#endif
+			_mesh->attributes.push_back(attrib);
+		}
+
+		void setKeyFrameValue()
+		{
+			const std::vector<float>& v = _keyFrameValues;
+			if (_key == KeyName::TRANSLATION && v.size() >= 3)
+			{
+				_translation = Vec3(v[0], v[1], v[2]);
+				_hasTranslation = true;
+			}
+			else if (_key == KeyName::ROTATION && v.size() >= 4)
+			{
+				_rotation = Quaternion(v[0], v[1], v[2], v[3]);
+				_hasRotation = true;
+			}
+			else if (_key == KeyName::SCALE && v.size() >= 3)
+			{
+				_scale = Vec3(v[0], v[1], v[2]);
+				_hasScale = true;
+			}
+		}
+
+		// {[2oĂƂDOMłƓɑ
+		template<typename T>
+		static void moveKeyFrames(std::vector<T>& src, std::vector<T>& dst)
+		{
+			if (dst.empty())
+			{
+				dst.swap(src);
+			}
+			else
+			{
+				dst.insert(dst.end(), src.begin(), src.end());
+			}
+		}
+	};
+
+	// jsoninsituŃp[XďBDOM̕jsonQƂ̂ŁAǂݏI܂ŉȂ
+	static std::string loadC3tFromJson(char* json, const std::string& fileName, MeshDatas& outMeshDatas, MaterialDatas& outMaterialDatas, NodeDatas& outNodeDatas, AnimationDatas& outAnimationDatas)
+	{
+		rapidjson::InsituStringStream stream(json);
+		C3tSaxHandler handler(stream, outMeshDatas, outAnimationDatas);
+		rapidjson::Reader reader;
+		reader.Parse<rapidjson::kParseInsituFlag>(stream, handler);
+		if (reader.HasParseError())
+		{
+			return "Parse json failed.";
+		}
+
+		const rapidjson::Document& jsonReader = handler.getDocument();
+		if (!jsonReader.IsObject() || !jsonReader.HasMember("version"))
 		{
 			return "Parse json failed.";
 		}
@@ -1805,14 +2466,17 @@ namespace C3bLoader
 			c3tVersion = mashDataArray.GetString();
 		}
 
-		// meshf[^[h
-		if (c3tVersion == "1.2" || c3tVersion == "0.2")
+		// meshf[^[hBp[XȂǂ߂ȂƂDOMǂ
+		if (!handler.hasStreamedMeshes())
 		{
-			loadMeshDatasFromJson_0_1(jsonReader, outMeshDatas);
-		}
-		else
-		{
-			loadMeshDatasFromJson(jsonReader, outMeshDatas);
+			if (isOldC3tLayoutVersion(c3tVersion))
+			{
+				loadMeshDatasFromJson_0_1(jsonReader, outMeshDatas);
+			}
+			else
+			{
+				loadMeshDatasFromJson(jsonReader, outMeshDatas);
+			}
 		}
 
 		size_t lastSlashIndex = fileName.find_last_of('/');
@@ -1898,12 +2562,36 @@ namespace C3bLoader
 			loadNodesFromJson(jsonReader, outNodeDatas, c3tVersion);
 		}
 		
-		loadAnimationDataFromJson(jsonReader, outAnimationDatas, c3tVersion);
+		if (!handler.hasStreamedAnimations())
+		{
+			loadAnimationDataFromJson(jsonReader, outAnimationDatas, c3tVersion);
+		}
+
 		return "";
 	}
 
+	std::string loadC3t(const std::string& fileName, MeshDatas& outMeshDatas, MaterialDatas& outMaterialDatas, NodeDatas& outNodeDatas, AnimationDatas& outAnimationDatas)
+	{
+		MGRRENDERER_PROFILE_SCOPE("C3bLoader::loadC3t");
+
+		// 0I[tœǂ񂾃obt@̂܂insituŃp[XBstd::stringɃRs[ƃt@C2̃g
+		size_t length;
+		unsigned char* buffer = FileUtility::getInstance()->getFileData(fileName, &length, true);
+		if (buffer == nullptr)
+		{
+			return "empty file";
+		}
+
+		const std::string& result = loadC3tFromJson(reinterpret_cast<char*>(buffer), fileName, outMeshDatas, outMaterialDatas, outNodeDatas, outAnimationDatas);
+		// getFileDatamallocŊmۂĂ
+		free(buffer);
+		return result;
+	}
+
 	std::string loadC3b(const std::string& fileName, MeshDatas& outMeshDatas, MaterialDatas& outMaterialDatas, NodeDatas& outNodeDatas, AnimationDatas& outAnimationDatas)
 	{
+		MGRRENDERER_PROFILE_SCOPE("C3bLoader::loadC3b");
+
 		size_t length;
 		unsigned char* buffer = FileUtility::getInstance()->getFileData(fileName, &length);
 		if (buffer == nullptr || length <= 0)
@@ -1932,7 +2620,7 @@ namespace C3bLoader
 		}
 
 		char versionStr[20]; // TODO:20͕̍s
-		sprintf_s(versionStr, "%d.%d", version[0], version[1]);
+		snprintf(versionStr, sizeof(versionStr), "%d.%d", version[0], version[1]);
 		std::string c3bVersion(versionStr);
 
 		// ̌̓V[Npf[^e[uiidAtypeAoffsetjB̌Af[^B
@@ -2068,6 +2756,52 @@ namespace C3bLoader
 
 		return "";
 	}
+
+	// c3t/c3b̃t@Cɏ钸_
+	static const char* const ATTRIBUTE_NAMES[] = {
+		"VERTEX_ATTRIB_POSITION",
+		"VERTEX_ATTRIB_COLOR",
+		"VERTEX_ATTRIB_TEX_COORD",
+		"VERTEX_ATTRIB_TEX_COORD1",
+		"VERTEX_ATTRIB_TEX_COORD2",
+		"VERTEX_ATTRIB_TEX_COORD3",
+		"VERTEX_ATTRIB_NORMAL",
+		"VERTEX_ATTRIB_BLEND_WEIGHT",
+		"VERTEX_ATTRIB_BLEND_INDEX",
+	};
+
+	MeshVertexAttribute createMeshVertexAttribute(const std::string& attributeName, size_t size)
+	{
+		MeshVertexAttribute attrib;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		attrib.size = size;
+		attrib.semantic = parseD3DProgramAttributeString(attributeName);
+		attrib.attributeSizeBytes = size * sizeof(float);
+#elif defined(MGRRENDERER_USE_OPENGL)
+		attrib.size = static_cast<GLint>(size);
+		attrib.type = GL_FLOAT;
+		attrib.location = parseGLProgramAttributeString(attributeName);
+		attrib.attributeSizeBytes = static_cast<int>(size * sizeof(float));
+#endif
+		return attrib;
+	}
+
+	std::string getMeshVertexAttributeName(const MeshVertexAttribute& attrib)
+	{
+		for (const char* attributeName : ATTRIBUTE_NAMES)
+		{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+			if (parseD3DProgramAttributeString(attributeName) == attrib.semantic)
+#elif defined(MGRRENDERER_USE_OPENGL)
+			if (parseGLProgramAttributeString(attributeName) == attrib.location)
+#endif
+			{
+				return attributeName;
+			}
+		}
+
+		return "";
+	}
 } // namespace C3bLoader
 
 } // namespace mgrrenderer
@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <map>
@@ -35,7 +36,8 @@ namespace C3bLoader
 
 	struct MeshData
 	{
-		typedef std::vector<unsigned short> IndexArray;
+		// c3b̃t@C16bitA[h32bitɍLB`掞̃rbgModelAsset߂
+		typedef std::vector<unsigned int> IndexArray;
 		std::vector<float> vertices;
 		size_t vertexSizeInFloat;
 		std::vector<IndexArray> subMeshIndices;
@@ -211,9 +213,8 @@ namespace C3bLoader
 		std::vector<ModelData*> modelNodeDatas;
 		std::vector<NodeData*> children;
 		NodeData* parent; // TODO:cocosɂ͂ȂAcocosSkeleton3DBone3Dɂ͂āAc[̃go[XɕKvȂ߁AbIɒǉ
-		Mat4 animatedTransform; // TODO:cocosɂ͂ȂAcocosSkeleton3DBone3Dɂ͂āAgo[XăAj[Vspbg߂̂ɕKvȂ߁AbIɒǉ Mat4::ZEROAAj[VĂȂ̂Ƃtransformg߂̔lɎg
 
-		NodeData() : parent(nullptr), transform(Mat4::ZERO), animatedTransform(Mat4::ZERO) {}
+		NodeData() : parent(nullptr), transform(Mat4::ZERO) {}
 		
 		~NodeData()
 		{
@@ -224,7 +225,6 @@ namespace C3bLoader
 		{
 			id.clear();
 			transform.setZero();
-			animatedTransform.setZero();
 
 			for (const auto& it : children)
 			{
@@ -266,7 +266,7 @@ namespace C3bLoader
 		}
 	};
 
-	// ̃^CC̃xɑΉ
+	// ̃^CC̃xɑΉB[hʂێ邾ŁAĐɂAnimationClipɕϊĎg
 	struct AnimationData {
 		// time0<=time<=1̃p[^łBtotalTimeƏZ邱ƂŎibjɂȂ
 		struct Vec3KeyFrame {
@@ -288,115 +288,6 @@ namespace C3bLoader
 		std::map<std::string, std::vector<QuaternionKeyFrame>> rotationKeyFrames;
 		std::map<std::string, std::vector<Vec3KeyFrame>> scaleKeyFrames;
 		float totalTime;
-
-		int determineIndex(const std::string& boneId, float time)
-		{
-			const std::vector<Vec3KeyFrame>& oneTranslationKeyFrames = translationKeyFrames[boneId];
-
-			// 2Tōł߂CfbNXT
-			unsigned int min = 0;
-			unsigned int max = oneTranslationKeyFrames.size() - 1; // oϐ̃xNg
-			unsigned int mid = 0;
-
-			do
-			{
-				mid = (min + max) / 2;
-				if (oneTranslationKeyFrames[mid].time <= time && time <= oneTranslationKeyFrames[mid + 1].time)
-				{
-					return mid;
-				}
-				else if (time < oneTranslationKeyFrames[mid].time)
-				{
-					max = mid - 1;
-				}
-				else
-				{
-					min = mid + 1;
-				}
-			} while (min <= max);
-
-			// qbĝȂ
-			return -1;
-		}
-
-		Vec3 evaluateTranslation(const std::string& boneId, float time)
-		{
-			const std::vector<Vec3KeyFrame>& oneTranslationKeyFrames = translationKeyFrames[boneId];
-
-			if (oneTranslationKeyFrames.size() == 1 || time <= oneTranslationKeyFrames[0].time)
-			{
-				return oneTranslationKeyFrames[0].value;
-			}
-			else if (time >= oneTranslationKeyFrames[oneTranslationKeyFrames.size() - 1].time)
-			{
-				return oneTranslationKeyFrames[oneTranslationKeyFrames.size() - 1].value;
-			}
-
-			int index = determineIndex(boneId, time);
-
-			// ⊮Ɏg2̒l
-			const Vec3KeyFrame& from = translationKeyFrames[boneId][index];
-			const Vec3KeyFrame& to = translationKeyFrames[boneId][index + 1];
-
-			// ⊮p[^
-			float t = (time - from.time) / (from.time - to.time);
-			return from.value + (to.value - from.value) * t;
-		}
-
-		Quaternion evaluateRotation(const std::string& boneId, float time)
-		{
-			const std::vector<QuaternionKeyFrame>& oneRotationKeyFrames = rotationKeyFrames[boneId];
-
-			if (oneRotationKeyFrames.size() == 1 || time <= oneRotationKeyFrames[0].time)
-			{
-				return oneRotationKeyFrames[0].value;
-			}
-			else if (time >= oneRotationKeyFrames[oneRotationKeyFrames.size() - 1].time)
-			{
-				return oneRotationKeyFrames[oneRotationKeyFrames.size() - 1].value;
-			}
-
-			int index = determineIndex(boneId, time);
-
-			// ⊮Ɏg2̒l
-			const QuaternionKeyFrame& from = rotationKeyFrames[boneId][index];
-			const QuaternionKeyFrame& to = rotationKeyFrames[boneId][index + 1];
-
-			// ⊮p[^
-			float t = (time - from.time) / (to.time - from.time);
-			if (t >= 0)
-			{
-				return Quaternion::slerp(from.value, to.value, t);
-			}
-			else
-			{
-				return Quaternion::slerp(to.value, from.value, t);
-			}
-		}
-
-		Vec3 evaluateScale(const std::string& boneId, float time)
-		{
-			const std::vector<Vec3KeyFrame>& oneScaleKeyFrames = scaleKeyFrames[boneId];
-
-			if (oneScaleKeyFrames.size() == 1 || time <= oneScaleKeyFrames[0].time)
-			{
-				return oneScaleKeyFrames[0].value;
-			}
-			else if (time >= oneScaleKeyFrames[oneScaleKeyFrames.size() - 1].time)
-			{
-				return oneScaleKeyFrames[oneScaleKeyFrames.size() - 1].value;
-			}
-
-			int index = determineIndex(boneId, time);
-
-			// ⊮Ɏg2̒l
-			const Vec3KeyFrame& from = scaleKeyFrames[boneId][index];
-			const Vec3KeyFrame& to = scaleKeyFrames[boneId][index + 1];
-
-			// ⊮p[^
-			float t = (time - from.time) / (from.time - to.time);
-			return from.value + (to.value - from.value) * t;
-		}
 	};
 
 	struct AnimationDatas {
@@ -408,6 +299,20 @@ namespace C3bLoader
 			resetData();
 		}
 
+		// ^CCƂ͌̂̂ŒuAÔ͉̂
+		void setAnimation(const std::string& name, AnimationData* animation)
+		{
+			std::map<std::string, AnimationData*>::iterator it = animations.find(name);
+			if (it != animations.end())
+			{
+				delete it->second;
+				it->second = animation;
+				return;
+			}
+
+			animations[name] = animation;
+		}
+
 		void resetData()
 		{
 			for (const auto& it : animations)
@@ -423,6 +328,11 @@ namespace C3bLoader
 	std::string loadC3t(const std::string& fileName, MeshDatas& outMeshDatas, MaterialDatas& outMaterialDatas, NodeDatas& outNodeDatas, AnimationDatas& outAnimationDatas);
 
 	std::string loadC3b(const std::string& fileName, MeshDatas& outMeshDatas, MaterialDatas& outMaterialDatas, NodeDatas& outNodeDatas, AnimationDatas& outAnimationDatas);
+
+	// _(VERTEX_ATTRIB_POSITIONȂ)float̗vf璸_Bcookedf̃[hŎg
+	MeshVertexAttribute createMeshVertexAttribute(const std::string& attributeName, size_t size);
+	// createMeshVertexAttribute̋tBΉ閼OȂ͋󕶎Ԃ
+	std::string getMeshVertexAttributeName(const MeshVertexAttribute& attrib);
 } // namespace C3bLoader
 
 } // namespace mgrrenderer
@@ -0,0 +1,66 @@
+#pragma once
+#include <cstddef>
+
+namespace mgrrenderer
+{
+
+// ModelCache::cookModelŏoAModelAsset}bvĂ̂܂܎gft@Č`
+// 擪HeaderAMeshEntry̕\ASubMeshEntry̕\A^f[^A_ƃCfbNX̃f[^̏ɕ
+// \ƒ_ACfbNX̃f[^DATA_ALIGNMENTɂ낦ĒûŁA}bvAhX\̂Ƃēǂ݁Â܂GPUɓ]ł
+// }eAA_AXPgAAj[V͏ϒȂ̂ŁA^f[^ƂBinaryReaderœǂŃRs[
+// ItZbg͑Săt@C擪̃oCgBo}VƓGfBAłǂ߂Ȃ
+namespace CookedModelFormat
+{
+	static const char MAGIC[4] = {'M', 'G', 'R', 'M'};
+	// `ςグBo[ẄႤt@C̓[hɍcook𑣂
+	// 2: obj̃TubṼeNX`ԍ}eA̔ԍeNX`̔ԍɕς
+	// 3: ^f[^ɃAt@eXg邩
+	static const unsigned int VERSION = 3;
+	static const size_t DATA_ALIGNMENT = 16;
+	// initWithFile͂̊gq̃t@CcookedfƂă[h
+	static const char* const EXTENSION = ".mgm";
+	static const int NO_DIFFUSE_TEXTURE = -1;
+
+	enum class ModelType : unsigned int
+	{
+		OBJ,
+		C3B,
+	};
+
+	struct Header
+	{
+		char magic[4];
+		unsigned int version;
+		ModelType modelType;
+		unsigned int numMeshes;
+		unsigned int meshTableOffset;
+		unsigned int numSubMeshes;
+		unsigned int subMeshTableOffset;
+		unsigned int metadataOffset;
+		unsigned int metadataByteSize;
+	};
+
+	struct MeshEntry
+	{
+		unsigned int vertexDataOffset;
+		unsigned int vertexDataByteSize;
+		// TubṼCfbNXÁBTubV̐擪4oCgEɂ낦Ă
+		unsigned int indexDataOffset;
+		unsigned int indexDataByteSize;
+		unsigned int firstSubMesh;
+		unsigned int numSubMeshes;
+	};
+
+	struct SubMeshEntry
+	{
+		// MeshEntry::indexDataOffset̃oCg
+		unsigned int indexOffset;
+		unsigned int numIndices;
+		// MeshIndices::Format
+		unsigned int format;
+		// ^f[^̃eNX`̔ԍBeNX`gȂTubVNO_DIFFUSE_TEXTURE
+		int diffuseTextureIndex;
+	};
+} // namespace CookedModelFormat
+
+} // namespace mgrrenderer
@@ -0,0 +1,75 @@
+#include "MeshSplitter.h"
+#include "utility/Logger.h"
+#include <cstdint>
+
+namespace mgrrenderer
+{
+
+namespace MeshSplitter
+{
+	void split(size_t numVertices, const std::vector<std::vector<unsigned int>>& subMeshIndices, size_t maxNumVertices, std::vector<Part>& outParts)
+	{
+		Logger::logAssert(maxNumVertices >= 3, "1̎Op`Ȃ_w肳ꂽB");
+
+		outParts.clear();
+		if (subMeshIndices.empty())
+		{
+			return;
+		}
+
+		// ̒_ԍ獡̃bVł̒_ԍւ̑ΉBpartIds̃bV̔ԍłȂ_͂܂ĂȂ
+		std::vector<unsigned int> remap(numVertices);
+		std::vector<size_t> partIds(numVertices, SIZE_MAX);
+
+		outParts.push_back(Part());
+		outParts.back().subMeshIndices.resize(subMeshIndices.size());
+
+		for (size_t subMeshIndex = 0; subMeshIndex < subMeshIndices.size(); ++subMeshIndex)
+		{
+			const std::vector<unsigned int>& indices = subMeshIndices[subMeshIndex];
+			Logger::logAssert(indices.size() % 3 == 0, "CfbNXOp`̒_̔{łȂB");
+
+			for (size_t i = 0; i + 2 < indices.size(); i += 3)
+			{
+				size_t partId = outParts.size() - 1;
+
+				// ̎Op`ŐV钸_B_2oĂkގOp`̂ŏd͐Ȃ
+				size_t numNewVertices = 0;
+				for (size_t corner = 0; corner < 3; ++corner)
+				{
+					unsigned int vertexIndex = indices[i + corner];
+					Logger::logAssert(vertexIndex < numVertices, "CfbNX̒l_𒴂B");
+					bool isNew = (partIds[vertexIndex] != partId);
+					for (size_t previous = 0; previous < corner; ++previous)
+					{
+						isNew = isNew && (indices[i + previous] != vertexIndex);
+					}
+					numNewVertices += isNew ? 1 : 0;
+				}
+
+				if (outParts.back().vertexIndices.size() + numNewVertices > maxNumVertices)
+				{
+					outParts.push_back(Part());
+					outParts.back().subMeshIndices.resize(subMeshIndices.size());
+					partId = outParts.size() - 1;
+				}
+
+				Part& part = outParts.back();
+				for (size_t corner = 0; corner < 3; ++corner)
+				{
+					unsigned int vertexIndex = indices[i + corner];
+					if (partIds[vertexIndex] != partId)
+					{
+						partIds[vertexIndex] = partId;
+						remap[vertexIndex] = static_cast<unsigned int>(part.vertexIndices.size());
+						part.vertexIndices.push_back(vertexIndex);
+					}
+
+					part.subMeshIndices[subMeshIndex].push_back(remap[vertexIndex]);
+				}
+			}
+		}
+	}
+} // namespace MeshSplitter
+
+} // namespace mgrrenderer
@@ -0,0 +1,26 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// _̑bVA16bitCfbNXŕ`钸_Ƃ̃bVɕ
+// _16bitɎ܂ȂbV32bitCfbNXŕ`邪A΃CfbNX̑ш͔ōς
+namespace MeshSplitter
+{
+	// 1bVB_͌̃bV̒_ԍŎ̂ŁA_f[^͌ĂяoŏW߂
+	struct Part
+	{
+		// ̃bV̒_ԍ猳̒_ԍւ̑Ή
+		std::vector<unsigned int> vertexIndices;
+		// ̃TubVƓтŁÃbV̒_ԍɂCfbNXBOp`ȂTubV͋ɂȂ
+		std::vector<std::vector<unsigned int>> subMeshIndices;
+	};
+
+	// Op`̏Ԃۂ܂ܐ擪l߂ĂA_maxNumVertices𒴂Op`Ŏ̃bVɐ؂ւ
+	// Op`܂ŋLĂ钸_́A؂ւ̃bVɂ
+	void split(size_t numVertices, const std::vector<std::vector<unsigned int>>& subMeshIndices, size_t maxNumVertices, std::vector<Part>& outParts);
+} // namespace MeshSplitter
+
+} // namespace mgrrenderer
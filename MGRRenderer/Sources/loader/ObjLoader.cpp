@@ -1,4 +1,11 @@
 #include "ObjLoader.h"
+#include "utility/JobScheduler.h"
+#include "utility/MappedFile.h"
+#include "utility/Profiler.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstring>
 #include <sstream>
 
 namespace mgrrenderer
@@ -6,90 +13,304 @@ namespace mgrrenderer
 
 namespace ObjLoader
 {
-	static const size_t SSCANF_BUFFER_SIZE = 4096;
+	// 1WuŃp[Xt@C̑傫̖ڈBt@C1WuŒɃp[X
+	static const size_t NUM_BYTES_PER_CHUNK = 256 * 1024;
+	// vtvnȗĂ邱Ƃ\CfbNX
+	static const unsigned int MISSING_INDEX = UINT_MAX;
+	// VertexIndexHashTable̋󂫃Xbg̒l
+	static const unsigned int EMPTY_SLOT = UINT_MAX;
 
 	struct VertexIndex {
-		size_t vIdx;
-		size_t vtIdx;
-		size_t vnIdx;
+		unsigned int vIdx;
+		unsigned int vtIdx;
+		unsigned int vnIdx;
 
-		VertexIndex() {};
-		VertexIndex(size_t idx) : vIdx(idx), vtIdx(idx), vnIdx(idx) {};
-		VertexIndex(size_t vIdxVal, size_t vtIdxVal, size_t vnIdxVal) : vIdx(vIdxVal), vtIdx(vtIdxVal), vnIdx(vnIdxVal) {};
+		bool operator==(const VertexIndex& another) const
+		{
+			return vIdx == another.vIdx && vtIdx == another.vtIdx && vnIdx == another.vnIdx;
+		}
+	};
 
-		// std::map̃ev[gŎw肷^operator<̒`Kv
-		bool operator<(const VertexIndex& another) const
+	// VertexIndex璸_z̃CfbNXJԒn@̃nbVe[u
+	// std::mapƈႢvfƂ̃mۂȂ̂ŁA_̑bVłd̏
+	class VertexIndexHashTable
+	{
+	public:
+		// o^vf̏A܂ȉɂȂ傫mۂ
+		explicit VertexIndexHashTable(size_t maxNumElements)
 		{
-			// vIdx, vnIdx, vtIdx̏ɔr
-			if (vIdx != another.vIdx)
+			size_t capacity = 16;
+			while (capacity < maxNumElements * 2)
 			{
-				return vIdx < another.vIdx;
+				capacity *= 2;
 			}
-			else if (vnIdx != another.vnIdx)
-			{
-				return vnIdx < another.vnIdx;
-			}
-			else if (vtIdx != another.vtIdx)
+
+			_keys.resize(capacity);
+			_values.resize(capacity, EMPTY_SLOT);
+			_mask = capacity - 1;
+		}
+
+		// keyo^Ă΂̒lԂBȂvalueo^valueԂ
+		unsigned int findOrInsert(const VertexIndex& key, unsigned int value)
+		{
+			size_t slot = hash(key) & _mask;
+			while (_values[slot] != EMPTY_SLOT)
 			{
-				return vtIdx < another.vtIdx;
+				if (_keys[slot] == key)
+				{
+					return _values[slot];
+				}
+
+				slot = (slot + 1) & _mask;
 			}
 
-			return false;
+			_keys[slot] = key;
+			_values[slot] = value;
+			return value;
 		}
+
+	private:
+		std::vector<VertexIndex> _keys;
+		std::vector<unsigned int> _values;
+		size_t _mask;
+
+		static size_t hash(const VertexIndex& key)
+		{
+			// ׂ荇CfbNXXbgɏW܂Ȃ悤ɍ
+			unsigned int h = key.vIdx * 0x9E3779B1u;
+			h ^= key.vtIdx * 0x85EBCA77u + (h << 6) + (h >> 2);
+			h ^= key.vnIdx * 0xC2B2AE3Du + (h << 6) + (h >> 2);
+			h ^= h >> 15;
+			return h;
+		}
+	};
+
+	enum class CommandType : int
+	{
+		GROUP,
+		OBJECT,
+		USE_MATERIAL,
+		MATERIAL_LIBRARY,
+	};
+
+	// p[XɌfȊO̖߁BfƂ̑O֌WnumTriangleCornersŕ\
+	struct Command
+	{
+		CommandType type;
+		std::string argument;
+		// ̖߂OɂfOp`ɕ_
+		size_t numTriangleCorners;
+	};
+
+	// t@Cs̋؂ŕAɃp[X1
+	struct Chunk
+	{
+		const char* begin;
+		const char* end;
+		size_t numPositions;
+		size_t numTextureCoordinates;
+		size_t numNormals;
+		// ̋ԂOɂvAvtAvn̐BŜ̔zւ݈̏ʒuƁA΃CfbNX̉Ɏg
+		size_t positionOffset;
+		size_t textureCoordinateOffset;
+		size_t normalOffset;
+		// fTRIANGLE_FAN`ŎOp`ɕ́B31̎Op`
+		std::vector<VertexIndex> triangleCorners;
+		std::vector<Command> commands;
+	};
+
+	// 1MeshDataɂȂf̕сBgAoAusemtlŋ؂Ap[X̋Ԃ܂Ƃ
+	struct FaceGroup
+	{
+		std::string name;
+		int materialIndex;
+		std::vector<std::pair<const VertexIndex*, const VertexIndex*>> ranges;
+		size_t numTriangleCorners;
 	};
 
 	static bool isSpace(const char c) { return (c == ' ' || c == '\t'); };
-	static bool isNewLine(const char c) { return (c == '\r' || c == '\n' || c == '\0'); };
+	static bool isDigit(const char c) { return (c >= '0' && c <= '9'); };
 
-	static float parseFloat(const char*& token)
+	// szʒu͍sƓ'\0'ƂĈ
+	static char charAt(const char* token, const char* end, size_t offset)
 	{
-		token += strspn(token, " \t");
-		//const char* end = token + strcspn(token, " \t\r");
-		// TODO:ȂcocosatofgȂvH+3.1417e+2݂ȋLqĂ邩H
-		// TODO:monguri:Ԃ񂻂Batofg`ɏC悤
-		// http://www.orchid.co.jp/computer/cschool/CREF/atof.html 
-		//double val = parseDouble(token, end);
-		//token = end;
-		//return static_cast<float>(val);
-		// TODO:cocosł͎Odoublep[XĂȂH
-		size_t len = strcspn(token, " \t\r");
-		std::string floatStr(token, len);
-		token += len;
-		float ret = static_cast<float>(atof(floatStr.c_str()));
-		return ret;
+		return (token + offset < end) ? token[offset] : '\0';
+	}
+
+	static const char* skipSpace(const char* token, const char* end)
+	{
+		while (token < end && isSpace(*token))
+		{
+			++token;
+		}
+		return token;
 	}
 
-	static Vec2 parseVec2(const char*& token)
+	static const char* skipToken(const char* token, const char* end)
 	{
-		float x = parseFloat(token);
-		float y = parseFloat(token);
+		while (token < end && !isSpace(*token) && *token != '\r')
+		{
+			++token;
+		}
+		return token;
+	}
+
+	// [token, end)̐擪1s͈̔͂߁Atoken̍s̐擪ɐi߂Bs̉sR[h͊܂߂Ȃ
+	static void getLine(const char*& token, const char* end, const char*& outLineBegin, const char*& outLineEnd)
+	{
+		const char* newLine = static_cast<const char*>(memchr(token, '\n', static_cast<size_t>(end - token)));
+		outLineBegin = token;
+		outLineEnd = (newLine != nullptr) ? newLine : end;
+		token = (newLine != nullptr) ? newLine + 1 : end;
+
+		if (outLineEnd > outLineBegin && outLineEnd[-1] == '\r')
+		{
+			--outLineEnd;
+		}
+	}
+
+	// atofƓlԂAP[ɈˑA0I[̍쐬KvȂ
+	// 2^53ȉ10̎w22ȉȂAdouble1̏揜ZŐۂ߂lɂȂBȊOpowŋߎ
+	static float parseFloat(const char*& token, const char* end)
+	{
+		static const double POWERS_OF_TEN[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+		};
+		// unsigned long longłӂȂ̌
+		static const int MAX_MANTISSA_DIGITS = 19;
+
+		token = skipSpace(token, end);
+		const char* p = token;
+
+		bool isNegative = false;
+		if (p < end && (*p == '+' || *p == '-'))
+		{
+			isNegative = (*p == '-');
+			++p;
+		}
+
+		unsigned long long mantissa = 0;
+		int numDigits = 0;
+		int exponent = 0;
+		while (p < end && isDigit(*p))
+		{
+			if (numDigits < MAX_MANTISSA_DIGITS)
+			{
+				mantissa = mantissa * 10 + (*p - '0');
+				numDigits += (mantissa != 0) ? 1 : 0;
+			}
+			else
+			{
+				++exponent;
+			}
+			++p;
+		}
+
+		if (p < end && *p == '.')
+		{
+			++p;
+			while (p < end && isDigit(*p))
+			{
+				if (numDigits < MAX_MANTISSA_DIGITS)
+				{
+					mantissa = mantissa * 10 + (*p - '0');
+					numDigits += (mantissa != 0) ? 1 : 0;
+					--exponent;
+				}
+				++p;
+			}
+		}
+
+		if (p < end && (*p == 'e' || *p == 'E'))
+		{
+			const char* q = p + 1;
+			bool isExponentNegative = false;
+			if (q < end && (*q == '+' || *q == '-'))
+			{
+				isExponentNegative = (*q == '-');
+				++q;
+			}
+
+			if (q < end && isDigit(*q))
+			{
+				int explicitExponent = 0;
+				while (q < end && isDigit(*q))
+				{
+					if (explicitExponent < 10000)
+					{
+						explicitExponent = explicitExponent * 10 + (*q - '0');
+					}
+					++q;
+				}
+
+				exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+				p = q;
+			}
+		}
+
+		double value;
+		if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+		{
+			value = (exponent < 0) ? static_cast<double>(mantissa) / POWERS_OF_TEN[-exponent] : static_cast<double>(mantissa) * POWERS_OF_TEN[exponent];
+		}
+		else
+		{
+			value = static_cast<double>(mantissa) * pow(10.0, exponent);
+		}
+
+		token = skipToken(p, end);
+		return static_cast<float>(isNegative ? -value : value);
+	}
+
+	static Vec2 parseVec2(const char*& token, const char* end)
+	{
+		float x = parseFloat(token, end);
+		float y = parseFloat(token, end);
 		return Vec2(x, y);
 	}
 
-	static Vec3 parseVec3(const char*& token)
+	static Vec3 parseVec3(const char*& token, const char* end)
 	{
-		float x = parseFloat(token);
-		float y = parseFloat(token);
-		float z = parseFloat(token);
+		float x = parseFloat(token, end);
+		float y = parseFloat(token, end);
+		float z = parseFloat(token, end);
 		return Vec3(x, y, z);
 	}
 
-	static std::string parseString(const char*& token)
+	static std::string parseString(const char*& token, const char* end)
 	{
-		std::string ret;
-		token += strspn(token, " \t");
-		size_t len = strcspn(token, " \t\r");
-		ret = std::string(token, &token[len]); //TODO:Atoken[len - 1]Ȃ́HāAtoken[len]" \t\r"̂ǂꂩȂ́H
-		token += len;
-		return ret;
+		token = skipSpace(token, end);
+		const char* begin = token;
+		token = skipToken(token, end);
+		return std::string(begin, token);
+	}
+
+	static int parseInt(const char*& token, const char* end)
+	{
+		bool isNegative = false;
+		if (token < end && (*token == '+' || *token == '-'))
+		{
+			isNegative = (*token == '-');
+			++token;
+		}
+
+		int ret = 0;
+		while (token < end && isDigit(*token))
+		{
+			ret = ret * 10 + (*token - '0');
+			++token;
+		}
+
+		return isNegative ? -ret : ret;
 	}
 
 	// Make index zero-base, and also support relative index.
-	static size_t fixIndexForArray(int idx, int size)
+	static unsigned int fixIndexForArray(int idx, size_t size)
 	{
 		if (idx > 0)
 		{
-			return static_cast<size_t>(idx - 1);
+			return static_cast<unsigned int>(idx - 1);
 		}
 		else if (idx == 0)
 		{
@@ -97,175 +318,246 @@ namespace ObjLoader
 		}
 		else // idx < 0
 		{
-			Logger::logAssert(size + idx >= 0, "objt@CŃTCY傫ȕ̒lꂽB");
-			return static_cast<size_t>(size + idx); // relative idx
+			Logger::logAssert(static_cast<long long>(size) + idx >= 0, "objt@CŃTCY傫ȕ̒lꂽB");
+			return static_cast<unsigned int>(size + idx); // relative idx
 		}
 	}
 
 	// Parse triples: i, i/j/k, i//k, i/j
-	static VertexIndex parseVertexIndex(const char*& token, int vsize, int vnsize, int vtsize)
+	static VertexIndex parseVertexIndex(const char*& token, const char* end, size_t vsize, size_t vtsize, size_t vnsize)
 	{
 		VertexIndex ret;
+		ret.vIdx = fixIndexForArray(parseInt(token, end), vsize);
+		ret.vtIdx = MISSING_INDEX;
+		ret.vnIdx = MISSING_INDEX;
 
-		ret.vIdx = fixIndexForArray(atoi(token), vsize);
-		token += strcspn(token, "/ \t\r");
-		if (token[0] != '/')
+		if (charAt(token, end, 0) != '/')
 		{
 			return ret;
 		}
 		token++;
 
 		// i//k
-		if (token[0] == '/')
+		if (charAt(token, end, 0) == '/')
 		{
 			token++;
-			ret.vnIdx = fixIndexForArray(atoi(token), vnsize);
-			token += strcspn(token, "/ \t\r");
+			ret.vnIdx = fixIndexForArray(parseInt(token, end), vnsize);
 			return ret;
 		}
 
 		// i/j/k or i/j
-		ret.vtIdx = fixIndexForArray(atoi(token), vtsize);
-		token += strcspn(token, "/ \t\r");
-		if (token[0] != '/')
+		ret.vtIdx = fixIndexForArray(parseInt(token, end), vtsize);
+		if (charAt(token, end, 0) != '/')
 		{
 			return ret;
 		}
 
 		// i/j/k
 		token++; // skip '/'
-		ret.vnIdx = fixIndexForArray(atoi(token), vnsize);
-		token += strcspn(token, "/ \t\r");
+		ret.vnIdx = fixIndexForArray(parseInt(token, end), vnsize);
 		return ret;
 	}
 
-	// ߂ĺAMeshData.positionsɓꂽvf̃CfbNXBAVertexIndexnormalstexcoordɂ͗vfȂB
-	// LbVɂłɓĂMeshDataɂ͒ǉÃCfbNXԂB
-	static unsigned int addOneVetexDataToMeshData(
-		std::map<VertexIndex, unsigned int> &vertexIndexPositionArrayIndexMap,
-		MeshData& mesh,
-		const std::vector<Vec3>& allPositions,
-		const std::vector<Vec3>& allNormals,
-		const std::vector<Vec2>& allTexCoords,
-		const VertexIndex& vi
-		) // static\bhɂăNXIɈȂƁAp͂ȂǂǂĂ񂾂ȁBB
+	// s̎ނvAvtAvn̐𐔂BeԂ݈̏ʒu߂邽߂ɁAp[X̑OɑSԂōs
+	static void countVertexElements(Chunk& chunk)
 	{
-		const std::map<VertexIndex, unsigned int>::iterator& it = vertexIndexPositionArrayIndexMap.find(vi);
-		if (it != vertexIndexPositionArrayIndexMap.end())
-		{
-			// LbVɃqbg炻̃CfbNXԂBɂāACfbNX`ɂĂB
-			return it->second;
-		}
+		chunk.numPositions = 0;
+		chunk.numTextureCoordinates = 0;
+		chunk.numNormals = 0;
 
-		Logger::logAssert(allPositions.size() > vi.vIdx, "CfbNX̒lz񐔂𒴂B");
-		Logger::logAssert(allNormals.size() > vi.vnIdx, "CfbNX̒lz񐔂𒴂B");
-		Logger::logAssert(allTexCoords.size() > vi.vtIdx, "CfbNX̒lz񐔂𒴂B");
+		const char* token = chunk.begin;
+		while (token < chunk.end)
+		{
+			const char* lineBegin;
+			const char* lineEnd;
+			getLine(token, chunk.end, lineBegin, lineEnd);
+			lineBegin = skipSpace(lineBegin, lineEnd);
 
-		Position3DNormalTextureCoordinates vertex;
-		vertex.position = allPositions[vi.vIdx];
+			if (charAt(lineBegin, lineEnd, 0) != 'v')
+			{
+				continue;
+			}
 
-		if (vi.vnIdx >= 0) // facenormal͕KƂ͌Ȃ
-		{
-			vertex.normal = allNormals[vi.vnIdx];
+			char c = charAt(lineBegin, lineEnd, 1);
+			if (isSpace(c))
+			{
+				++chunk.numPositions;
+			}
+			else if (c == 't' && isSpace(charAt(lineBegin, lineEnd, 2)))
+			{
+				++chunk.numTextureCoordinates;
+			}
+			else if (c == 'n' && isSpace(charAt(lineBegin, lineEnd, 2)))
+			{
+				++chunk.numNormals;
+			}
 		}
-		else
+	}
+
+	// Ԃp[XAvAvtAvn͑Ŝ̔z̋Ԃ̈ʒuɒڏށBȊO͋Ԃ̒ɏɒ߂
+	static void parseChunk(Chunk& chunk, std::vector<Vec3>& allPositions, std::vector<Vec2>& allTexCoords, std::vector<Vec3>& allNormals)
+	{
+		size_t numPositions = chunk.positionOffset;
+		size_t numTexCoords = chunk.textureCoordinateOffset;
+		size_t numNormals = chunk.normalOffset;
+		std::vector<VertexIndex> face;
+
+		const char* token = chunk.begin;
+		while (token < chunk.end)
 		{
-			Logger::logAssert(false, "AvnCfbNX̏ȗɂ͖Ή");
-		}
+			const char* lineBegin;
+			const char* lineEnd;
+			getLine(token, chunk.end, lineBegin, lineEnd);
 
-		Logger::logAssert(vi.vtIdx >= 0, "AvtCfbNX̏ȗɂ͖Ή");
-		vertex.textureCoordinate = allTexCoords[vi.vtIdx];
+			// Skip leading space.
+			const char* lineToken = skipSpace(lineBegin, lineEnd);
+			if (lineToken == lineEnd)
+			{
+				continue; // empty line
+			}
+
+			if (lineToken[0] == '#')
+			{
+				continue; // comment line
+			}
+
+			// vertex
+			if (lineToken[0] == 'v' && isSpace(charAt(lineToken, lineEnd, 1)))
+			{
+				lineToken += 2;
+				allPositions[numPositions++] = parseVec3(lineToken, lineEnd);
+			}
+			// normal
+			else if (lineToken[0] == 'v' && charAt(lineToken, lineEnd, 1) == 'n' && isSpace(charAt(lineToken, lineEnd, 2)))
+			{
+				lineToken += 3;
+				allNormals[numNormals++] = parseVec3(lineToken, lineEnd);
+			}
+			// texture coordinate
+			else if (lineToken[0] == 'v' && charAt(lineToken, lineEnd, 1) == 't' && isSpace(charAt(lineToken, lineEnd, 2)))
+			{
+				lineToken += 3;
+				allTexCoords[numTexCoords++] = parseVec2(lineToken, lineEnd);
+			}
+			// face
+			else if (lineToken[0] == 'f' && isSpace(charAt(lineToken, lineEnd, 1)))
+			{
+				lineToken += 2;
+				lineToken = skipSpace(lineToken, lineEnd);
+
+				// f̏ꍇnp`|S̏ꍇnł̂Ń[vłׂĂƂ
+				face.clear();
+				while (lineToken < lineEnd)
+				{
+					face.push_back(parseVertexIndex(lineToken, lineEnd, numPositions, numTexCoords, numNormals));
+					// ߂łȂcĂ玟̋؂܂œǂݔ΂
+					lineToken = skipToken(lineToken, lineEnd);
+					while (lineToken < lineEnd && (isSpace(*lineToken) || *lineToken == '\r'))
+					{
+						++lineToken;
+					}
+				}
 
-		mesh.vertices.push_back(vertex);
+				// |STRIANGLE_FAN`3p`ɕ
+				for (size_t i = 2; i < face.size(); i++)
+				{
+					chunk.triangleCorners.push_back(face[0]);
+					chunk.triangleCorners.push_back(face[i - 1]);
+					chunk.triangleCorners.push_back(face[i]);
+				}
+			}
+			// use mtl
+			else if (lineEnd - lineToken > 6 && strncmp(lineToken, "usemtl", 6) == 0 && isSpace(lineToken[6]))
+			{
+				lineToken += 7;
+				Command command = {CommandType::USE_MATERIAL, parseString(lineToken, lineEnd), chunk.triangleCorners.size()};
+				chunk.commands.push_back(command);
+			}
+			// load mtl
+			else if (lineEnd - lineToken > 6 && strncmp(lineToken, "mtllib", 6) == 0 && isSpace(lineToken[6]))
+			{
+				lineToken += 7;
+				Command command = {CommandType::MATERIAL_LIBRARY, parseString(lineToken, lineEnd), chunk.triangleCorners.size()};
+				chunk.commands.push_back(command);
+			}
+			// group name
+			else if (lineToken[0] == 'g' && isSpace(charAt(lineToken, lineEnd, 1)))
+			{
+				// tinyobjloaderƂtokeni߂ĂȂBggnames[0]Ƃē炵
+				lineToken += 2;
 
-		unsigned int idxOfPositions = mesh.vertices.size() - 1;
-		// LbVɓĂ
-		vertexIndexPositionArrayIndexMap[vi] = idxOfPositions;
-		return idxOfPositions;
+				// ̖OłĂ擪̖Og
+				const std::string& name = parseString(lineToken, lineEnd);
+				Logger::logAssert(!name.empty(), "objg̃tH[}bg");
+				Command command = {CommandType::GROUP, name, chunk.triangleCorners.size()};
+				chunk.commands.push_back(command);
+			}
+			// object name
+			else if (lineToken[0] == 'o' && isSpace(charAt(lineToken, lineEnd, 1)))
+			{
+				lineToken += 2;
+				Command command = {CommandType::OBJECT, parseString(lineToken, lineEnd), chunk.triangleCorners.size()};
+				chunk.commands.push_back(command);
+			}
+			// Ignore unknown command.
+		}
 	}
 
-	static bool createMeshDataFromFaceGroup(
-		MeshData& mesh,
-		std::map<VertexIndex, unsigned int> vertexIndexPositionsArrayIndexMap,
+	// CfbNXkꂽf[^LMeshDataBd钸_̓O[v̒ł܂Ƃ߂
+	static void createMeshDataFromFaceGroup(
+		const FaceGroup& faceGroup,
 		const std::vector<Vec3>& allPositions,
 		const std::vector<Vec3>& allNormals,
 		const std::vector<Vec2>& allTexCoords,
-		const std::vector<std::vector<VertexIndex>>& faceGroup,
-		const int materialIndex,
-		const std::string& name,
-		bool clearCache
+		MeshData& mesh
 		)
 	{
-		if (faceGroup.empty())
-		{
-			return false;
-		}
+		VertexIndexHashTable vertexIndexTable(faceGroup.numTriangleCorners);
+		mesh.indices.reserve(faceGroup.numTriangleCorners);
+		mesh.materialIndices.reserve(faceGroup.numTriangleCorners / 3);
 
-		// CfbNXkꂽf[^LMeshData
-		for (const std::vector<VertexIndex>& face : faceGroup)
+		for (const std::pair<const VertexIndex*, const VertexIndex*>& range : faceGroup.ranges)
 		{
-			// |STRIANGLE_FAN`3p`ɕĂAMeshDataPNT̔zɓĂ
-			// łvi0Ă邩Af[^̎ƂĂTRIANGLESƓŏdĒ_Ă
-
-			// ̃[v̂߂̏l
-			VertexIndex vi0 = face[0];
-			VertexIndex vi1;
-			VertexIndex vi2 = face[1];
-
-			size_t numPolys = face.size();
-			for (size_t i = 2; i < numPolys; i++)
+			for (const VertexIndex* vi = range.first; vi != range.second; ++vi)
 			{
-				vi1 = vi2;
-				vi2 = face[i];
-
-				unsigned int idx0 = addOneVetexDataToMeshData(
-					vertexIndexPositionsArrayIndexMap,
-					mesh,
-					allPositions,
-					allNormals,
-					allTexCoords,
-					vi0
-					);
-				mesh.indices.push_back(static_cast<unsigned short>(idx0));
-
-				unsigned int idx1 = addOneVetexDataToMeshData(
-					vertexIndexPositionsArrayIndexMap,
-					mesh,
-					allPositions,
-					allNormals,
-					allTexCoords,
-					vi1
-					);
-				mesh.indices.push_back(static_cast<unsigned short>(idx1));
-
-				unsigned int idx2 = addOneVetexDataToMeshData(
-					vertexIndexPositionsArrayIndexMap,
-					mesh,
-					allPositions,
-					allNormals,
-					allTexCoords,
-					vi2
-					);
-				mesh.indices.push_back(static_cast<unsigned short>(idx2));
+				unsigned int numVertices = static_cast<unsigned int>(mesh.vertices.size());
+				unsigned int index = vertexIndexTable.findOrInsert(*vi, numVertices);
+				if (index == numVertices)
+				{
+					// ߂ďoĂgݍ킹Ȃ̂Œ_ǉ
+					Logger::logAssert(vi->vtIdx != MISSING_INDEX, "AvtCfbNX̏ȗɂ͖Ή");
+					Logger::logAssert(vi->vnIdx != MISSING_INDEX, "AvnCfbNX̏ȗɂ͖Ή");
+					Logger::logAssert(allPositions.size() > vi->vIdx, "CfbNX̒lz񐔂𒴂B");
+					Logger::logAssert(allNormals.size() > vi->vnIdx, "CfbNX̒lz񐔂𒴂B");
+					Logger::logAssert(allTexCoords.size() > vi->vtIdx, "CfbNX̒lz񐔂𒴂B");
+
+					mesh.vertices.push_back(Position3DNormalTextureCoordinates(allPositions[vi->vIdx], allNormals[vi->vnIdx], allTexCoords[vi->vtIdx]));
+				}
 
-				mesh.materialIndices.push_back(materialIndex); // e_ƂɃ}eAID
-				// TODO:AzɎ܂Ƃ߂mapȂȂȂ̃O[vɎĂ̂ł́B܂KPNTׂăf[^ƌȂ烁eʓIɂ͖ʂǁBB
+				mesh.indices.push_back(index);
 			}
 		}
 
-		mesh.name = name;
+		// eOp`ƂɃ}eAID
+		mesh.materialIndices.assign(mesh.indices.size() / 3, faceGroup.materialIndex);
+		mesh.name = faceGroup.name;
 		mesh.numMaterialIndex = mesh.materialIndices.size();
 
-		if (clearCache)
+		// }eAƂɃTubVɕ
+		for (size_t i = 0; i < mesh.numMaterialIndex; i++)
 		{
-			vertexIndexPositionsArrayIndexMap.clear();
+			std::vector<unsigned int>& subMeshIndices = mesh.subMeshMap[mesh.materialIndices[i]];
+			size_t index = i * 3;
+			subMeshIndices.push_back(mesh.indices[index]);
+			subMeshIndices.push_back(mesh.indices[index + 1]);
+			subMeshIndices.push_back(mesh.indices[index + 2]);
 		}
-
-		return true;
 	}
 
 	std::string loadMtl(const std::string& fileName, std::vector<MaterialData>& materials, std::map<std::string, int>& materialNameMaterialArrayIndexMap, const std::string& mtlBasePath)
 	{
+		MGRRENDERER_PROFILE_SCOPE("ObjLoader::loadMtl");
+
 		std::string filePath;
 
 		if (mtlBasePath.empty())
@@ -323,6 +615,7 @@ namespace ObjLoader
 
 			// Skip leading space.
 			const char* token = lineBuf.c_str();
+			const char* lineEnd = token + lineBuf.size();
 			token += strspn(token, " \t");
 
 			Logger::logAssert(token != nullptr, "g[N̎擾s");
@@ -347,66 +640,65 @@ namespace ObjLoader
 					materials.push_back(material);
 				}
 
-				char nameBuf[SSCANF_BUFFER_SIZE];
 				token += 7;
-				sscanf_s(token, "%s", nameBuf, _countof(nameBuf));
+				const std::string& name = parseString(token, lineEnd);
 
 				material = MaterialData();
-				material.name = nameBuf;
+				material.name = name;
 			}
 			// ambient
 			else if (token[0] == 'K' && token[1] == 'a' && isSpace(token[2]))
 			{
 				token += 2;
-				material.ambient = parseVec3(token);
+				material.ambient = parseVec3(token, lineEnd);
 			}
 			// diffuse
 			else if (token[0] == 'K' && token[1] == 'd' && isSpace(token[2]))
 			{
 				token += 2;
-				material.diffuse = parseVec3(token);
+				material.diffuse = parseVec3(token, lineEnd);
 			}
 			// specular
 			else if (token[0] == 'K' && token[1] == 's' && isSpace(token[2]))
 			{
 				token += 2;
-				material.specular = parseVec3(token);
+				material.specular = parseVec3(token, lineEnd);
 			}
 			// transmittance
 			else if (token[0] == 'K' && token[1] == 't' && isSpace(token[2]))
 			{
 				token += 2;
-				material.transmittance = parseVec3(token);
+				material.transmittance = parseVec3(token, lineEnd);
 			}
 			// index of refraction
 			else if (token[0] == 'N' && token[1] == 'i' && isSpace(token[2]))
 			{
 				token += 2;
-				material.indexOfRefraction = parseFloat(token);
+				material.indexOfRefraction = parseFloat(token, lineEnd);
 			}
 			// emission
 			else if (token[0] == 'K' && token[1] == 'e' && isSpace(token[2]))
 			{
 				token += 2;
-				material.emission = parseVec3(token);
+				material.emission = parseVec3(token, lineEnd);
 			}
 			// shinness
 			else if (token[0] == 'N' && token[1] == 's' && isSpace(token[2]))
 			{
 				token += 2;
-				material.shinness = parseFloat(token);
+				material.shinness = parseFloat(token, lineEnd);
 			}
 			// illumination model
 			else if (strncmp(token, "illum", 5) == 0 && isSpace(token[5]))
 			{
 				token += 6;
-				material.illumination = parseFloat(token);
+				material.illumination = parseFloat(token, lineEnd);
 			}
 			// dissolve
 			else if (token[0] == 'T' && token[1] == 'r' && isSpace(token[2]))
 			{
 				token += 2;
-				material.dissolve = 1.0f - parseFloat(token);
+				material.dissolve = 1.0f - parseFloat(token, lineEnd);
 			}
 			// ambient texture
 			else if (strncmp(token, "map_Ka", 6) == 0 && isSpace(token[6]))
@@ -432,6 +724,12 @@ namespace ObjLoader
 				token += 7;
 				material.normalTextureName = FileUtility::convertPathFormatToUnixStyle(token);
 			}
+			// alpha texture
+			else if (strncmp(token, "map_d", 5) == 0 && isSpace(token[5]))
+			{
+				token += 6;
+				material.alphaTextureName = FileUtility::convertPathFormatToUnixStyle(token);
+			}
 			// unknown parameter
 			// TODO:monguri:loadObjłunknownɂ͑ΉĂȂ̂ɂȂloadMtlH
 			else
@@ -459,12 +757,14 @@ namespace ObjLoader
 
 	std::string loadObj(const std::string& fileName, std::vector<MeshData>& outMeshArray, std::vector<MaterialData>& outMaterialArray)
 	{
+		MGRRENDERER_PROFILE_SCOPE("ObjLoader::loadObj");
+
 		outMeshArray.clear();
 		outMaterialArray.clear();
 
 		std::stringstream err;
-		std::istringstream fstream(FileUtility::getInstance()->getStringFromFile(fileName));
-		if (!fstream) //TODO: istringstrema͉^Ȃ񂾁H
+		MappedFile file;
+		if (!file.open(fileName))
 		{
 			err << "Cannot open file [" << fileName << "]" << std::endl;
 			return err.str();
@@ -473,260 +773,143 @@ namespace ObjLoader
 		const std::string& fullPath = FileUtility::getInstance()->getFullPathForFileName(fileName);
 		const std::string& mtlBasePath = fullPath.substr(0, fullPath.find_last_of("\\/") + 1);
 
-		std::vector<Vec3> vertexArray;
-		std::vector<Vec2> textureCoordinateArray;
-		std::vector<Vec3> normalVertexArray;
+		//
+		// t@Cs̋؂ŋԂɕ
+		//
+		const char* fileBegin = reinterpret_cast<const char*>(file.getData());
+		const char* fileEnd = fileBegin + file.getSize();
+		size_t numChunks = std::max(file.getSize() / NUM_BYTES_PER_CHUNK, static_cast<size_t>(1));
 
-		std::vector<std::vector<VertexIndex>> faceGroup;
-		std::string name;
-
-		// material
-		std::map<std::string, int> materialNameMaterialArrayIndexMap;
-		std::map<VertexIndex, unsigned int> vertexIndexPositionsArrayIndexMap;
-		int materialIndex = -1;
-
-		MeshData mesh;
-
-		int MAX_CHARS = 8192;
-		std::vector<char> buf(MAX_CHARS);
-
-		while (fstream.peek() != -1)
+		std::vector<Chunk> chunks(numChunks);
+		const char* chunkBegin = fileBegin;
+		for (size_t i = 0; i < numChunks; ++i)
 		{
-			fstream.getline(&buf[0], MAX_CHARS);
-
-			std::string lineBuf(&buf[0]);
-
-			// Trim newline '\r\n' or '\n'
-			size_t size = lineBuf.size();
-			if (size > 0)
+			const char* chunkEnd = fileEnd;
+			if (i + 1 < numChunks)
 			{
-				if (lineBuf[size - 1] == '\n')
-				{
-					lineBuf.erase(size - 1);
-				}
-			}
-			size = lineBuf.size();
-			if (size > 0)
-			{
-				if (lineBuf[size - 1] == '\r')
-				{
-					lineBuf.erase(size - 1);
-				}
+				// Ԃ̋Ẻš܂ł炵AsԂ܂Ȃ悤ɂ
+				chunkEnd = std::max(chunkBegin, fileBegin + file.getSize() / numChunks * (i + 1));
+				const char* newLine = static_cast<const char*>(memchr(chunkEnd, '\n', static_cast<size_t>(fileEnd - chunkEnd)));
+				chunkEnd = (newLine != nullptr) ? newLine + 1 : fileEnd;
 			}
 
-			// Skip if empty line.
-			if (lineBuf.empty())
-			{
-				continue;
-			}
+			chunks[i].begin = chunkBegin;
+			chunks[i].end = chunkEnd;
+			chunkBegin = chunkEnd;
+		}
 
-			// Skip leading space.
-			const char* token = lineBuf.c_str();
-			token += strspn(token, " \t");
+		//
+		// vAvtAvn𐔂ĊeԂ݈̏ʒu߂ĂASԂɃp[X
+		//
+		JobScheduler::getInstance()->parallelFor(numChunks, [&chunks](size_t chunkIndex)
+		{
+			countVertexElements(chunks[chunkIndex]);
+		});
 
-			Logger::logAssert(token != nullptr, "Xy[X̍s͖{͂Ȃ͂");
+		size_t numPositions = 0;
+		size_t numTexCoords = 0;
+		size_t numNormals = 0;
+		for (Chunk& chunk : chunks)
+		{
+			chunk.positionOffset = numPositions;
+			chunk.textureCoordinateOffset = numTexCoords;
+			chunk.normalOffset = numNormals;
+			numPositions += chunk.numPositions;
+			numTexCoords += chunk.numTextureCoordinates;
+			numNormals += chunk.numNormals;
+		}
 
-			if (token[0] == '\0')
-			{
-				continue; // empty line
-			}
+		Logger::logAssert(numPositions < MISSING_INDEX && numTexCoords < MISSING_INDEX && numNormals < MISSING_INDEX, "obj̒_vf");
 
-			if (token[0] == '#')
-			{
-				continue; // comment line
-			}
+		std::vector<Vec3> vertexArray(numPositions);
+		std::vector<Vec2> textureCoordinateArray(numTexCoords);
+		std::vector<Vec3> normalVertexArray(numNormals);
 
-			// vertex
-			if (token[0] == 'v' && isSpace(token[1]))
-			{
-				token += 2;
-				const Vec3& vec = parseVec3(token);
-				vertexArray.push_back(vec);
-			}
-			// normal
-			else if (token[0] == 'v' && token[1] == 'n' && isSpace(token[2]))
-			{
-				token += 3;
-				const Vec3& vec = parseVec3(token);
-				normalVertexArray.push_back(vec);
-			}
-			// texture coordinate
-			else if (token[0] == 'v' && token[1] == 't' && isSpace(token[2]))
-			{
-				token += 3;
-				const Vec2& vec = parseVec2(token);
-				textureCoordinateArray.push_back(vec);
-			}
-			// face
-			else if (token[0] == 'f' && isSpace(token[1]))
-			{
-				token += 2;
-				token += strspn(token, " \t");
+		JobScheduler::getInstance()->parallelFor(numChunks, [&](size_t chunkIndex)
+		{
+			parseChunk(chunks[chunkIndex], vertexArray, textureCoordinateArray, normalVertexArray);
+		});
 
-				// f̏ꍇnp`|S̏ꍇnł̂Ń[vłׂĂƂ
-				std::vector<VertexIndex> face;
-				while (!isNewLine(token[0]))
-				{
-					VertexIndex vi = parseVertexIndex(token, vertexArray.size(), textureCoordinateArray.size(), normalVertexArray.size());
-					face.push_back(vi);
-					token += strspn(token, " \t\r");
-				}
+		//
+		// fȊO̖߂t@C̏ɏAfMeshDataPʂ̃O[vɕ
+		//
+		std::map<std::string, int> materialNameMaterialArrayIndexMap;
+		std::vector<FaceGroup> faceGroups;
+		FaceGroup faceGroup;
+		faceGroup.numTriangleCorners = 0;
+		std::string name;
+		int materialIndex = -1;
 
-				faceGroup.push_back(face);
-			}
-			// use mtl
-			else if (strncmp(token, "usemtl", 6) == 0 && isSpace(token[6]))
+		for (const Chunk& chunk : chunks)
+		{
+			size_t numTriangleCorners = 0;
+			for (size_t i = 0; i <= chunk.commands.size(); ++i)
 			{
-				char nameBuf[SSCANF_BUFFER_SIZE];
-				token += 7;
-
-				sscanf_s(token, "%s", nameBuf, _countof(nameBuf));
-
-				bool ret = createMeshDataFromFaceGroup(
-					mesh,
-					vertexIndexPositionsArrayIndexMap,
-					vertexArray,
-					normalVertexArray,
-					textureCoordinateArray,
-					faceGroup,
-					materialIndex,
-					name,
-					true
-					);
-
-				if (ret)
+				// O̖߂炱̖߂܂łf̃O[vɓ
+				size_t nextNumTriangleCorners = (i < chunk.commands.size()) ? chunk.commands[i].numTriangleCorners : chunk.triangleCorners.size();
+				if (nextNumTriangleCorners > numTriangleCorners)
 				{
-					outMeshArray.push_back(mesh);
+					const VertexIndex* corners = chunk.triangleCorners.data();
+					faceGroup.ranges.push_back(std::make_pair(corners + numTriangleCorners, corners + nextNumTriangleCorners));
+					faceGroup.numTriangleCorners += nextNumTriangleCorners - numTriangleCorners;
+					numTriangleCorners = nextNumTriangleCorners;
 				}
 
-				mesh = MeshData(); // MeshDataϐpɍ蒼
-				faceGroup.clear();
-
-				if (materialNameMaterialArrayIndexMap.find(nameBuf) != materialNameMaterialArrayIndexMap.end())
+				if (i == chunk.commands.size())
 				{
-					materialIndex = materialNameMaterialArrayIndexMap[nameBuf];
+					break;
 				}
-				else
-				{
-					// { error!! material not found }
-					materialIndex = -1;
-				}
-			}
-			// load mtl
-			else if (strncmp(token, "mtllib", 6) == 0 && isSpace(token[6]))
-			{
-				char fileNameBuf[SSCANF_BUFFER_SIZE];
-				token += 7;
 
-				sscanf_s(token, "%s", fileNameBuf, _countof(fileNameBuf));
-
-				std::string errMtl = loadMtl(fileNameBuf, outMaterialArray, materialNameMaterialArrayIndexMap, mtlBasePath);
-				if (!errMtl.empty())
+				const Command& command = chunk.commands[i];
+				if (command.type == CommandType::MATERIAL_LIBRARY)
 				{
-					faceGroup.clear();
-					return errMtl;
+					std::string errMtl = loadMtl(command.argument, outMaterialArray, materialNameMaterialArrayIndexMap, mtlBasePath);
+					if (!errMtl.empty())
+					{
+						return errMtl;
+					}
+					continue;
 				}
-			}
-			// group name
-			else if (token[0] == 'g' && isSpace(token[1]))
-			{
-				// tinyobjloaderƂtokeni߂ĂȂBggnames[0]Ƃē炵
-				token += 2;
 
 				// flush previous face group.
-				bool ret = createMeshDataFromFaceGroup(
-					mesh,
-					vertexIndexPositionsArrayIndexMap,
-					vertexArray,
-					normalVertexArray,
-					textureCoordinateArray,
-					faceGroup,
-					materialIndex,
-					name,
-					true
-					);
-				if (ret)
+				if (faceGroup.numTriangleCorners > 0)
 				{
-					outMeshArray.push_back(mesh);
+					faceGroup.name = name;
+					faceGroup.materialIndex = materialIndex;
+					faceGroups.push_back(faceGroup);
 				}
+				faceGroup.ranges.clear();
+				faceGroup.numTriangleCorners = 0;
 
-				mesh = MeshData(); // MeshDataϐpɍ蒼
-				faceGroup.clear();
-
-				std::vector<std::string> names;
-				while (!isNewLine(token[0]))
+				if (command.type == CommandType::USE_MATERIAL)
 				{
-					std::string str = parseString(token);
-					names.push_back(str);
-					token += strspn(token, " \t\r");
+					std::map<std::string, int>::const_iterator it = materialNameMaterialArrayIndexMap.find(command.argument);
+					// { error!! material not found }
+					materialIndex = (it != materialNameMaterialArrayIndexMap.end()) ? it->second : -1;
 				}
-
-				Logger::logAssert(names.size() > 0, "objg̃tH[}bg");
-				name = names[0];
-			}
-			// object name
-			else if (token[0] == 'o' && isSpace(token[1]))
-			{
-				// flush previous face group.
-				bool ret = createMeshDataFromFaceGroup(
-					mesh,
-					vertexIndexPositionsArrayIndexMap,
-					vertexArray,
-					normalVertexArray,
-					textureCoordinateArray,
-					faceGroup,
-					materialIndex,
-					name,
-					true
-					);
-				if (ret)
+				else
 				{
-					outMeshArray.push_back(mesh);
+					name = command.argument;
 				}
-
-				mesh = MeshData(); // MeshDataϐpɍ蒼
-				faceGroup.clear();
-
-				char fileNameBuf[SSCANF_BUFFER_SIZE];
-				token += 2;
-
-				sscanf_s(token, "%s", fileNameBuf, _countof(fileNameBuf));
-				name = std::string(fileNameBuf);
 			}
-			// Ignore unknown command.
 		}
 
-		bool ret = createMeshDataFromFaceGroup(
-			mesh,
-			vertexIndexPositionsArrayIndexMap,
-			vertexArray,
-			normalVertexArray,
-			textureCoordinateArray,
-			faceGroup,
-			materialIndex,
-			name,
-			true
-			);
-		if (ret)
+		if (faceGroup.numTriangleCorners > 0)
 		{
-			outMeshArray.push_back(mesh);
+			faceGroup.name = name;
+			faceGroup.materialIndex = materialIndex;
+			faceGroups.push_back(faceGroup);
 		}
 
-		// }eAƂɃTubVɕ
-		std::map<int, std::vector<unsigned short>> subMeshMap;
-		for (MeshData& meshData : outMeshArray)
+		//
+		// O[vƂɓƗĂ̂ŁAMeshDataɍ
+		//
+		outMeshArray.resize(faceGroups.size());
+		JobScheduler::getInstance()->parallelFor(faceGroups.size(), [&](size_t groupIndex)
 		{
-			for (size_t i = 0; i < meshData.numMaterialIndex; i++)
-			{
-				int materialId = meshData.materialIndices[i];
-				size_t index = i * 3;
-				meshData.subMeshMap[materialId].push_back(meshData.indices[index]);
-				meshData.subMeshMap[materialId].push_back(meshData.indices[index + 1]);
-				meshData.subMeshMap[materialId].push_back(meshData.indices[index + 2]);
-			}
-		}
+			createMeshDataFromFaceGroup(faceGroups[groupIndex], vertexArray, normalVertexArray, textureCoordinateArray, outMeshArray[groupIndex]);
+		});
 
-		faceGroup.clear();
 		return err.str();
 	}
 
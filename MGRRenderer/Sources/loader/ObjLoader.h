@@ -16,13 +16,13 @@ namespace ObjLoader
 		//typedef std::vector<unsigned short> IndexArray;
 		std::string name;
 		std::vector<Position3DNormalTextureCoordinates> vertices;
-		// Ŝ̃CfbNXz
-		std::vector<unsigned short> indices;
+		// Ŝ̃CfbNXzB`掞̃rbgModelAssetTubVƂɌ߂
+		std::vector<unsigned int> indices;
 		// }eAIDz
 		std::vector<int> materialIndices;
 		size_t numMaterialIndex;
 		// }eAIDƂ̃CfbNXz̃}bv
-		std::map<int, std::vector<unsigned short>> subMeshMap;
+		std::map<int, std::vector<unsigned int>> subMeshMap;
 		// cocos2d-xłsubMeshMapɕsubMeshIndicessumMeshIdsATubVƃ}eȂΉ
 		// ModelDataŕێĂ邪Aʂ̃f[^ĝʓ|Ȃ̂ŕȂƂɂ
 		//std::vector<IndexArray> subMeshIndices;
@@ -47,6 +47,8 @@ namespace ObjLoader
 		std::string diffuseTextureName;
 		std::string specularTextureName;
 		std::string normalTextureName;
+		// ɎgeNX`(map_d)Bw肪diffuseTexturẽAt@Ŕ
+		std::string alphaTextureName;
 		std::map<std::string, std::string> unknownParameter;
 
 		MaterialData() :
@@ -55,6 +57,7 @@ namespace ObjLoader
 			diffuseTextureName(""),
 			specularTextureName(""),
 			normalTextureName(""),
+			alphaTextureName(""),
 			shinness(1.0f),
 			indexOfRefraction(1.0f),
 			dissolve(1.0f),
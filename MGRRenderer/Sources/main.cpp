@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cstdlib>
 #include "Config.h"
 #include "MGRRenderer.h"
 
@@ -7,11 +8,31 @@
 #pragma comment(lib, "d3dcompiler.lib")
 #pragma comment(lib, "dxgi.lib")
 #elif defined(MGRRENDERER_USE_OPENGL)
+#if defined(_WIN32)
 #define GLEW_STATIC
 #include <glew/include/glew.h>
 #include <glfw3/include/glfw3.h>
+#else
+#include "renderer/GLCommandRecorder.h"
+#include "renderer/GLOffscreenContext.h"
+#include "renderer/Image.h"
+#include "renderer/ShaderCache.h"
+#include "renderer/SoftwareDeferredRenderer.h"
+#include "renderer/SoftwareRasterizer.h"
+#include "loader/ObjLoader.h"
+#include "node/ModelAsset.h"
+#include "node/ModelCache.h"
+#include "utility/JobScheduler.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#endif
 #endif
 
+#if defined(_WIN32)
 // STRICT͒`Ă悤
 //#define STRICT					// ^`FbNɍsȂ
 #define WIN32_LEAN_AND_MEAN		// wb_[炠܂gȂ֐Ȃ
@@ -19,6 +40,7 @@
 // Windows Header Files:
 #include <windows.h>
 #include <tchar.h>
+#endif
 
 static const int WINDOW_WIDTH = 960;
 static const int WINDOW_HEIGHT = 720;
@@ -33,14 +55,17 @@ using namespace mgrrenderer;
 LRESULT CALLBACK mainWindowProc(HWND handleWindow, UINT message, UINT windowParam, LONG param);
 static void initialize(HWND handleWindow);
 #elif defined(MGRRENDERER_USE_OPENGL)
+#if defined(_WIN32)
 static void fwErrorHandler(int error, const char* description);
 static void fwKeyInputHandler(GLFWwindow* window, int key, int scancode, int action, int mods);
 void APIENTRY debugMessageHandler(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, GLvoid* userParam);
+#endif
 static void initialize();
 #endif
 static void update();
 static void finalize();
 
+#if defined(_WIN32)
 int APIENTRY _tWinMain(HINSTANCE hInstance,
 	HINSTANCE hPrevInstance,
 	LPTSTR    lpCmdLine,
@@ -242,6 +267,549 @@ int APIENTRY _tWinMain(HINSTANCE hInstance,
 #endif
 	return 0;
 }
+#else
+// obj̓ǂݍ݂w肵񐔌JԂA1񂠂̎Ԃo͂B`͂Ȃ̂GL̃ReLXgȂ
+static int benchmarkObjLoader(const char* filePath, int numIterations)
+{
+	if (numIterations <= 0)
+	{
+		std::cerr << "Number of iterations must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::vector<ObjLoader::MeshData> meshList;
+	std::vector<ObjLoader::MaterialData> materialList;
+	std::string error;
+	double totalMs = 0.0;
+	double minMs = DBL_MAX;
+	for (int i = 0; i < numIterations; i++)
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		error = ObjLoader::loadObj(filePath, meshList, materialList);
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+		totalMs += elapsedMs;
+		minMs = std::min(minMs, elapsedMs);
+	}
+
+	if (!error.empty())
+	{
+		std::cerr << error << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	size_t numVertices = 0;
+	size_t numIndices = 0;
+	for (const ObjLoader::MeshData& mesh : meshList)
+	{
+		numVertices += mesh.vertices.size();
+		numIndices += mesh.indices.size();
+	}
+
+	Logger::log("%s: meshes=%zu materials=%zu vertices=%zu indices=%zu", filePath, meshList.size(), materialList.size(), numVertices, numIndices);
+	Logger::log("%d iterations, average %.3f ms, min %.3f ms", numIterations, totalMs / numIterations, minMs);
+	return EXIT_SUCCESS;
+}
+
+// ft@Ccookedfɕϊ
+static int cookModel(const char* sourceFilePath, const char* cookedFilePath)
+{
+	bool isSucceeded = ModelCache::getInstance()->cookModel(sourceFilePath, cookedFilePath);
+	ModelCache::destroy();
+	if (!isSucceeded)
+	{
+		std::cerr << "Can't cook " << sourceFilePath << " to " << cookedFilePath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+// f̃[hGPŨobt@ƃeNX`̍쐬܂łw肵񐔌JԂA1񂠂̎Ԃo͂
+// \[Xt@CcookedfnĔׂ
+static int benchmarkModelLoader(const char* filePath, int numIterations)
+{
+	if (numIterations <= 0)
+	{
+		std::cerr << "Number of iterations must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	double totalMs = 0.0;
+	double minMs = DBL_MAX;
+	for (int i = 0; i < numIterations; i++)
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		const ModelAsset* model = ModelCache::getInstance()->getModel(filePath);
+		glFinish();
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+		if (model == nullptr)
+		{
+			std::cerr << "Can't load " << filePath << std::endl;
+			ModelCache::destroy();
+			return EXIT_FAILURE;
+		}
+
+		// ̉LbVɓ炸Ƀ[h悤ɉ
+		ModelCache::getInstance()->releaseModel(model);
+		totalMs += elapsedMs;
+		minMs = std::min(minMs, elapsedMs);
+	}
+
+	ModelCache::destroy();
+	Logger::log("%s: %d iterations, average %.3f ms, min %.3f ms", filePath, numIterations, totalMs / numIterations, minMs);
+	return EXIT_SUCCESS;
+}
+
+// Sprite3DgVF[_oG[VSăRpCăfBXNLbVɓBrhzzOɈxsĂ
+static int precompileShaders()
+{
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	size_t numPrograms = Sprite3D::precompileShaderPermutations();
+	// ReLXgjOɃvO
+	ShaderCache::destroy();
+	Logger::log("%zu shader programs precompiled", numPrograms);
+	return (numPrograms > 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// SoftwareRasterizerŌŒ̃V[w肵񐔕`悵1񂠂̎Ԃo͂AʂTGAŏo
+// 摜nƏo摜ƔrB̊ۂ߂̈ႢŎOp`̕ӂ̃sNZς邱Ƃ̂ŁA̍͋e
+static int benchmarkSoftwareRasterizer(const char* outputFilePath, const char* goldenFilePath, int numIterations)
+{
+	if (numIterations <= 0)
+	{
+		std::cerr << "Number of iterations must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	static const unsigned int RASTERIZER_WIDTH = 256;
+	static const unsigned int RASTERIZER_HEIGHT = 256;
+
+	SoftwareRasterizer rasterizer;
+	if (!rasterizer.init(SizeUint(RASTERIZER_WIDTH, RASTERIZER_HEIGHT)))
+	{
+		std::cerr << "Can't initialize software rasterizer." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Mat4 viewProjectionMatrix = Mat4::createPerspective(60.0f, static_cast<float>(RASTERIZER_WIDTH) / RASTERIZER_HEIGHT, 1.0f, 100.0f) * Mat4::createLookAtFrom(Vec3(0.0f, 3.0f, 6.0f), Vec3(0.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f));
+	// Mat4Vec4Ƃ̏ZwvZȂ̂ŁANbvWւ̕ῗł
+	auto transformToClip = [&viewProjectionMatrix](const Vec3& position) {
+		const float (&m)[4][4] = viewProjectionMatrix.m;
+		return Vec4(
+			m[0][0] * position.x + m[1][0] * position.y + m[2][0] * position.z + m[3][0],
+			m[0][1] * position.x + m[1][1] * position.y + m[2][1] * position.z + m[3][1],
+			m[0][2] * position.x + m[1][2] * position.y + m[2][2] * position.z + m[3][2],
+			m[0][3] * position.x + m[1][3] * position.y + m[2][3] * position.z + m[3][3]);
+	};
+
+	// BjANbvɂ悤ɎOɑ傫L΂āANbvƓ␳ʂ
+	std::vector<Vec4> floorPositions;
+	for (const Vec3& position : {Vec3(-8.0f, -1.0f, -8.0f), Vec3(8.0f, -1.0f, -8.0f), Vec3(8.0f, -1.0f, 8.0f), Vec3(-8.0f, -1.0f, 8.0f)})
+	{
+		floorPositions.push_back(transformToClip(position));
+	}
+	std::vector<unsigned int> floorIndices = {0, 2, 1, 0, 3, 2};
+	// dSWeNX`WԂĎs͗lɂ
+	const Vec2 floorTextureCoords[] = {Vec2(0.0f, 0.0f), Vec2(8.0f, 0.0f), Vec2(8.0f, 8.0f), Vec2(0.0f, 8.0f)};
+	SoftwareRasterizer::PixelShader floorShader = [&floorIndices, &floorTextureCoords](size_t triangleIndex, const Vec3& barycentric) {
+		const unsigned int* indices = &floorIndices[triangleIndex * 3];
+		Vec2 textureCoord = floorTextureCoords[indices[0]] * barycentric.x + floorTextureCoords[indices[1]] * barycentric.y + floorTextureCoords[indices[2]] * barycentric.z;
+		bool isWhite = ((static_cast<int>(floorf(textureCoord.x)) + static_cast<int>(floorf(textureCoord.y))) & 1) == 0;
+		return isWhite ? Color4F(0.8f, 0.8f, 0.8f, 1.0f) : Color4F(0.2f, 0.2f, 0.3f, 1.0f);
+	};
+
+	// ]́BʂƂɐFςĐ[xeXǧʂ悤ɂ
+	Mat4 cubeMatrix = Mat4::createTransform(Vec3(0.0f, 0.0f, 0.0f), Quaternion(Vec3(20.0f, 35.0f, 0.0f)), Vec3(1.0f, 1.0f, 1.0f));
+	std::vector<Vec4> cubePositions;
+	for (int i = 0; i < 8; i++)
+	{
+		Vec3 position((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f, (i & 4) ? 1.0f : -1.0f);
+		cubePositions.push_back(transformToClip(cubeMatrix * position));
+	}
+	std::vector<unsigned int> cubeIndices = {
+		0, 2, 3, 0, 3, 1, // -z
+		4, 5, 7, 4, 7, 6, // +z
+		0, 4, 6, 0, 6, 2, // -x
+		1, 3, 7, 1, 7, 5, // +x
+		0, 1, 5, 0, 5, 4, // -y
+		2, 6, 7, 2, 7, 3, // +y
+	};
+	const Color4F faceColors[] = {
+		Color4F(1.0f, 0.2f, 0.2f, 1.0f),
+		Color4F(0.2f, 1.0f, 0.2f, 1.0f),
+		Color4F(0.2f, 0.2f, 1.0f, 1.0f),
+		Color4F(1.0f, 1.0f, 0.2f, 1.0f),
+		Color4F(1.0f, 0.2f, 1.0f, 1.0f),
+		Color4F(0.2f, 1.0f, 1.0f, 1.0f),
+	};
+	SoftwareRasterizer::PixelShader cubeShader = [&faceColors](size_t triangleIndex, const Vec3& barycentric) {
+		// ӂɋ߂قǈÂāAӂ̈ʒûꂪ摜̍ɏo悤ɂ
+		float edgeFactor = 0.5f + 0.5f * (std::min)(1.0f, 8.0f * (std::min)(barycentric.x, (std::min)(barycentric.y, barycentric.z)));
+		const Color4F& faceColor = faceColors[triangleIndex / 2];
+		return Color4F(faceColor.color.x * edgeFactor, faceColor.color.y * edgeFactor, faceColor.color.z * edgeFactor, 1.0f);
+	};
+
+	// ̂̎Oɂ锼̎Op`ƉZ̎Op`B[x͏Ȃ
+	std::vector<Vec4> overlayPositions;
+	for (const Vec3& position : {Vec3(-2.5f, -1.0f, 2.0f), Vec3(0.5f, -1.0f, 2.0f), Vec3(-1.0f, 2.0f, 1.5f), Vec3(-0.5f, -0.5f, 2.5f), Vec3(2.5f, -0.5f, 1.0f), Vec3(1.5f, 2.5f, 0.0f)})
+	{
+		overlayPositions.push_back(transformToClip(position));
+	}
+	std::vector<unsigned int> alphaIndices = {0, 1, 2};
+	std::vector<unsigned int> additiveIndices = {3, 4, 5};
+	SoftwareRasterizer::PixelShader alphaShader = [](size_t, const Vec3& barycentric) {
+		return Color4F(barycentric.x, barycentric.y, barycentric.z, 0.5f);
+	};
+	SoftwareRasterizer::PixelShader additiveShader = [](size_t, const Vec3& barycentric) {
+		return Color4F(0.3f * barycentric.x, 0.3f * barycentric.y, 0.3f * barycentric.z, 1.0f);
+	};
+
+	double totalMs = 0.0;
+	double minMs = DBL_MAX;
+	for (int i = 0; i < numIterations; i++)
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		rasterizer.clear(Color4F(0.1f, 0.1f, 0.1f, 1.0f), 1.0f);
+		rasterizer.drawTriangles(floorPositions, floorIndices, floorShader, SoftwareRasterizer::BlendMode::NONE, true, true);
+		rasterizer.drawTriangles(cubePositions, cubeIndices, cubeShader, SoftwareRasterizer::BlendMode::NONE, true, true);
+		rasterizer.drawTriangles(overlayPositions, alphaIndices, alphaShader, SoftwareRasterizer::BlendMode::ALPHA, true, false);
+		rasterizer.drawTriangles(overlayPositions, additiveIndices, additiveShader, SoftwareRasterizer::BlendMode::ADDITIVE, true, false);
+		rasterizer.flush();
+		double elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+		totalMs += elapsedMs;
+		minMs = std::min(minMs, elapsedMs);
+	}
+
+	Logger::log("software rasterizer %ux%u, %u threads: %d iterations, average %.3f ms, min %.3f ms", RASTERIZER_WIDTH, RASTERIZER_HEIGHT, JobScheduler::getInstance()->getNumWorkers() + 1, numIterations, totalMs / numIterations, minMs);
+	JobScheduler::destroy();
+
+	if (!rasterizer.saveColorBufferToTga(outputFilePath))
+	{
+		std::cerr << "Can't save image to " << outputFilePath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (goldenFilePath == nullptr)
+	{
+		return EXIT_SUCCESS;
+	}
+
+	std::ifstream outputFile(outputFilePath, std::ios::in | std::ios::binary);
+	std::ifstream goldenFile(goldenFilePath, std::ios::in | std::ios::binary);
+	if (!goldenFile)
+	{
+		std::cerr << "Can't open golden image " << goldenFilePath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::vector<unsigned char> output((std::istreambuf_iterator<char>(outputFile)), std::istreambuf_iterator<char>());
+	std::vector<unsigned char> golden((std::istreambuf_iterator<char>(goldenFile)), std::istreambuf_iterator<char>());
+	// wb_ȂTCYƃtH[}bg
+	static const size_t TGA_HEADER_SIZE = 18;
+	if (output.size() != golden.size() || output.size() < TGA_HEADER_SIZE || !std::equal(output.begin(), output.begin() + TGA_HEADER_SIZE, golden.begin()))
+	{
+		std::cerr << "Image format differs from golden image " << goldenFilePath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// 1`lł2傫ႤsNZ𐔂AŜ0.1%𒴂玸sɂ
+	static const int CHANNEL_TOLERANCE = 2;
+	size_t numPixels = (output.size() - TGA_HEADER_SIZE) / 4;
+	size_t numDifferentPixels = 0;
+	for (size_t i = 0; i < numPixels; i++)
+	{
+		for (size_t channel = 0; channel < 4; channel++)
+		{
+			size_t offset = TGA_HEADER_SIZE + i * 4 + channel;
+			if (std::abs(static_cast<int>(output[offset]) - static_cast<int>(golden[offset])) > CHANNEL_TOLERANCE)
+			{
+				numDifferentPixels++;
+				break;
+			}
+		}
+	}
+
+	Logger::log("%zu / %zu pixels differ from %s", numDifferentPixels, numPixels, goldenFilePath);
+	return (numDifferentPixels * 1000 <= numPixels) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// sxftHgSprite2D1uV[`悵AXvCg̈ʒuɉ摜̂܂܏oĂ邩m߂
+// sȉ摜nƁBXvCg2DJ̌_A܂ʂ̍ɒu
+static int checkSprite(const char* imageFilePath)
+{
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	Director::getInstance()->init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT), NEAR_CLIP, FAR_CLIP);
+
+	Image image;
+	if (!image.initWithFilePath(imageFilePath) || image.getPixelFormat() != TextureUtility::PixelFormat::RGB888 || image.getWidth() > WINDOW_WIDTH || image.getHeight() > WINDOW_HEIGHT)
+	{
+		std::cerr << imageFilePath << " must be an RGB image that fits in the window." << std::endl;
+		finalize();
+		return EXIT_FAILURE;
+	}
+
+	Sprite2D* sprite = new Sprite2D();
+	bool isSucceeded = sprite->init(imageFilePath);
+	Logger::logAssert(isSucceeded, "m[h̏s");
+
+	Scene* scene = new Scene();
+	scene->init();
+	scene->pushNode2D(sprite);
+	Director::getInstance()->setScene(*scene);
+	Director::getInstance()->update();
+
+	Image frame;
+	if (!Director::getRenderer().readBackBuffer(frame))
+	{
+		std::cerr << "Can't read back the frame." << std::endl;
+		finalize();
+		return EXIT_FAILURE;
+	}
+
+	// ǂݖ߂摜͏̍sł̂ŁAXvCg͉[ɐڂĂB
+	// GLł̓eNX`̐擪sv=0ɓASprite2Dv=0[ɒûŁA摜̐擪s͍ŉsɗ
+	const unsigned char* source = image.getRawData();
+	const unsigned char* destination = frame.getRawData();
+	size_t numPixels = image.getWidth() * image.getHeight();
+	size_t numDifferentPixels = 0;
+	for (unsigned int y = 0; y < image.getHeight(); y++)
+	{
+		for (unsigned int x = 0; x < image.getWidth(); x++)
+		{
+			const unsigned char* sourcePixel = &source[(y * image.getWidth() + x) * 3];
+			const unsigned char* destinationPixel = &destination[((WINDOW_HEIGHT - 1 - y) * WINDOW_WIDTH + x) * 4];
+			for (int channel = 0; channel < 3; channel++)
+			{
+				if (abs(static_cast<int>(sourcePixel[channel]) - static_cast<int>(destinationPixel[channel])) > 2)
+				{
+					numDifferentPixels++;
+					break;
+				}
+			}
+		}
+	}
+
+	finalize();
+
+	Logger::log("%zu / %zu sprite pixels differ from %s", numDifferentPixels, numPixels, imageFilePath);
+	return (numDifferentPixels * 1000 <= numPixels) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Nw肵t[`悷܂łOpenGĽĂяoL^ăt@Cɏo
+// MGRReplayōŌ̃t[JԂĐ΁AScenȅ܂ɃR}hs̃RXgvł
+static int captureFrames(int numFrames, const char* captureFilePath)
+{
+	if (numFrames <= 0)
+	{
+		std::cerr << "Number of frames must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// ĐŃeNX`obt@悤ɁA`̏OL^
+	GLCommandRecorder::begin(WINDOW_WIDTH, WINDOW_HEIGHT);
+
+	initialize();
+	Director::getInstance()->setFixedDeltaTime(1.0f / FPS);
+
+	for (int i = 0; i < numFrames; i++)
+	{
+		update();
+		GLCommandRecorder::endFrame();
+	}
+
+	bool isSucceeded = GLCommandRecorder::end(captureFilePath);
+	if (!isSucceeded)
+	{
+		std::cerr << "Can't save capture to " << captureFilePath << std::endl;
+	}
+
+	finalize();
+	return isSucceeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// initialize()̃V[AfBt@[h̃pXGPUg킸SoftwareDeferredRendererŕ`悵AŌ̃t[PNGŏo
+// m[h̏OpenGL̃\[X̂ŃReLXg͍邪At[̕`łOpenGLĂ΂ȂB2D̃m[h͕`Ȃ
+static int renderSoftware(int numFrames, const char* outputFilePath)
+{
+	if (numFrames <= 0)
+	{
+		std::cerr << "Number of frames must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	initialize();
+	Director::getInstance()->setFixedDeltaTime(1.0f / FPS);
+
+	SoftwareDeferredRenderer renderer;
+	if (!renderer.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		finalize();
+		return EXIT_FAILURE;
+	}
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (int i = 0; i < numFrames; i++)
+	{
+		Director::getInstance()->updateSoftware(renderer);
+	}
+	float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+	Logger::log("%d software frames, %u threads, %.3f ms/frame", numFrames, JobScheduler::getInstance()->getNumWorkers() + 1, elapsedMs / numFrames);
+
+	Image image;
+	bool isSucceeded = renderer.readColorBuffer(image) && image.saveToPngFile(outputFilePath);
+	if (!isSucceeded)
+	{
+		std::cerr << "Can't save frame to " << outputFilePath << std::endl;
+	}
+
+	finalize();
+	return isSucceeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// WindowsȊOł̓EBhE炸AEGL̃ItXN[ReLXgŎw肵t[`悵AŌ̃t[PNGŏo
+// g: MGRRenderer [t[] [o͂PNG̃pX]
+//         MGRRenderer --benchmark-obj [obj̃pX] []
+//         MGRRenderer --cook-model [ft@C̃pX] [cookedf̃pX]
+//         MGRRenderer --benchmark-model [ft@C̃pX] []
+//         MGRRenderer --benchmark-rasterizer [o͂TGÃpX] [TGÃpX] []
+//         MGRRenderer --check-sprite [sRGBPNG̃pX]
+//         MGRRenderer --precompile-shaders
+//         MGRRenderer --capture [t[] [o͂Lv`̃pX]
+//         MGRRenderer --render-software [t[] [o͂PNG̃pX]
+int main(int argc, char* argv[])
+{
+	if (argc > 1 && strcmp(argv[1], "--benchmark-obj") == 0)
+	{
+		const char* objFilePath = (argc > 2) ? argv[2] : "../MGRRenderer/Resources/nanosuit/nanosuit.obj";
+		int numIterations = (argc > 3) ? atoi(argv[3]) : 10;
+		return benchmarkObjLoader(objFilePath, numIterations);
+	}
+
+	if (argc > 3 && strcmp(argv[1], "--cook-model") == 0)
+	{
+		return cookModel(argv[2], argv[3]);
+	}
+
+	if (argc > 2 && strcmp(argv[1], "--benchmark-model") == 0)
+	{
+		int numIterations = (argc > 3) ? atoi(argv[3]) : 10;
+		return benchmarkModelLoader(argv[2], numIterations);
+	}
+
+	if (argc > 1 && strcmp(argv[1], "--benchmark-rasterizer") == 0)
+	{
+		const char* outputFilePath = (argc > 2) ? argv[2] : "rasterizer.tga";
+		// 摜-nƔrȂB摜蒼ƂɎg
+		const char* goldenFilePath = (argc > 3) ? argv[3] : "../MGRRenderer/Resources/golden/rasterizer.tga";
+		if (strcmp(goldenFilePath, "-") == 0)
+		{
+			goldenFilePath = nullptr;
+		}
+		int numIterations = (argc > 4) ? atoi(argv[4]) : 10;
+		return benchmarkSoftwareRasterizer(outputFilePath, goldenFilePath, numIterations);
+	}
+
+	if (argc > 1 && strcmp(argv[1], "--check-sprite") == 0)
+	{
+		const char* imageFilePath = (argc > 2) ? argv[2] : "../MGRRenderer/Resources/Hello.png";
+		return checkSprite(imageFilePath);
+	}
+
+	if (argc > 1 && strcmp(argv[1], "--precompile-shaders") == 0)
+	{
+		return precompileShaders();
+	}
+
+	if (argc > 1 && strcmp(argv[1], "--capture") == 0)
+	{
+		int numFrames = (argc > 2) ? atoi(argv[2]) : FPS;
+		const char* captureFilePath = (argc > 3) ? argv[3] : "frame.mgrc";
+		return captureFrames(numFrames, captureFilePath);
+	}
+
+	if (argc > 1 && strcmp(argv[1], "--render-software") == 0)
+	{
+		int numFrames = (argc > 2) ? atoi(argv[2]) : FPS;
+		const char* outputFilePath = (argc > 3) ? argv[3] : "software.png";
+		return renderSoftware(numFrames, outputFilePath);
+	}
+
+	int numFrames = (argc > 1) ? atoi(argv[1]) : FPS;
+	const char* outputFilePath = (argc > 2) ? argv[2] : "frame.png";
+	if (numFrames <= 0)
+	{
+		std::cerr << "Number of frames must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT)))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	// `̏
+	initialize();
+	// sxɂ炸t[Ȃ瓯摜ɂȂ悤ɁAoߎԂŒ肷
+	Director::getInstance()->setFixedDeltaTime(1.0f / FPS);
+
+	std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+	for (int i = 0; i < numFrames; i++)
+	{
+		// `̃C[v
+		update();
+	}
+	// R}h̔słȂGPȔ̊܂łvɊ܂߂
+	glFinish();
+	float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+	Logger::log("%d frames, %.3f ms/frame", numFrames, elapsedMs / numFrames);
+
+	Image image;
+	bool isSucceeded = Director::getRenderer().readBackBuffer(image) && image.saveToPngFile(outputFilePath);
+	if (!isSucceeded)
+	{
+		std::cerr << "Can't save frame to " << outputFilePath << std::endl;
+	}
+
+	// `̏I
+	finalize();
+	return isSucceeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+#endif
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 static bool isKeyPressed[0xFF]; // WindowsVK_XX̐0xFFɂȂĂBAXL[R[hƒl͈vĂ
@@ -277,7 +845,7 @@ LRESULT CALLBACK mainWindowProc(HWND handleWindow, UINT message, UINT windowPara
 	}
 	return DefWindowProc(handleWindow, message, windowParam, param);
 }
-#elif defined(MGRRENDERER_USE_OPENGL)
+#elif defined(MGRRENDERER_USE_OPENGL) && defined(_WIN32)
 static bool isKeyPressed[GLFW_KEY_LAST];
 static bool keyToggle[GLFW_KEY_LAST];
 
@@ -495,7 +1063,9 @@ void initialize()
 		ambientLight->setColor(Color3B::WHITE);
 	}
 
-	Sprite2D* depthTextureSprite = nullptr;
+	// VhE}bv̎̂̓t[Ot`掞Ɋ蓖Ă̂ŁAł͂܂eNX`ȂB
+	// fobO\ƂDirectorGobt@\̂悤ɁA`掞Sprite2D::setRenderBufferTextureōւ邱
+	//Sprite2D* depthTextureSprite = nullptr;
 
 	DirectionalLight* dirLight = new (std::nothrow) DirectionalLight(Vec3(-1.0f, -1.0f, -1.0f), Color3B::WHITE);
 	dirLight->setIntensity(0.7f);
@@ -508,14 +1078,14 @@ void initialize()
 		SizeUint(WINDOW_WIDTH, WINDOW_HEIGHT));
 	scene->setDirectionalLight(dirLight);
 
-	if (dirLight->hasShadowMap())
-	{
-		depthTextureSprite = new Sprite2D();
-		const SizeFloat& contentSize = Director::getInstance()->getWindowSize() / 5.0f;
-		depthTextureSprite->initWithDepthStencilTexture(dirLight->getShadowMapData().getDepthTexture(), Sprite2D::RenderBufferType::DEPTH_TEXTURE_ORTHOGONAL, dirLight->getNearClip(), dirLight->getFarClip(), dirLight->getShadowMapData().projectionMatrix);
-		depthTextureSprite->setScale(1 / 5.0f);
-		depthTextureSprite->setPosition(Vec3(WINDOW_WIDTH - contentSize.width, 0.0f, 0.0f));
-	}
+	//if (dirLight->hasShadowMap())
+	//{
+	//	depthTextureSprite = new Sprite2D();
+	//	const SizeFloat& contentSize = Director::getInstance()->getWindowSize() / 5.0f;
+	//	depthTextureSprite->initWithDepthStencilTexture(dirLight->getShadowMapData().getDepthTexture(), Sprite2D::RenderBufferType::DEPTH_TEXTURE_ORTHOGONAL, dirLight->getNearClip(), dirLight->getFarClip(), dirLight->getShadowMapData().projectionMatrix);
+	//	depthTextureSprite->setScale(1 / 5.0f);
+	//	depthTextureSprite->setPosition(Vec3(WINDOW_WIDTH - contentSize.width, 0.0f, 0.0f));
+	//}
 
 	// I[N(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f, 0)(0,-1,0)̌~蒍悤ɂĂ
 	PointLight* light = new (std::nothrow) PointLight(Vec3(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f, 0.0f + WINDOW_WIDTH), Color3B::WHITE, 3000.0f);
@@ -524,14 +1094,14 @@ void initialize()
 	light->initShadowMap(NEAR_CLIP, WINDOW_WIDTH);
 	scene->addPointLight(light);
 
-	if (light->hasShadowMap())
-	{
-		depthTextureSprite = new Sprite2D();
-		const SizeFloat& contentSize = Director::getInstance()->getWindowSize() / 5.0f;
-		depthTextureSprite->setScale(1 / 5.0f);
-		depthTextureSprite->initWithDepthStencilTexture(light->getShadowMapData().getDepthTexture(), Sprite2D::RenderBufferType::DEPTH_CUBEMAP_TEXTURE, light->getNearClip(), light->getRange(), light->getShadowMapData().projectionMatrix, CubeMapFace::Z_NEGATIVE);
-		depthTextureSprite->setPosition(Vec3(WINDOW_WIDTH - contentSize.width, 0.0f, 0.0f));
-	}
+	//if (light->hasShadowMap())
+	//{
+	//	depthTextureSprite = new Sprite2D();
+	//	const SizeFloat& contentSize = Director::getInstance()->getWindowSize() / 5.0f;
+	//	depthTextureSprite->setScale(1 / 5.0f);
+	//	depthTextureSprite->initWithDepthStencilTexture(light->getShadowMapData().getDepthTexture(), Sprite2D::RenderBufferType::DEPTH_CUBEMAP_TEXTURE, light->getNearClip(), light->getRange(), light->getShadowMapData().projectionMatrix, CubeMapFace::Z_NEGATIVE);
+	//	depthTextureSprite->setPosition(Vec3(WINDOW_WIDTH - contentSize.width, 0.0f, 0.0f));
+	//}
 
 	// I[N(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f, 0)(0,-1,0)̌~蒍悤ɂĂ
 	//PointLight* light2 = new (std::nothrow) PointLight(Vec3(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f + WINDOW_WIDTH, 0.0f), Color3B::WHITE, 3000.0f);
@@ -664,7 +1234,14 @@ void update()
 		keyToggle['Z'] = true;
 		Director::getRenderer().toggleDrawWireFrame();
 	}
-#elif defined(MGRRENDERER_USE_OPENGL)
+
+	// vt@Cʂchrome://tracingœǂ߂t@Cɏo
+	if (isKeyPressed['P'] && !keyToggle['P'])
+	{
+		keyToggle['P'] = true;
+		Profiler::getInstance()->dumpChromeTrace("profile.json");
+	}
+#elif defined(MGRRENDERER_USE_OPENGL) && defined(_WIN32)
 	if (isKeyPressed[GLFW_KEY_W])
 	{
 		cameraAnglePitch += ANGLE_DELTA;
@@ -704,6 +1281,16 @@ void update()
 		keyToggle[GLFW_KEY_Z] = true;
 		Director::getRenderer().toggleDrawWireFrame();
 	}
+
+	// vt@Cʂchrome://tracingœǂ߂t@Cɏo
+	if (isKeyPressed[GLFW_KEY_P] && !keyToggle[GLFW_KEY_P])
+	{
+		keyToggle[GLFW_KEY_P] = true;
+		Profiler::getInstance()->dumpChromeTrace("profile.json");
+	}
+#else
+	// ItXN[sł̓L[͂Ȃ̂ŁAJ͏ʒû܂
+	(void)ANGLE_DELTA; // gpϐx}
 #endif
 
 	const Vec3& newCameraPos = Vec3(WINDOW_HEIGHT / 1.1566f * cos(cameraAnglePitch ) * cos(cameraAngleYaw) + WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f + WINDOW_HEIGHT / 1.1566f * sin(cameraAnglePitch ), WINDOW_HEIGHT / 1.1566f * cos(cameraAnglePitch ) * sin(cameraAngleYaw));
@@ -0,0 +1,282 @@
+#include "AnimationScheduler.h"
+#include "Camera.h"
+#include "ModelAsset.h"
+#include "Sprite3D.h"
+#include "utility/JobScheduler.h"
+#include "utility/Profiler.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace mgrrenderer
+{
+
+// oCh|[ỸoEfBOɑ΂AAj[VŎ葫Lт镪̗]T
+static const float ANIMATION_BOUNDS_MARGIN = 1.5f;
+
+AnimationScheduler* AnimationScheduler::_instance = nullptr;
+
+AnimationScheduler* AnimationScheduler::getInstance()
+{
+	if (_instance == nullptr)
+	{
+		_instance = new AnimationScheduler();
+	}
+
+	return _instance;
+}
+
+void AnimationScheduler::destroy()
+{
+	delete _instance;
+	_instance = nullptr;
+}
+
+AnimationScheduler::AnimationScheduler() :
+_maxJointsPerFrame(4096),
+_numEvaluatedJoints(0)
+{
+	// ʂ1/4ȏ̍ɉf͖̂t[A菬̂͊ԈAɏ͎̂wȂǂ̐[WCgȂ
+	_lodLevels[0].minScreenSize = 0.25f;
+	_lodLevels[0].updateInterval = 1;
+	_lodLevels[0].maxJointDepth = ALL_JOINTS;
+	_lodLevels[1].minScreenSize = 0.08f;
+	_lodLevels[1].updateInterval = 2;
+	_lodLevels[1].maxJointDepth = ALL_JOINTS;
+	_lodLevels[2].minScreenSize = 0.0f;
+	_lodLevels[2].updateInterval = 4;
+	_lodLevels[2].maxJointDepth = 4;
+}
+
+AnimationScheduler::~AnimationScheduler()
+{
+}
+
+void AnimationScheduler::request(Sprite3D* sprite)
+{
+	Request request;
+	request.sprite = sprite;
+	request.lodLevel = 0;
+	request.screenSize = 0.0f;
+	request.staleness = 0.0f;
+	request.numJoints = 0;
+	request.isCulled = false;
+	request.isEvaluated = false;
+	request.isMatrixPaletteChanged = false;
+	_requests.push_back(request);
+}
+
+void AnimationScheduler::execute(const Camera& camera)
+{
+	MGRRENDERER_PROFILE_SCOPE("AnimationScheduler::execute");
+
+	_numEvaluatedJoints = 0;
+	if (_requests.empty())
+	{
+		return;
+	}
+
+	// r[vWFNVs̍s王6ʂ߂Bm[][s]Ȃ̂ōsm[0][i]`m[3][i]
+	const Mat4& projectionMatrix = camera.getProjectionMatrix();
+	Mat4 viewProjectionMatrix = projectionMatrix * camera.getViewMatrix();
+	Vec4 rows[4];
+	for (int i = 0; i < 4; ++i)
+	{
+		rows[i] = Vec4(viewProjectionMatrix.m[0][i], viewProjectionMatrix.m[1][i], viewProjectionMatrix.m[2][i], viewProjectionMatrix.m[3][i]);
+	}
+
+	Vec4 planes[6] = {
+		rows[3] + rows[0], rows[3] - rows[0],
+		rows[3] + rows[1], rows[3] - rows[1],
+		rows[3] + rows[2], rows[3] - rows[2],
+	};
+	for (Vec4& plane : planes)
+	{
+		float length = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+		if (length > 0.0f)
+		{
+			plane /= length;
+		}
+	}
+
+	// e̍̊g嗦Br[Ԃ̐[ŊƉʂ̍(NDC2)ɑ΂傫ɂȂ
+	float projectionScale = fabsf(projectionMatrix.m[1][1]);
+
+	//
+	// LOD߂
+	//
+	_dueRequestIndices.clear();
+	for (size_t i = 0; i < _requests.size(); ++i)
+	{
+		Request& request = _requests[i];
+		const Sprite3D* sprite = request.sprite;
+		const ModelAsset* model = sprite->_model;
+		const Mat4& modelMatrix = sprite->getModelMatrix();
+
+		Vec3 center = modelMatrix * model->getBoundingSphereCenter();
+		float maxScale = 0.0f;
+		for (int column = 0; column < 3; ++column)
+		{
+			const float* axis = modelMatrix.m[column];
+			maxScale = std::max(maxScale, sqrtf(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]));
+		}
+		float radius = model->getBoundingSphereRadius() * maxScale * ANIMATION_BOUNDS_MARGIN;
+
+		for (const Vec4& plane : planes)
+		{
+			if (plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+			{
+				request.isCulled = true;
+				break;
+			}
+		}
+
+		if (request.isCulled)
+		{
+			continue;
+		}
+
+		float depth = rows[3].x * center.x + rows[3].y * center.y + rows[3].z * center.z + rows[3].w;
+		// JoEfBO̒ɂƂ͉ʂςɉfĂƂ݂Ȃ
+		request.screenSize = (depth > radius) ? radius * projectionScale / depth : 1.0f;
+
+		request.lodLevel = NUM_LOD_LEVELS - 1;
+		for (size_t level = 0; level < NUM_LOD_LEVELS; ++level)
+		{
+			if (request.screenSize >= _lodLevels[level].minScreenSize)
+			{
+				request.lodLevel = level;
+				break;
+			}
+		}
+
+		const LodLevel& lodLevel = _lodLevels[request.lodLevel];
+		request.numJoints = model->getSkeleton().getNumJointsWithinDepth(lodLevel.maxJointDepth);
+
+		// OvZt[XVԊuȏソĂ邩AÕpbggȂ̂vŽɂ
+		unsigned int updateInterval = std::max(lodLevel.updateInterval, 1u);
+		unsigned int numFrames = sprite->_framesSinceAnimationEvaluation + 1;
+		if (sprite->_snapMatrixPalette)
+		{
+			request.staleness = FLT_MAX;
+			_dueRequestIndices.push_back(i);
+		}
+		else if (numFrames >= updateInterval)
+		{
+			request.staleness = static_cast<float>(numFrames) / updateInterval;
+			_dueRequestIndices.push_back(i);
+		}
+	}
+
+	//
+	// ͈̔͂ŌvZCX^XI
+	//
+	// ҂ẮA傫fĂ̂̏ɗD悷BȂo^ɂĖt[̌ʂIɂ
+	std::sort(_dueRequestIndices.begin(), _dueRequestIndices.end(), [this](size_t a, size_t b)
+	{
+		const Request& requestA = _requests[a];
+		const Request& requestB = _requests[b];
+		if (requestA.staleness != requestB.staleness)
+		{
+			return requestA.staleness > requestB.staleness;
+		}
+		if (requestA.screenSize != requestB.screenSize)
+		{
+			return requestA.screenSize > requestB.screenSize;
+		}
+		return a < b;
+	});
+
+	for (size_t index : _dueRequestIndices)
+	{
+		Request& request = _requests[index];
+		if (_numEvaluatedJoints == 0 || _numEvaluatedJoints + request.numJoints <= _maxJointsPerFrame)
+		{
+			request.isEvaluated = true;
+			_numEvaluatedJoints += request.numJoints;
+		}
+	}
+
+	//
+	// pvZApbgXV
+	//
+	// eCX^X̌vZ͎̏ԂƋL̓ǂݎpModelAssetGȂ̂ŁAɌvZĂƓʂɂȂ
+	_evaluatedRequestIndices.clear();
+	_visibleRequestIndices.clear();
+	for (size_t i = 0; i < _requests.size(); ++i)
+	{
+		Request& request = _requests[i];
+		Sprite3D* sprite = request.sprite;
+
+		if (request.isCulled)
+		{
+			// fĂȂ̂ŌvZȂBɉfƂ͕ԂɌvZpbĝ܂܎g
+			sprite->_snapMatrixPalette = true;
+			continue;
+		}
+
+		if (request.isEvaluated)
+		{
+			_evaluatedRequestIndices.push_back(i);
+		}
+		else if (sprite->_framesSinceAnimationEvaluation < UINT_MAX)
+		{
+			++sprite->_framesSinceAnimationEvaluation;
+		}
+
+		_visibleRequestIndices.push_back(i);
+	}
+
+	{
+		MGRRENDERER_PROFILE_SCOPE("AnimationScheduler::evaluate");
+
+		// o^ɘACX^X1Wuɂ܂Ƃ߁AWu̐؂ւƃXbhԂ̎󂯓n炷
+		size_t numJobs = (_evaluatedRequestIndices.size() + NUM_INSTANCES_PER_JOB - 1) / NUM_INSTANCES_PER_JOB;
+		JobScheduler::getInstance()->parallelFor(numJobs, [this](size_t jobIndex)
+		{
+			size_t begin = jobIndex * NUM_INSTANCES_PER_JOB;
+			size_t end = std::min(begin + NUM_INSTANCES_PER_JOB, _evaluatedRequestIndices.size());
+			for (size_t i = begin; i < end; ++i)
+			{
+				const Request& request = _requests[_evaluatedRequestIndices[i]];
+				const LodLevel& lodLevel = _lodLevels[request.lodLevel];
+				request.sprite->evaluateAnimation(std::max(lodLevel.updateInterval, 1u), lodLevel.maxJointDepth);
+			}
+		});
+	}
+
+	{
+		MGRRENDERER_PROFILE_SCOPE("AnimationScheduler::blend");
+
+		size_t numJobs = (_visibleRequestIndices.size() + NUM_INSTANCES_PER_JOB - 1) / NUM_INSTANCES_PER_JOB;
+		JobScheduler::getInstance()->parallelFor(numJobs, [this](size_t jobIndex)
+		{
+			size_t begin = jobIndex * NUM_INSTANCES_PER_JOB;
+			size_t end = std::min(begin + NUM_INSTANCES_PER_JOB, _visibleRequestIndices.size());
+			for (size_t i = begin; i < end; ++i)
+			{
+				Request& request = _requests[_visibleRequestIndices[i]];
+				request.isMatrixPaletteChanged = request.sprite->blendMatrixPalette();
+			}
+		});
+	}
+
+	{
+		MGRRENDERER_PROFILE_SCOPE("AnimationScheduler::skin");
+
+		// CPUXLjO̓CX^X̒Œ_Ƃɕ񉻂Ă̂ŁACX^X͏ɏB_obt@̍XVCXbhōs
+		for (size_t index : _visibleRequestIndices)
+		{
+			const Request& request = _requests[index];
+			if (request.isMatrixPaletteChanged && request.sprite->_useCpuSkinning)
+			{
+				request.sprite->skinVertices();
+				request.sprite->uploadSkinnedVertices();
+			}
+		}
+	}
+
+	_requests.clear();
+}
+
+} // namespace mgrrenderer
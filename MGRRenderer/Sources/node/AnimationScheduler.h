@@ -0,0 +1,83 @@
+#pragma once
+#include "Config.h"
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <vector>
+
+namespace mgrrenderer
+{
+class Camera;
+class Sprite3D;
+
+// Aj[VĂSprite3D̎pvZAʏ̑傫Ɖł܂Ƃ߂ĊԈXPW[
+// Sprite3D::updateœo^AScene::updateőSm[hupdatěexecuteĂ
+// ̊ÕCX^X͌vZAfCX^X͐t[ɈxvZĊԂ̃t[̓pbgԂ
+// 1t[ɌvZWCg̏𒴂镪́AŌɌvZĂ璷҂ĂCX^XD悵Ď̃t[ɉ
+// I񂾃CX^X̎pƃpbgJobSchedulerŕɌvZBCX^Xm͓ƗĂ̂Ōʂ͒ƓɂȂ
+class AnimationScheduler final
+{
+public:
+	static const size_t NUM_LOD_LEVELS = 3;
+	static const unsigned int ALL_JOINTS = UINT_MAX;
+
+	struct LodLevel
+	{
+		// ʂ̍ɑ΂oEfBO̒åȏȂ炱LODg
+		float minScreenSize;
+		// t[ɈxpvZ邩
+		unsigned int updateInterval;
+		// Aj[VvZWCg̐[̏B[WCg̓oCh|[Ŷ܂܂ɂ
+		unsigned int maxJointDepth;
+	};
+
+	static AnimationScheduler* getInstance();
+	static void destroy();
+
+	// 0ԂԏڍׂLODBminScreenSizȇ傫ɕׂ邱
+	void setLodLevel(size_t level, const LodLevel& lodLevel) { _lodLevels[level] = lodLevel; }
+	const LodLevel& getLodLevel(size_t level) const { return _lodLevels[level]; }
+	// 1t[ɌvZWCg̏BA1CX^XvZłȂƂ͗Dxԍ̂͌vZ
+	void setMaxJointsPerFrame(size_t maxJointsPerFrame) { _maxJointsPerFrame = maxJointsPerFrame; }
+	size_t getMaxJointsPerFrame() const { return _maxJointsPerFrame; }
+	// OexecuteŌvZWCg
+	size_t getNumEvaluatedJoints() const { return _numEvaluatedJoints; }
+
+	// t[Aj[Vi߂CX^Xo^Bo^executeŏ
+	void request(Sprite3D* sprite);
+	// o^ꂽCX^XLOD߁A͈̔͂ŎpvZASCX^X̃pbgXV
+	void execute(const Camera& camera);
+
+private:
+	struct Request
+	{
+		Sprite3D* sprite;
+		size_t lodLevel;
+		float screenSize;
+		// OvZẴt[XVԊuŊ́B傫قǗD悷
+		float staleness;
+		size_t numJoints;
+		bool isCulled;
+		bool isEvaluated;
+		bool isMatrixPaletteChanged;
+	};
+
+	// 1WuŎpvZCX^X
+	static const size_t NUM_INSTANCES_PER_JOB = 4;
+
+	static AnimationScheduler* _instance;
+
+	std::array<LodLevel, NUM_LOD_LEVELS> _lodLevels;
+	size_t _maxJointsPerFrame;
+	size_t _numEvaluatedJoints;
+	std::vector<Request> _requests;
+	// vZCX^XIԂ߂̍Ɨ̈Bt[mۂȂ悤ɕێĂ
+	std::vector<size_t> _dueRequestIndices;
+	std::vector<size_t> _evaluatedRequestIndices;
+	std::vector<size_t> _visibleRequestIndices;
+
+	AnimationScheduler();
+	~AnimationScheduler();
+};
+
+} // namespace mgrrenderer
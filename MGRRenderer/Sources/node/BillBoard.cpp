@@ -1,7 +1,6 @@
 #include "BillBoard.h"
 #include "renderer/Director.h"
 #include "renderer/GLProgram.h"
-#include "renderer/Image.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "renderer/D3DTexture.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
@@ -21,22 +20,9 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 {
 	_mode = mode;
 
-	// Texture[hApngjpeg𐶃f[^ɂAOpenGLɂdg݂˂΁BBSpritẽ\[XƂB
-	Image image; // ImageCPŨgĂ̂ł̃XR[vŉĂ悢̂X^bNɎ
-	image.initWithFilePath(filePath);
+	const SizeUint& contentSize = initTexture(filePath);
 
-	// TextureGPŨgĂ̂ŉƍ̂Ńq[vɂƂ
 #if defined(MGRRENDERER_USE_DIRECT3D)
-	_texture = new D3DTexture();
-#elif defined(MGRRENDERER_USE_OPENGL)
-	_texture = new GLTexture();
-#endif
-
-	Texture* texture = _texture;
-	texture->initWithImage(image); // TODO:ȂÖقɌpNX̃\bhĂׂȂ
-
-#if defined(MGRRENDERER_USE_DIRECT3D)
-	const SizeUint& contentSize = texture->getContentSize();
 	_quadrangle.bottomLeft.position = Vec2(0.0f, 0.0f);
 	_quadrangle.bottomLeft.textureCoordinate = Vec2(0.0f, 1.0f);
 	_quadrangle.bottomRight.position = Vec2((float)contentSize.width, 0.0f);
@@ -45,6 +31,7 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 	_quadrangle.topLeft.textureCoordinate = Vec2(0.0f, 0.0f);
 	_quadrangle.topRight.position = Vec2((float)contentSize.width, (float)contentSize.height);
 	_quadrangle.topRight.textureCoordinate = Vec2(1.0f, 0.0f);
+	remapTextureCoordinatesToAtlasRegion();
 
 	// _obt@̒`
 	D3D11_BUFFER_DESC vertexBufferDesc;
@@ -154,8 +141,8 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 
 	// Viewsp
 	constantBuffer = nullptr;
@@ -165,8 +152,8 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 
 	// Projectionsp
 	constantBuffer = nullptr;
@@ -176,8 +163,8 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 
 	// ZF
 	constantBuffer = nullptr;
@@ -188,13 +175,12 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 
 	return true;
 #elif defined(MGRRENDERER_USE_OPENGL)
 	// TODO:͂BillboardSprite2DpĂӖ邩ȁH
-	const SizeUint& contentSize = texture->getContentSize();
 	_quadrangle.bottomLeft.position = Vec2(0.0f, 0.0f);
 	_quadrangle.bottomLeft.textureCoordinate = Vec2(0.0f, 0.0f);
 	_quadrangle.bottomRight.position = Vec2((float)contentSize.width, 0.0f);
@@ -203,9 +189,12 @@ bool BillBoard::init(const std::string& filePath, Mode mode)
 	_quadrangle.topLeft.textureCoordinate = Vec2(0.0f, 1.0f);
 	_quadrangle.topRight.position = Vec2((float)contentSize.width, (float)contentSize.height);
 	_quadrangle.topRight.textureCoordinate = Vec2(1.0f, 1.0f);
+	remapTextureCoordinatesToAtlasRegion();
 
 	_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionTexture.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureMultiplyColor.glsl");
 	_glProgramForGBuffer.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionTexture.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureMultiplyColorGBuffer.glsl");
+
+	createGLVertexArray();
 	return true;
 #endif
 }
@@ -274,59 +263,21 @@ void BillBoard::renderGBuffer()
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
 		// TODO:ւ񋤒ʉȁBB
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose(); // nϊs̓vWFNVsɍŏ炩Ă
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color4B(getColor().r, getColor().g, getColor().b, 255));
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
 		// bV͂ЂƂ
 		UINT strides[1] = {sizeof(_quadrangle.topLeft)};
@@ -337,7 +288,7 @@ void BillBoard::renderGBuffer()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 		_d3dProgramForGBuffer.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForGBuffer.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForGBuffer, direct3dContext);
 
 		ID3D11ShaderResourceView* resourceView[1] = { _texture->getShaderResourceView() };
 		direct3dContext->PSSetShaderResources(0, 1, resourceView);
@@ -349,25 +300,19 @@ void BillBoard::renderGBuffer()
 		glUseProgram(_glProgramForGBuffer.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform3f(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
-		GLProgram::checkGLError();
-
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
+		glUniform3f(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
 		GLProgram::checkGLError();
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.position);
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.textureCoordinate);
+		_glVertexArray.bind();
 
 		glBindTexture(GL_TEXTURE_2D, _texture->getTextureId());
 		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -378,99 +323,28 @@ void BillBoard::renderGBuffer()
 // Sprite2DƂ̈Ⴂ͐[xeXgONɂĂ邱Ƃ
 void BillBoard::renderForward()
 {
-	_renderForwardCommand.init([=]
-	{
 #if defined(MGRRENDERER_USE_DIRECT3D)
-		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-
-		// TODO:ւ񋤒ʉȁBB
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
-		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
-
-		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
-
-		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
-
-		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		const Color4F& multiplyColor = Color4F(Color3B(getColor().r, getColor().g, getColor().b), getOpacity());
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
-
-		// bV͂ЂƂ
-		UINT strides[1] = {sizeof(_quadrangle.topLeft)};
-		UINT offsets[1] = {0};
-		direct3dContext->IASetVertexBuffers(0, _d3dProgramForForwardRendering.getVertexBuffers(0).size(), _d3dProgramForForwardRendering.getVertexBuffers(0).data(), strides, offsets);
-		direct3dContext->IASetIndexBuffer(_d3dProgramForForwardRendering.getIndexBuffer(0, 0), DXGI_FORMAT_R32_UINT, 0);
-		direct3dContext->IASetInputLayout(_d3dProgramForForwardRendering.getInputLayout());
-		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
-
-		_d3dProgramForForwardRendering.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForForwardRendering.setConstantBuffersToDirect3DContext(direct3dContext);
-
-		ID3D11ShaderResourceView* resourceView[1] = { _texture->getShaderResourceView() };
-		direct3dContext->PSSetShaderResources(0, 1, resourceView);
-		ID3D11SamplerState* samplerState[1] = { Director::getRenderer().getLinearSamplerState() };
-		direct3dContext->PSSetSamplers(0, 1, samplerState);
-
-		direct3dContext->DrawIndexed(4, 0, 0);
+	// CeBOȂ̂ŁAeNX`̃r{[hƂ܂Ƃ߂ĕ`悷
+	addQuadToSpriteBatch(Director::getCamera());
 #elif defined(MGRRENDERER_USE_OPENGL)
+	// OpenGLł̓CgƉevZĂ̂ł܂Ƃ߂ȂB1`悷
+	_renderForwardCommand.init([=]
+	{
 		// cocos2d-xTriangleCommandsĂ`ȁBBeNX`oChTexture2DłĂ̂ɑvH
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
+		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
 		static const Mat4& depthBiasMatrix = Mat4::createScale(Vec3(0.5f, 0.5f, 0.5f)) * Mat4::createTranslation(Vec3(1.0f, 1.0f, 1.0f));
 		glUniformMatrix4fv(
-			_glProgramForForwardRendering.getUniformLocation("u_depthBiasMatrix"),
+			_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DEPTH_BIAS_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)depthBiasMatrix.m
@@ -483,7 +357,7 @@ void BillBoard::renderForward()
 		Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 		Color3B lightColor = ambientLight->getColor();
 		float intensity = ambientLight->getIntensity();
-		glUniform3f(_glProgramForForwardRendering.getUniformLocation("u_ambientLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::AMBIENT_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 		GLProgram::checkGLError();
 
 
@@ -493,41 +367,40 @@ void BillBoard::renderForward()
 		if (directionalLight != nullptr)
 		{
 			glUniform1i(
-				_glProgramForForwardRendering.getUniformLocation("u_directionalLightIsValid"),
+				_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_IS_VALID),
 				1
 			);
 			GLProgram::checkGLError();
 
 			lightColor = directionalLight->getColor();
 			intensity = directionalLight->getIntensity();
-			glUniform3f(_glProgramForForwardRendering.getUniformLocation("u_directionalLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 			GLProgram::checkGLError();
 
 			Vec3 direction = directionalLight->getDirection();
 			direction.normalize();
-			glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_directionalLightDirection"), 1, (GLfloat*)&direction);
+			glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_DIRECTION), 1, (GLfloat*)&direction);
 			GLProgram::checkGLError();
 
 			if (directionalLight->hasShadowMap())
 			{
 				glUniformMatrix4fv(
-					_glProgramForForwardRendering.getUniformLocation("u_directionalLightViewMatrix"),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_VIEW_MATRIX),
 					1,
 					GL_FALSE,
 					(GLfloat*)directionalLight->getShadowMapData().viewMatrix.m
 				);
 
 				glUniformMatrix4fv(
-					_glProgramForForwardRendering.getUniformLocation("u_directionalLightProjectionMatrix"),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_PROJECTION_MATRIX),
 					1,
 					GL_FALSE,
 					(GLfloat*)directionalLight->getShadowMapData().projectionMatrix.m
 				);
 
-				glActiveTexture(GL_TEXTURE1);
+				glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_DIRECTIONAL_LIGHT_SHADOW_MAP);
 				GLuint textureId = directionalLight->getShadowMapData().getDepthTexture()->getTextureId();
 				glBindTexture(GL_TEXTURE_2D, textureId);
-				glUniform1i(_glProgramForForwardRendering.getUniformLocation("u_directionalLightShadowMap"), 0);
 				glActiveTexture(GL_TEXTURE0);
 			}
 		}
@@ -538,54 +411,52 @@ void BillBoard::renderForward()
 			const PointLight* pointLight = scene.getPointLight(i);
 			if (pointLight != nullptr)
 			{
-				glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_IS_VALID, i), 1);
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 				GLProgram::checkGLError();
 
 				lightColor = pointLight->getColor();
 				intensity = pointLight->getIntensity();
-				glUniform3f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 
 				GLProgram::checkGLError();
 
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / pointLight->getRange());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 				GLProgram::checkGLError();
 
 				glUniform1i(
-					glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 					pointLight->hasShadowMap()
 				);
 				//glUniform1i(
-				//	_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 				//	pointLight->hasShadowMap()
 				//);
 
 				if (pointLight->hasShadowMap())
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 					//);
 
-					glActiveTexture(GL_TEXTURE2 + i);
+					glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP + i);
 					GLuint textureId = pointLight->getShadowMapData().getDepthTexture()->getTextureId();
 					glBindTexture(GL_TEXTURE_CUBE_MAP, textureId);
-					glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")).c_str()), 1 + i);
-					//glUniform1i(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")), 5 + i);
 					glActiveTexture(GL_TEXTURE0);
 				}
 			}
@@ -597,99 +468,91 @@ void BillBoard::renderForward()
 			const SpotLight* spotLight = scene.getSpotLight(i);
 			if (spotLight != nullptr)
 			{
-				glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_IS_VALID, i), 1);
 				GLProgram::checkGLError();
 
 				lightColor = spotLight->getColor();
 				intensity = spotLight->getIntensity();
-				glUniform3f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 				GLProgram::checkGLError();
 
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&spotLight->getPosition());
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&spotLight->getPosition());
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
 				GLProgram::checkGLError();
 
 				Vec3 direction = spotLight->getDirection();
 				direction.normalize();
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&direction);
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&direction);
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / spotLight->getRange());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / spotLight->getRange());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getInnerAngleCos());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getInnerAngleCos());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getOuterAngleCos());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getOuterAngleCos());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
 				GLProgram::checkGLError();
 
 				glUniform1i(
-					glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 					spotLight->hasShadowMap()
 				);
 				//glUniform1i(
-				//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 				//	spotLight->hasShadowMap()
 				//);
 
 				if (spotLight->hasShadowMap())
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 					//);
 
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 					//);
 
-					glActiveTexture(GL_TEXTURE6 + i);
+					glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP + i);
 					GLuint textureId = spotLight->getShadowMapData().getDepthTexture()->getTextureId();
 					glBindTexture(GL_TEXTURE_2D, textureId);
-					glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")).c_str()), 5 + i);
-					//glUniform1i(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")), 9 + i);
 					glActiveTexture(GL_TEXTURE0);
 				}
 			}
 		}
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.position);
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.textureCoordinate);
+		_glVertexArray.bind();
 
 		glBindTexture(GL_TEXTURE_2D, _texture->getTextureId());
 		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-#endif
+		GLVertexArray::unbind();
 	});
 
 	Director::getRenderer().addCommand(&_renderForwardCommand);
+#endif
 }
 
 } // namespace mgrrenderer
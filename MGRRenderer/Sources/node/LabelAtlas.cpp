@@ -1,15 +1,16 @@
 #include "LabelAtlas.h"
 #include "renderer/Director.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "renderer/D3DTexture.h"
+#elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLTexture.h"
-#include "renderer/Shaders.h"
+#endif
 
 namespace mgrrenderer
 {
 
 LabelAtlas::LabelAtlas() :
-#if defined(MGRRENDERER_USE_OPENGL)
 _texture(nullptr),
-#endif
 _mapStartCharacter(0),
 _itemWidth(0),
 _itemHeight(0)
@@ -18,14 +19,11 @@ _itemHeight(0)
 
 LabelAtlas::~LabelAtlas()
 {
-#if defined(MGRRENDERER_USE_OPENGL)
-	glBindTexture(GL_TEXTURE_2D, 0);
 	_texture = nullptr;
-#endif
 }
 
-#if defined(MGRRENDERER_USE_OPENGL)
-bool LabelAtlas::init(const std::string& string, const GLTexture* texture, float itemWidth, float itemHeight, char mapStartChararcter)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+bool LabelAtlas::init(const std::string& string, const D3DTexture* texture, float itemWidth, float itemHeight, char mapStartChararcter)
 {
 	_texture = texture;
 
@@ -35,10 +33,22 @@ bool LabelAtlas::init(const std::string& string, const GLTexture* texture, float
 
 	setString(string);
 
-	_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionTexture.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureMultiplyColor.glsl");
+	return true;
+}
+#elif defined(MGRRENDERER_USE_OPENGL)
+bool LabelAtlas::init(const std::string& string, const GLTexture* texture, float itemWidth, float itemHeight, char mapStartChararcter)
+{
+	_texture = texture;
+
+	_mapStartCharacter = mapStartChararcter;
+	_itemWidth = itemWidth;
+	_itemHeight = itemHeight;
+
+	setString(string);
 
 	return true;
 }
+#endif
 
 void LabelAtlas::setString(const std::string& string)
 {
@@ -52,9 +62,7 @@ void LabelAtlas::setString(const std::string& string)
 
 	size_t len = _string.length();
 	_vertices.clear();
-	_vertices.resize(4 * len); // GL_TRIANGLESg4p`̏d̓CfbNXŔr̂4_
-	_indices.clear();
-	_indices.resize(6 * len); // GL_TRIANGLESĝň4p`6
+	_vertices.resize(4 * len); // 4p`̏dSpriteBatcher̃CfbNXŔr̂4_
 
 	for (size_t i = 0; i < len; ++i)
 	{
@@ -77,17 +85,8 @@ void LabelAtlas::setString(const std::string& string)
 		_vertices[4 * i + 1].position = Vec2(i * _itemWidth, 0.0f);
 		_vertices[4 * i + 2].position = Vec2((i + 1) * _itemWidth, _itemHeight);
 		_vertices[4 * i + 3].position = Vec2((i + 1) * _itemWidth, 0.0f);
-
-		// TODO:glDrawElementsgĂāACfbNX͒Pɑ₵Ă邾Œ_̏d͍lĂȂBƌ邩
-		_indices[6 * i] = static_cast<unsigned short>(4 * i);
-		_indices[6 * i + 1] = static_cast<unsigned short>(4 * i + 1);
-		_indices[6 * i + 2] = static_cast<unsigned short>(4 * i + 2);
-		_indices[6 * i + 3] = static_cast<unsigned short>(4 * i + 3);
-		_indices[6 * i + 4] = static_cast<unsigned short>(4 * i + 2);
-		_indices[6 * i + 5] = static_cast<unsigned short>(4 * i + 1);
 	}
 }
-#endif
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 void LabelAtlas::renderGBuffer()
@@ -98,44 +97,25 @@ void LabelAtlas::renderGBuffer()
 
 void LabelAtlas::renderForward()
 {
-	_renderForwardCommand.init([=]
+	if (_vertices.size() == 0)
 	{
-#if defined(MGRRENDERER_USE_OPENGL)
-		if (_indices.size() == 0)
-		{
-			// ܂ݒĂȂƂ͕`悵ȂB`悷glVertexAttribPointer0CfbNXɃANZX̂ŃG[ɂȂB
-			return;
-		}
-
-		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
-		GLProgram::checkGLError();
-
-		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
-		GLProgram::checkGLError();
-
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getProjectionMatrix().m);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
-		GLProgram::checkGLError();
-
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_vertices[0].position);
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_vertices[0].textureCoordinate);
+		// ܂ݒĂȂƂ͕`悵Ȃ
+		return;
+	}
 
-		glBindTexture(GL_TEXTURE_2D, _texture->getTextureId());
-		GLProgram::checkGLError();
-		glDrawElements(GL_TRIANGLES, _indices.size(), GL_UNSIGNED_SHORT, &_indices[0]);
-		GLProgram::checkGLError();
+	// eNX`̑̃xXvCgƂ܂Ƃ߂ĕ`悷
+	SpriteBatchRenderCommand::Material material;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	material.texture = _texture->getShaderResourceView();
+#elif defined(MGRRENDERER_USE_OPENGL)
+	material.texture = _texture->getTextureId();
 #endif
-	});
+	material.blendMode = SpriteBatchRenderCommand::BlendMode::ALPHA;
+	material.camera = &Director::getCameraFor2D();
 
-	Director::getRenderer().addCommand(&_renderForwardCommand);
+	// Node̕sx0sŁA傫قǓB_J[̃At@Ƃ͋tȂ̂Ŕ]ēn
+	const Color3B& color = getColor();
+	Director::getRenderer().addSpriteQuads(material, _vertices.data(), _vertices.size() / 4, getModelMatrix(), Color4B(color.r, color.g, color.b, static_cast<unsigned char>((1.0f - getOpacity()) * 255.0f)));
 }
 
 } // namespace mgrrenderer
@@ -1,13 +1,15 @@
 #pragma once
 #include "Node.h"
-#include "renderer/GLProgram.h"
-#include "renderer/CustomRenderCommand.h"
 #include "renderer/Director.h"
 
 namespace mgrrenderer
 {
 
+#if defined(MGRRENDERER_USE_DIRECT3D)
+class D3DTexture;
+#elif defined(MGRRENDERER_USE_OPENGL)
 class GLTexture;
+#endif
 
 class LabelAtlas : public Node
 {
@@ -16,21 +18,23 @@ public:
 
 	LabelAtlas();
 	~LabelAtlas();
-#if defined(MGRRENDERER_USE_OPENGL)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	bool init(const std::string& string, const D3DTexture* texture, float itemWidth, float itemHeight, char mapStartChararcter);
+#elif defined(MGRRENDERER_USE_OPENGL)
 	bool init(const std::string& string, const GLTexture* texture, float itemWidth, float itemHeight, char mapStartChararcter);
-	void setString(const std::string& string);
 #endif
+	void setString(const std::string& string);
 
 private:
-#if defined(MGRRENDERER_USE_OPENGL)
-	GLProgram _glProgramForForwardRendering;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	const D3DTexture* _texture;
+#elif defined(MGRRENDERER_USE_OPENGL)
 	const GLTexture* _texture;
 #endif
-	CustomRenderCommand _renderForwardCommand;
 	char _mapStartCharacter;
 	std::string _string;
+	// 11lp`ŁAQuadrangle2DƓ_ɕׂĂB`RendererSpriteBatcherł܂Ƃ߂čs
 	std::vector<Position2DTextureCoordinates> _vertices;
-	std::vector<unsigned short> _indices;
 	float _itemWidth;
 	float _itemHeight;
 
@@ -54,23 +54,6 @@ _direction(direction)
 #endif
 }
 
-DirectionalLight::~DirectionalLight()
-{
-#if defined(MGRRENDERER_USE_DIRECT3D)
-	if (_shadowMapData.depthTexture != nullptr)
-	{
-		delete _shadowMapData.depthTexture;
-		_shadowMapData.depthTexture = nullptr;
-	}
-#elif defined(MGRRENDERER_USE_OPENGL)
-	if (_shadowMapData.depthFrameBuffer != nullptr)
-	{
-		delete _shadowMapData.depthFrameBuffer;
-		_shadowMapData.depthFrameBuffer = nullptr;
-	}
-#endif
-}
-
 void DirectionalLight::setColor(const Color3B& color)
 {
 	Light::setColor(color);
@@ -100,24 +83,16 @@ void DirectionalLight::initShadowMap(const Vec3& cameraPosition, float nearClip,
 
 	_shadowMapData.projectionMatrix = Mat4::createOrthographicAtCenter((float)size.width, (float)size.height, nearClip, farClip);
 
-	// fvXeNX`쐬
+	// fvXeNX`̎̂Scenẽt[Otꎞ\[XƂĊ蓖Ă̂ŁA傫oĂ
+	_shadowMapData.size = size;
+
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	_constantBufferData.hasShadowMap = 1.0f;
 
 	_constantBufferData.viewMatrix = _shadowMapData.viewMatrix.createTranspose();
 	_constantBufferData.projectionMatrix = (Mat4::CHIRARITY_CONVERTER * _shadowMapData.projectionMatrix).transpose(); // nϊs̓vWFNVsɍŏ炩Ă
-
-	_shadowMapData.depthTexture = new D3DTexture();
-	_shadowMapData.depthTexture->initDepthStencilTexture(size);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	_hasShadowMap = true;
-
-	_shadowMapData.depthFrameBuffer = new GLFrameBuffer();
-	std::vector<GLenum> drawBuffer;
-	drawBuffer.push_back(GL_NONE);
-	std::vector<GLenum> pixelFormats;
-	pixelFormats.push_back(GL_DEPTH_COMPONENT);
-	_shadowMapData.depthFrameBuffer->initWithTextureParams(drawBuffer, pixelFormats, false, false, size);
 #endif
 }
 
@@ -260,7 +235,9 @@ void PointLight::initShadowMap(float nearClip, unsigned int size)
 		_range // far clip
 	);
 
-	// fvXeNX`쐬
+	// fvXeNX`̎̂Scenẽt[Ot蓖Ă
+	_shadowMapData.size = SizeUint(size, size);
+
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	_constantBufferData.hasShadowMap = 1.0f;
 
@@ -270,18 +247,8 @@ void PointLight::initShadowMap(float nearClip, unsigned int size)
 	{
 		_constantBufferData.viewMatrices[i] = _shadowMapData.viewMatrices[i].createTranspose();
 	}
-
-	_shadowMapData.depthTexture = new D3DTexture();
-	_shadowMapData.depthTexture->initDepthStencilCubeMapTexture(size);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	_hasShadowMap = true;
-
-	_shadowMapData.depthFrameBuffer = new GLFrameBuffer();
-	std::vector<GLenum> drawBuffer;
-	drawBuffer.push_back(GL_NONE);
-	std::vector<GLenum> pixelFormats;
-	pixelFormats.push_back(GL_DEPTH_COMPONENT);
-	_shadowMapData.depthFrameBuffer->initWithTextureParams(drawBuffer, pixelFormats, false, true, SizeUint(size, size));
 #endif
 }
 
@@ -418,24 +385,16 @@ void SpotLight::initShadowMap(float nearClip, const SizeUint& size)
 		_range // far clip
 	);
 
-	// fvXeNX`쐬
+	// fvXeNX`̎̂Scenẽt[Ot蓖Ă
+	_shadowMapData.size = size;
+
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	_constantBufferData.hasShadowMap = 1.0f;
 
 	_constantBufferData.viewMatrix = _shadowMapData.viewMatrix.createTranspose();
 	_constantBufferData.projectionMatrix = (Mat4::CHIRARITY_CONVERTER * _shadowMapData.projectionMatrix).transpose(); // nϊs̓vWFNVsɍŏ炩Ă
-
-	_shadowMapData.depthTexture = new D3DTexture();
-	_shadowMapData.depthTexture->initDepthStencilTexture(size);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	_hasShadowMap = true;
-
-	_shadowMapData.depthFrameBuffer = new GLFrameBuffer();
-	std::vector<GLenum> drawBuffer;
-	drawBuffer.push_back(GL_NONE);
-	std::vector<GLenum> pixelFormats;
-	pixelFormats.push_back(GL_DEPTH_COMPONENT);
-	_shadowMapData.depthFrameBuffer->initWithTextureParams(drawBuffer, pixelFormats, false, false, size);
 #endif
 }
 
@@ -85,8 +85,9 @@ public:
 	{
 		Mat4 viewMatrix;
 		Mat4 projectionMatrix;
+		SizeUint size; // t[Otɍ点fvXeNX`̑傫
 #if defined(MGRRENDERER_USE_DIRECT3D)
-		D3DTexture* depthTexture;
+		D3DTexture* depthTexture; // LȂ
 
 		D3DTexture* getDepthTexture() const
 		{
@@ -95,7 +96,7 @@ public:
 
 		ShadowMapData() : depthTexture(nullptr) {};
 #elif defined(MGRRENDERER_USE_OPENGL)
-		GLFrameBuffer* depthFrameBuffer;
+		GLFrameBuffer* depthFrameBuffer; // LȂ
 
 		GLTexture* getDepthTexture() const
 		{
@@ -121,7 +122,6 @@ public:
 #endif
 
 	DirectionalLight(const Vec3& direction, const Color3B& color);
-	~DirectionalLight();
 
 	LightType getLightType() const override { return LightType::DIRECTION; };
 	const Vec3& getDirection() const { return _direction; }
@@ -133,6 +133,12 @@ public:
 	void initShadowMap(const Vec3& cameraPosition, float nearClip, float farClip, const SizeUint& size);
 	bool hasShadowMap() const override;
 	const ShadowMapData& getShadowMapData() const { return _shadowMapData; }
+	// VhE}bv̎̂̓t[Ott[compile()Ŋ蓖Ă̂ŁǍɓn
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	void setShadowMapTexture(D3DTexture* depthTexture) { _shadowMapData.depthTexture = depthTexture; }
+#elif defined(MGRRENDERER_USE_OPENGL)
+	void setShadowMapFrameBuffer(GLFrameBuffer* depthFrameBuffer) { _shadowMapData.depthFrameBuffer = depthFrameBuffer; }
+#endif
 	void prepareShadowMapRendering();
 	float getNearClip() const { Logger::logAssert(hasShadowMap(), "VhE}bvĂȂ̂ɎĂÕ\bhĂяoB"); return _nearClip; }
 	float getFarClip() const { Logger::logAssert(hasShadowMap(), "VhE}bvĂȂ̂ɎĂÕ\bhĂяoB"); return _farClip; }
@@ -162,8 +168,9 @@ public:
 		// Ԃ́AxAxAyAyAzAz
 		Mat4 viewMatrices[(size_t)CubeMapFace::NUM_CUBEMAP_FACE];
 		Mat4 projectionMatrix;
+		SizeUint size; // t[Otɍ点fvXeNX`̑傫BL[u}bvȂ̂widthgȂ
 #if defined(MGRRENDERER_USE_DIRECT3D)
-		D3DTexture* depthTexture;
+		D3DTexture* depthTexture; // LȂ
 
 		D3DTexture* getDepthTexture() const
 		{
@@ -172,7 +179,7 @@ public:
 
 		ShadowMapData() : depthTexture(nullptr) {};
 #elif defined(MGRRENDERER_USE_OPENGL)
-		GLFrameBuffer* depthFrameBuffer;
+		GLFrameBuffer* depthFrameBuffer; // LȂ
 
 		GLTexture* getDepthTexture() const
 		{
@@ -212,6 +219,12 @@ public:
 	void initShadowMap(float nearClip, unsigned int size);
 	bool hasShadowMap() const override;
 	const ShadowMapData& getShadowMapData() const { return _shadowMapData; }
+	// VhE}bv̎̂̓t[Ott[compile()Ŋ蓖Ă̂ŁǍɓn
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	void setShadowMapTexture(D3DTexture* depthTexture) { _shadowMapData.depthTexture = depthTexture; }
+#elif defined(MGRRENDERER_USE_OPENGL)
+	void setShadowMapFrameBuffer(GLFrameBuffer* depthFrameBuffer) { _shadowMapData.depthFrameBuffer = depthFrameBuffer; }
+#endif
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	void prepareShadowMapRendering();
 #elif defined(MGRRENDERER_USE_OPENGL)
@@ -247,8 +260,9 @@ public:
 	{
 		Mat4 viewMatrix;
 		Mat4 projectionMatrix;
+		SizeUint size; // t[Otɍ点fvXeNX`̑傫
 #if defined(MGRRENDERER_USE_DIRECT3D)
-		D3DTexture* depthTexture;
+		D3DTexture* depthTexture; // LȂ
 
 		D3DTexture* getDepthTexture() const
 		{
@@ -257,7 +271,7 @@ public:
 
 		ShadowMapData() : depthTexture(nullptr) {};
 #elif defined(MGRRENDERER_USE_OPENGL)
-		GLFrameBuffer* depthFrameBuffer;
+		GLFrameBuffer* depthFrameBuffer; // LȂ
 
 		GLTexture* getDepthTexture() const
 		{
@@ -302,6 +316,12 @@ public:
 	void initShadowMap(float nearClip, const SizeUint& size);
 	bool hasShadowMap() const override;
 	const ShadowMapData& getShadowMapData() const { return _shadowMapData; }
+	// VhE}bv̎̂̓t[Ott[compile()Ŋ蓖Ă̂ŁǍɓn
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	void setShadowMapTexture(D3DTexture* depthTexture) { _shadowMapData.depthTexture = depthTexture; }
+#elif defined(MGRRENDERER_USE_OPENGL)
+	void setShadowMapFrameBuffer(GLFrameBuffer* depthFrameBuffer) { _shadowMapData.depthFrameBuffer = depthFrameBuffer; }
+#endif
 	void prepareShadowMapRendering();
 	float getNearClip() const { Logger::logAssert(hasShadowMap(), "VhE}bvĂȂ̂ɎĂÕ\bhĂяoB"); return _nearClip; }
 
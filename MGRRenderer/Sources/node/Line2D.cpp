@@ -120,7 +120,7 @@ bool Line2D::initWithVertexArray(const std::vector<Vec2>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 
 	// Viewsp
 	constantBuffer = nullptr;
@@ -130,7 +130,7 @@ bool Line2D::initWithVertexArray(const std::vector<Vec2>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 
 	// Projectionsp
 	constantBuffer = nullptr;
@@ -140,7 +140,7 @@ bool Line2D::initWithVertexArray(const std::vector<Vec2>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 
 	constantBufferDesc.ByteWidth = sizeof(Color4F); // getColor()Color3Bɂ12oCgEȂ̂16oCgÊ߂ɃpfBOf[^˂΂ȂȂ
 	// ZF
@@ -151,9 +151,13 @@ bool Line2D::initWithVertexArray(const std::vector<Vec2>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPosition.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionMultiplyColor.glsl");
+
+	_glVertexArray.init();
+	size_t bufferIndex = _glVertexArray.addVertexBuffer(_vertexArray.data(), sizeof(_vertexArray[0]) * _vertexArray.size(), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, bufferIndex, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, 0, 0);
 #endif
 
 	return true;
@@ -173,59 +177,21 @@ void Line2D::renderForward()
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCameraFor2D().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCameraFor2D().getProjectionMatrix()).transpose();// nϊs̓vWFNVsɍŏ炩Ă
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color3B(getColor().r, getColor().g, getColor().b), getOpacity());
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
 		// bV͂ЂƂ
 		UINT strides[1] = {sizeof(Vec2)};
@@ -236,30 +202,28 @@ void Line2D::renderForward()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_LINELIST);
 
 		_d3dProgramForForwardRendering.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForForwardRendering.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForForwardRendering, direct3dContext);
 
 		direct3dContext->DrawIndexed(_vertexArray.size(), 0, 0);
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
+		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
 		glLineWidth(1.0f);
 		GLProgram::checkGLError();
 
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)&_vertexArray[0]);
-		GLProgram::checkGLError();
+		_glVertexArray.bind();
 		glDrawArrays(GL_LINES, 0, _vertexArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
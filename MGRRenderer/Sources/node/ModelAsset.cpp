@@ -0,0 +1,939 @@
+#include "ModelAsset.h"
+#include "loader/BinaryReader.h"
+#include "loader/BinaryWriter.h"
+#include "loader/CookedModelFormat.h"
+#include "loader/MeshSplitter.h"
+#include "loader/ObjLoader.h"
+#include "renderer/Image.h"
+#include "renderer/Director.h"
+#include "utility/FileUtility.h"
+#include "utility/Logger.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "renderer/D3DProgram.h"
+#include "renderer/D3DTexture.h"
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "renderer/GLTexture.h"
+#endif
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+
+namespace mgrrenderer
+{
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+static ID3D11Buffer* createStaticBuffer(ID3D11Device* direct3dDevice, UINT bindFlags, const void* data, size_t byteSize)
+{
+	D3D11_BUFFER_DESC bufferDesc;
+	bufferDesc.Usage = D3D11_USAGE_DEFAULT;
+	bufferDesc.ByteWidth = static_cast<UINT>(byteSize);
+	bufferDesc.BindFlags = bindFlags;
+	bufferDesc.CPUAccessFlags = 0;
+	bufferDesc.MiscFlags = 0;
+	bufferDesc.StructureByteStride = 0;
+
+	D3D11_SUBRESOURCE_DATA subData;
+	subData.pSysMem = data;
+	subData.SysMemPitch = 0;
+	subData.SysMemSlicePitch = 0;
+
+	ID3D11Buffer* buffer = nullptr;
+	HRESULT result = direct3dDevice->CreateBuffer(&bufferDesc, &subData, &buffer);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+		return nullptr;
+	}
+
+	return buffer;
+}
+#endif
+
+ModelAsset::ModelAsset() :
+_isObj(false),
+_isC3b(false),
+_meshDatas(nullptr),
+_perVertexByteSize(0),
+_boundingSphereRadius(0.0f),
+_shininess(0.0f),
+_needsAlphaTest(false)
+{
+}
+
+ModelAsset::~ModelAsset()
+{
+	if (_meshDatas != nullptr)
+	{
+		delete _meshDatas;
+		_meshDatas = nullptr;
+	}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	for (ID3D11Buffer* vertexBuffer : _vertexBuffers)
+	{
+		vertexBuffer->Release();
+	}
+	_vertexBuffers.clear();
+
+	for (const std::vector<ID3D11Buffer*>& indexBufferList : _indexBuffers)
+	{
+		for (ID3D11Buffer* indexBuffer : indexBufferList)
+		{
+			indexBuffer->Release();
+		}
+	}
+	_indexBuffers.clear();
+
+	for (D3DTexture* texture : _textures)
+#elif defined(MGRRENDERER_USE_OPENGL)
+	for (GLVertexArray* vertexArray : _vertexArrays)
+	{
+		delete vertexArray;
+	}
+	_vertexArrays.clear();
+
+	for (GLTexture* texture : _textures)
+#endif
+	{
+		delete texture;
+	}
+	_textures.clear();
+	_textureFilePaths.clear();
+}
+
+const AnimationClip* ModelAsset::findAnimationClip(const std::string& animationName) const
+{
+	auto it = _animationClips.find(animationName);
+	return (it != _animationClips.end()) ? &it->second : nullptr;
+}
+
+bool ModelAsset::initWithFile(const std::string& filePath, bool splitLargeMeshes)
+{
+	const std::string& ext = filePath.substr(filePath.length() - 4, 4);
+	bool isSucceeded = false;
+	if (ext == CookedModelFormat::EXTENSION)
+	{
+		isSucceeded = initWithCookedFile(filePath);
+	}
+	else
+	{
+		isSucceeded = initWithSourceFile(filePath, splitLargeMeshes);
+	}
+
+	if (!isSucceeded)
+	{
+		return false;
+	}
+
+	for (const std::string& textureFileName : _textureFileNames)
+	{
+		addTexture(_directoryPath + textureFileName);
+	}
+
+	return createBuffers();
+}
+
+bool ModelAsset::initWithSourceFile(const std::string& filePath, bool splitLargeMeshes)
+{
+	const std::string& ext = filePath.substr(filePath.length() - 4, 4);
+	if (ext == ".obj")
+	{
+		return initWithObj(filePath, splitLargeMeshes);
+	}
+	else if (ext == ".c3t" || ext == ".c3b")
+	{
+		return initWithC3b(filePath, ext == ".c3b");
+	}
+	else
+	{
+		Logger::logAssert(false, "ΉĂȂgq%s", ext.c_str());
+		return false;
+	}
+}
+
+bool ModelAsset::initWithObj(const std::string& filePath, bool splitLargeMeshes)
+{
+	_isObj = true;
+
+	std::vector<ObjLoader::MeshData> meshList;
+	std::vector<ObjLoader::MaterialData> materialList;
+
+	const std::string& err = ObjLoader::loadObj(filePath, meshList, materialList);
+	if (!err.empty())
+	{
+		Logger::log(err.c_str());
+		return false;
+	}
+
+	// materialList͌󖳎
+	// TODO:MeshData͂̎_Ń}eAƂɂ܂Ƃ܂ĂȂ̂ł́HfaceGroup܂Ƃ܂ĂH
+	// ܂Ƃ܂ĂBA̓}eA͈ނƂOł
+	for (size_t meshIndex = 0; meshIndex < meshList.size(); ++meshIndex)
+	{
+		const ObjLoader::MeshData& mesh = meshList[meshIndex];
+
+		std::vector<std::vector<unsigned int>> subMeshIndices;
+		std::vector<int> subMeshDiffuseTextureIndices;
+		for (const auto& subMesh : mesh.subMeshMap)
+		{
+			subMeshIndices.push_back(subMesh.second);
+			subMeshDiffuseTextureIndices.push_back(subMesh.first);
+		}
+
+		if (!splitLargeMeshes || mesh.vertices.size() <= MeshIndices::MAX_NUM_VERTICES_FOR_UINT16)
+		{
+			addObjMesh(mesh.vertices, subMeshIndices, subMeshDiffuseTextureIndices);
+			continue;
+		}
+
+		// 16bitCfbNXŕ`钸_Ƃ̃bVɕāAꂼʂ̃bVƂĎ
+		std::vector<MeshSplitter::Part> parts;
+		MeshSplitter::split(mesh.vertices.size(), subMeshIndices, MeshIndices::MAX_NUM_VERTICES_FOR_UINT16, parts);
+		Logger::log("obj̃bV𕪊: name=%s vertices=%u meshes=%u", mesh.name.c_str(), static_cast<unsigned int>(mesh.vertices.size()), static_cast<unsigned int>(parts.size()));
+
+		for (const MeshSplitter::Part& part : parts)
+		{
+			std::vector<Position3DNormalTextureCoordinates> vertices(part.vertexIndices.size());
+			for (size_t i = 0; i < part.vertexIndices.size(); ++i)
+			{
+				vertices[i] = mesh.vertices[part.vertexIndices[i]];
+			}
+
+			addObjMesh(vertices, part.subMeshIndices, subMeshDiffuseTextureIndices);
+		}
+	}
+
+	// SbVǉI_verticesList̗vfȂȂĂw
+	for (const std::vector<Position3DNormalTextureCoordinates>& vertices : _verticesList)
+	{
+		_vertexDataList.push_back(DataRange(vertices.data(), sizeof(Position3DNormalTextureCoordinates) * vertices.size()));
+	}
+
+	const std::string& fullPath = FileUtility::getInstance()->getFullPathForFileName(filePath);
+	_directoryPath = fullPath.substr(0, fullPath.find_last_of("\\/") + 1);
+
+	// TubV̓}eA̔ԍĂ邪AeNX`diffuseTexturê}eA̕Ȃ̂ŃeNX`̔ԍɒ
+	std::vector<int> materialTextureIndices(materialList.size(), CookedModelFormat::NO_DIFFUSE_TEXTURE);
+	for (size_t i = 0; i < materialList.size(); ++i)
+	{
+		// TODO:Ƃ肠diffuseTextureɑΉ
+		if (!materialList[i].diffuseTextureName.empty())
+		{
+			materialTextureIndices[i] = static_cast<int>(_textureFileNames.size());
+			_textureFileNames.push_back(materialList[i].diffuseTextureName);
+		}
+
+		// ̃eNX`(map_d)w肵}eA΁AdiffuseTexturẽAt@Ŕ
+		// diffuseTexturẽAt@XyL̃}XNȂǂɎgĂ郂f̂ŁAAt@邾ł͔Ȃ
+		if (!materialList[i].alphaTextureName.empty())
+		{
+			_needsAlphaTest = true;
+		}
+	}
+
+	for (std::vector<int>& diffuseTextureIndices : _diffuseTextureIndices)
+	{
+		for (int& diffuseTextureIndex : diffuseTextureIndices)
+		{
+			bool hasMaterial = (diffuseTextureIndex >= 0 && static_cast<size_t>(diffuseTextureIndex) < materialTextureIndices.size());
+			diffuseTextureIndex = hasMaterial ? materialTextureIndices[diffuseTextureIndex] : CookedModelFormat::NO_DIFFUSE_TEXTURE;
+		}
+	}
+
+	return true;
+}
+
+void ModelAsset::addObjMesh(const std::vector<Position3DNormalTextureCoordinates>& vertices, const std::vector<std::vector<unsigned int>>& subMeshIndices, const std::vector<int>& subMeshDiffuseTextureIndices)
+{
+	std::vector<MeshIndices> indicesList;
+	std::vector<int> diffuseTextureIndices;
+	for (size_t i = 0; i < subMeshIndices.size(); ++i)
+	{
+		// bVɂ͎Op`1ȂTubVB̃obt@͍Ȃ̂ŏ
+		if (subMeshIndices[i].empty())
+		{
+			continue;
+		}
+
+		indicesList.push_back(MeshIndices(subMeshIndices[i]));
+		diffuseTextureIndices.push_back(subMeshDiffuseTextureIndices[i]);
+	}
+
+	_verticesList.push_back(vertices);
+	_indicesList.push_back(indicesList);
+	_diffuseTextureIndices.push_back(diffuseTextureIndices);
+}
+
+bool ModelAsset::initWithC3b(const std::string& filePath, bool isBinary)
+{
+	_isC3b = true; // TODO:̃tO͔ɂ
+
+	_meshDatas = new (std::nothrow)C3bLoader::MeshDatas();
+	C3bLoader::MaterialDatas materialDatas;
+	// m[h̃c[̓XPgɕR͎gȂ̂ŁA[h̊Ԃ
+	C3bLoader::NodeDatas nodeDatas;
+	C3bLoader::AnimationDatas animationDatas;
+	std::string err;
+	if (isBinary)
+	{
+		err = C3bLoader::loadC3b(filePath, *_meshDatas, materialDatas, nodeDatas, animationDatas);
+	}
+	else
+	{
+		err = C3bLoader::loadC3t(filePath, *_meshDatas, materialDatas, nodeDatas, animationDatas);
+	}
+
+	if (!err.empty())
+	{
+		Logger::log(err.c_str());
+		return false;
+	}
+
+	Logger::logAssert(_meshDatas->meshDatas.size() == 1, "󃁃bVɂ͑ΉĂȂB");
+	const C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
+	std::vector<MeshIndices> indicesList;
+	for (const C3bLoader::MeshData::IndexArray& subMeshIndices : meshData->subMeshIndices)
+	{
+		indicesList.push_back(MeshIndices(subMeshIndices));
+	}
+	_indicesList.push_back(indicesList);
+
+	_vertexAttributes = meshData->attributes;
+	_perVertexByteSize = 0;
+
+	for (const C3bLoader::MeshVertexAttribute& attrib : _vertexAttributes)
+	{
+		_perVertexByteSize += attrib.attributeSizeBytes;
+	}
+
+	_vertexDataList.push_back(DataRange(meshData->vertices.data(), sizeof(float) * meshData->vertices.size()));
+
+	computeBoundingSphere();
+
+	// C3bLoader̓eNX`̃pXɃft@C̃fBNgĕԂ̂ŁAcookedfɏ悤ɊOĂ
+	_directoryPath = filePath.substr(0, filePath.find_last_of('/') + 1);
+
+	C3bLoader::MaterialData* materialData = materialDatas.materialDatas[0];
+	const C3bLoader::TextureData& texture = materialData->textures[0];
+	if (texture.fileName.compare(0, _directoryPath.size(), _directoryPath) == 0)
+	{
+		_textureFileNames.push_back(texture.fileName.substr(_directoryPath.size()));
+	}
+	else
+	{
+		_textureFileNames.push_back(texture.fileName);
+	}
+	_ambient = materialData->ambient;
+	_diffuse = materialData->diffuse;
+	_specular = materialData->specular;
+	//_emissive = materialData->emissive;
+	//_opacity = materialData->opacity;
+	_shininess = materialData->shininess;
+
+	// TRANSPARENCỸeNX`}eÁAeNX`̃At@Ŕ
+	for (const C3bLoader::TextureData& materialTexture : materialData->textures)
+	{
+		if (materialTexture.type == C3bLoader::TextureData::Usage::TRANSPARENCY)
+		{
+			_needsAlphaTest = true;
+		}
+	}
+
+	// t[{[ŌȂĂ悤ɁAXPgzɕRAAj[ṼWCgԍňgbNɕϊĂ
+	const C3bLoader::ModelData* modelData = nodeDatas.nodes[0]->modelNodeDatas[0]; //TODO: nodesɗvf͈Apartsɂł邱ƂOɂĂ
+	if (!_skeleton.initWithNodeDatas(nodeDatas, modelData->bones, modelData->invBindPose))
+	{
+		return false;
+	}
+
+	for (const auto& it : animationDatas.animations)
+	{
+		AnimationClip& clip = _animationClips[it.first];
+		clip.initWithAnimationData(*it.second, _skeleton.getJointNames());
+
+		const AnimationClip::CompressionStats& stats = clip.getCompressionStats();
+		Logger::log("Aj[Vk: name=%s keys=%u->%u bytes=%u->%u ratio=%.2f maxError translation=%f rotation=%f scale=%f",
+			it.first.c_str(),
+			static_cast<unsigned int>(stats.numSourceKeys),
+			static_cast<unsigned int>(stats.numKeys),
+			static_cast<unsigned int>(stats.sourceByteSize),
+			static_cast<unsigned int>(stats.byteSize),
+			stats.getCompressionRatio(),
+			stats.maxTranslationError,
+			stats.maxRotationError,
+			stats.maxScaleError);
+	}
+
+	return true;
+}
+
+// offsetbyteSizeoCgsizeoCg͈̔͂Ɏ܂Ă邩BZӂȂ悤ɈZŔׂ
+static bool isRangeInBounds(size_t offset, size_t byteSize, size_t size)
+{
+	return offset <= size && byteSize <= size - offset;
+}
+
+static bool isAligned(size_t offset, size_t alignment)
+{
+	return offset % alignment == 0;
+}
+
+static bool areIndicesInRange(const MeshIndices& indices, size_t numVertices)
+{
+	for (size_t i = 0; i < indices.getNumIndices(); ++i)
+	{
+		if (indices.getIndex(i) >= numVertices)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ModelAsset::initWithCookedFile(const std::string& filePath)
+{
+	if (!_cookedFile.open(filePath))
+	{
+		return false;
+	}
+
+	const unsigned char* fileData = _cookedFile.getData();
+	size_t fileSize = _cookedFile.getSize();
+	if (fileSize < sizeof(CookedModelFormat::Header) || memcmp(fileData, CookedModelFormat::MAGIC, sizeof(CookedModelFormat::MAGIC)) != 0)
+	{
+		Logger::log("cookedf̃t@Cł͂ȂBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	const CookedModelFormat::Header* header = reinterpret_cast<const CookedModelFormat::Header*>(fileData);
+	if (header->version != CookedModelFormat::VERSION)
+	{
+		Logger::log("cookedf̃o[WႤ̂ŁAcookKvBpath=%s version=%u expected=%u", filePath.c_str(), header->version, CookedModelFormat::VERSION);
+		return false;
+	}
+
+	// \ƃf[^t@CɎ܂Ă邱ƂɊm߂Ă΁Aȍ~̓}bv\̂ƂĒړǂ߂
+	if (!isRangeInBounds(header->meshTableOffset, sizeof(CookedModelFormat::MeshEntry) * header->numMeshes, fileSize)
+		|| !isRangeInBounds(header->subMeshTableOffset, sizeof(CookedModelFormat::SubMeshEntry) * header->numSubMeshes, fileSize)
+		|| !isRangeInBounds(header->metadataOffset, header->metadataByteSize, fileSize)
+		|| !isAligned(header->meshTableOffset, CookedModelFormat::DATA_ALIGNMENT)
+		|| !isAligned(header->subMeshTableOffset, CookedModelFormat::DATA_ALIGNMENT)
+		|| (header->modelType != CookedModelFormat::ModelType::OBJ && header->modelType != CookedModelFormat::ModelType::C3B))
+	{
+		Logger::log("cookedf̃wb_ĂBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	_isObj = (header->modelType == CookedModelFormat::ModelType::OBJ);
+	_isC3b = (header->modelType == CookedModelFormat::ModelType::C3B);
+
+	const CookedModelFormat::MeshEntry* meshTable = reinterpret_cast<const CookedModelFormat::MeshEntry*>(fileData + header->meshTableOffset);
+	const CookedModelFormat::SubMeshEntry* subMeshTable = reinterpret_cast<const CookedModelFormat::SubMeshEntry*>(fileData + header->subMeshTableOffset);
+	for (size_t meshIndex = 0; meshIndex < header->numMeshes; ++meshIndex)
+	{
+		const CookedModelFormat::MeshEntry& mesh = meshTable[meshIndex];
+		if (!isRangeInBounds(mesh.vertexDataOffset, mesh.vertexDataByteSize, fileSize)
+			|| !isRangeInBounds(mesh.indexDataOffset, mesh.indexDataByteSize, fileSize)
+			|| !isAligned(mesh.vertexDataOffset, CookedModelFormat::DATA_ALIGNMENT)
+			|| !isAligned(mesh.indexDataOffset, CookedModelFormat::DATA_ALIGNMENT)
+			|| mesh.firstSubMesh > header->numSubMeshes
+			|| mesh.numSubMeshes > header->numSubMeshes - mesh.firstSubMesh)
+		{
+			Logger::log("cookedf̃bV̕\ĂBpath=%s mesh=%u", filePath.c_str(), static_cast<unsigned int>(meshIndex));
+			return false;
+		}
+
+		_vertexDataList.push_back(DataRange(fileData + mesh.vertexDataOffset, mesh.vertexDataByteSize));
+		_cookedIndexDataList.push_back(DataRange(fileData + mesh.indexDataOffset, mesh.indexDataByteSize));
+
+		std::vector<MeshIndices> indicesList;
+		std::vector<int> diffuseTextureIndices;
+		for (size_t i = mesh.firstSubMesh; i < mesh.firstSubMesh + mesh.numSubMeshes; ++i)
+		{
+			const CookedModelFormat::SubMeshEntry& subMesh = subMeshTable[i];
+			MeshIndices::Format format = static_cast<MeshIndices::Format>(subMesh.format);
+			if (format != MeshIndices::Format::UINT16 && format != MeshIndices::Format::UINT32)
+			{
+				Logger::log("cookedf̃CfbNX̃tH[}bgsBpath=%s", filePath.c_str());
+				return false;
+			}
+
+			// CfbNX̓Rs[Ƀ}bvt@C̒w
+			MeshIndices indices(format, fileData + mesh.indexDataOffset + subMesh.indexOffset, subMesh.numIndices);
+			if (!isRangeInBounds(subMesh.indexOffset, indices.getByteSize(), mesh.indexDataByteSize) || !isAligned(subMesh.indexOffset, indices.getStride()))
+			{
+				Logger::log("cookedf̃TubV̕\ĂBpath=%s", filePath.c_str());
+				return false;
+			}
+
+			indicesList.push_back(indices);
+			diffuseTextureIndices.push_back(subMesh.diffuseTextureIndex);
+		}
+
+		_indicesList.push_back(indicesList);
+		_diffuseTextureIndices.push_back(diffuseTextureIndices);
+	}
+
+	const std::string& fullPath = FileUtility::getInstance()->getFullPathForFileName(filePath);
+	_directoryPath = fullPath.substr(0, fullPath.find_last_of("\\/") + 1);
+
+	if (!readCookedMetadata(fileData + header->metadataOffset, header->metadataByteSize))
+	{
+		Logger::log("cookedf̃^f[^ǂ߂ȂBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	if (_isC3b && (_vertexDataList.size() != 1 || _indicesList[0].empty() || _perVertexByteSize == 0))
+	{
+		Logger::log("cookedfc3t/c3b̃bVsBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	// `掞̓eNX`ԍƃCfbNXŔzⒸ_obt@̂ŁA^f[^Ŕ͈͂Ɏ܂Ă邩m߂Ă
+	size_t perVertexByteSize = _isC3b ? _perVertexByteSize : sizeof(Position3DNormalTextureCoordinates);
+	for (size_t meshIndex = 0; meshIndex < _vertexDataList.size(); ++meshIndex)
+	{
+		if (_vertexDataList[meshIndex].byteSize % perVertexByteSize != 0)
+		{
+			Logger::log("cookedf̒_f[^̑傫_̑傫̔{łȂBpath=%s mesh=%u", filePath.c_str(), static_cast<unsigned int>(meshIndex));
+			return false;
+		}
+
+		size_t numVertices = _vertexDataList[meshIndex].byteSize / perVertexByteSize;
+		for (size_t subMeshIndex = 0; subMeshIndex < _indicesList[meshIndex].size(); ++subMeshIndex)
+		{
+			int diffuseTextureIndex = _diffuseTextureIndices[meshIndex][subMeshIndex];
+			if (diffuseTextureIndex < CookedModelFormat::NO_DIFFUSE_TEXTURE || (diffuseTextureIndex >= 0 && static_cast<size_t>(diffuseTextureIndex) >= _textureFileNames.size()))
+			{
+				Logger::log("cookedf̃TubṼeNX`ԍsBpath=%s mesh=%u index=%d", filePath.c_str(), static_cast<unsigned int>(meshIndex), diffuseTextureIndex);
+				return false;
+			}
+
+			if (!areIndicesInRange(_indicesList[meshIndex][subMeshIndex], numVertices))
+			{
+				Logger::log("cookedf̃CfbNX_𒴂ĂBpath=%s mesh=%u", filePath.c_str(), static_cast<unsigned int>(meshIndex));
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool ModelAsset::readCookedMetadata(const unsigned char* metadata, size_t byteSize)
+{
+	if (byteSize == 0)
+	{
+		return false;
+	}
+
+	BinaryReader reader;
+	reader.init(metadata, byteSize);
+
+	// ͂ǂAvfƂɏȂƂ4oCg̒̂ŁAc̃oCg1/4𒴂ĂΉĂ
+	unsigned int numTextures = 0;
+	if (reader.read(&numTextures, 4, 1) != 1 || numTextures > reader.getRemainingLength() / 4)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < numTextures; ++i)
+	{
+		_textureFileNames.push_back(reader.readString());
+	}
+
+	unsigned int needsAlphaTest = 0;
+	if (reader.read(&_ambient, sizeof(float), 3) != 3
+		|| reader.read(&_diffuse, sizeof(float), 3) != 3
+		|| reader.read(&_specular, sizeof(float), 3) != 3
+		|| reader.read(&_shininess, sizeof(float), 1) != 1
+		|| reader.read(&needsAlphaTest, 4, 1) != 1
+		|| reader.read(&_boundingSphereCenter, sizeof(float), 3) != 3
+		|| reader.read(&_boundingSphereRadius, sizeof(float), 1) != 1)
+	{
+		return false;
+	}
+
+	_needsAlphaTest = (needsAlphaTest != 0);
+
+	if (!_isC3b)
+	{
+		return true;
+	}
+
+	unsigned int numAttributes = 0;
+	if (reader.read(&numAttributes, 4, 1) != 1 || numAttributes > reader.getRemainingLength() / 4)
+	{
+		return false;
+	}
+
+	_perVertexByteSize = 0;
+	for (size_t i = 0; i < numAttributes; ++i)
+	{
+		const std::string& attributeName = reader.readString();
+		unsigned int size = 0;
+		if (reader.read(&size, 4, 1) != 1)
+		{
+			return false;
+		}
+
+		_vertexAttributes.push_back(C3bLoader::createMeshVertexAttribute(attributeName, size));
+		_perVertexByteSize += _vertexAttributes.back().attributeSizeBytes;
+	}
+
+	if (!_skeleton.initWithCookedData(reader))
+	{
+		return false;
+	}
+
+	unsigned int numAnimationClips = 0;
+	if (reader.read(&numAnimationClips, 4, 1) != 1)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < numAnimationClips; ++i)
+	{
+		const std::string& animationName = reader.readString();
+		if (!_animationClips[animationName].initWithCookedData(reader))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ModelAsset::writeCookedFile(const std::string& filePath) const
+{
+	// ^f[^BreadCookedMetadataƓɏ
+	BinaryWriter metadata;
+	unsigned int numTextures = static_cast<unsigned int>(_textureFileNames.size());
+	metadata.write(&numTextures, 4, 1);
+	for (const std::string& textureFileName : _textureFileNames)
+	{
+		metadata.writeString(textureFileName);
+	}
+
+	metadata.write(&_ambient, sizeof(float), 3);
+	metadata.write(&_diffuse, sizeof(float), 3);
+	metadata.write(&_specular, sizeof(float), 3);
+	metadata.write(&_shininess, sizeof(float), 1);
+	unsigned int needsAlphaTest = _needsAlphaTest ? 1 : 0;
+	metadata.write(&needsAlphaTest, 4, 1);
+	metadata.write(&_boundingSphereCenter, sizeof(float), 3);
+	metadata.write(&_boundingSphereRadius, sizeof(float), 1);
+
+	if (_isC3b)
+	{
+		unsigned int numAttributes = static_cast<unsigned int>(_vertexAttributes.size());
+		metadata.write(&numAttributes, 4, 1);
+		for (const C3bLoader::MeshVertexAttribute& attrib : _vertexAttributes)
+		{
+			const std::string& attributeName = C3bLoader::getMeshVertexAttributeName(attrib);
+			if (attributeName.empty())
+			{
+				Logger::log("cookedfɏȂ_Bpath=%s", filePath.c_str());
+				return false;
+			}
+
+			unsigned int size = static_cast<unsigned int>(attrib.size);
+			metadata.writeString(attributeName);
+			metadata.write(&size, 4, 1);
+		}
+
+		_skeleton.writeCookedData(metadata);
+
+		unsigned int numAnimationClips = static_cast<unsigned int>(_animationClips.size());
+		metadata.write(&numAnimationClips, 4, 1);
+		for (const auto& it : _animationClips)
+		{
+			metadata.writeString(it.first);
+			it.second.writeCookedData(metadata);
+		}
+	}
+
+	// _ƃCfbNX̃f[^BItZbg͂f[^̐擪琔Awb_̑傫܂Ăt@C擪ɒ
+	BinaryWriter data;
+	std::vector<CookedModelFormat::MeshEntry> meshTable(_vertexDataList.size());
+	std::vector<CookedModelFormat::SubMeshEntry> subMeshTable;
+	for (size_t meshIndex = 0; meshIndex < _vertexDataList.size(); ++meshIndex)
+	{
+		CookedModelFormat::MeshEntry& mesh = meshTable[meshIndex];
+
+		data.align(CookedModelFormat::DATA_ALIGNMENT);
+		mesh.vertexDataOffset = static_cast<unsigned int>(data.tell());
+		mesh.vertexDataByteSize = static_cast<unsigned int>(_vertexDataList[meshIndex].byteSize);
+		data.write(_vertexDataList[meshIndex].data, 1, _vertexDataList[meshIndex].byteSize);
+
+		// OpenGLł̓bṼCfbNX̂܂1̃CfbNXobt@ɂł悤ɁAcreateBuffersƓ4oCgEŘA
+		data.align(CookedModelFormat::DATA_ALIGNMENT);
+		mesh.indexDataOffset = static_cast<unsigned int>(data.tell());
+		mesh.firstSubMesh = static_cast<unsigned int>(subMeshTable.size());
+		mesh.numSubMeshes = static_cast<unsigned int>(_indicesList[meshIndex].size());
+		for (size_t subMeshIndex = 0; subMeshIndex < _indicesList[meshIndex].size(); ++subMeshIndex)
+		{
+			const MeshIndices& indices = _indicesList[meshIndex][subMeshIndex];
+			data.align(sizeof(unsigned int));
+
+			CookedModelFormat::SubMeshEntry subMesh;
+			subMesh.indexOffset = static_cast<unsigned int>(data.tell() - mesh.indexDataOffset);
+			subMesh.numIndices = static_cast<unsigned int>(indices.getNumIndices());
+			subMesh.format = static_cast<unsigned int>(indices.getFormat());
+			subMesh.diffuseTextureIndex = CookedModelFormat::NO_DIFFUSE_TEXTURE;
+			if (meshIndex < _diffuseTextureIndices.size())
+			{
+				// ǂݍݎɔ͈͊ÕeNX`ԍ͒êŁAeNX`wĂȂ̂̓eNX`ȂƂď
+				int diffuseTextureIndex = _diffuseTextureIndices[meshIndex][subMeshIndex];
+				if (diffuseTextureIndex >= 0 && static_cast<size_t>(diffuseTextureIndex) < _textureFileNames.size())
+				{
+					subMesh.diffuseTextureIndex = diffuseTextureIndex;
+				}
+			}
+			subMeshTable.push_back(subMesh);
+
+			data.write(indices.getData(), 1, indices.getByteSize());
+		}
+		mesh.indexDataByteSize = static_cast<unsigned int>(data.tell() - mesh.indexDataOffset);
+	}
+
+	CookedModelFormat::Header header;
+	memcpy(header.magic, CookedModelFormat::MAGIC, sizeof(header.magic));
+	header.version = CookedModelFormat::VERSION;
+	header.modelType = _isC3b ? CookedModelFormat::ModelType::C3B : CookedModelFormat::ModelType::OBJ;
+	header.numMeshes = static_cast<unsigned int>(meshTable.size());
+	header.numSubMeshes = static_cast<unsigned int>(subMeshTable.size());
+
+	BinaryWriter file;
+	file.write(&header, sizeof(header), 1);
+	file.align(CookedModelFormat::DATA_ALIGNMENT);
+	header.meshTableOffset = static_cast<unsigned int>(file.tell());
+	file.write(meshTable.data(), sizeof(CookedModelFormat::MeshEntry), meshTable.size());
+	file.align(CookedModelFormat::DATA_ALIGNMENT);
+	header.subMeshTableOffset = static_cast<unsigned int>(file.tell());
+	file.write(subMeshTable.data(), sizeof(CookedModelFormat::SubMeshEntry), subMeshTable.size());
+	file.align(CookedModelFormat::DATA_ALIGNMENT);
+	header.metadataOffset = static_cast<unsigned int>(file.tell());
+	header.metadataByteSize = static_cast<unsigned int>(metadata.tell());
+	file.write(metadata.getBuffer().data(), 1, metadata.tell());
+	file.align(CookedModelFormat::DATA_ALIGNMENT);
+
+	size_t dataOffset = file.tell();
+	if (dataOffset + data.tell() > UINT_MAX)
+	{
+		Logger::log("cookedf̃ItZbg32bitɎ܂ȂBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	for (CookedModelFormat::MeshEntry& mesh : meshTable)
+	{
+		mesh.vertexDataOffset += static_cast<unsigned int>(dataOffset);
+		mesh.indexDataOffset += static_cast<unsigned int>(dataOffset);
+	}
+
+	// ItZbg܂wb_ƕ\
+	std::vector<unsigned char> bytes = file.getBuffer();
+	memcpy(bytes.data(), &header, sizeof(header));
+	if (!meshTable.empty())
+	{
+		memcpy(bytes.data() + header.meshTableOffset, meshTable.data(), sizeof(CookedModelFormat::MeshEntry) * meshTable.size());
+	}
+
+	std::ofstream stream(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!stream)
+	{
+		Logger::log("cookedf̃t@CJȂBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+	stream.write(reinterpret_cast<const char*>(data.getBuffer().data()), data.tell());
+	return !stream.fail();
+}
+
+void ModelAsset::computeBoundingSphere()
+{
+	// ʒu̒_擪floatPʂ̃ItZbgT
+	int positionOffset = -1;
+	size_t vertexSizeInFloat = 0;
+	for (const C3bLoader::MeshVertexAttribute& attrib : _vertexAttributes)
+	{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		if (attrib.semantic == D3DProgram::SEMANTIC_POSITION)
+#elif defined(MGRRENDERER_USE_OPENGL)
+		if (attrib.location == GLProgram::AttributeLocation::POSITION)
+#endif
+		{
+			positionOffset = static_cast<int>(vertexSizeInFloat);
+		}
+		vertexSizeInFloat += attrib.attributeSizeBytes / sizeof(float);
+	}
+
+	size_t numVertices = getNumC3bVertices();
+	if (positionOffset < 0 || vertexSizeInFloat == 0 || numVertices == 0)
+	{
+		return;
+	}
+
+	// AABB̒S̒SɂBŏ̋ł͂ȂAJOLOD̔ɂ͏\
+	const float* vertices = getC3bVertices();
+	Vec3 minimum(FLT_MAX, FLT_MAX, FLT_MAX);
+	Vec3 maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+	for (size_t i = 0; i < numVertices; ++i)
+	{
+		const float* position = &vertices[i * vertexSizeInFloat + positionOffset];
+		minimum = Vec3(std::min(minimum.x, position[0]), std::min(minimum.y, position[1]), std::min(minimum.z, position[2]));
+		maximum = Vec3(std::max(maximum.x, position[0]), std::max(maximum.y, position[1]), std::max(maximum.z, position[2]));
+	}
+
+	_boundingSphereCenter = (minimum + maximum) * 0.5f;
+
+	float radiusSquared = 0.0f;
+	for (size_t i = 0; i < numVertices; ++i)
+	{
+		const float* position = &vertices[i * vertexSizeInFloat + positionOffset];
+		Vec3 diff = Vec3(position[0], position[1], position[2]) - _boundingSphereCenter;
+		radiusSquared = std::max(radiusSquared, diff.x * diff.x + diff.y * diff.y + diff.z * diff.z);
+	}
+	_boundingSphereRadius = sqrtf(radiusSquared);
+}
+
+void ModelAsset::addTexture(const std::string& filePath)
+{
+	Image image; // ImageCPŨgĂ̂ł̃XR[vŉĂ悢̂X^bNɎ
+	bool success = image.initWithFilePath(filePath);
+	Logger::logAssert(success, "ModelAssetŃeNX`쐬ɎsB");
+	if (!success)
+	{
+		return;
+	}
+
+	// TextureGPŨgĂ̂ŉƍ̂Ńq[vɂƂ
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	D3DTexture* texture = new D3DTexture();
+#elif defined(MGRRENDERER_USE_OPENGL)
+	GLTexture* texture = new GLTexture();
+#endif
+	success = static_cast<Texture*>(texture)->initWithImage(image); // TODO:ȂÖقɌpNX̃\bhĂׂȂ
+	Logger::logAssert(success, "ModelAssetŃeNX`쐬ɎsB");
+	if (success)
+	{
+		_textures.push_back(texture);
+		_textureFilePaths.push_back(filePath);
+	}
+	else
+	{
+		delete texture;
+	}
+}
+
+bool ModelAsset::createBuffers()
+{
+	// _ƃCfbNX̓\[Xt@C烍[hAcookedfȂ}bvt@C璼ړ]
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	ID3D11Device* direct3dDevice = Director::getRenderer().getDirect3dDevice();
+
+	// MeshData̐̃[v
+	for (const DataRange& vertexData : _vertexDataList)
+	{
+		ID3D11Buffer* vertexBuffer = createStaticBuffer(direct3dDevice, D3D11_BIND_VERTEX_BUFFER, vertexData.data, vertexData.byteSize);
+		if (vertexBuffer == nullptr)
+		{
+			return false;
+		}
+		_vertexBuffers.push_back(vertexBuffer);
+	}
+
+	// subMesh̐̃[v
+	for (const std::vector<MeshIndices>& subMeshIndicesList : _indicesList)
+	{
+		std::vector<ID3D11Buffer*> indexBufferList;
+		for (const MeshIndices& subMeshIndices : subMeshIndicesList)
+		{
+			ID3D11Buffer* indexBuffer = createStaticBuffer(direct3dDevice, D3D11_BIND_INDEX_BUFFER, subMeshIndices.getData(), subMeshIndices.getByteSize());
+			if (indexBuffer == nullptr)
+			{
+				return false;
+			}
+			indexBufferList.push_back(indexBuffer);
+		}
+
+		_indexBuffers.push_back(indexBufferList);
+	}
+#elif defined(MGRRENDERER_USE_OPENGL)
+	if (_isObj)
+	{
+		size_t numMesh = _vertexDataList.size();
+		for (size_t meshIndex = 0; meshIndex < numMesh; ++meshIndex)
+		{
+			const DataRange& vertexData = _vertexDataList[meshIndex];
+
+			GLVertexArray* vertexArray = new GLVertexArray();
+			vertexArray->init();
+
+			size_t bufferIndex = vertexArray->addVertexBuffer(vertexData.data, vertexData.byteSize, GL_STATIC_DRAW);
+			vertexArray->setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, bufferIndex, 3, GL_FLOAT, sizeof(Position3DNormalTextureCoordinates), offsetof(Position3DNormalTextureCoordinates, position));
+			vertexArray->setVertexAttribute((GLuint)GLProgram::AttributeLocation::NORMAL, bufferIndex, 3, GL_FLOAT, sizeof(Position3DNormalTextureCoordinates), offsetof(Position3DNormalTextureCoordinates, normal));
+			vertexArray->setVertexAttribute((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, bufferIndex, 2, GL_FLOAT, sizeof(Position3DNormalTextureCoordinates), offsetof(Position3DNormalTextureCoordinates, textureCoordinate));
+
+			std::vector<size_t> subMeshIndexOffsets;
+			if (!_cookedIndexDataList.empty())
+			{
+				// cookedfcookɓKŘAĂ̂ŁÂ܂ܓ]
+				const DataRange& indexData = _cookedIndexDataList[meshIndex];
+				for (const MeshIndices& subMeshIndices : _indicesList[meshIndex])
+				{
+					subMeshIndexOffsets.push_back(static_cast<size_t>(static_cast<const unsigned char*>(subMeshIndices.getData()) - static_cast<const unsigned char*>(indexData.data)));
+				}
+
+				vertexArray->setIndexBuffer(indexData.data, indexData.byteSize, GL_STATIC_DRAW);
+			}
+			else
+			{
+				// TubVƂɃCfbNX̃rbgႤ̂ŁAoCgƂĘAB32bit̃TubV̐擪4oCgEɂȂ悤ɂ낦
+				std::vector<unsigned char> indices;
+				for (const MeshIndices& subMeshIndices : _indicesList[meshIndex])
+				{
+					size_t offset = (indices.size() + sizeof(unsigned int) - 1) / sizeof(unsigned int) * sizeof(unsigned int);
+					subMeshIndexOffsets.push_back(offset);
+					indices.resize(offset + subMeshIndices.getByteSize());
+					memcpy(indices.data() + offset, subMeshIndices.getData(), subMeshIndices.getByteSize());
+				}
+
+				vertexArray->setIndexBuffer(indices.data(), indices.size(), GL_STATIC_DRAW);
+			}
+
+			_vertexArrays.push_back(vertexArray);
+			_subMeshIndexOffsets.push_back(subMeshIndexOffsets);
+		}
+	}
+	else if (_isC3b)
+	{
+		const DataRange& vertexData = _vertexDataList[0];
+
+		GLVertexArray* vertexArray = new GLVertexArray();
+		vertexArray->init();
+
+		size_t bufferIndex = vertexArray->addVertexBuffer(vertexData.data, vertexData.byteSize, GL_STATIC_DRAW);
+		for (size_t i = 0, offset = 0; i < _vertexAttributes.size(); ++i)
+		{
+			const C3bLoader::MeshVertexAttribute& attrib = _vertexAttributes[i];
+			vertexArray->setVertexAttribute((GLuint)attrib.location, bufferIndex, attrib.size, attrib.type, static_cast<GLsizei>(_perVertexByteSize), sizeof(float) * offset);
+			offset += attrib.size;
+		}
+
+		vertexArray->setIndexBuffer(_indicesList[0][0].getData(), _indicesList[0][0].getByteSize(), GL_STATIC_DRAW);
+
+		_vertexArrays.push_back(vertexArray);
+	}
+#endif
+
+	return true;
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,155 @@
+#pragma once
+#include "Config.h"
+#include "renderer/BasicDataTypes.h"
+#include "loader/C3bLoader.h"
+#include "renderer/MeshIndices.h"
+#include "animation/AnimationClip.h"
+#include "animation/Skeleton.h"
+#include "utility/MappedFile.h"
+#include <map>
+#include <string>
+#include <vector>
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11.h>
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "renderer/GLVertexArray.h"
+#endif
+
+namespace mgrrenderer
+{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	class D3DTexture;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	class GLTexture;
+#endif
+
+// ft@CSĂSprite3DŋLA[hɕύXȂf[^
+// WIgAXPgAAj[VAeNX`AGPŨobt@BModelCache炾AQƃJEgŉ
+// pAj[V̍ĐԂ̓CX^XƂɈႤ̂ŁAɂ͎Sprite3DɎ
+class ModelAsset final
+{
+public:
+	bool isObj() const { return _isObj; }
+	bool isC3b() const { return _isC3b; }
+
+	size_t getNumMeshes() const { return _vertexDataList.size(); }
+	// std::vectoȓKẃAbVƁBbṼ}eAIDƂ
+	// CfbNX̃rbg̓TubVƂɈႤ̂ŁA`掞MeshIndices̃tH[}bggBc3t/c3b[0]ɓĂ
+	const std::vector<std::vector<MeshIndices>>& getIndicesList() const { return _indicesList; }
+	const std::vector<std::vector<int>>& getDiffuseTextureIndices() const { return _diffuseTextureIndices; }
+	// getTextures()Ɠɕ񂾁Aǂݍ߂eNX`̃t@CpXBCPUŃeNX`ƂɎg
+	const std::vector<std::string>& getTextureFilePaths() const { return _textureFilePaths; }
+
+	// ȉobĵ
+	const Position3DNormalTextureCoordinates* getObjVertices(size_t meshIndex) const { return static_cast<const Position3DNormalTextureCoordinates*>(_vertexDataList[meshIndex].data); }
+	size_t getNumObjVertices(size_t meshIndex) const { return _vertexDataList[meshIndex].byteSize / sizeof(Position3DNormalTextureCoordinates); }
+
+	// ȉc3t/c3b̂
+	// TODO:c3t/c3bŃbVf[^͈łO
+	const std::vector<C3bLoader::MeshVertexAttribute>& getVertexAttributes() const { return _vertexAttributes; }
+	// C^[[u_Bcookedfł̓}bvt@C̒w
+	const float* getC3bVertices() const { return static_cast<const float*>(_vertexDataList[0].data); }
+	size_t getNumC3bVertices() const { return (_perVertexByteSize > 0) ? _vertexDataList[0].byteSize / _perVertexByteSize : 0; }
+	size_t getPerVertexByteSize() const { return _perVertexByteSize; }
+	const Skeleton& getSkeleton() const { return _skeleton; }
+	// oCh|[Y̒_͂ދBf̃[JW
+	const Vec3& getBoundingSphereCenter() const { return _boundingSphereCenter; }
+	float getBoundingSphereRadius() const { return _boundingSphereRadius; }
+	// ȂꍇnullptrԂ
+	const AnimationClip* findAnimationClip(const std::string& animationName) const;
+	const Color3F& getAmbient() const { return _ambient; }
+	const Color3F& getDiffuse() const { return _diffuse; }
+	const Color3F& getSpecular() const { return _specular; }
+	float getShininess() const { return _shininess; }
+	// }eAeNX`̃At@Ŕ悤w肵Ă邩B`摤ALPHA_TEST̃VF[_oG[Vg
+	bool needsAlphaTest() const { return _needsAlphaTest; }
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	const std::vector<D3DTexture*>& getTextures() const { return _textures; }
+	// Ԃobt@AddRefĂȂBD3DProgramɎƂ͌ĂяoAddRef
+	ID3D11Buffer* getVertexBuffer(size_t meshIndex) const { return _vertexBuffers[meshIndex]; }
+	ID3D11Buffer* getIndexBuffer(size_t meshIndex, size_t subMeshIndex) const { return _indexBuffers[meshIndex][subMeshIndex]; }
+#elif defined(MGRRENDERER_USE_OPENGL)
+	const std::vector<GLTexture*>& getTextures() const { return _textures; }
+	// ÓIȒ_`悷VAOBobj̃TubṼCfbNX1̃CfbNXobt@ɘAAoCgItZbgŕ`
+	const GLVertexArray* getVertexArray(size_t meshIndex) const { return _vertexArrays[meshIndex]; }
+	const std::vector<std::vector<size_t>>& getSubMeshIndexOffsets() const { return _subMeshIndexOffsets; }
+#endif
+
+private:
+	friend class ModelCache;
+
+	// GPUɓ]f[^͈̔
+	struct DataRange
+	{
+		const void* data;
+		size_t byteSize;
+
+		DataRange(const void* dataVal, size_t byteSizeVal) : data(dataVal), byteSize(byteSizeVal) {}
+	};
+
+	bool _isObj;
+	bool _isC3b;
+	// \[Xt@C烍[hƂ̒_̎́Bobj_verticesListAc3t/c3b_meshDatasɎBcookedfł͎gȂ
+	std::vector<std::vector<Position3DNormalTextureCoordinates>> _verticesList;
+	C3bLoader::MeshDatas* _meshDatas;
+	// bVƂ̒_B\[Xt@C烍[hƂ͏̎̂Acookedfł̓}bvt@C̒w
+	std::vector<DataRange> _vertexDataList;
+	// cookedf̃bVƂɁATubṼCfbNXÁB}bvt@C̒w
+	std::vector<DataRange> _cookedIndexDataList;
+	std::vector<std::vector<MeshIndices>> _indicesList;
+	std::vector<std::vector<int>> _diffuseTextureIndices;
+	// cookedf̃t@CB_ƃCfbNX𒼐ڎwĂ̂ŁAModelAssetĂԂ̓}bv܂܂ɂ
+	MappedFile _cookedFile;
+
+	std::vector<C3bLoader::MeshVertexAttribute> _vertexAttributes;
+	size_t _perVertexByteSize;
+	Vec3 _boundingSphereCenter;
+	float _boundingSphereRadius;
+	Skeleton _skeleton;
+	// [hɃXPg̃WCgԍ̃gbNɕϊAj[VBL[̓^CC
+	std::map<std::string, AnimationClip> _animationClips;
+	// ft@ĈfBNgƁȂ΃pXŕ\eNX`̃t@C
+	std::string _directoryPath;
+	std::vector<std::string> _textureFileNames;
+	std::vector<std::string> _textureFilePaths;
+	//TODO: Texturê͍Ƃ냂ft@CŎwłȂBꖇ݂̂ɑΉ
+	Color3F _ambient;
+	Color3F _diffuse;
+	Color3F _specular;
+	float _shininess;
+	bool _needsAlphaTest;
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	std::vector<D3DTexture*> _textures;
+	std::vector<ID3D11Buffer*> _vertexBuffers;
+	std::vector<std::vector<ID3D11Buffer*>> _indexBuffers;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	std::vector<GLTexture*> _textures;
+	std::vector<GLVertexArray*> _vertexArrays;
+	std::vector<std::vector<size_t>> _subMeshIndexOffsets;
+#endif
+
+	ModelAsset();
+	~ModelAsset();
+	// gqCookedModelFormat::EXTENSIONȂcookedfƂāAȊO̓\[Xt@CƂă[hAeNX`GPŨobt@
+	// splitLargeMeshestrueȂA_16bitCfbNXɎ܂Ȃobj̃bV܂傫ɕ
+	bool initWithFile(const std::string& filePath, bool splitLargeMeshes);
+	// \[Xt@CCPŨɃ[h邾ŁAeNX`GPŨobt@͍ȂBcookɂ͂ꂾg
+	bool initWithSourceFile(const std::string& filePath, bool splitLargeMeshes);
+	bool initWithObj(const std::string& filePath, bool splitLargeMeshes);
+	void addObjMesh(const std::vector<Position3DNormalTextureCoordinates>& vertices, const std::vector<std::vector<unsigned int>>& subMeshIndices, const std::vector<int>& subMeshDiffuseTextureIndices);
+	bool initWithC3b(const std::string& filePath, bool isBinary);
+	bool initWithCookedFile(const std::string& filePath);
+	bool readCookedMetadata(const unsigned char* metadata, size_t byteSize);
+	// initWithSourceFileŃ[hecookedfƂďo
+	bool writeCookedFile(const std::string& filePath) const;
+	void computeBoundingSphere();
+	void addTexture(const std::string& filePath);
+	bool createBuffers();
+
+	ModelAsset(const ModelAsset&) = delete;
+	ModelAsset& operator=(const ModelAsset&) = delete;
+};
+
+} // namespace mgrrenderer
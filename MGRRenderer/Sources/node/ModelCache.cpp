@@ -0,0 +1,100 @@
+#include "ModelCache.h"
+#include "ModelAsset.h"
+#include "utility/FileUtility.h"
+#include "utility/Logger.h"
+
+namespace mgrrenderer
+{
+
+ModelCache* ModelCache::_instance = nullptr;
+
+ModelCache* ModelCache::getInstance()
+{
+	if (_instance == nullptr)
+	{
+		_instance = new ModelCache();
+	}
+
+	return _instance;
+}
+
+void ModelCache::destroy()
+{
+	delete _instance;
+	_instance = nullptr;
+}
+
+ModelCache::ModelCache() : _splitLargeMeshes(false)
+{
+}
+
+ModelCache::~ModelCache()
+{
+	clear();
+}
+
+void ModelCache::clear()
+{
+	for (auto& it : _entries)
+	{
+		delete it.second.model;
+	}
+	_entries.clear();
+}
+
+const ModelAsset* ModelCache::getModel(const std::string& filePath)
+{
+	// ΃pX̏Ăt@CȂ狤L
+	const std::string& fullPath = FileUtility::getInstance()->getFullPathForFileName(filePath);
+
+	auto it = _entries.find(fullPath);
+	if (it != _entries.end())
+	{
+		it->second.referenceCount++;
+		return it->second.model;
+	}
+
+	ModelAsset* model = new ModelAsset();
+	if (!model->initWithFile(filePath, _splitLargeMeshes))
+	{
+		delete model;
+		return nullptr;
+	}
+
+	Entry entry;
+	entry.model = model;
+	entry.referenceCount = 1;
+	_entries[fullPath] = entry;
+	return model;
+}
+
+bool ModelCache::cookModel(const std::string& sourceFilePath, const std::string& cookedFilePath) const
+{
+	// eNX`GPŨobt@͍Ȃ̂ŁA`̃ReLXgȂĂcookł
+	ModelAsset model;
+	return model.initWithSourceFile(sourceFilePath, _splitLargeMeshes) && model.writeCookedFile(cookedFilePath);
+}
+
+void ModelCache::releaseModel(const ModelAsset* model)
+{
+	for (auto it = _entries.begin(); it != _entries.end(); ++it)
+	{
+		if (it->second.model != model)
+		{
+			continue;
+		}
+
+		Logger::logAssert(it->second.referenceCount > 0, "QƃJEgsB");
+		it->second.referenceCount--;
+		if (it->second.referenceCount == 0)
+		{
+			delete it->second.model;
+			_entries.erase(it);
+		}
+		return;
+	}
+
+	// cleařɉꂽf͂łɍ폜ς
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,47 @@
+#pragma once
+#include "Config.h"
+#include <string>
+#include <unordered_map>
+
+namespace mgrrenderer
+{
+class ModelAsset;
+
+// vZXŜŋL郂f̃LbVBpX̃ft@C͈x[hASprite3D̃CX^XԂŋL
+// QÔ悤ɓfʂɒuĂAƃ[hԂ̓f̎ސɂႵȂ
+class ModelCache final
+{
+public:
+	static ModelCache* getInstance();
+	static void destroy();
+	// LbVĂ郂fSĉBfoCXReLXgjOɌĂ
+	void clear();
+
+	// QƃJEg𑝂₵ăfԂB[hɎsƂnullptrԂBsvɂȂreleaseModelĂ
+	const ModelAsset* getModel(const std::string& filePath);
+	void releaseModel(const ModelAsset* model);
+	// _16bitCfbNXɎ܂Ȃobj̃bVA32bitCfbNXŕ`ɕă[hBȍ~Ƀ[h郂fɌ
+	void setSplitLargeMeshes(bool splitLargeMeshes) { _splitLargeMeshes = splitLargeMeshes; }
+	// objAc3tAc3b̃ft@CA}bvĂ̂܂܎gcookedf(CookedModelFormat)ɕϊďo
+	// eNX`̓ft@C̃fBNg̑΃pXŋL^̂ŁAcookedf͌̃ft@CƓfBNgɒu
+	// cookedfgetModelł̃pXn΃[hłBobj̕setSplitLargeMeshes̐ݒcookɍς܂
+	bool cookModel(const std::string& sourceFilePath, const std::string& cookedFilePath) const;
+
+private:
+	struct Entry
+	{
+		ModelAsset* model;
+		size_t referenceCount;
+	};
+
+	static ModelCache* _instance;
+
+	// L[̓tpX
+	std::unordered_map<std::string, Entry> _entries;
+	bool _splitLargeMeshes;
+
+	ModelCache();
+	~ModelCache();
+};
+
+} // namespace mgrrenderer
@@ -52,6 +52,12 @@ void Node::renderForward()
 	// Ȃ
 }
 
+void Node::renderSoftware(SoftwareDeferredRenderer& renderer)
+{
+	// Ȃ
+	(void)renderer;
+}
+
 void Node::setRotation(const Vec3& angleVec) {
 	_rotation = Quaternion(angleVec);
 }
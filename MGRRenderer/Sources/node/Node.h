@@ -8,6 +8,7 @@ namespace mgrrenderer
 class DirectionalLight;
 class PointLight;
 class SpotLight;
+class SoftwareDeferredRenderer;
 
 class Node
 {
@@ -22,6 +23,8 @@ public:
 	virtual void renderPointLightShadowMap(size_t index, const PointLight* light, CubeMapFace face = CubeMapFace::X_POSITIVE);
 	virtual void renderSpotLightShadowMap(size_t index, const SpotLight* light);
 	virtual void renderForward();
+	// GPUg킸ɃfBt@[h̃pX`ƂɁAsȃWIgSoftwareDeferredRendererɓo^
+	virtual void renderSoftware(SoftwareDeferredRenderer& renderer);
 	const Vec3& getPosition() const { return _position; }
 	virtual void setPosition(const Vec3& position) { _position = position; };
 	const Quaternion& getRotation() const { return _rotation; }
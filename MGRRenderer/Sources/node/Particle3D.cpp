@@ -13,6 +13,7 @@ namespace mgrrenderer
 Particle3D::Particle3D() :
 #if defined(MGRRENDERER_USE_OPENGL)
 _texture(nullptr),
+_elapsedTimeBufferIndex(0),
 #endif
 _elapsedTimeMs(0)
 {
@@ -90,7 +91,7 @@ bool Particle3D::initWithParameter(const Particle3D::Parameter& parameter)
 	// Ƃ肠ݒʂ̃p[eBNӂ炻ŏIɂ
 	_glProgramForForwardRendering.initWithShaderString(
 		// vertex shader
-		"#version 430\n"
+		"#version 430 compatibility\n"
 		"attribute vec4 a_position;"
 		"attribute vec3 a_initVelocity;"
 		"attribute float a_elapsedTime;"
@@ -111,7 +112,7 @@ bool Particle3D::initWithParameter(const Particle3D::Parameter& parameter)
 		"}"
 		,
 		// fragment shader
-		"#version 430\n"
+		"#version 430 compatibility\n"
 		"uniform sampler2D u_texture;"
 		"varying float v_opacity;"
 		"void main()"
@@ -124,6 +125,15 @@ bool Particle3D::initWithParameter(const Particle3D::Parameter& parameter)
 		"	}"
 		"}"
 	);
+
+	// ʒuƏ͏ɕςȂ̂ňx]AoߎԂ𖈃t[XV
+	_glVertexArray.init();
+	size_t vertexBufferIndex = _glVertexArray.addVertexBuffer(_vertexArray.data(), sizeof(_vertexArray[0]) * _vertexArray.size(), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, vertexBufferIndex, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, 0, 0);
+	size_t initVelocityBufferIndex = _glVertexArray.addVertexBuffer(_initVelocityArray.data(), sizeof(_initVelocityArray[0]) * _initVelocityArray.size(), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::INIT_VELOCITY, initVelocityBufferIndex, sizeof(_initVelocityArray[0]) / sizeof(GLfloat), GL_FLOAT, 0, 0);
+	_elapsedTimeBufferIndex = _glVertexArray.addVertexBuffer(_elapsedTimeArray.data(), sizeof(_elapsedTimeArray[0]) * _elapsedTimeArray.size(), GL_DYNAMIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::ELAPSED_TIME, _elapsedTimeBufferIndex, sizeof(_elapsedTimeArray[0]) / sizeof(GLfloat), GL_FLOAT, 0, 0);
 #endif
 
 	return true;
@@ -194,38 +204,28 @@ void Particle3D::renderForward()
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
-		GLProgram::checkGLError();
-
-		glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_gravity"), 1, (GLfloat*)&_parameter.gravity);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
-		glUniform1f(_glProgramForForwardRendering.getUniformLocation("u_lifeTime"), _parameter.lifeTime);
-		GLProgram::checkGLError();
-		glUniform1f(_glProgramForForwardRendering.getUniformLocation("u_pointSize"), _parameter.pointSize);
+		glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::GRAVITY), 1, (GLfloat*)&_parameter.gravity);
 		GLProgram::checkGLError();
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
+		glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::LIFE_TIME), _parameter.lifeTime);
 		GLProgram::checkGLError();
-		glEnableVertexAttribArray(_glProgramForForwardRendering.getAttributeLocation("a_initVelocity"));
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray(_glProgramForForwardRendering.getAttributeLocation("a_elapsedTime"));
+		glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_SIZE), _parameter.pointSize);
 		GLProgram::checkGLError();
 
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_vertexArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer(_glProgramForForwardRendering.getAttributeLocation("a_initVelocity"), sizeof(_initVelocityArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_initVelocityArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer(_glProgramForForwardRendering.getAttributeLocation("a_elapsedTime"), sizeof(_elapsedTimeArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_elapsedTimeArray.data());
-		GLProgram::checkGLError();
+		_glVertexArray.updateVertexBuffer(_elapsedTimeBufferIndex, _elapsedTimeArray.data(), sizeof(_elapsedTimeArray[0]) * _elapsedTimeArray.size());
+		_glVertexArray.bind();
 
 		glBindTexture(GL_TEXTURE_2D, _texture->getTextureId());
 
 		int numParticle = static_cast<int>(_parameter.loopFlag ? _parameter.numParticle * _parameter.lifeTime : _parameter.numParticle);
 		glDrawArrays(GL_POINTS, 0, numParticle);
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "Node.h"
 #include "renderer/GLProgram.h"
+#include "renderer/GLVertexArray.h"
 #include "renderer/CustomRenderCommand.h"
 
 namespace mgrrenderer
@@ -32,6 +33,8 @@ private:
 #if defined(MGRRENDERER_USE_OPENGL)
 	GLProgram _glProgramForForwardRendering;
 	GLTexture* _texture;
+	GLVertexArray _glVertexArray;
+	size_t _elapsedTimeBufferIndex;
 #endif
 	CustomRenderCommand _renderForwardCommand;
 	Parameter _parameter;
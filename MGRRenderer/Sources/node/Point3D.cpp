@@ -1,6 +1,7 @@
 #include "Point3D.h"
 #include "renderer/Director.h"
 #include "Camera.h"
+#include <cstddef>
 
 namespace mgrrenderer
 {
@@ -114,7 +115,7 @@ void Point3D::initWithPointArray(const std::vector<Point3DData>& pointArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 
 	// Viewsp
 	constantBuffer = nullptr;
@@ -124,7 +125,7 @@ void Point3D::initWithPointArray(const std::vector<Point3DData>& pointArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 
 	// Projectionsp
 	constantBuffer = nullptr;
@@ -134,7 +135,7 @@ void Point3D::initWithPointArray(const std::vector<Point3DData>& pointArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 
 	constantBufferDesc.ByteWidth = sizeof(Color4F); // getColor()Color3Bɂ12oCgEȂ̂16oCgÊ߂ɃpfBOf[^˂΂ȂȂ
 	// ZF
@@ -145,11 +146,11 @@ void Point3D::initWithPointArray(const std::vector<Point3DData>& pointArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	_glProgramForForwardRendering.initWithShaderString(
 		// vertex shader
-		"#version 430\n"
+		"#version 430 compatibility\n"
 		"attribute vec4 a_position;"
 		"attribute float a_pointSize;"
 		"uniform mat4 u_modelMatrix;"
@@ -162,13 +163,18 @@ void Point3D::initWithPointArray(const std::vector<Point3DData>& pointArray)
 		"}"
 		,
 		// fragment shader
-		"#version 430\n"
+		"#version 430 compatibility\n"
 		"uniform vec3 u_multipleColor;"
 		"void main()"
 		"{"
 		"	gl_FragColor = vec4(u_multipleColor, 1.0);"
 		"}"
 		);
+
+	_glVertexArray.init();
+	size_t bufferIndex = _glVertexArray.addVertexBuffer(_pointArray.data(), sizeof(Point3DData) * _pointArray.size(), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, bufferIndex, sizeof(_pointArray[0].point) / sizeof(GLfloat), GL_FLOAT, sizeof(Point3DData), offsetof(Point3DData, point));
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POINT_SIZE, bufferIndex, sizeof(_pointArray[0].pointSize) / sizeof(GLfloat), GL_FLOAT, sizeof(Point3DData), offsetof(Point3DData, pointSize));
 #endif
 }
 
@@ -186,59 +192,21 @@ void Point3D::renderForward()
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color3B(getColor().r, getColor().g, getColor().b), getOpacity());
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
 		// bV͂ЂƂ
 		UINT strides[1] = {sizeof(Point3DData)};
@@ -249,33 +217,25 @@ void Point3D::renderForward()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_POINTLIST);
 
 		_d3dProgramForForwardRendering.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForForwardRendering.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForForwardRendering, direct3dContext);
 
 		direct3dContext->DrawIndexed(_pointArray.size(), 0, 0);
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
+		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray(_glProgramForForwardRendering.getAttributeLocation("a_pointSize"));
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_pointArray[0].point) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, sizeof(Point3DData), (GLvoid*)&_pointArray[0].point);
-		GLProgram::checkGLError();
-		glVertexAttribPointer(_glProgramForForwardRendering.getAttributeLocation("a_pointSize"), sizeof(_pointArray[0].pointSize) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, sizeof(Point3DData), (GLvoid*)((GLbyte*)&_pointArray[0].pointSize));
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
+		_glVertexArray.bind();
 		glDrawArrays(GL_POINTS, 0, _pointArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -7,6 +7,7 @@
 #include "renderer/D3DProgram.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLProgram.h"
+#include "renderer/GLVertexArray.h"
 #endif
 
 namespace mgrrenderer
@@ -31,6 +32,7 @@ private:
 	D3DProgram _d3dProgramForForwardRendering;
 #elif defined(MGRRENDERER_USE_OPENGL)
 	GLProgram _glProgramForForwardRendering;
+	GLVertexArray _glVertexArray;
 #endif
 	CustomRenderCommand _renderForwardCommand;
 
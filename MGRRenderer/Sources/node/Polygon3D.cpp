@@ -2,6 +2,7 @@
 #include "renderer/Director.h"
 #include "Camera.h"
 #include "Light.h"
+#include "renderer/SoftwareDeferredRenderer.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "renderer/D3DTexture.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
@@ -189,7 +190,7 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::RENDER_MODE, constantBuffer);
 
 	// Modelsp
 	constantBuffer = nullptr;
@@ -199,11 +200,11 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 #endif
 
 	// Viewsp
@@ -214,11 +215,11 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 #endif
 
 	// Projectionsp
@@ -229,11 +230,11 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 #endif
 
 	// fvXoCAXsp
@@ -244,10 +245,10 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
 #endif
 
 	// Normalsp
@@ -258,10 +259,10 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer);
 #endif
 
 	// ZF
@@ -273,10 +274,10 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 #endif
 
 	// ArGgCgJ[
@@ -288,8 +289,8 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, constantBuffer);
 
 	// fBNVigCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(DirectionalLight::ConstantBufferData);
@@ -300,8 +301,8 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
 
 	// |CgCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM;
@@ -312,7 +313,7 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, constantBuffer);
 
 	constantBufferDesc.ByteWidth = sizeof(PointLight::ConstantBufferData);
 	constantBuffer = nullptr;
@@ -322,7 +323,7 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, constantBuffer);
 
 	// X|bgCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM;
@@ -333,33 +334,21 @@ bool Polygon3D::initWithVertexArray(const std::vector<Vec3>& vertexArray)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, constantBuffer);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	// TODO:obj̃VF[_ƂقړBʉB
 	_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionNormal3D.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionNormalMultiplyColor3D.glsl");
 
-	_glProgramForShadowMap.initWithShaderString(
-		// vertex shader
-		// ModelDatagȂꍇ
-		"#version 430\n"
-		"attribute vec4 a_position;"
-		"uniform mat4 u_modelMatrix;"
-		"uniform mat4 u_lightViewMatrix;" // etɎgCgJɌĂr[s
-		"uniform mat4 u_lightProjectionMatrix;"
-		"void main()"
-		"{"
-		"	gl_Position = u_lightProjectionMatrix * u_lightViewMatrix * u_modelMatrix * a_position;"
-		"}"
-		,
-		// fragment shader
-		"#version 430\n"
-		"void main()"
-		"{" // Ƃ[x͎ŏ܂ 
-		"}"
-	);
+	_glProgramForShadowMap.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderShadowMap.glsl", "../MGRRenderer/Resources/shader/FragmentShaderShadowMap.glsl");
 
 	// STRINGIFYɂǂݍ݂ƁAGeForce850M܂#version̍s̉sǂݎĂꂸGLSLRpCG[ɂȂ
 	_glProgramForGBuffer.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionNormal.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionNormalMultiplyColorGBuffer.glsl");
+
+	_glVertexArray.init();
+	size_t vertexBufferIndex = _glVertexArray.addVertexBuffer(_vertexArray.data(), sizeof(_vertexArray[0]) * _vertexArray.size(), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, vertexBufferIndex, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, 0, 0);
+	size_t normalBufferIndex = _glVertexArray.addVertexBuffer(_normalArray.data(), sizeof(_normalArray[0]) * _normalArray.size(), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::NORMAL, normalBufferIndex, sizeof(_normalArray[0]) / sizeof(GLfloat), GL_FLOAT, 0, 0);
 #endif
 
 	return true;
@@ -373,73 +362,26 @@ void Polygon3D::renderGBuffer()
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// m[}s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 normalMatrix = Mat4::CHIRARITY_CONVERTER * Mat4::createNormalMatrix(getModelMatrix());
 		normalMatrix.transpose();
-		CopyMemory(mappedResource.pData, &normalMatrix.m, sizeof(normalMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::NORMAL_MATRIX, &normalMatrix.m, sizeof(normalMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color4B(getColor().r, getColor().g, getColor().b, 255));
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
 		// bV͂ЂƂ
 		UINT strides[2] = {sizeof(Vec3), sizeof(Vec3)};
@@ -450,7 +392,7 @@ void Polygon3D::renderGBuffer()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForGBuffer.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForGBuffer.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForGBuffer, direct3dContext);
 
 		direct3dContext->DrawIndexed(_vertexArray.size(), 0, 0);
 #elif defined(MGRRENDERER_USE_OPENGL)
@@ -458,29 +400,21 @@ void Polygon3D::renderGBuffer()
 		glUseProgram(_glProgramForGBuffer.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform3f(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
+		glUniform3f(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
 		Mat4 normalMatrix = Mat4::createNormalMatrix(getModelMatrix());
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_vertexArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, sizeof(_normalArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_normalArray.data());
-		GLProgram::checkGLError();
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
 
+		_glVertexArray.bind();
 		glDrawArrays(GL_TRIANGLES, 0, (GLsizei)_vertexArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -500,47 +434,18 @@ void Polygon3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightViewMatrix.transpose(); // Direct3Dł͓]uԂœ
-		CopyMemory(mappedResource.pData, &lightViewMatrix.m, sizeof(lightViewMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &lightViewMatrix.m, sizeof(lightViewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightProjectionMatrix = Mat4::CHIRARITY_CONVERTER * lightProjectionMatrix; // nϊs̓vWFNVsɍŏ炩Ă
 		lightProjectionMatrix.transpose();
-		CopyMemory(mappedResource.pData, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
 
 		// bV͂ЂƂ
 		UINT strides[2] = {sizeof(Vec3), sizeof(Vec3)};
@@ -551,17 +456,17 @@ void Polygon3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForShadowMap.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForShadowMap.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForShadowMap, direct3dContext);
 
 		direct3dContext->DrawIndexed(_vertexArray.size(), 0, 0);
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForShadowMap.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightViewMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_VIEW_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightViewMatrix.m
@@ -569,25 +474,17 @@ void Polygon3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 		GLProgram::checkGLError();
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightProjectionMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_PROJECTION_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightProjectionMatrix.m
 		);
 		GLProgram::checkGLError();
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_vertexArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, sizeof(_normalArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_normalArray.data());
-		GLProgram::checkGLError();
-
+		_glVertexArray.bind();
 		glDrawArrays(GL_TRIANGLES, 0, (GLsizei)_vertexArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -604,32 +501,12 @@ void Polygon3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		(void)face;
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForPointLightShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[sƃvWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		CopyMemory(mappedResource.pData, light->getConstantBufferDataPointer(), sizeof(PointLight::ConstantBufferData));
-		direct3dContext->Unmap(_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER), 0);
+		_d3dProgramForPointLightShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, light->getConstantBufferDataPointer(), sizeof(PointLight::ConstantBufferData));
 
 		// bV͂ЂƂ
 		UINT strides[2] = {sizeof(Vec3), sizeof(Vec3)};
@@ -640,18 +517,18 @@ void Polygon3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForPointLightShadowMap.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForPointLightShadowMap.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForPointLightShadowMap, direct3dContext);
 
 		direct3dContext->DrawIndexed(_vertexArray.size(), 0, 0);
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForShadowMap.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
 
 		const Mat4& lightViewMatrix = light->getShadowMapData().viewMatrices[(int)face];
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightViewMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_VIEW_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightViewMatrix.m
@@ -660,25 +537,17 @@ void Polygon3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 
 		const Mat4& lightProjectionMatrix = light->getShadowMapData().projectionMatrix;
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightProjectionMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_PROJECTION_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightProjectionMatrix.m
 		);
 		GLProgram::checkGLError();
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_vertexArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, sizeof(_normalArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_normalArray.data());
-		GLProgram::checkGLError();
-
+		_glVertexArray.bind();
 		glDrawArrays(GL_TRIANGLES, 0, (GLsizei)_vertexArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -698,47 +567,19 @@ void Polygon3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		//TODO:DirectionalLightƑSeBʉ
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
 		
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightViewMatrix.transpose(); // Direct3Dł͓]uԂœ
-		CopyMemory(mappedResource.pData, &lightViewMatrix.m, sizeof(lightViewMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &lightViewMatrix.m, sizeof(lightViewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightProjectionMatrix = Mat4::CHIRARITY_CONVERTER * lightProjectionMatrix; // nϊs̓vWFNVsɍŏ炩Ă
 		lightProjectionMatrix.transpose();
-		CopyMemory(mappedResource.pData, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
 
 		// bV͂ЂƂ
 		UINT strides[2] = {sizeof(Vec3), sizeof(Vec3)};
@@ -749,7 +590,7 @@ void Polygon3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForShadowMap.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForShadowMap.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForShadowMap, direct3dContext);
 
 		direct3dContext->DrawIndexed(_vertexArray.size(), 0, 0);
 #elif defined(MGRRENDERER_USE_OPENGL)
@@ -757,10 +598,10 @@ void Polygon3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 		glUseProgram(_glProgramForShadowMap.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightViewMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_VIEW_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightViewMatrix.m
@@ -768,25 +609,17 @@ void Polygon3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 		GLProgram::checkGLError();
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightProjectionMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_PROJECTION_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightProjectionMatrix.m
 		);
 		GLProgram::checkGLError();
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_vertexArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, sizeof(_normalArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_normalArray.data());
-		GLProgram::checkGLError();
-
+		_glVertexArray.bind();
 		glDrawArrays(GL_TRIANGLES, 0, (GLsizei)_vertexArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
@@ -800,99 +633,34 @@ void Polygon3D::renderForward()
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// render modẽ}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Renderer::RenderMode renderMode = Director::getRenderer().getRenderMode();
-		CopyMemory(mappedResource.pData, &renderMode, sizeof(renderMode));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::RENDER_MODE, &renderMode, sizeof(renderMode));
 
 		// fs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// fvXoCAXs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 depthBiasMatrix = (Mat4::TEXTURE_COORDINATE_CONVERTER * Mat4::createScale(Vec3(0.5f, 0.5f, 1.0f)) * Mat4::createTranslation(Vec3(1.0f, -1.0f, 0.0f))).transpose(); //TODO: Mat4Qƌ^ɂƒlȂĂ܂
-		CopyMemory(mappedResource.pData, &depthBiasMatrix.m, sizeof(depthBiasMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, &depthBiasMatrix.m, sizeof(depthBiasMatrix));
 
 		// m[}s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 normalMatrix = Mat4::CHIRARITY_CONVERTER * Mat4::createNormalMatrix(getModelMatrix());
 		normalMatrix.transpose();
-		CopyMemory(mappedResource.pData, &normalMatrix.m, sizeof(normalMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::NORMAL_MATRIX, &normalMatrix.m, sizeof(normalMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color3B(getColor().r, getColor().g, getColor().b), getOpacity());
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
 		const Scene& scene = Director::getInstance()->getScene();
 
@@ -901,16 +669,7 @@ void Polygon3D::renderForward()
 		Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 
 		// ArGgCgJ[̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		CopyMemory(mappedResource.pData, ambientLight->getConstantBufferDataPointer(), sizeof(AmbientLight::ConstantBufferData));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, ambientLight->getConstantBufferDataPointer(), sizeof(AmbientLight::ConstantBufferData));
 
 
 		// fBNViCg
@@ -925,16 +684,7 @@ void Polygon3D::renderForward()
 				direct3dContext->PSSetShaderResources(0, 1, shaderResouceView);
 			}
 
-			result = direct3dContext->Map(
-				_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, directionalLight->getConstantBufferDataPointer(), sizeof(DirectionalLight::ConstantBufferData));
-			direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER), 0);
+			_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, directionalLight->getConstantBufferDataPointer(), sizeof(DirectionalLight::ConstantBufferData));
 
 			dirLightShadowMapResourceView = directionalLight->getShadowMapData().depthTexture->getShaderResourceView();
 		}
@@ -953,17 +703,8 @@ void Polygon3D::renderForward()
 			}
 		}
 
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-
-		PointLight::ConstantBufferData* pointLightConstBufData = static_cast<PointLight::ConstantBufferData*>(mappedResource.pData);
-		ZeroMemory(pointLightConstBufData, sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM);
+		// mۂ̈̓[NAĂ
+		PointLight::ConstantBufferData* pointLightConstBufData = static_cast<PointLight::ConstantBufferData*>(_d3dProgramForForwardRendering.allocateConstantBufferData(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM));
 
 		size_t numPointLight = scene.getNumPointLight();
 		for (size_t i = 0; i < numPointLight; i++)
@@ -975,8 +716,6 @@ void Polygon3D::renderForward()
 			}
 		}
 
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER), 0);
-
 
 		// X|bgCg̈ʒuW̋t̃}bv
 		std::array<ID3D11ShaderResourceView*, SpotLight::MAX_NUM> spotLightShadowMapResourceView;
@@ -992,17 +731,8 @@ void Polygon3D::renderForward()
 		}
 
 
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-
-		SpotLight::ConstantBufferData* spotLightConstBufData = static_cast<SpotLight::ConstantBufferData*>(mappedResource.pData);
-		ZeroMemory(spotLightConstBufData, sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM);
+		// mۂ̈̓[NAĂ
+		SpotLight::ConstantBufferData* spotLightConstBufData = static_cast<SpotLight::ConstantBufferData*>(_d3dProgramForForwardRendering.allocateConstantBufferData(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM));
 
 		size_t numSpotLight = scene.getNumSpotLight();
 		for (size_t i = 0; i < numSpotLight; i++)
@@ -1014,8 +744,6 @@ void Polygon3D::renderForward()
 			}
 		}
 
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER), 0);
-
 		// bV͂ЂƂ
 		UINT strides[2] = {sizeof(Vec3), sizeof(Vec3)};
 		UINT offsets[2] = {0, 0};
@@ -1025,7 +753,7 @@ void Polygon3D::renderForward()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForForwardRendering.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForForwardRendering.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForForwardRendering, direct3dContext);
 
 		ID3D11ShaderResourceView* shaderResourceViews[1] = {
 			dirLightShadowMapResourceView,
@@ -1044,22 +772,22 @@ void Polygon3D::renderForward()
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_RENDER_MODE), (GLint)Director::getRenderer().getRenderMode());
+		glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::RENDER_MODE), (GLint)Director::getRenderer().getRenderMode());
 
-		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
+		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
 		Mat4 normalMatrix = Mat4::createNormalMatrix(getModelMatrix());
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
 
 		static const Mat4& depthBiasMatrix = Mat4::createScale(Vec3(0.5f, 0.5f, 0.5f)) * Mat4::createTranslation(Vec3(1.0f, 1.0f, 1.0f));
 		glUniformMatrix4fv(
-			_glProgramForForwardRendering.getUniformLocation("u_depthBiasMatrix"),
+			_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DEPTH_BIAS_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)depthBiasMatrix.m
@@ -1072,7 +800,7 @@ void Polygon3D::renderForward()
 		Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 		Color3B lightColor = ambientLight->getColor();
 		float intensity = ambientLight->getIntensity();
-		glUniform3f(_glProgramForForwardRendering.getUniformLocation("u_ambientLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::AMBIENT_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 		GLProgram::checkGLError();
 
 
@@ -1082,41 +810,41 @@ void Polygon3D::renderForward()
 		if (directionalLight != nullptr)
 		{
 			glUniform1i(
-				_glProgramForForwardRendering.getUniformLocation("u_directionalLightIsValid"),
+				_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_IS_VALID),
 				1
 			);
 			GLProgram::checkGLError();
 
 			lightColor = directionalLight->getColor();
 			intensity = directionalLight->getIntensity();
-			glUniform3f(_glProgramForForwardRendering.getUniformLocation("u_directionalLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 			GLProgram::checkGLError();
 
 			Vec3 direction = directionalLight->getDirection();
 			direction.normalize();
-			glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_directionalLightDirection"), 1, (GLfloat*)&direction);
+			glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_DIRECTION), 1, (GLfloat*)&direction);
 			GLProgram::checkGLError();
 
 			if (directionalLight->hasShadowMap())
 			{
 				glUniformMatrix4fv(
-					_glProgramForForwardRendering.getUniformLocation("u_directionalLightViewMatrix"),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_VIEW_MATRIX),
 					1,
 					GL_FALSE,
 					(GLfloat*)directionalLight->getShadowMapData().viewMatrix.m
 				);
 
 				glUniformMatrix4fv(
-					_glProgramForForwardRendering.getUniformLocation("u_directionalLightProjectionMatrix"),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_PROJECTION_MATRIX),
 					1,
 					GL_FALSE,
 					(GLfloat*)directionalLight->getShadowMapData().projectionMatrix.m
 				);
 
-				glActiveTexture(GL_TEXTURE0);
+				glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_DIRECTIONAL_LIGHT_SHADOW_MAP);
 				GLuint textureId = directionalLight->getShadowMapData().getDepthTexture()->getTextureId();
 				glBindTexture(GL_TEXTURE_2D, textureId);
-				glUniform1i(_glProgramForForwardRendering.getUniformLocation("u_directionalLightShadowMap"), 0);
+				glActiveTexture(GL_TEXTURE0);
 			}
 		}
 
@@ -1126,54 +854,52 @@ void Polygon3D::renderForward()
 			const PointLight* pointLight = scene.getPointLight(i);
 			if (pointLight != nullptr)
 			{
-				glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_IS_VALID, i), 1);
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 				GLProgram::checkGLError();
 
 				lightColor = pointLight->getColor();
 				intensity = pointLight->getIntensity();
-				glUniform3f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 
 				GLProgram::checkGLError();
 
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / pointLight->getRange());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 				GLProgram::checkGLError();
 
 				glUniform1i(
-					glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 					pointLight->hasShadowMap()
 				);
 				//glUniform1i(
-				//	_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 				//	pointLight->hasShadowMap()
 				//);
 
 				if (pointLight->hasShadowMap())
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 					//);
 
-					glActiveTexture(GL_TEXTURE1 + i);
+					glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP + i);
 					GLuint textureId = pointLight->getShadowMapData().getDepthTexture()->getTextureId();
 					glBindTexture(GL_TEXTURE_CUBE_MAP, textureId);
-					glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")).c_str()), 1 + i);
-					//glUniform1i(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")), 5 + i);
 					glActiveTexture(GL_TEXTURE0);
 				}
 			}
@@ -1185,100 +911,97 @@ void Polygon3D::renderForward()
 			const SpotLight* spotLight = scene.getSpotLight(i);
 			if (spotLight != nullptr)
 			{
-				glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_IS_VALID, i), 1);
 				GLProgram::checkGLError();
 
 				lightColor = spotLight->getColor();
 				intensity = spotLight->getIntensity();
-				glUniform3f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 				GLProgram::checkGLError();
 
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&spotLight->getPosition());
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&spotLight->getPosition());
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
 				GLProgram::checkGLError();
 
 				Vec3 direction = spotLight->getDirection();
 				direction.normalize();
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&direction);
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&direction);
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / spotLight->getRange());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / spotLight->getRange());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getInnerAngleCos());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getInnerAngleCos());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getOuterAngleCos());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getOuterAngleCos());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
 				GLProgram::checkGLError();
 
 				glUniform1i(
-					glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 					spotLight->hasShadowMap()
 				);
 				//glUniform1i(
-				//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 				//	spotLight->hasShadowMap()
 				//);
 
 				if (spotLight->hasShadowMap())
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 					//);
 
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 					//);
 
-					glActiveTexture(GL_TEXTURE5 + i);
+					glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP + i);
 					GLuint textureId = spotLight->getShadowMapData().getDepthTexture()->getTextureId();
 					glBindTexture(GL_TEXTURE_2D, textureId);
-					glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")).c_str()), 5 + i);
-					//glUniform1i(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")), 9 + i);
 					glActiveTexture(GL_TEXTURE0);
 				}
 			}
 		}
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, sizeof(_vertexArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_vertexArray.data());
-		GLProgram::checkGLError();
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, sizeof(_normalArray[0]) / sizeof(GLfloat), GL_FLOAT, GL_FALSE, 0, (GLvoid*)_normalArray.data());
-		GLProgram::checkGLError();
-
+		_glVertexArray.bind();
 		glDrawArrays(GL_TRIANGLES, 0, (GLsizei)_vertexArray.size());
 		GLProgram::checkGLError();
+		GLVertexArray::unbind();
 #endif
 	});
 
 	Director::getRenderer().addCommand(&_renderForwardCommand);
 }
 
+void Polygon3D::renderSoftware(SoftwareDeferredRenderer& renderer)
+{
+	// Gobt@̃VF[_ƓAeNX`ȂŏZF̂܂ܐFɂ
+	size_t verticesIndex = renderer.addVertices(getModelMatrix(), _vertexArray.data(), _normalArray.data(), _vertexArray.size());
+	renderer.addMesh(verticesIndex, nullptr, std::string(), Color3F(getColor()), false);
+}
+
 } // namespace mgrrenderer
@@ -9,6 +9,7 @@
 #include "renderer/D3DProgram.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLProgram.h"
+#include "renderer/GLVertexArray.h"
 #endif
 
 namespace mgrrenderer
@@ -32,6 +33,7 @@ private:
 	GLProgram _glProgramForGBuffer;
 	GLProgram _glProgramForForwardRendering;
 	GLProgram _glProgramForShadowMap;
+	GLVertexArray _glVertexArray;
 #endif
 
 	std::vector<Vec3> _vertexArray;
@@ -52,6 +54,7 @@ private:
 	void renderPointLightShadowMap(size_t index, const PointLight* light, CubeMapFace face = CubeMapFace::X_POSITIVE) override;
 	void renderSpotLightShadowMap(size_t index, const SpotLight* light) override;
 	void renderForward() override;
+	void renderSoftware(SoftwareDeferredRenderer& renderer) override;
 };
 
 } // namespace mgrrenderer
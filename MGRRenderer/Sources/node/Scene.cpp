@@ -1,6 +1,9 @@
 #include "Scene.h"
 #include "renderer/Director.h"
 #include "Light.h"
+#include "AnimationScheduler.h"
+#include "renderer/SoftwareDeferredRenderer.h"
+#include "utility/Profiler.h"
 
 namespace mgrrenderer
 {
@@ -9,8 +12,14 @@ Scene::Scene() :
 _ambientLight(nullptr),
 _directionalLight(nullptr),
 _numPointLight(0),
-_numSpotLight(0)
-{}
+_numSpotLight(0),
+_backBufferHandle(FrameGraph::INVALID_HANDLE),
+_gBufferHandle(FrameGraph::INVALID_HANDLE),
+_directionalLightShadowMapHandle(FrameGraph::INVALID_HANDLE)
+{
+	_pointLightShadowMapHandles.fill(FrameGraph::INVALID_HANDLE);
+	_spotLightShadowMapHandles.fill(FrameGraph::INVALID_HANDLE);
+}
 
 Scene::~Scene()
 {
@@ -55,11 +64,19 @@ void Scene::init()
 	for (size_t i = 0; i < PointLight::MAX_NUM; i++)
 	{
 		_pointLightList[i] = nullptr;
+		_pointLightShadowMapNames[i] = Profiler::getInstance()->internName("PointLightShadowMap" + std::to_string(i));
+#if defined(MGRRENDERER_USE_OPENGL)
+		for (int face = (int)CubeMapFace::X_POSITIVE; face < (int)CubeMapFace::NUM_CUBEMAP_FACE; face++)
+		{
+			_pointLightShadowMapFacePassNames[i][face] = Profiler::getInstance()->internName("PointLightShadowMap" + std::to_string(i) + "Face" + std::to_string(face));
+		}
+#endif
 	}
 
 	for (size_t i = 0; i < SpotLight::MAX_NUM; i++)
 	{
 		_spotLightList[i] = nullptr;
+		_spotLightShadowMapNames[i] = Profiler::getInstance()->internName("SpotLightShadowMap" + std::to_string(i));
 	}
 
 	// ftHgŃArGgCg
@@ -78,69 +95,163 @@ void Scene::pushNode2D(Node* node)
 
 void Scene::update(float dt)
 {
-	_camera.update(dt);
+	MGRRENDERER_PROFILE_SCOPE("Scene::update");
 
-	for (Node* child : _children)
 	{
-		child->update(dt);
+		MGRRENDERER_PROFILE_SCOPE("Scene::updateNodes");
+
+		_camera.update(dt);
+
+		for (Node* child : _children)
+		{
+			child->update(dt);
+		}
+
+		_cameraFor2D.update(dt);
+
+		for (Node* child : _children2D)
+		{
+			child->update(dt);
+		}
 	}
 
-	_cameraFor2D.update(dt);
+	{
+		MGRRENDERER_PROFILE_SCOPE("Scene::prepareRendering");
 
-	for (Node* child : _children2D)
+		_camera.prepareRendering();
+
+		for (Node* child : _children)
+		{
+			child->prepareRendering();
+		}
+
+		// eSprite3Dupdateœo^ꂽAj[VAJ̌LOD߂Ă܂Ƃ߂ČvZBfs񂪋܂ɍs
+		AnimationScheduler::getInstance()->execute(_camera);
+
+		_cameraFor2D.prepareRendering();
+
+		for (Node* child : _children2D)
+		{
+			child->prepareRendering();
+		}
+	}
+
+	_frameGraph.reset();
+	setupFrameGraph();
+}
+
+void Scene::render()
+{
 	{
-		child->update(dt);
+		MGRRENDERER_PROFILE_SCOPE("FrameGraph::compile");
+		_frameGraph.compile();
 	}
 
-	_camera.prepareRendering();
+	assignFrameGraphResources();
 
-	for (Node* child : _children)
 	{
-		child->prepareRendering();
+		MGRRENDERER_PROFILE_SCOPE("FrameGraph::execute");
+		_frameGraph.execute();
 	}
+}
 
-	_cameraFor2D.prepareRendering();
+void Scene::renderSoftware(SoftwareDeferredRenderer& renderer)
+{
+	MGRRENDERER_PROFILE_SCOPE("Scene::renderSoftware");
 
-	for (Node* child : _children2D)
+	renderer.beginFrame(_camera.getViewMatrix(), _camera.getProjectionMatrix());
+
+	Logger::logAssert(_ambientLight != nullptr, "V[ɃArGgCgȂB");
+	renderer.setAmbientLight(_ambientLight);
+	if (_directionalLight != nullptr)
 	{
-		child->prepareRendering();
+		renderer.setDirectionalLight(_directionalLight);
 	}
 
-#if defined(MGRRENDERER_DEFERRED_RENDERING)
-	//_camera.renderGBuffer();
+	for (size_t i = 0; i < _numPointLight; i++)
+	{
+		renderer.addPointLight(_pointLightList[i]);
+	}
 
-	// s߃f̓fBt@[h_O
-	_prepareGBufferRenderingCommand.init([=]
+	for (size_t i = 0; i < _numSpotLight; i++)
 	{
-		Director::getRenderer().prepareGBufferRendering();
-	});
-	Director::getRenderer().addCommand(&_prepareGBufferRenderingCommand);
+		renderer.addSpotLight(_spotLightList[i]);
+	}
 
+	// Gobt@ƃVhE}bṽpXɂGPUƓs߂ȃm[h`
 	for (Node* child : _children)
 	{
 		if (!child->getIsTransparent())
 		{
-			child->renderGBuffer();
+			child->renderSoftware(renderer);
 		}
 	}
+
+	renderer.render();
+}
+
+void Scene::setupFrameGraph()
+{
+	// s͓ǂݏ̈ˑ猈܂邪AobNobt@̂悤ɓ\[XɏpXm͓o^ɂȂ̂ŁA`揇Ɠɓo^
+	_backBufferHandle = _frameGraph.importResource("BackBuffer");
+	FrameGraph::ResourceHandle backBuffer = _backBufferHandle;
+
+	// Gobt@ƃVhE}bv͈ꎞ\[XƂč点Âcompile()Ŏ̏dȂȂ̓mL
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+	// s߃f̓fBt@[h_O
+	_frameGraph.addPass("GBuffer",
+		[=](FrameGraph::PassBuilder& builder)
+		{
+			_gBufferHandle = builder.createTexture("GBuffer", FrameGraph::ResourceDesc(Director::getInstance()->getWindowSize(), FrameGraph::ResourceFormat::GBUFFER));
+		},
+		[=]
+		{
+			//_camera.renderGBuffer();
+
+			_prepareGBufferRenderingCommand.init([=]
+			{
+				Director::getRenderer().prepareGBufferRendering();
+			});
+			Director::getRenderer().addCommand(&_prepareGBufferRenderingCommand);
+
+			for (Node* child : _children)
+			{
+				if (!child->getIsTransparent())
+				{
+					child->renderGBuffer();
+				}
+			}
+		}
+	);
 #endif
 
 	//
 	// VhE}bv̕`
 	//
+	_directionalLightShadowMapHandle = FrameGraph::INVALID_HANDLE;
 	if (_directionalLight != nullptr && _directionalLight->hasShadowMap())
 	{
-		_directionalLight->prepareShadowMapRendering();
-
-		for (Node* child : _children)
-		{
-			if (!child->getIsTransparent())
+		_frameGraph.addPass("DirectionalLightShadowMap",
+			[=](FrameGraph::PassBuilder& builder)
+			{
+				_directionalLightShadowMapHandle = builder.createTexture("DirectionalLightShadowMap", FrameGraph::ResourceDesc(_directionalLight->getShadowMapData().size, FrameGraph::ResourceFormat::DEPTH_STENCIL));
+			},
+			[=]
 			{
-				child->renderDirectionalLightShadowMap(_directionalLight);
+				_directionalLight->prepareShadowMapRendering();
+
+				for (Node* child : _children)
+				{
+					if (!child->getIsTransparent())
+					{
+						child->renderDirectionalLightShadowMap(_directionalLight);
+					}
+				}
 			}
-		}
+		);
 	}
 
+	_pointLightShadowMapHandles.fill(FrameGraph::INVALID_HANDLE);
 	for (size_t i = 0; i < PointLight::MAX_NUM; i++)
 	{
 		PointLight* pointLight = _pointLightList[i];
@@ -149,32 +260,61 @@ void Scene::update(float dt)
 			continue;
 		}
 
-#if defined(MGRRENDERER_USE_DIRECT3D)
-		pointLight->prepareShadowMapRendering();
+		FrameGraph::ResourceDesc shadowMapDesc(pointLight->getShadowMapData().size, FrameGraph::ResourceFormat::DEPTH_STENCIL_CUBEMAP);
 
-		for (Node* child : _children)
-		{
-			if (!child->getIsTransparent())
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		_frameGraph.addPass(_pointLightShadowMapNames[i],
+			[=](FrameGraph::PassBuilder& builder)
 			{
-				child->renderPointLightShadowMap(i, pointLight);
+				_pointLightShadowMapHandles[i] = builder.createTexture(_pointLightShadowMapNames[i], shadowMapDesc);
+			},
+			[=]
+			{
+				pointLight->prepareShadowMapRendering();
+
+				for (Node* child : _children)
+				{
+					if (!child->getIsTransparent())
+					{
+						child->renderPointLightShadowMap(i, pointLight);
+					}
+				}
 			}
-		}
+		);
 #elif defined(MGRRENDERER_USE_OPENGL)
 		for (int face = (int)CubeMapFace::X_POSITIVE; face < (int)CubeMapFace::NUM_CUBEMAP_FACE; face++)
 		{
-			pointLight->prepareShadowMapRendering((CubeMapFace)face);
-
-			for (Node* child : _children)
-			{
-				if (!child->getIsTransparent())
+			// ŏ̖ʂ̃pXōAc̖ʂ̃pX͓L[u}bvɏ
+			_frameGraph.addPass(_pointLightShadowMapFacePassNames[i][face],
+				[=](FrameGraph::PassBuilder& builder)
+				{
+					if (face == (int)CubeMapFace::X_POSITIVE)
+					{
+						_pointLightShadowMapHandles[i] = builder.createTexture(_pointLightShadowMapNames[i], shadowMapDesc);
+					}
+					else
+					{
+						builder.write(_pointLightShadowMapHandles[i]);
+					}
+				},
+				[=]
 				{
-					child->renderPointLightShadowMap(i, pointLight, (CubeMapFace)face);
+					pointLight->prepareShadowMapRendering((CubeMapFace)face);
+
+					for (Node* child : _children)
+					{
+						if (!child->getIsTransparent())
+						{
+							child->renderPointLightShadowMap(i, pointLight, (CubeMapFace)face);
+						}
+					}
 				}
-			}
+			);
 		}
 #endif
 	}
 
+	_spotLightShadowMapHandles.fill(FrameGraph::INVALID_HANDLE);
 	for (size_t i = 0; i < SpotLight::MAX_NUM; i++)
 	{
 		SpotLight* spotLight = _spotLightList[i];
@@ -183,84 +323,212 @@ void Scene::update(float dt)
 			continue;
 		}
 
-		spotLight->prepareShadowMapRendering();
+		_frameGraph.addPass(_spotLightShadowMapNames[i],
+			[=](FrameGraph::PassBuilder& builder)
+			{
+				_spotLightShadowMapHandles[i] = builder.createTexture(_spotLightShadowMapNames[i], FrameGraph::ResourceDesc(spotLight->getShadowMapData().size, FrameGraph::ResourceFormat::DEPTH_STENCIL));
+			},
+			[=]
+			{
+				spotLight->prepareShadowMapRendering();
 
-		for (Node* child : _children)
+				for (Node* child : _children)
+				{
+					if (!child->getIsTransparent())
+					{
+						child->renderSpotLightShadowMap(i, spotLight);
+					}
+				}
+			}
+		);
+	}
+
+	// s߃f̕`̓VhE}bvSǂ
+	std::function<void(FrameGraph::PassBuilder&)> readShadowMaps = [=](FrameGraph::PassBuilder& builder)
+	{
+		if (_directionalLightShadowMapHandle != FrameGraph::INVALID_HANDLE)
+		{
+			builder.read(_directionalLightShadowMapHandle);
+		}
+
+		for (FrameGraph::ResourceHandle shadowMap : _pointLightShadowMapHandles)
 		{
-			if (!child->getIsTransparent())
+			if (shadowMap != FrameGraph::INVALID_HANDLE)
 			{
-				child->renderSpotLightShadowMap(i, spotLight);
+				builder.read(shadowMap);
 			}
 		}
-	}
+
+		for (FrameGraph::ResourceHandle shadowMap : _spotLightShadowMapHandles)
+		{
+			if (shadowMap != FrameGraph::INVALID_HANDLE)
+			{
+				builder.read(shadowMap);
+			}
+		}
+	};
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 	//
 	// Gobt@ƃVhE}bvg`
 	//
-	_prepareDeferredRenderingCommand.init([=]
-	{
-		Director::getRenderer().prepareDeferredRendering();
-	});
-	Director::getRenderer().addCommand(&_prepareDeferredRenderingCommand);
+	_frameGraph.addPass("DeferredLighting",
+		[=](FrameGraph::PassBuilder& builder)
+		{
+			builder.read(_gBufferHandle);
+			readShadowMaps(builder);
+			builder.write(backBuffer);
+			builder.setSideEffect();
+		},
+		[=]
+		{
+			_prepareDeferredRenderingCommand.init([=]
+			{
+				Director::getRenderer().prepareDeferredRendering();
+			});
+			Director::getRenderer().addCommand(&_prepareDeferredRenderingCommand);
 
-	_renderDeferredCommand.init([=]
-	{
-		Director::getRenderer().renderDeferred();
-	});
-	Director::getRenderer().addCommand(&_renderDeferredCommand);
+			_renderDeferredCommand.init([=]
+			{
+				Director::getRenderer().renderDeferred();
+			});
+			Director::getRenderer().addCommand(&_renderDeferredCommand);
+		}
+	);
 #elif defined(MGRRENDERER_FOWARD_RENDERING)
-	_prepareFowardRenderingCommand.init([=]
-	{
-		Director::getRenderer().prepareFowardRendering();
-	});
-	Director::getRenderer().addCommand(&_prepareFowardRenderingCommand);
-
-	_camera.renderForward();
-	for (Node* child : _children)
-	{
-		if (!child->getIsTransparent())
+	_frameGraph.addPass("Foward",
+		[=](FrameGraph::PassBuilder& builder)
+		{
+			readShadowMaps(builder);
+			builder.write(backBuffer);
+			builder.setSideEffect();
+		},
+		[=]
 		{
-			child->renderForward();
+			_prepareFowardRenderingCommand.init([=]
+			{
+				Director::getRenderer().prepareFowardRendering();
+			});
+			Director::getRenderer().addCommand(&_prepareFowardRenderingCommand);
+
+			_camera.renderForward();
+			for (Node* child : _children)
+			{
+				if (!child->getIsTransparent())
+				{
+					child->renderForward();
+				}
+			}
 		}
-	}
+	);
 #endif
-	_prepareTransparentRenderingCommand.init([=]
-	{
-		Director::getRenderer().prepareTransparentRendering();
-	});
-	Director::getRenderer().addCommand(&_prepareTransparentRenderingCommand);
 
 	// ߃fpX
-	std::map<float, Node*> transparentNodes; // L[̓J2拗Bmap͊i[2؂Ƃă\[gĂ̂𗘗p
+	_frameGraph.addPass("Transparent",
+		[=](FrameGraph::PassBuilder& builder)
+		{
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+			builder.read(_gBufferHandle); // s߃f̃fvXƂGobt@̃fvXg
+#endif
+			readShadowMaps(builder);
+			builder.write(backBuffer);
+			builder.setSideEffect();
+		},
+		[=]
+		{
+			_prepareTransparentRenderingCommand.init([=]
+			{
+				Director::getRenderer().prepareTransparentRendering();
+			});
+			Director::getRenderer().addCommand(&_prepareTransparentRenderingCommand);
 
-	for (Node* child : _children)
-	{
-		// ߕm
-		if (child->getIsTransparent())
+			std::map<float, Node*> transparentNodes; // L[̓J2拗Bmap͊i[2؂Ƃă\[gĂ̂𗘗p
+
+			for (Node* child : _children)
+			{
+				// ߕm
+				if (child->getIsTransparent())
+				{
+					float distSqFromCamera = (child->getPosition() - Director::getCamera().getPosition()).lengthSquare();
+					transparentNodes[distSqFromCamera] = child;
+				}
+			}
+
+			for (std::map<float, Node*>::reverse_iterator it = transparentNodes.rbegin(); it != transparentNodes.rend(); ++it)
+			{
+				it->second->renderForward();
+			}
+		}
+	);
+
+	// 2Dm[h͐[ẍႤ̂ň͂
+	_frameGraph.addPass("Foward2D",
+		[=](FrameGraph::PassBuilder& builder)
+		{
+			builder.write(backBuffer);
+			builder.setSideEffect();
+		},
+		[=]
 		{
-			float distSqFromCamera = (child->getPosition() - Director::getCamera().getPosition()).lengthSquare();
-			transparentNodes[distSqFromCamera] = child;
+			_prepareFowardRendering2DCommand.init([=]
+			{
+				Director::getRenderer().prepareFowardRendering2D();
+			});
+			Director::getRenderer().addCommand(&_prepareFowardRendering2DCommand);
+
+			_cameraFor2D.renderForward();
+
+			for (Node* child : _children2D)
+			{
+				child->renderForward();
+			}
 		}
-	}
+	);
+}
+
+void Scene::assignFrameGraphResources()
+{
+	// ꎞ\[X̎̂compile()Ŋ蓖ĂAt[Ƃɕς肤̂Ŗt[n
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	const std::vector<D3DTexture*>& gBufferTextures = _frameGraph.getTextures(_gBufferHandle);
+	Director::getRenderer().setGBuffer(gBufferTextures[0], gBufferTextures[1], gBufferTextures[2], gBufferTextures[3]);
+#elif defined(MGRRENDERER_USE_OPENGL)
+	Director::getRenderer().setGBuffer(_frameGraph.getFrameBuffer(_gBufferHandle));
+#endif
+#endif
 
-	for (std::map<float, Node*>::reverse_iterator it = transparentNodes.rbegin(); it != transparentNodes.rend(); ++it)
+	if (_directionalLightShadowMapHandle != FrameGraph::INVALID_HANDLE)
 	{
-		it->second->renderForward();
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		_directionalLight->setShadowMapTexture(_frameGraph.getTexture(_directionalLightShadowMapHandle));
+#elif defined(MGRRENDERER_USE_OPENGL)
+		_directionalLight->setShadowMapFrameBuffer(_frameGraph.getFrameBuffer(_directionalLightShadowMapHandle));
+#endif
 	}
 
-	// 2Dm[h͐[ẍႤ̂ň͂
-	_prepareFowardRendering2DCommand.init([=]
+	for (size_t i = 0; i < PointLight::MAX_NUM; i++)
 	{
-		Director::getRenderer().prepareFowardRendering2D();
-	});
-	Director::getRenderer().addCommand(&_prepareFowardRendering2DCommand);
-
-	_cameraFor2D.renderForward();
+		if (_pointLightShadowMapHandles[i] != FrameGraph::INVALID_HANDLE)
+		{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+			_pointLightList[i]->setShadowMapTexture(_frameGraph.getTexture(_pointLightShadowMapHandles[i]));
+#elif defined(MGRRENDERER_USE_OPENGL)
+			_pointLightList[i]->setShadowMapFrameBuffer(_frameGraph.getFrameBuffer(_pointLightShadowMapHandles[i]));
+#endif
+		}
+	}
 
-	for (Node* child : _children2D)
+	for (size_t i = 0; i < SpotLight::MAX_NUM; i++)
 	{
-		child->renderForward();
+		if (_spotLightShadowMapHandles[i] != FrameGraph::INVALID_HANDLE)
+		{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+			_spotLightList[i]->setShadowMapTexture(_frameGraph.getTexture(_spotLightShadowMapHandles[i]));
+#elif defined(MGRRENDERER_USE_OPENGL)
+			_spotLightList[i]->setShadowMapFrameBuffer(_frameGraph.getFrameBuffer(_spotLightShadowMapHandles[i]));
+#endif
+		}
 	}
 }
 
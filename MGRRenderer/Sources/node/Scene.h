@@ -3,6 +3,7 @@
 #include "Light.h"
 #include "Camera.h"
 #include "renderer/CustomRenderCommand.h"
+#include "renderer/FrameGraph.h"
 #include <array>
 #include <vector>
 #include <map>
@@ -21,6 +22,16 @@ public:
 	void pushNode2D(Node* node);
 	// TODO:{dt̓XPW[ɓn΂̂A͊em[hupdate\bhŃAj[VĂ̂dtvisitupdateɓnĂ
 	void update(float dt);
+	// update()œo^pXƁǍOǉpX܂Ƃ߂ăXPW[A`R}hς
+	void render();
+	// render()̑ɁAsȃm[hGPUg킸SoftwareDeferredRendererŕ`Bt[Ot͎sȂ
+	void renderSoftware(SoftwareDeferredRenderer& renderer);
+	// fobO`ȂǃV[ÕpXupdate()render()̊Ԃɂɒǉ
+	FrameGraph& getFrameGraph() { return _frameGraph; }
+	FrameGraph::ResourceHandle getBackBufferHandle() const { return _backBufferHandle; }
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+	FrameGraph::ResourceHandle getGBufferHandle() const { return _gBufferHandle; }
+#endif
 	Camera& getCamera() { return _camera; }
 	const Camera& getCameraFor2D() { return _cameraFor2D; } // 2Dp̌ŒJȂ̂ŊOCȂ
 	void setCamera(const Camera& camera) { _camera = camera; } // ܂債ăTCY傫Ȃ̂PODƂĈ
@@ -57,6 +68,19 @@ private:
 	std::array<SpotLight*, SpotLight::MAX_NUM> _spotLightList;
 	size_t _numSpotLight;
 
+	FrameGraph _frameGraph;
+	FrameGraph::ResourceHandle _backBufferHandle;
+	FrameGraph::ResourceHandle _gBufferHandle;
+	FrameGraph::ResourceHandle _directionalLightShadowMapHandle;
+	std::array<FrameGraph::ResourceHandle, PointLight::MAX_NUM> _pointLightShadowMapHandles;
+	std::array<FrameGraph::ResourceHandle, SpotLight::MAX_NUM> _spotLightShadowMapHandles;
+	// Cg̔ԍ܂ރpXƃ\[XBt[Ot͖t[gݒ̂ŁAinit()ňxinternĂ
+	std::array<const char*, PointLight::MAX_NUM> _pointLightShadowMapNames;
+#if defined(MGRRENDERER_USE_OPENGL)
+	std::array<std::array<const char*, (size_t)CubeMapFace::NUM_CUBEMAP_FACE>, PointLight::MAX_NUM> _pointLightShadowMapFacePassNames;
+#endif
+	std::array<const char*, SpotLight::MAX_NUM> _spotLightShadowMapNames;
+
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 	CustomRenderCommand _prepareGBufferRenderingCommand;
 	CustomRenderCommand _prepareDeferredRenderingCommand; // Gobt@̕`܂߂ăfBt@[h_OA킩₷邽߂Gobt@gŏI`Ăł
@@ -66,6 +90,10 @@ private:
 	CustomRenderCommand _prepareTransparentRenderingCommand;
 	CustomRenderCommand _prepareFowardRendering2DCommand;
 	CustomRenderCommand _renderDeferredCommand;
+
+	void setupFrameGraph();
+	// compile()Ŋ蓖ĂGobt@ƃVhE}bv̎̂RendererƃCgɓn
+	void assignFrameGraphResources();
 };
 
 } // namespace mgrrenderer
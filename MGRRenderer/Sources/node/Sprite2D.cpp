@@ -4,21 +4,21 @@
 #include "renderer/Director.h"
 #include "renderer/Shaders.h"
 #include "renderer/TextureUtility.h"
+#include "renderer/TextureAtlas.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "renderer/D3DTexture.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLTexture.h"
 #endif
+#include <cstddef>
 
 namespace mgrrenderer
 {
 
-const std::string Sprite2D::CONSTANT_BUFFER_DEPTH_TEXTURE_PARAMETER = "CONSTANT_BUFFER_DEPTH_TEXTURE_PARAMETER";
-const std::string Sprite2D::CONSTANT_BUFFER_DEPTH_TEXTURE_PROJECTION_MATRIX = "CONSTANT_BUFFER_DEPTH_TEXTURE_PROJECTION_MATRIX";
-
 Sprite2D::Sprite2D() :
 _texture(nullptr),
 _renderBufferType(RenderBufferType::NONE),
+_blendMode(SpriteBatchRenderCommand::BlendMode::ALPHA),
 _isOwnTexture(false),
 _nearClip(0.0f),
 _farClip(0.0f),
@@ -28,6 +28,12 @@ _cubeMapFace(CubeMapFace::NONE)
 
 Sprite2D::~Sprite2D()
 {
+	if (!_atlasKey.empty())
+	{
+		TextureAtlas::getInstance()->release(_atlasKey);
+		_atlasKey.clear();
+	}
+
 	if (_isOwnTexture && _texture != nullptr)
 	{
 		delete _texture;
@@ -46,6 +52,7 @@ bool Sprite2D::initCommon(const std::string& path, const std::string& vertexShad
 	_quadrangle.topLeft.textureCoordinate = Vec2(0.0f, 0.0f);
 	_quadrangle.topRight.position = Vec2((float)contentSize.width, (float)contentSize.height);
 	_quadrangle.topRight.textureCoordinate = Vec2(1.0f, 0.0f);
+	remapTextureCoordinatesToAtlasRegion();
 
 	// _obt@̒`
 	D3D11_BUFFER_DESC vertexBufferDesc;
@@ -152,7 +159,7 @@ bool Sprite2D::initCommon(const std::string& path, const std::string& vertexShad
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 
 	// Viewsp
 	constantBuffer = nullptr;
@@ -162,7 +169,7 @@ bool Sprite2D::initCommon(const std::string& path, const std::string& vertexShad
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 
 	// Projectionsp
 	constantBuffer = nullptr;
@@ -172,7 +179,7 @@ bool Sprite2D::initCommon(const std::string& path, const std::string& vertexShad
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 	return true;
 }
 #elif defined(MGRRENDERER_USE_OPENGL)
@@ -189,15 +196,36 @@ bool Sprite2D::initCommon(const std::string& geometryShaderFunctionPath, const s
 	_quadrangle.topLeft.textureCoordinate = Vec2(0.0f, 1.0f);
 	_quadrangle.topRight.position = Vec2((float)contentSize.width, (float)contentSize.height);
 	_quadrangle.topRight.textureCoordinate = Vec2(1.0f, 1.0f);
+	remapTextureCoordinatesToAtlasRegion();
 
 	_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionTexture.glsl", pixelShaderFunctionPath);
 
+	createGLVertexArray();
+
 	return true;
 }
+
+void Sprite2D::createGLVertexArray()
+{
+	// lp`̒_͏ɕςȂ̂ŁAɈxGPUɓ]
+	_glVertexArray.init();
+	size_t bufferIndex = _glVertexArray.addVertexBuffer(&_quadrangle, sizeof(_quadrangle), GL_STATIC_DRAW);
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, bufferIndex, 2, GL_FLOAT, sizeof(Position2DTextureCoordinates), offsetof(Position2DTextureCoordinates, position));
+	_glVertexArray.setVertexAttribute((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, bufferIndex, 2, GL_FLOAT, sizeof(Position2DTextureCoordinates), offsetof(Position2DTextureCoordinates, textureCoordinate));
+}
 #endif
 
-bool Sprite2D::init(const std::string& filePath)
+SizeUint Sprite2D::initTexture(const std::string& filePath)
 {
+	// 摜̓AgXɋlߍŁÃXvCgƓeNX`ł܂Ƃ߂ĕ`ł悤ɂ
+	const TextureAtlas::Region* region = TextureAtlas::getInstance()->retain(filePath);
+	if (region != nullptr)
+	{
+		_atlasKey = filePath;
+		_texture = TextureAtlas::getInstance()->getPageTexture(region->pageIndex);
+		return region->contentSize;
+	}
+
 	// Texture[hApngjpeg𐶃f[^ɂAOpenGLɂdg݂˂΁BBSpritẽ\[XƂB
 	Image image; // ImageCPŨgĂ̂ł̃XR[vŉĂ悢̂X^bNɎ
 	image.initWithFilePath(filePath);
@@ -213,9 +241,37 @@ bool Sprite2D::init(const std::string& filePath)
 
 	Texture* texture = _texture;
 	texture->initWithImage(image); // TODO:ȂÖقɌpNX̃\bhĂׂȂ
+	return texture->getContentSize();
+}
+
+void Sprite2D::remapTextureCoordinatesToAtlasRegion()
+{
+	if (_atlasKey.empty())
+	{
+		return;
+	}
+
+	const TextureAtlas::Region* region = TextureAtlas::getInstance()->getRegion(_atlasKey);
+	Logger::logAssert(region != nullptr, "QƂĂ͂̃eNX`AgẌ̗悪ȂBkey=%s", _atlasKey.c_str());
+
+	const Vec2& min = region->textureCoordinateMin;
+	const Vec2& max = region->textureCoordinateMax;
+	Position2DTextureCoordinates* vertices[] = {&_quadrangle.topLeft, &_quadrangle.bottomLeft, &_quadrangle.topRight, &_quadrangle.bottomRight};
+	for (Position2DTextureCoordinates* vertex : vertices)
+	{
+		vertex->textureCoordinate = Vec2(
+			min.x + vertex->textureCoordinate.x * (max.x - min.x),
+			min.y + vertex->textureCoordinate.y * (max.y - min.y)
+		);
+	}
+}
+
+bool Sprite2D::init(const std::string& filePath)
+{
+	const SizeUint& contentSize = initTexture(filePath);
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
-	bool success = initCommon("Resources/shader/PositionTextureMultiplyColor.hlsl", "VS", "", "PS", texture->getContentSize());
+	bool success = initCommon("Resources/shader/PositionTextureMultiplyColor.hlsl", "VS", "", "PS", contentSize);
 	if (!success)
 	{
 		return false;
@@ -236,10 +292,10 @@ bool Sprite2D::init(const std::string& filePath)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 	return true;
 #elif defined(MGRRENDERER_USE_OPENGL)
-	return initCommon("", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureMultiplyColor.glsl", texture->getContentSize());
+	return initCommon("", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureMultiplyColor.glsl", contentSize);
 #endif
 }
 
@@ -268,7 +324,7 @@ bool Sprite2D::initWithTexture(D3DTexture* texture)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
 
 	return true;
 }
@@ -329,7 +385,7 @@ bool Sprite2D::initWithDepthStencilTexture(D3DTexture* texture, RenderBufferType
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(CONSTANT_BUFFER_DEPTH_TEXTURE_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_TEXTURE_PARAMETER, constantBuffer);
 
 	constantBufferDesc.ByteWidth = sizeof(Mat4);
 	result = Director::getRenderer().getDirect3dDevice()->CreateBuffer(&constantBufferDesc, nullptr, &constantBuffer);
@@ -338,10 +394,16 @@ bool Sprite2D::initWithDepthStencilTexture(D3DTexture* texture, RenderBufferType
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(CONSTANT_BUFFER_DEPTH_TEXTURE_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_TEXTURE_PROJECTION_MATRIX, constantBuffer);
 
 	return true;
 }
+
+void Sprite2D::setRenderBufferTexture(D3DTexture* texture)
+{
+	Logger::logAssert(_renderBufferType != RenderBufferType::NONE, "_[obt@̃XvCgłȂ̂ɃeNX`ւ悤ƂB");
+	_texture = texture;
+}
 #elif defined(MGRRENDERER_USE_OPENGL)
 bool Sprite2D::initWithRenderBuffer(GLTexture* texture, RenderBufferType renderBufferType)
 {
@@ -373,6 +435,12 @@ bool Sprite2D::initWithDepthStencilTexture(GLTexture* texture, RenderBufferType
 
 	return initWithRenderBuffer(texture, renderBufferType);
 }
+
+void Sprite2D::setRenderBufferTexture(GLTexture* texture)
+{
+	Logger::logAssert(_renderBufferType != RenderBufferType::NONE, "_[obt@̃XvCgłȂ̂ɃeNX`ւ悤ƂB");
+	_texture = texture;
+}
 #endif
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
@@ -382,54 +450,48 @@ void Sprite2D::renderGBuffer()
 }
 #endif
 
+void Sprite2D::addQuadToSpriteBatch(const Camera& camera)
+{
+	SpriteBatchRenderCommand::Material material;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	material.texture = _texture->getShaderResourceView();
+#elif defined(MGRRENDERER_USE_OPENGL)
+	material.texture = _texture->getTextureId();
+#endif
+	material.blendMode = _blendMode;
+	material.camera = &camera;
+
+	// Node̕sx0sŁA傫قǓB_J[̃At@Ƃ͋tȂ̂Ŕ]ēn
+	const Color3B& color = getColor();
+	Director::getRenderer().addSpriteQuads(material, &_quadrangle.topLeft, 1, getModelMatrix(), Color4B(color.r, color.g, color.b, static_cast<unsigned char>((1.0f - getOpacity()) * 255.0f)));
+}
+
 void Sprite2D::renderForward()
 {
+	if (_renderBufferType == RenderBufferType::NONE)
+	{
+		// ʏ̃eNX`̃XvCg̓m[hƂɃh[A܂Ƃ߂ĕ`悷
+		addQuadToSpriteBatch(Director::getCameraFor2D());
+		return;
+	}
+
 	_renderForwardCommand.init([=]
 	{
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
 		// TODO:ւ񋤒ʉȁBB
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCameraFor2D().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCameraFor2D().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// fvXeNX``掞̃vWFNVs̏̃}bv
 		switch (_renderBufferType) {
@@ -437,36 +499,17 @@ void Sprite2D::renderForward()
 			case RenderBufferType::DEPTH_TEXTURE_ORTHOGONAL:
 			case RenderBufferType::DEPTH_CUBEMAP_TEXTURE:
 			{
-				result = direct3dContext->Map(
-					_d3dProgramForForwardRendering.getConstantBuffer(CONSTANT_BUFFER_DEPTH_TEXTURE_PARAMETER),
-					0,
-					D3D11_MAP_WRITE_DISCARD,
-					0,
-					&mappedResource
-				);
-				Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 				// nearClip, farClip̒l𐳂ɂĂƂ͉Enłz͕Bz̒ln
-
 				struct Parameter {
 					float nearClip;
 					float farClip;
 					unsigned int faceIndex;
 					float padding;
 				} parameter = {-_nearClip, -_farClip, (unsigned int)_cubeMapFace, 0.0f};
-				CopyMemory(mappedResource.pData, &parameter, sizeof(parameter));
-				direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(CONSTANT_BUFFER_DEPTH_TEXTURE_PARAMETER), 0);
-
-				result = direct3dContext->Map(
-					_d3dProgramForForwardRendering.getConstantBuffer(CONSTANT_BUFFER_DEPTH_TEXTURE_PROJECTION_MATRIX),
-					0,
-					D3D11_MAP_WRITE_DISCARD,
-					0,
-					&mappedResource
-				);
-				Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
+				_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DEPTH_TEXTURE_PARAMETER, &parameter, sizeof(parameter));
+
 				Mat4 depthProjectionMatrix = (Mat4::CHIRARITY_CONVERTER * _projectionMatrix).transpose();
-				CopyMemory(mappedResource.pData, &depthProjectionMatrix.m, sizeof(depthProjectionMatrix));
-				direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(CONSTANT_BUFFER_DEPTH_TEXTURE_PROJECTION_MATRIX), 0);
+				_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DEPTH_TEXTURE_PROJECTION_MATRIX, &depthProjectionMatrix.m, sizeof(depthProjectionMatrix));
 			}
 				break;
 			case RenderBufferType::GBUFFER_COLOR_SPECULAR_INTENSITY:
@@ -476,17 +519,8 @@ void Sprite2D::renderForward()
 			default:
 			{
 				// ZF̃}bv
-				result = direct3dContext->Map(
-					_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-					0,
-					D3D11_MAP_WRITE_DISCARD,
-					0,
-					&mappedResource
-				);
-				Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 				const Color4F& multiplyColor = Color4F(Color3B(getColor().r, getColor().g, getColor().b), getOpacity());
-				CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-				direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+				_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 				break;
 			}
 		}
@@ -500,7 +534,7 @@ void Sprite2D::renderForward()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 		_d3dProgramForForwardRendering.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForForwardRendering.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForForwardRendering, direct3dContext);
 
 		UINT startSlot = 0;
 		// L[u}bveNX`͕ʂ̃Xbgg
@@ -520,27 +554,27 @@ void Sprite2D::renderForward()
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCameraFor2D().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
 		// fvXeNX``掞̃vWFNVs̃}bv
 		switch (_renderBufferType) {
 			case RenderBufferType::DEPTH_CUBEMAP_TEXTURE:
-				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_CUBEMAP_FACE), (GLint)_cubeMapFace);
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::CUBE_MAP_FACE), (GLint)_cubeMapFace);
 				GLProgram::checkGLError();
 				// ̂܂ܒʉ߂
 			case RenderBufferType::DEPTH_TEXTURE:
 			case RenderBufferType::DEPTH_TEXTURE_ORTHOGONAL:
 			{
-				glUniform1f(_glProgramForForwardRendering.getUniformLocation("u_nearClipZ"), -_nearClip);
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::NEAR_CLIP_Z), -_nearClip);
 				GLProgram::checkGLError();
 
-				glUniform1f(_glProgramForForwardRendering.getUniformLocation("u_farClipZ"), -_farClip);
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::FAR_CLIP_Z), -_farClip);
 				GLProgram::checkGLError();
 
-				glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation("u_depthTextureProjectionMatrix"), 1, GL_FALSE, (GLfloat*)_projectionMatrix.m);
+				glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DEPTH_TEXTURE_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)_projectionMatrix.m);
 				GLProgram::checkGLError();
 				break;
 			}
@@ -549,19 +583,12 @@ void Sprite2D::renderForward()
 			case RenderBufferType::GBUFFER_SPECULAR_POWER:
 				break;
 			default:
-				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
 				GLProgram::checkGLError();
 				break;
 		}
 
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
-		GLProgram::checkGLError();
-
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.position);
-		glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.textureCoordinate);
+		_glVertexArray.bind();
 
 		if (_renderBufferType == RenderBufferType::DEPTH_CUBEMAP_TEXTURE)
 		{
@@ -572,6 +599,7 @@ void Sprite2D::renderForward()
 			glBindTexture(GL_TEXTURE_2D, _texture->getTextureId());
 		}
 		glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+		GLVertexArray::unbind();
 #endif
 	});
 
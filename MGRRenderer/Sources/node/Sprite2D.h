@@ -8,6 +8,7 @@
 #include "renderer/D3DProgram.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLProgram.h"
+#include "renderer/GLVertexArray.h"
 #endif
 
 namespace mgrrenderer
@@ -50,10 +51,16 @@ public:
 	// TODO:{̓\bh𕪂̂łȂ}eAm[h؂藣ă}eAŗ^悤ɂ
 	bool initWithRenderBuffer(D3DTexture* texture, RenderBufferType renderBufferType);
 	bool initWithDepthStencilTexture(D3DTexture* texture, RenderBufferType renderBufferType, float nearClip, float farClip, const Mat4& projectionMatrix, CubeMapFace face = CubeMapFace::NONE);
+	// _[obt@̃XvCĝݗLBt[Oẗꎞ\[X͎̂t[Ƃɕς肤̂ŕ`Oɍւ
+	void setRenderBufferTexture(D3DTexture* texture);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	bool initWithRenderBuffer(GLTexture* texture, RenderBufferType renderBufferType);
 	bool initWithDepthStencilTexture(GLTexture* texture, RenderBufferType renderBufferType, float nearClip, float farClip, const Mat4& projectionMatrix, CubeMapFace face = CubeMapFace::NONE);
+	// _[obt@̃XvCĝݗLBt[Oẗꎞ\[X͎̂t[Ƃɕς肤̂ŕ`Oɍւ
+	void setRenderBufferTexture(GLTexture* texture);
 #endif
+	// ʏ̃eNX`̃XvCĝݗLBuh[hႤXvCg͕ʂ̃ob`ɂȂ
+	void setBlendMode(SpriteBatchRenderCommand::BlendMode blendMode) { _blendMode = blendMode; }
 
 protected:
 	RenderBufferType _renderBufferType;
@@ -63,20 +70,27 @@ protected:
 #elif defined(MGRRENDERER_USE_OPENGL)
 	GLProgram _glProgramForForwardRendering;
 	GLTexture* _texture;
+	GLVertexArray _glVertexArray;
 #endif
 	CustomRenderCommand _renderForwardCommand;
 	Quadrangle2D _quadrangle;
+	SpriteBatchRenderCommand::BlendMode _blendMode;
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	bool initCommon(const std::string& path, const std::string& vertexShaderFunctionName, const std::string& geometryShaderFunctionName, const std::string& pixelShaderFunctionName, const SizeUint& contentSize);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	bool initCommon(const std::string& geometryShaderFunctionPath, const std::string& pixelShaderFunctionPath, const SizeUint& contentSize);
+	void createGLVertexArray();
 #endif
+	// 摜̓eNX`AgẌ̗QƂAAgXɓȂ摜͌ʂɃeNX`𐶐BRecTCYԂ
+	SizeUint initTexture(const std::string& filePath);
+	// eNX`AgẌ̗QƂĂꍇA01̃eNX`Ẅ̃eNX`WɎʑ
+	void remapTextureCoordinatesToAtlasRegion();
+	// lp`RendererSpriteBatcherɒǉAeNX`ƃuh[h̎lp`Ƃ܂Ƃ߂ĕ`悷
+	void addQuadToSpriteBatch(const Camera& camera);
 
 private:
-	// fvXeNX`̓jAfvXɖ߂̂3DJ̃vWFNVs񂪕KvȂ̂ŁASprite2D2DJp̃vWFNVs̕ϐƋʂĂ
-	static const std::string CONSTANT_BUFFER_DEPTH_TEXTURE_PROJECTION_MATRIX;
-	static const std::string CONSTANT_BUFFER_DEPTH_TEXTURE_PARAMETER;
 	bool _isOwnTexture; // OŐeNX`ł΂̃NXŉ
+	std::string _atlasKey; // eNX`AgẌ̗QƂĂꍇ̃L[BȂQƂĂȂ
 	bool _isDepthTexture; // fvXeNX`ꍇ
 	float _nearClip;
 	float _farClip;
@@ -1,280 +1,193 @@
 #include "Sprite3D.h"
-#include "loader/ObjLoader.h"
+#include "ModelAsset.h"
+#include "ModelCache.h"
+#include "AnimationScheduler.h"
 #include "renderer/Image.h"
 #include "renderer/Director.h"
+#include "renderer/ShaderCache.h"
+#include "renderer/ShaderPermutation.h"
 #include "Light.h"
+#include "renderer/SoftwareDeferredRenderer.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "renderer/D3DTexture.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLTexture.h"
 #endif
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 
 namespace mgrrenderer
 {
 
+// s̊evf`ԂBԂ̊ԊuZΉ]̏k݂͖ڗȂBoutfromƓł悢
+static void lerpMatrixPalette(const std::vector<Mat4>& from, const std::vector<Mat4>& to, float ratio, std::vector<Mat4>& out)
+{
+	for (size_t i = 0; i < out.size(); ++i)
+	{
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+			{
+				out[i].m[column][row] = from[i].m[column][row] + (to[i].m[column][row] - from[i].m[column][row]) * ratio;
+			}
+		}
+	}
+}
+
+#if defined(MGRRENDERER_USE_OPENGL)
+// VhE}bvGobt@̕`ɎgVF[_B`悷pX̃rbgłǂ`؂ւ
+static const char* OBJ_VERTEX_SHADER_FILE = "../MGRRenderer/Resources/shader/VertexShaderObj.glsl";
+static const char* OBJ_FRAGMENT_SHADER_FILE = "../MGRRenderer/Resources/shader/FragmentShaderObj.glsl";
+#endif
+
 Sprite3D::Sprite3D() :
 _isObj(false),
 _isC3b(false),
 _useMtl(true),
-_meshDatas(nullptr),
-_nodeDatas(nullptr),
+_useCpuSkinning(false),
+#if defined(MGRRENDERER_USE_OPENGL)
+_skinnedVertexArray(nullptr),
+#endif
+_model(nullptr),
 _perVertexByteSize(0),
-_animationDatas(nullptr),
-_currentAnimation(nullptr),
-_loopAnimation(false),
-_elapsedTime(0.0f)
+_lastDeltaTime(0.0f),
+_matrixPaletteBlendRatio(1.0f),
+_matrixPaletteBlendStep(1.0f),
+_isMatrixPaletteDirty(false),
+_snapMatrixPalette(true),
+_framesSinceAnimationEvaluation(0)
 {
 }
 
 Sprite3D::~Sprite3D()
 {
-	_currentAnimation = nullptr;
-
-	if (_animationDatas != nullptr)
-	{
-		delete _animationDatas;
-		_animationDatas = nullptr;
-	}
-
-	if (_nodeDatas != nullptr)
-	{
-		delete _nodeDatas;
-		_nodeDatas = nullptr;
-	}
-
-	if (_meshDatas != nullptr)
+#if defined(MGRRENDERER_USE_OPENGL)
+	// fVAOModelAssetĂ̂ŁAō̂폜
+	if (_skinnedVertexArray != nullptr)
 	{
-		delete _meshDatas;
-		_meshDatas = nullptr;
+		delete _skinnedVertexArray;
+		_skinnedVertexArray = nullptr;
 	}
+	_glVertexArrays.clear();
 
-#if defined(MGRRENDERER_USE_OPENGL)
 	glBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
+	// f̃eNX`ModelAssetĂ̂ŁAaddTextureŒǉ̂폜
 #if defined(MGRRENDERER_USE_DIRECT3D)
-	for (D3DTexture* texture : _textureList)
+	for (D3DTexture* texture : _addedTextureList)
 #elif defined(MGRRENDERER_USE_OPENGL)
-	for (GLTexture* texture : _textureList)
+	for (GLTexture* texture : _addedTextureList)
 #endif
 	{
-		if (texture != nullptr)
-		{
-			delete texture;
-		}
+		delete texture;
 	}
 
+	_addedTextureList.clear();
 	_textureList.clear();
+	_textureFilePathList.clear();
+
+	if (_model != nullptr)
+	{
+		ModelCache::getInstance()->releaseModel(_model);
+		_model = nullptr;
+	}
 }
 
-bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
+bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl, bool useCpuSkinning)
 {
-	Logger::logAssert(_textureList.empty(), "Sprite3Dł͂Ƃ肠initWithModel͈񂵂Ă΂ȂOB");
-	Logger::logAssert(_verticesList.empty(), "Sprite3Dł͂Ƃ肠initWithModel͈񂵂Ă΂ȂOB");
-	Logger::logAssert(_indicesList.empty(), "Sprite3Dł͂Ƃ肠initWithModel͈񂵂Ă΂ȂOB");
-
-	_isObj = false;
-	_isC3b = false;
+	Logger::logAssert(_model == nullptr, "Sprite3Dł͂Ƃ肠initWithModel͈񂵂Ă΂ȂOB");
 
-	const std::string& ext = filePath.substr(filePath.length() - 4, 4);
-	if (ext == ".obj")
+	// pX̃f̓[hς݂̂̂L
+	_model = ModelCache::getInstance()->getModel(filePath);
+	if (_model == nullptr)
 	{
-		_isObj = true;
-		_useMtl = useMtl;
+		return false;
+	}
 
-		std::vector<ObjLoader::MeshData> meshList;
-		std::vector<ObjLoader::MaterialData> materialList;
+	_isObj = _model->isObj();
+	_isC3b = _model->isC3b();
+	_textureList = _model->getTextures();
+	_textureFilePathList = _model->getTextureFilePaths();
 
-		const std::string& err = ObjLoader::loadObj(filePath, meshList, materialList);
-		if (!err.empty())
-		{
-			Logger::log(err.c_str());
-			return false;
-		}
+	if (_isObj)
+	{
+		_useMtl = useMtl;
+	}
+	else if (_isC3b)
+	{
+		_useCpuSkinning = useCpuSkinning;
+		_perVertexByteSize = _model->getPerVertexByteSize();
+		_ambient = _model->getAmbient();
+		_diffuse = _model->getDiffuse();
+		_specular = _model->getSpecular();
+		_shininess = _model->getShininess();
 
-		// materialList͌󖳎
-		// TODO:MeshData͂̎_Ń}eAƂɂ܂Ƃ܂ĂȂ̂ł́HfaceGroup܂Ƃ܂ĂH
-		// ܂Ƃ܂ĂBA̓}eA͈ނƂOł
-		// {́Astd::vector<std::vector<Position3DTextureCoordinates>> oϐɂȂĂāA}eAƂɐ؂ւĕ`悷
-		// eNX`{͐؂ւO񂾂setTextureă\bhȁBB
-		for (size_t meshIndex = 0; meshIndex < meshList.size(); ++meshIndex)
+		const Skeleton& skeleton = _model->getSkeleton();
+		if (_useCpuSkinning)
 		{
-			ObjLoader::MeshData& mesh = meshList[meshIndex];
-			_verticesList.push_back(mesh.vertices);
-
-			std::vector<std::vector<unsigned short>> subMeshIndices;
-			std::vector<int> subMeshDiffuseTextureIndices;
-			for (const auto& subMesh : mesh.subMeshMap)
+			if (!_skinnedVertexCache.initWithVertices(_model->getVertexAttributes(), _model->getC3bVertices(), _model->getNumC3bVertices(), skeleton.getNumSkinBones()))
 			{
-				subMeshIndices.push_back(subMesh.second);
-				subMeshDiffuseTextureIndices.push_back(subMesh.first);
+				return false;
 			}
 
-			_indicesList.push_back(subMeshIndices);
-			_diffuseTextureIndices.push_back(subMeshDiffuseTextureIndices);;
+			// XLjO̒_objƓCAEgŕ`悷
+			_perVertexByteSize = sizeof(Position3DNormalTextureCoordinates);
 		}
 
-		const std::string& fullPath = FileUtility::getInstance()->getFullPathForFileName(filePath);
-		std::string textureBasePath = fullPath.substr(0, fullPath.find_last_of("\\/") + 1);
-		if (textureBasePath.empty())
-		{
-			textureBasePath = "";
-		}
+		_animationBlender.initWithSkeleton(&skeleton);
 
-		for (const ObjLoader::MaterialData& material : materialList)
+		// Aj[VĂȂԂoCh|[Ỹpbgŕ`ł悤ɁAňxvZĂ
+		_localPoses.resize(skeleton.getNumJoints());
+		_modelPoses.resize(skeleton.getNumJoints());
+		_previousMatrixPalette.resize(skeleton.getNumSkinBones());
+		_nextMatrixPalette.resize(skeleton.getNumSkinBones());
+		_matrixPalette.resize(skeleton.getNumSkinBones());
+		evaluateMatrixPalette(0.0f, AnimationScheduler::ALL_JOINTS);
+		_matrixPaletteBlendRatio = 1.0f;
+		_isMatrixPaletteDirty = true;
+		blendMatrixPalette();
+		if (_useCpuSkinning)
 		{
-			// TODO:Ƃ肠diffuseTextureɑΉ
-			if (!material.diffuseTextureName.empty())
-			{
-				addTexture(textureBasePath + material.diffuseTextureName);
-			}
+			skinVertices();
 		}
 	}
-	else if (ext == ".c3t" || ext == ".c3b")
-	{
-		_isC3b = true; // TODO:̃tO͔ɂ
-
-		_meshDatas = new (std::nothrow)C3bLoader::MeshDatas();
-		C3bLoader::MaterialDatas* materialDatas = new (std::nothrow)C3bLoader::MaterialDatas();
-		_nodeDatas = new (std::nothrow)C3bLoader::NodeDatas();
-		_animationDatas = new (std::nothrow)C3bLoader::AnimationDatas();
-		std::string err;
-		if (ext == ".c3t")
-		{
-			err = C3bLoader::loadC3t(filePath, *_meshDatas, *materialDatas, *_nodeDatas, *_animationDatas);
-		}
-		else
-		{
-			Logger::logAssert(ext == ".c3b", "");
-			err = C3bLoader::loadC3b(filePath, *_meshDatas, *materialDatas, *_nodeDatas, *_animationDatas);
-		}
-
-		if (!err.empty())
-		{
-			Logger::log(err.c_str());
-			return false;
-		}
-
-		Logger::logAssert(_meshDatas->meshDatas.size() == 1, "󃁃bVɂ͑ΉĂȂB");
-		C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-		_indicesList.push_back(meshData->subMeshIndices);
-
-		_perVertexByteSize = 0;
-
-		for (C3bLoader::MeshVertexAttribute attrib : meshData->attributes)
-		{
-			_perVertexByteSize += attrib.attributeSizeBytes;
-		}
-
-		C3bLoader::MaterialData* materialData = materialDatas->materialDatas[0];
-		const C3bLoader::TextureData& texture = materialData->textures[0];
-		addTexture(texture.fileName);
-		_ambient = materialData->ambient;
-		_diffuse = materialData->diffuse;
-		_specular = materialData->specular;
-		//_emissive = materialData->emissive;
-		//_opacity = materialData->opacity;
-		_shininess = materialData->shininess;
-
-		delete materialDatas;
-	}
-	else
-	{
-		Logger::logAssert(false, "ΉĂȂgq%s", ext);
-	}
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	ID3D11Device* direct3dDevice = Director::getRenderer().getDirect3dDevice();
 	HRESULT result = E_FAIL;
 
+	// pX̃rbg͕`悷pXŁAAt@eXg̓f̃}eAŌ߂
+	unsigned int alphaTestFeature = _model->needsAlphaTest() ? ShaderPermutation::FEATURE_ALPHA_TEST : ShaderPermutation::FEATURE_NONE;
+	unsigned int shadowMapFeatures = ShaderPermutation::FEATURE_SHADOW_MAP | alphaTestFeature;
+	// At@eXgȂƂ́AVhE}bv̕`ɃsNZVF[_gȂ
+	std::string shadowMapPixelShader = _model->needsAlphaTest() ? "PS_SM_ALPHA_TEST" : "";
+	std::string pointLightShadowMapPixelShader = _model->needsAlphaTest() ? "PS_SM_POINT_LIGHT_ALPHA_TEST" : "";
+
 	if (_isObj)
 	{
-		// MeshData̐̃[v
-		size_t numMesh = _verticesList.size();
+		// _obt@ƃCfbNXobt@ModelAsset̂̂L
+		size_t numMesh = _model->getNumMeshes();
 		for (size_t meshIndex = 0; meshIndex < numMesh; ++meshIndex)
 		{
-			const std::vector<Position3DNormalTextureCoordinates>& vertices = _verticesList[meshIndex];
-			// _obt@̒`
-			D3D11_BUFFER_DESC vertexBufferDesc;
-			vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-			vertexBufferDesc.ByteWidth = sizeof(Position3DNormalTextureCoordinates) * vertices.size();
-			vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-			vertexBufferDesc.CPUAccessFlags = 0;
-			vertexBufferDesc.MiscFlags = 0;
-			vertexBufferDesc.StructureByteStride = 0;
-
-			// _obt@̃Tu\[X̒`
-			D3D11_SUBRESOURCE_DATA vertexBufferSubData;
-			vertexBufferSubData.pSysMem = vertices.data();
-			vertexBufferSubData.SysMemPitch = 0;
-			vertexBufferSubData.SysMemSlicePitch = 0;
-
-			// _obt@̃Tu\[X̍쐬
-			ID3D11Buffer* vertexBuffer = nullptr;
-			result = direct3dDevice->CreateBuffer(&vertexBufferDesc, &vertexBufferSubData, &vertexBuffer);
-			if (FAILED(result))
-			{
-				Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
-				return false;
-			}
-			std::vector<ID3D11Buffer*> oneMeshVBs;
-			oneMeshVBs.push_back(vertexBuffer);
-			_d3dProgramForForwardRendering.addVertexBuffers(oneMeshVBs);
-			_d3dProgramForShadowMap.addVertexBuffers(oneMeshVBs);
-			_d3dProgramForPointLightShadowMap.addVertexBuffers(oneMeshVBs);
-#if defined(MGRRENDERER_DEFERRED_RENDERING)
-			_d3dProgramForGBuffer.addVertexBuffers(oneMeshVBs);
-#endif
+			addVertexBufferToPrograms(_model->getVertexBuffer(meshIndex));
 
 			std::vector<ID3D11Buffer*> indexBufferList;
-			size_t numSubMesh = _indicesList[meshIndex].size();
-
-			// subMesh̐̃[v
+			size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 			for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 			{
-				const std::vector<unsigned short>& subMeshIndices = _indicesList[meshIndex][subMeshIndex];
-
-				// CfbNXobt@̒`
-				D3D11_BUFFER_DESC indexBufferDesc;
-				indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-				indexBufferDesc.ByteWidth = sizeof(USHORT) * subMeshIndices.size();
-				indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-				indexBufferDesc.CPUAccessFlags = 0;
-				indexBufferDesc.MiscFlags = 0;
-				indexBufferDesc.StructureByteStride = 0;
-
-				// CfbNXobt@̃Tu\[X̒`
-				D3D11_SUBRESOURCE_DATA indexBufferSubData;
-				indexBufferSubData.pSysMem = subMeshIndices.data();
-				indexBufferSubData.SysMemPitch = 0;
-				indexBufferSubData.SysMemSlicePitch = 0;
-
-				// CfbNXobt@̃Tu\[X̍쐬
-				ID3D11Buffer* indexBuffer = nullptr;
-				result = direct3dDevice->CreateBuffer(&indexBufferDesc, &indexBufferSubData, &indexBuffer);
-				if (FAILED(result))
-				{
-					Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
-					return false;
-				}
-
-				indexBufferList.push_back(indexBuffer);
+				indexBufferList.push_back(_model->getIndexBuffer(meshIndex, subMeshIndex));
 			}
-
-			_d3dProgramForForwardRendering.addIndexBuffers(indexBufferList);
-			_d3dProgramForShadowMap.addIndexBuffers(indexBufferList);
-			_d3dProgramForPointLightShadowMap.addIndexBuffers(indexBufferList);
-#if defined(MGRRENDERER_DEFERRED_RENDERING)
-			_d3dProgramForGBuffer.addIndexBuffers(indexBufferList);
-#endif
+			addIndexBuffersToPrograms(indexBufferList);
 		}
 
 		bool depthEnable = true;
 		_d3dProgramForForwardRendering.initWithShaderFile("Resources/shader/ObjForward.hlsl", depthEnable, "VS", "", "PS");
-		_d3dProgramForShadowMap.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_SM", "", "");
-		_d3dProgramForPointLightShadowMap.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_SM_POINT_LIGHT", "GS_SM_POINT_LIGHT", "");
+		_d3dProgramForShadowMap.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_SM", "", shadowMapPixelShader, shadowMapFeatures);
+		_d3dProgramForPointLightShadowMap.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_SM_POINT_LIGHT", "GS_SM_POINT_LIGHT", pointLightShadowMapPixelShader, shadowMapFeatures);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-		_d3dProgramForGBuffer.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_GBUFFER", "", "PS_GBUFFER");
+		_d3dProgramForGBuffer.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_GBUFFER", "", "PS_GBUFFER", ShaderPermutation::FEATURE_GBUFFER | alphaTestFeature);
 #endif
 
 		// ̓CAEgIuWFNg̍쐬
@@ -305,90 +218,83 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 	}
 	else if (_isC3b)
 	{
-		C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-
-		// _obt@̒`
-		D3D11_BUFFER_DESC vertexBufferDesc;
-		vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-		vertexBufferDesc.ByteWidth = sizeof(float) * meshData->vertices.size();
-		vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-		vertexBufferDesc.CPUAccessFlags = 0;
-		vertexBufferDesc.MiscFlags = 0;
-		vertexBufferDesc.StructureByteStride = 0;
-
-		// _obt@̃Tu\[X̒`
-		D3D11_SUBRESOURCE_DATA vertexBufferSubData;
-		vertexBufferSubData.pSysMem = &meshData->vertices[0];
-		vertexBufferSubData.SysMemPitch = 0;
-		vertexBufferSubData.SysMemSlicePitch = 0;
-
-		// _obt@̃Tu\[X̍쐬
-		ID3D11Buffer* vertexBuffer = nullptr;
-		result = direct3dDevice->CreateBuffer(&vertexBufferDesc, &vertexBufferSubData, &vertexBuffer);
-		if (FAILED(result))
+		const std::vector<C3bLoader::MeshVertexAttribute>& attributes = _model->getVertexAttributes();
+
+		if (_useCpuSkinning)
 		{
-			Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
-			return false;
-		}
-		std::vector<ID3D11Buffer*> oneMeshVBs;
-		oneMeshVBs.push_back(vertexBuffer);
-		_d3dProgramForForwardRendering.addVertexBuffers(oneMeshVBs);
-		_d3dProgramForShadowMap.addVertexBuffers(oneMeshVBs);
-		_d3dProgramForPointLightShadowMap.addVertexBuffers(oneMeshVBs);
-#if defined(MGRRENDERER_DEFERRED_RENDERING)
-		_d3dProgramForGBuffer.addVertexBuffers(oneMeshVBs);
-#endif
+			// XLjOς݂̒_̓CX^XƂɈႤ̂ŁÃCX^Xp̒_obt@Bt[updateUpdateSubresourceď
+			const std::vector<Position3DNormalTextureCoordinates>& vertices = _skinnedVertexCache.getSkinnedVertices();
 
-		// CfbNXobt@̒`
-		D3D11_BUFFER_DESC indexBufferDesc;
-		indexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-		indexBufferDesc.ByteWidth = sizeof(USHORT) * _indicesList[0][0].size();
-		indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-		indexBufferDesc.CPUAccessFlags = 0;
-		indexBufferDesc.MiscFlags = 0;
-		indexBufferDesc.StructureByteStride = 0;
-
-		// CfbNXobt@̃Tu\[X̒`
-		D3D11_SUBRESOURCE_DATA indexBufferSubData;
-		indexBufferSubData.pSysMem = _indicesList[0][0].data();
-		indexBufferSubData.SysMemPitch = 0;
-		indexBufferSubData.SysMemSlicePitch = 0;
-
-		// CfbNXobt@̃Tu\[X̍쐬
-		ID3D11Buffer* indexBuffer = nullptr;
-		result = direct3dDevice->CreateBuffer(&indexBufferDesc, &indexBufferSubData, &indexBuffer);
-		if (FAILED(result))
+			D3D11_BUFFER_DESC vertexBufferDesc;
+			vertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+			vertexBufferDesc.ByteWidth = sizeof(Position3DNormalTextureCoordinates) * vertices.size();
+			vertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+			vertexBufferDesc.CPUAccessFlags = 0;
+			vertexBufferDesc.MiscFlags = 0;
+			vertexBufferDesc.StructureByteStride = 0;
+
+			D3D11_SUBRESOURCE_DATA vertexBufferSubData;
+			vertexBufferSubData.pSysMem = vertices.data();
+			vertexBufferSubData.SysMemPitch = 0;
+			vertexBufferSubData.SysMemSlicePitch = 0;
+
+			ID3D11Buffer* vertexBuffer = nullptr;
+			result = direct3dDevice->CreateBuffer(&vertexBufferDesc, &vertexBufferSubData, &vertexBuffer);
+			if (FAILED(result))
+			{
+				Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+				return false;
+			}
+			addVertexBufferToPrograms(vertexBuffer);
+			vertexBuffer->Release(); // evOQƂ̂ō쐬̎QƂ͎
+		}
+		else
 		{
-			Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
-			return false;
+			addVertexBufferToPrograms(_model->getVertexBuffer(0));
 		}
 
 		std::vector<ID3D11Buffer*> indexBufferList;
-		indexBufferList.push_back(indexBuffer);
+		indexBufferList.push_back(_model->getIndexBuffer(0, 0));
+		addIndexBuffersToPrograms(indexBufferList);
 
-		_d3dProgramForForwardRendering.addIndexBuffers(indexBufferList);
-		_d3dProgramForShadowMap.addIndexBuffers(indexBufferList);
-		_d3dProgramForPointLightShadowMap.addIndexBuffers(indexBufferList);
+		bool depthEnable = true;
+		std::vector<D3D11_INPUT_ELEMENT_DESC> layouts;
+		if (_useCpuSkinning)
+		{
+			// XLjOς݂̒_objƓVF[_ŕ`悷
+			_d3dProgramForForwardRendering.initWithShaderFile("Resources/shader/ObjForward.hlsl", depthEnable, "VS", "", "PS");
+			_d3dProgramForShadowMap.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_SM", "", shadowMapPixelShader, shadowMapFeatures);
+			_d3dProgramForPointLightShadowMap.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_SM_POINT_LIGHT", "GS_SM_POINT_LIGHT", pointLightShadowMapPixelShader, shadowMapFeatures);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-		_d3dProgramForGBuffer.addIndexBuffers(indexBufferList);
+			_d3dProgramForGBuffer.initWithShaderFile("Resources/shader/Obj.hlsl", depthEnable, "VS_GBUFFER", "", "PS_GBUFFER", ShaderPermutation::FEATURE_GBUFFER | alphaTestFeature);
 #endif
 
-		bool depthEnable = true;
-		_d3dProgramForForwardRendering.initWithShaderFile("Resources/shader/C3bC3tForward.hlsl", depthEnable, "VS", "", "PS");
-		_d3dProgramForShadowMap.initWithShaderFile("Resources/shader/C3bC3t.hlsl", depthEnable, "VS_SM", "", "");
-		_d3dProgramForPointLightShadowMap.initWithShaderFile("Resources/shader/C3bC3t.hlsl", depthEnable, "VS_SM_POINT_LIGHT", "GS_SM_POINT_LIGHT", "");
+			// ̓CAEgIuWFNg̍쐬
+			D3D11_INPUT_ELEMENT_DESC layout[] = {
+				{D3DProgram::SEMANTIC_POSITION.c_str(), 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{D3DProgram::SEMANTIC_NORMAL.c_str(), 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, sizeof(Vec3), D3D11_INPUT_PER_VERTEX_DATA, 0},
+				{D3DProgram::SEMANTIC_TEXTURE_COORDINATE.c_str(), 0, DXGI_FORMAT_R32G32_FLOAT, 0, sizeof(Vec3) * 2, D3D11_INPUT_PER_VERTEX_DATA, 0},
+			};
+			layouts.assign(layout, layout + _countof(layout));
+		}
+		else
+		{
+			_d3dProgramForForwardRendering.initWithShaderFile("Resources/shader/C3bC3tForward.hlsl", depthEnable, "VS", "", "PS");
+			_d3dProgramForShadowMap.initWithShaderFile("Resources/shader/C3bC3t.hlsl", depthEnable, "VS_SM", "", shadowMapPixelShader, shadowMapFeatures);
+			_d3dProgramForPointLightShadowMap.initWithShaderFile("Resources/shader/C3bC3t.hlsl", depthEnable, "VS_SM_POINT_LIGHT", "GS_SM_POINT_LIGHT", pointLightShadowMapPixelShader, shadowMapFeatures);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-		_d3dProgramForGBuffer.initWithShaderFile("Resources/shader/C3bC3t.hlsl", depthEnable, "VS_GBUFFER", "", "PS_GBUFFER");
+			_d3dProgramForGBuffer.initWithShaderFile("Resources/shader/C3bC3t.hlsl", depthEnable, "VS_GBUFFER", "", "PS_GBUFFER", ShaderPermutation::FEATURE_GBUFFER | alphaTestFeature);
 #endif
 
-		// ̓CAEgIuWFNg̍쐬
-		std::vector<D3D11_INPUT_ELEMENT_DESC> layouts(meshData->numAttribute);
-		for (size_t i = 0, offset = 0; i < meshData->numAttribute; ++i)
-		{
-			const C3bLoader::MeshVertexAttribute& attrib = meshData->attributes[i];
-			D3D11_INPUT_ELEMENT_DESC layout = {attrib.semantic.c_str(), 0, D3DProgram::getDxgiFormat(attrib.semantic), 0, static_cast<UINT>(offset), D3D11_INPUT_PER_VERTEX_DATA, 0};
-			layouts[i] = layout;
-			offset += attrib.attributeSizeBytes;
+			// ̓CAEgIuWFNg̍쐬
+			layouts.resize(attributes.size());
+			for (size_t i = 0, offset = 0; i < attributes.size(); ++i)
+			{
+				const C3bLoader::MeshVertexAttribute& attrib = attributes[i];
+				D3D11_INPUT_ELEMENT_DESC layout = {attrib.semantic.c_str(), 0, D3DProgram::getDxgiFormat(attrib.semantic), 0, static_cast<UINT>(offset), D3D11_INPUT_PER_VERTEX_DATA, 0};
+				layouts[i] = layout;
+				offset += attrib.attributeSizeBytes;
+			}
 		}
 
 		ID3D11InputLayout* inputLayout = nullptr;
@@ -429,7 +335,7 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::RENDER_MODE, constantBuffer);
 
 	// Modelsp
 	constantBuffer = nullptr;
@@ -439,11 +345,11 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::MODEL_MATRIX, constantBuffer);
 #endif
 
 	// Viewsp
@@ -454,11 +360,11 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 #endif
 
 	// Projectionsp
@@ -469,11 +375,11 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 #endif
 
 	// fvXoCAXsp
@@ -484,11 +390,11 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
 #endif
 
 	// Normalsp
@@ -499,11 +405,11 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX, constantBuffer);
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::NORMAL_MATRIX, constantBuffer);
 #endif
 
 	constantBufferDesc.ByteWidth = sizeof(Color4F); // getColor()Color3Bɂ12oCgEȂ̂16oCgÊ߂ɃpfBOf[^˂΂ȂȂ
@@ -515,15 +421,15 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
 #endif
 
-	// XLjÕ}gbNXpbg
-	if (_isC3b)
+	// XLjÕ}gbNXpbgBCPUŃXLjOƂ̓VF[_ɓnȂ
+	if (_isC3b && !_useCpuSkinning)
 	{
 		constantBufferDesc.ByteWidth = sizeof(Mat4) * MAX_SKINNING_JOINT;
 		constantBuffer = nullptr;
@@ -533,11 +439,11 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 			Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 			return false;
 		}
-		_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE, constantBuffer);
-		_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
-		_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+		_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, constantBuffer);
+		_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+		_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-		_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE, constantBuffer);
+		_d3dProgramForGBuffer.addConstantBuffer(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, constantBuffer);
 #endif
 	}
 
@@ -550,9 +456,9 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
 
 	// fBNVigCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(DirectionalLight::ConstantBufferData);
@@ -563,9 +469,9 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
 
 	// |CgCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM;
@@ -576,7 +482,7 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, constantBuffer);
 
 	constantBufferDesc.ByteWidth = sizeof(PointLight::ConstantBufferData);
 	constantBuffer = nullptr;
@@ -586,8 +492,8 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
-	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, constantBuffer); // VF[_ł͎gȂACfbNX̐lLĂ̂łȂ悤ɃVhE}bvp萔obt@ɂ
+	_d3dProgramForPointLightShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, constantBuffer);
 
 	// X|bgCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM;
@@ -598,7 +504,7 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForForwardRendering.addConstantBuffer(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, constantBuffer);
 
 	constantBufferDesc.ByteWidth = sizeof(SpotLight::ConstantBufferData);
 	constantBuffer = nullptr;
@@ -608,13 +514,18 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return false;
 	}
-	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForShadowMap.addConstantBuffer(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, constantBuffer);
 
 #elif defined(MGRRENDERER_USE_OPENGL)
 	if (_isObj)
 	{
 		_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionNormalTexture3D.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureNormalMultiplyColor3D.glsl");
 	}
+	else if (_isC3b && _useCpuSkinning)
+	{
+		// XLjOς݂̒_objƓVF[_ŕ`悷
+		_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderPositionNormalTexture3D.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionTextureNormalMultiplyColor3D.glsl");
+	}
 	else if (_isC3b)
 	{
 		_glProgramForForwardRendering.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderC3bC3t.glsl", "../MGRRenderer/Resources/shader/FragmentShaderC3bC3t.glsl");
@@ -622,207 +533,154 @@ bool Sprite3D::initWithModel(const std::string& filePath, bool useMtl)
 
 	// TODO:Cg̔Ȃ
 
-	if (_isObj)
+	// VhE}bvGobt@́Aobjc3b/c3tœVF[_gA`悷pX̃rbgŐ؂ւ
+	// c3b/c3t̓XLjOoG[VɂAAt@eXg̓f̃}eAŌ߂
+	unsigned int features = (_isC3b && !_useCpuSkinning) ? ShaderPermutation::FEATURE_SKINNING : ShaderPermutation::FEATURE_NONE;
+	if (_model->needsAlphaTest())
 	{
-		_glProgramForShadowMap.initWithShaderString(
-			// vertex shader
-			// ModelDatagȂꍇ
-			"#version 430\n"
-			"attribute vec4 a_position;"
-			"uniform mat4 u_modelMatrix;"
-			"uniform mat4 u_lightViewMatrix;" // etɎgCgJɌĂr[s
-			"uniform mat4 u_lightProjectionMatrix;"
-			"void main()"
-			"{"
-			"	gl_Position = u_lightProjectionMatrix * u_lightViewMatrix * u_modelMatrix * a_position;"
-			"}"
-			,
-			// fragment shader
-			"#version 430\n"
-			"void main()"
-			"{" // Ƃ[x͎ŏ܂ 
-			"}"
-		);
+		features |= ShaderPermutation::FEATURE_ALPHA_TEST;
 	}
-	else if (_isC3b)
+
+	_glProgramForShadowMap.initWithShaderFile(OBJ_VERTEX_SHADER_FILE, OBJ_FRAGMENT_SHADER_FILE, features | ShaderPermutation::FEATURE_SHADOW_MAP);
+
+	// STRINGIFYɂǂݍ݂ƁAGeForce850M܂#version̍s̉sǂݎĂꂸGLSLRpCG[ɂȂ
+	_glProgramForGBuffer.initWithShaderFile(OBJ_VERTEX_SHADER_FILE, OBJ_FRAGMENT_SHADER_FILE, features | ShaderPermutation::FEATURE_GBUFFER);
+
+	if (_isC3b && _useCpuSkinning)
 	{
-		_glProgramForShadowMap.initWithShaderString(
-			// vertex shader
-			// ModelDatagȂꍇ
-			//"attribute vec4 a_position;"
-			//"uniform mat4 u_lightViewMatrix;" // etɎgCgJɌĂr[s
-			//"uniform mat4 u_viewMatrix;"
-			//"uniform mat4 u_projectionMatrix;"
-			//"void main()"
-			//"{"
-			//"	gl_Position = u_projectionMatrix * u_lightViewMatrix * u_modelMatrix * getPosition();"
-			//"}"
-			//// Aj[Vgꍇ
-			"#version 430\n"
-			"attribute vec3 a_position;" // ꂪvec3ɂȂĂ̂ɒ TODO:ȂȂ̂H
-			"attribute vec4 a_blendWeight;"
-			"attribute vec4 a_blendIndex;"
-			""
-			"const int MAX_SKINNING_JOINT = 60;" // TODO:Ȃ60܂łȂ̂H
-			""
-			"uniform mat4 u_modelMatrix;"
-			"uniform mat4 u_lightViewMatrix;" // etɎgCgJɌĂr[s
-			"uniform mat4 u_lightProjectionMatrix;"
-			"uniform mat4 u_matrixPalette[MAX_SKINNING_JOINT];"
-			""
-			"varying vec2 v_texCoord;"
-			""
-			"vec4 getPosition()"
-			"{"
-			"	mat4 skinMatrix = u_matrixPalette[int(a_blendIndex[0])] * a_blendWeight[0];"
-			""
-			"	if (a_blendWeight[1] > 0.0)"
-			"	{"
-			"		skinMatrix += u_matrixPalette[int(a_blendIndex[1])] * a_blendWeight[1];"
-			""
-			"		if (a_blendWeight[2] > 0.0)"
-			"		{"
-			"			skinMatrix += u_matrixPalette[int(a_blendIndex[2])] * a_blendWeight[2];"
-			""
-			"			if (a_blendWeight[3] > 0.0)"
-			"			{"
-			"				skinMatrix += u_matrixPalette[int(a_blendIndex[3])] * a_blendWeight[3];"
-			"			}"
-			"		}"
-			"	}"
-			""
-			"	vec4 position = vec4(a_position, 1.0);"
-			"	vec4 skinnedPosition = skinMatrix * position;"
-			"	skinnedPosition.w = 1.0;"
-			"	return skinnedPosition;"
-			"}"
-			""
-			"void main()"
-			"{"
-			"	gl_Position = u_lightProjectionMatrix * u_lightViewMatrix * u_modelMatrix * getPosition();"
-			"}"
-			,
-			// fragment shader
-			"#version 430\n"
-			"void main()"
-			"{" // Ƃ[x͎ŏ܂ 
-			"}"
-		);
-	}
+		// XLjOς݂̒_̓CX^XƂɈႤ̂ŁÃCX^XpVAOBt[updateŏ
+		const std::vector<Position3DNormalTextureCoordinates>& vertices = _skinnedVertexCache.getSkinnedVertices();
 
-	if (_isObj)
+		_skinnedVertexArray = new GLVertexArray();
+		_skinnedVertexArray->init();
+
+		size_t bufferIndex = _skinnedVertexArray->addVertexBuffer(vertices.data(), sizeof(Position3DNormalTextureCoordinates) * vertices.size(), GL_DYNAMIC_DRAW);
+		_skinnedVertexArray->setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, bufferIndex, 3, GL_FLOAT, sizeof(Position3DNormalTextureCoordinates), offsetof(Position3DNormalTextureCoordinates, position));
+		_skinnedVertexArray->setVertexAttribute((GLuint)GLProgram::AttributeLocation::NORMAL, bufferIndex, 3, GL_FLOAT, sizeof(Position3DNormalTextureCoordinates), offsetof(Position3DNormalTextureCoordinates, normal));
+		_skinnedVertexArray->setVertexAttribute((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, bufferIndex, 2, GL_FLOAT, sizeof(Position3DNormalTextureCoordinates), offsetof(Position3DNormalTextureCoordinates, textureCoordinate));
+
+		const MeshIndices& indices = _model->getIndicesList()[0][0];
+		_skinnedVertexArray->setIndexBuffer(indices.getData(), indices.getByteSize(), GL_STATIC_DRAW);
+
+		_glVertexArrays.push_back(_skinnedVertexArray);
+	}
+	else
 	{
-		// STRINGIFYɂǂݍ݂ƁAGeForce850M܂#version̍s̉sǂݎĂꂸGLSLRpCG[ɂȂ
-		_glProgramForGBuffer.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderObj.glsl", "../MGRRenderer/Resources/shader/FragmentShaderPositionNormalTextureMultiplyColorGBuffer.glsl");
+		// VAOModelAsset̂̂L
+		size_t numMesh = _isObj ? _model->getNumMeshes() : 1;
+		for (size_t meshIndex = 0; meshIndex < numMesh; ++meshIndex)
+		{
+			_glVertexArrays.push_back(_model->getVertexArray(meshIndex));
+		}
 	}
-	else if (_isC3b)
+#endif
+
+	return true;
+}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+void Sprite3D::addVertexBufferToPrograms(ID3D11Buffer* vertexBuffer)
+{
+	// D3DProgram̓fXgN^Ńobt@ReleasêŁAvO̐QƂ𑝂₷
+	std::vector<ID3D11Buffer*> oneMeshVBs;
+	oneMeshVBs.push_back(vertexBuffer);
+
+	vertexBuffer->AddRef();
+	_d3dProgramForForwardRendering.addVertexBuffers(oneMeshVBs);
+	vertexBuffer->AddRef();
+	_d3dProgramForShadowMap.addVertexBuffers(oneMeshVBs);
+	vertexBuffer->AddRef();
+	_d3dProgramForPointLightShadowMap.addVertexBuffers(oneMeshVBs);
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+	vertexBuffer->AddRef();
+	_d3dProgramForGBuffer.addVertexBuffers(oneMeshVBs);
+#endif
+}
+
+void Sprite3D::addIndexBuffersToPrograms(const std::vector<ID3D11Buffer*>& indexBufferList)
+{
+	for (ID3D11Buffer* indexBuffer : indexBufferList)
 	{
-		_glProgramForGBuffer.initWithShaderString(
-			// vertex shader
-			// ModelDatagȂꍇ
-			//"attribute vec4 a_position;"
-			//"attribute vec2 a_texCoord;"
-			//"varying vec2 v_texCoord;"
-			//"uniform mat4 u_modelMatrix;"
-			//"uniform mat4 u_viewMatrix;"
-			//"uniform mat4 u_projectionMatrix;"
-			//"void main()"
-			//"{"
-			//"	gl_Position = u_projectionMatrix * u_viewMatrix * a_position;"
-			//"	v_texCoord = a_texCoord;"
-			//"	v_texCoord.y = 1.0 - v_texCoord.y;"
-			//"}"
-			//// Aj[Vgꍇ
-			"#version 430\n"
-			""
-			"in vec3 a_position;" // ꂪvec3ɂȂĂ̂ɒ TODO:ȂȂ̂H
-			"in vec3 a_normal;"
-			"in vec2 a_texCoord;"
-			"in vec4 a_blendWeight;"
-			"in vec4 a_blendIndex;"
-			""
-			"const int MAX_SKINNING_JOINT = 60;" // TODO:Ȃ60܂łȂ̂H
-			""
-			"uniform mat4 u_modelMatrix;"
-			"uniform mat4 u_viewMatrix;"
-			"uniform mat4 u_projectionMatrix;"
-			"uniform mat4 u_normalMatrix;" // scaleϊɑΉ邽߂Ƀfs̋ts]ûp
-			"uniform mat4 u_matrixPalette[MAX_SKINNING_JOINT];"
-			""
-			"out vec4 v_normal;"
-			"out vec2 v_texCoord;"
-			""
-			"vec4 getPosition()"
-			"{"
-			"	mat4 skinMatrix = u_matrixPalette[int(a_blendIndex[0])] * a_blendWeight[0];"
-			""
-			"	if (a_blendWeight[1] > 0.0)"
-			"	{"
-			"		skinMatrix += u_matrixPalette[int(a_blendIndex[1])] * a_blendWeight[1];"
-			""
-			"		if (a_blendWeight[2] > 0.0)"
-			"		{"
-			"			skinMatrix += u_matrixPalette[int(a_blendIndex[2])] * a_blendWeight[2];"
-			""
-			"			if (a_blendWeight[3] > 0.0)"
-			"			{"
-			"				skinMatrix += u_matrixPalette[int(a_blendIndex[3])] * a_blendWeight[3];"
-			"			}"
-			"		}"
-			"	}"
-			""
-			"	vec4 position = vec4(a_position, 1.0);"
-			"	vec4 skinnedPosition = skinMatrix * position;"
-			"	skinnedPosition.w = 1.0;"
-			"	return skinnedPosition;"
-			"}"
-			""
-			"void main()"
-			"{"
-			"	gl_Position = u_projectionMatrix * u_viewMatrix * u_modelMatrix * getPosition();"
-			"	vec4 normal = vec4(a_normal, 1.0);"
-			"	v_normal = vec4(normalize((u_normalMatrix * normal).xyz), 1.0);"
-			"	v_texCoord = a_texCoord;"
-			"	v_texCoord.y = 1.0 - v_texCoord.y;" // c3b̎ɂ
-			"}"
-			,
-			// fragment shader
-			"#version 430\n"
-			""
-			"float SPECULAR_POWER_RANGE_X = 10.0;"
-			"float SPECULAR_POWER_RANGE_Y = 250.0;"
-			""
-			"in vec4 v_position;"
-			"in vec4 v_normal;"
-			"in vec2 v_texCoord;"
-			""
-			"uniform vec3 u_multipleColor;"
-			"uniform sampler2D u_texture;"
-			""
-			"layout (location = 0) out vec4 FragColor;" // fvXobt@̕
-			"layout (location = 1) out vec4 ColorSpecularIntensity;"
-			"layout (location = 2) out vec4 Normal;"
-			"layout (location = 3) out vec4 SpecularPower;"
-			""
-			"void main()"
-			"{"
-			"	"// Gobt@ւ̃pbLOs
-			""
-			"	"// specular͍̂ƂΉĂȂ
-			"	float specularPower = 0.0;"
-			"	float specularIntensity = 0.0;"
-			"	float specularPowerNorm = max(0.0001, (specularPower - SPECULAR_POWER_RANGE_X) / SPECULAR_POWER_RANGE_Y);"
-			""
-			"	ColorSpecularIntensity = vec4(texture2D(u_texture, v_texCoord).rgb * u_multipleColor.rgb, specularIntensity);"
-			"	Normal = vec4(v_normal.xyz * 0.5 + 0.5, 0.0);"
-			"	SpecularPower = vec4(specularPowerNorm, 0.0, 0.0, 0.0);"
-			"}"
-		);
+		indexBuffer->AddRef();
+		indexBuffer->AddRef();
+		indexBuffer->AddRef();
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+		indexBuffer->AddRef();
+#endif
 	}
 
+	_d3dProgramForForwardRendering.addIndexBuffers(indexBufferList);
+	_d3dProgramForShadowMap.addIndexBuffers(indexBufferList);
+	_d3dProgramForPointLightShadowMap.addIndexBuffers(indexBufferList);
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+	_d3dProgramForGBuffer.addIndexBuffers(indexBufferList);
+#endif
+}
 #endif
 
-	return true;
+size_t Sprite3D::precompileShaderPermutations()
+{
+	size_t ret = 0;
+	const unsigned int alphaTestFeatures[] = { ShaderPermutation::FEATURE_NONE, ShaderPermutation::FEATURE_ALPHA_TEST };
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	ShaderCache* shaderCache = ShaderCache::getInstance();
+	// objCPUXLjOc3b/c3tObj.hlslAGPUXLjOc3b/c3tC3bC3t.hlslgBHLSL̓XLjOt@CŕĂ
+	const char* paths[] = { "Resources/shader/Obj.hlsl", "Resources/shader/C3bC3t.hlsl" };
+	for (const char* path : paths)
+	{
+		for (unsigned int alphaTestFeature : alphaTestFeatures)
+		{
+			unsigned int shadowMapFeatures = ShaderPermutation::FEATURE_SHADOW_MAP | alphaTestFeature;
+			std::vector<ID3D11DeviceChild*> shaders;
+			shaders.push_back(shaderCache->getVertexShader(path, "VS_SM", shadowMapFeatures, nullptr));
+			shaders.push_back(shaderCache->getVertexShader(path, "VS_SM_POINT_LIGHT", shadowMapFeatures, nullptr));
+			shaders.push_back(shaderCache->getGeometryShader(path, "GS_SM_POINT_LIGHT", shadowMapFeatures));
+			if (alphaTestFeature != ShaderPermutation::FEATURE_NONE)
+			{
+				shaders.push_back(shaderCache->getPixelShader(path, "PS_SM_ALPHA_TEST", shadowMapFeatures));
+				shaders.push_back(shaderCache->getPixelShader(path, "PS_SM_POINT_LIGHT_ALPHA_TEST", shadowMapFeatures));
+			}
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+			unsigned int gBufferFeatures = ShaderPermutation::FEATURE_GBUFFER | alphaTestFeature;
+			shaders.push_back(shaderCache->getVertexShader(path, "VS_GBUFFER", gBufferFeatures, nullptr));
+			shaders.push_back(shaderCache->getPixelShader(path, "PS_GBUFFER", gBufferFeatures));
+#endif
+
+			for (ID3D11DeviceChild* shader : shaders)
+			{
+				Logger::logAssert(shader != nullptr, "VF[_̃vRpCɎsBpath=%s", path);
+				if (shader != nullptr)
+				{
+					shader->Release();
+					ret++;
+				}
+			}
+		}
+	}
+#elif defined(MGRRENDERER_USE_OPENGL)
+	const unsigned int passFeatures[] = { ShaderPermutation::FEATURE_SHADOW_MAP, ShaderPermutation::FEATURE_GBUFFER };
+	const unsigned int skinningFeatures[] = { ShaderPermutation::FEATURE_NONE, ShaderPermutation::FEATURE_SKINNING };
+	for (unsigned int passFeature : passFeatures)
+	{
+		for (unsigned int skinningFeature : skinningFeatures)
+		{
+			for (unsigned int alphaTestFeature : alphaTestFeatures)
+			{
+				// vOShaderCachefBXNɕۑ̂ŁAł͂Ă悢
+				GLProgram program;
+				program.initWithShaderFile(OBJ_VERTEX_SHADER_FILE, OBJ_FRAGMENT_SHADER_FILE, passFeature | skinningFeature | alphaTestFeature);
+				Logger::logAssert(program.getShaderProgram() != 0, "VF[_̃vRpCɎsBfeatures=%u", passFeature | skinningFeature | alphaTestFeature);
+				if (program.getShaderProgram() != 0)
+				{
+					ret++;
+				}
+			}
+		}
+	}
+#endif
+
+	return ret;
 }
 
 void Sprite3D::addTexture(const std::string& filePath)
@@ -846,129 +704,191 @@ void Sprite3D::addTexture(const std::string& filePath)
 	if (success)
 	{
 		_textureList.push_back(texture);
+		_addedTextureList.push_back(texture);
+		_textureFilePathList.push_back(filePath);
 	}
 }
 
-void Sprite3D::startAnimation(const std::string& animationName, bool loop /* = false*/)
+const AnimationClip* Sprite3D::findAnimationClip(const std::string& animationName) const
 {
-	_elapsedTime = 0.0f;
-	_currentAnimation = _animationDatas->animations[animationName];
-	_loopAnimation = loop;
+	const AnimationClip* clip = _model->findAnimationClip(animationName);
+	Logger::logAssert(clip != nullptr, "݂ȂAj[V animationName=%s", animationName.c_str());
+	return clip;
 }
 
-void Sprite3D::stopAnimation()
+size_t Sprite3D::getSubMeshTextureIndex(size_t meshIndex, size_t subMeshIndex) const
 {
-	_currentAnimation = nullptr;
+	if (!_useMtl)
+	{
+		return 0;
+	}
+
+	// ModelAsset̓[hɃeNX`ƏƂ炵Ă邪AeNX`̂ȂTubV-1ɂȂĂ
+	int textureIndex = _model->getDiffuseTextureIndices()[meshIndex][subMeshIndex];
+	if (textureIndex < 0 || static_cast<size_t>(textureIndex) >= _textureList.size())
+	{
+		return 0;
+	}
+
+	return static_cast<size_t>(textureIndex);
 }
 
-C3bLoader::NodeData* Sprite3D::findJointByName(const std::string& jointName, const std::vector<C3bLoader::NodeData*> children)
+void Sprite3D::setShadowMapAlphaTestTexture(size_t textureIndex) const
 {
-	for (C3bLoader::NodeData* child : children)
+	if (!_model->needsAlphaTest())
 	{
-		if (child->id == jointName)
-		{
-			// 炻ԂB[vIB
-			return child;
-		}
-		else if (child->children.size() > 0)
-		{
-			// 炸AqȂqTɍs
-			C3bLoader::NodeData* findResult = findJointByName(jointName, child->children);
-			if (findResult != nullptr)
-			{
-				// 炻ԂB[vIB
-				return findResult;
-			}
-		}
+		return;
 	}
 
-	return nullptr;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
+
+	ID3D11ShaderResourceView* shaderResourceViews[1] = { _textureList[textureIndex]->getShaderResourceView() };
+	direct3dContext->PSSetShaderResources(0, 1, shaderResourceViews);
+
+	ID3D11SamplerState* samplerState[1] = { Director::getRenderer().getLinearSamplerState() };
+	direct3dContext->PSSetSamplers(0, 1, samplerState);
+#elif defined(MGRRENDERER_USE_OPENGL)
+	glActiveTexture(GL_TEXTURE0);
+	glBindTexture(GL_TEXTURE_2D, _textureList[textureIndex]->getTextureId());
+	GLProgram::checkGLError();
+#endif
+}
+
+void Sprite3D::startAnimation(const std::string& animationName, bool loop /* = false*/)
+{
+	_animationBlender.play(findAnimationClip(animationName), loop);
+	_snapMatrixPalette = true;
+}
+
+void Sprite3D::crossFadeAnimation(const std::string& animationName, float duration, bool loop /* = false*/)
+{
+	// ̎pAĐ؂ւ̂ŁApbg̕Ԃ͂̂܂ܑ
+	_animationBlender.crossFade(findAnimationClip(animationName), duration, loop);
+}
+
+void Sprite3D::addAnimationLayer(const std::string& animationName, float weight, bool loop /* = false*/, AnimationBlender::BlendMode mode /* = AnimationBlender::BlendMode::NORMAL*/)
+{
+	_animationBlender.addLayer(findAnimationClip(animationName), weight, loop, mode);
+}
+
+void Sprite3D::setAnimationWeight(const std::string& animationName, float weight)
+{
+	_animationBlender.setLayerWeight(findAnimationClip(animationName), weight);
+}
+
+void Sprite3D::stopAnimation()
+{
+	_animationBlender.stop();
+
+	// Aj[VĂȂԂAnimationSchedulerɓo^Ȃ̂ŁAŃoCh|[Yɖ߂Ă
+	if (_isC3b)
+	{
+		evaluateMatrixPalette(0.0f, AnimationScheduler::ALL_JOINTS);
+		_matrixPaletteBlendRatio = 1.0f;
+		_isMatrixPaletteDirty = true;
+		updateMatrixPalette();
+	}
 }
 
 void Sprite3D::update(float dt)
 {
 	Node::update(dt);
 
-	if (!_isC3b) {
+	if (!_isC3b || !_animationBlender.isPlaying()) {
 		return;
 	}
 
-	float t = 0; // 0<=t<=1̃Aj[V⊮p[^
-	if (_currentAnimation != nullptr)
-	{
-		_elapsedTime += dt;
-		if (_loopAnimation && _elapsedTime > _currentAnimation->totalTime)
-		{
-			_elapsedTime = 0.0f;
-		}
+	_animationBlender.advance(dt);
+	_lastDeltaTime = dt;
 
-		t = _elapsedTime / _currentAnimation->totalTime;
-	}
+	// p̌vŹAʏ̑傫ƉŊԈ悤AnimationSchedulerőSCX^X܂Ƃ߂čs
+	AnimationScheduler::getInstance()->request(this);
+}
 
-	_matrixPalette.clear();
+void Sprite3D::evaluateMatrixPalette(float lookAheadTime, unsigned int maxJointDepth)
+{
+	// ɊeWCg̃[Jp߂BĐ̃NbvuhAL[t[񂪂ȂWCgNodeDatas::skeletontransformg
+	const Skeleton& skeleton = _model->getSkeleton();
+	_animationBlender.evaluate(lookAheadTime, maxJointDepth, _localPoses.data());
 
-	// Aj[VsBAnimate3D::updateQl C3bLoader::AnimationData̎gȂ̂
-	size_t numSkinJoint = _nodeDatas->nodes[0]->modelNodeDatas[0]->bones.size();
-	Logger::logAssert(numSkinJoint == _nodeDatas->nodes[0]->modelNodeDatas[0]->invBindPose.size(), "WCg͈v͂");
+	// Ƀ[g珇ɃfԂ̎p߂ȂAWCg̃}gbNXpbgׂċ߂
+	skeleton.computeMatrixPalette(_localPoses.data(), _modelPoses.data(), _nextMatrixPalette.data());
+}
 
-	// ɊeWCg̃Aj[Vs쐬
-	for (size_t i = 0; i < numSkinJoint; ++i)
+void Sprite3D::evaluateAnimation(unsigned int updateInterval, unsigned int maxJointDepth)
+{
+	if (!_snapMatrixPalette)
 	{
-		const std::string& jointName = _nodeDatas->nodes[0]->modelNodeDatas[0]->bones[i];//TODO: nodesɗvf͈Apartsɂł邱ƂOɂĂ
-
-		// L[t[񂪂ȂANodeDatas::skeletons::transform̃̕c[ċAIɃWCgʒuWϊzvZ
-		// ܂͑Ή{[TAݒ肳Ăs擾
-		C3bLoader::NodeData* node = findJointByName(jointName, _nodeDatas->skeleton);
-		Logger::logAssert(node != nullptr, "nodes̕ɂ̂skeletons{[ŌȂB");
+		// \ĂpbgԂ̎n_ɂ
+		lerpMatrixPalette(_previousMatrixPalette, _nextMatrixPalette, _matrixPaletteBlendRatio, _previousMatrixPalette);
+	}
 
-		// UAAj[VgȂɏ
-		node->animatedTransform = Mat4::ZERO;
+	// ԈĂԂ͕Ԃ̂ŁAɌvZt[̎̎pɋ߂ĂBt[vZƂ͍̎ɂȂ
+	evaluateMatrixPalette(_lastDeltaTime * (updateInterval - 1), maxJointDepth);
 
-		if (_currentAnimation != nullptr && _currentAnimation->translationKeyFrames.find(jointName) != _currentAnimation->translationKeyFrames.end())
-		{
-			// Aj[VŁAf[^ɂ̃{[̃L[t[񂪂Ƃ͂炩sŏ㏑
-			const Vec3& translation = _currentAnimation->evaluateTranslation(jointName, t);
-			const Quaternion& rotation = _currentAnimation->evaluateRotation(jointName, t);
-			const Vec3& scale = _currentAnimation->evaluateScale(jointName, t);
+	_matrixPaletteBlendStep = 1.0f / updateInterval;
+	_matrixPaletteBlendRatio = _snapMatrixPalette ? 1.0f : 0.0f;
+	_isMatrixPaletteDirty = true;
+	_snapMatrixPalette = false;
+	_framesSinceAnimationEvaluation = 0;
+}
 
-			node->animatedTransform = Mat4::createTransform(translation, rotation, scale);
-		}
+bool Sprite3D::blendMatrixPalette()
+{
+	if (!_isMatrixPaletteDirty)
+	{
+		return false;
 	}
 
-	// ɃWCg̃}gbNXpbgׂċ߂
-	for (size_t i = 0; i < numSkinJoint; ++i)
+	_matrixPaletteBlendRatio = std::min(_matrixPaletteBlendRatio + _matrixPaletteBlendStep, 1.0f);
+	if (_matrixPaletteBlendRatio >= 1.0f)
+	{
+		_matrixPalette = _nextMatrixPalette;
+		_isMatrixPaletteDirty = false;
+	}
+	else
 	{
-		const std::string& jointName = _nodeDatas->nodes[0]->modelNodeDatas[0]->bones[i];//TODO: nodesɗvf͈Apartsɂł邱ƂOɂĂ
+		lerpMatrixPalette(_previousMatrixPalette, _nextMatrixPalette, _matrixPaletteBlendRatio, _matrixPalette);
+	}
 
-		// L[t[񂪂ȂANodeDatas::skeletons::transform̃̕c[ċAIɃWCgʒuWϊzvZ
-		// ܂͑Ή{[TAݒ肳Ăs擾
-		C3bLoader::NodeData* node = findJointByName(jointName, _nodeDatas->skeleton);
-		if (node == nullptr)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	if (!_useCpuSkinning)
+	{
+		for (Mat4& matrix : _matrixPalette)
 		{
-			Logger::log("nodes̕ɂ̂skeletons{[ŌȂB");
+			matrix.transpose();
 		}
-		Logger::logAssert(node != nullptr, "c3b̎dlAWCgȂ͂ȂB");
+	}
+#endif
 
-		Mat4 transform = (node->animatedTransform != Mat4::ZERO) ? node->animatedTransform : node->transform;
+	return true;
+}
 
-		// e[g܂ł̂ڂă[hsvZ
-		while (node->parent != nullptr)
-		{
-			// TODO:ẽ{[Aj[VĂ\߂ɁANodeDataɂMatrixƂȕ@B{Skeleton3DBone3D݂ɕʂ̊Kw\f[^ێ
-			const Mat4& parentTransform = (node->parent->animatedTransform != Mat4::ZERO) ? node->parent->animatedTransform : node->parent->transform;
-			transform = parentTransform * transform;
-			node = node->parent;
-		}
+void Sprite3D::skinVertices()
+{
+	// SpXŎg_ňxXLjOĂBpbg̓VF[_ɓnȂ
+	_skinnedVertexCache.skin(_matrixPalette);
+}
 
-		// {[̔zus
-		const Mat4& invBindPose = _nodeDatas->nodes[0]->modelNodeDatas[0]->invBindPose[i];//TODO: nodesɗvf͈Apartsɂł邱ƂOɂĂ
+void Sprite3D::updateMatrixPalette()
+{
+	if (blendMatrixPalette() && _useCpuSkinning)
+	{
+		skinVertices();
+		uploadSkinnedVertices();
+	}
+}
 
-		Mat4 matrix = transform * invBindPose;
+void Sprite3D::uploadSkinnedVertices()
+{
+	const std::vector<Position3DNormalTextureCoordinates>& vertices = _skinnedVertexCache.getSkinnedVertices();
 #if defined(MGRRENDERER_USE_DIRECT3D)
-		matrix.transpose();
+	// _obt@͑SvOŋLĂ̂ŁA1񏑂ΑSpXɔf
+	Director::getRenderer().getDirect3dContext()->UpdateSubresource(_d3dProgramForForwardRendering.getVertexBuffers(0)[0], 0, nullptr, vertices.data(), 0, 0);
+#elif defined(MGRRENDERER_USE_OPENGL)
+	_skinnedVertexArray->updateVertexBuffer(0, vertices.data(), sizeof(Position3DNormalTextureCoordinates) * vertices.size());
 #endif
-		_matrixPalette.push_back(matrix);
-	}
 }
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
@@ -980,87 +900,31 @@ void Sprite3D::renderGBuffer()
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
 		// TODO:ւ񋤒ʉȁBB
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// m[}s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 normalMatrix = Mat4::CHIRARITY_CONVERTER * Mat4::createNormalMatrix(getModelMatrix());
 		normalMatrix.transpose();
-		CopyMemory(mappedResource.pData, &normalMatrix.m, sizeof(normalMatrix));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::NORMAL_MATRIX, &normalMatrix.m, sizeof(normalMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color4B(getColor().r, getColor().g, getColor().b, 255));
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
-		if (_isC3b)
+		if (_isC3b && !_useCpuSkinning)
 		{
 			// WCg}gbNXpbg̃}bv
-			result = direct3dContext->Map(
-				_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
-			direct3dContext->Unmap(_d3dProgramForGBuffer.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE), 0);
+			_d3dProgramForGBuffer.setConstantBufferData(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
 		}
 
 		size_t stride = 0;
@@ -1080,7 +944,7 @@ void Sprite3D::renderGBuffer()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForGBuffer.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForGBuffer.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForGBuffer, direct3dContext);
 
 		ID3D11SamplerState* samplerState[1] = { Director::getRenderer().getLinearSamplerState() };
 		direct3dContext->PSSetSamplers(0, 1, samplerState);
@@ -1088,25 +952,20 @@ void Sprite3D::renderGBuffer()
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
 				direct3dContext->IASetVertexBuffers(0, _d3dProgramForGBuffer.getVertexBuffers(meshIndex).size(), _d3dProgramForGBuffer.getVertexBuffers(meshIndex).data(), strides, offsets);
 
-				D3DTexture* texture = _textureList[0];
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					int subMeshDiffuseTextureIndex = _diffuseTextureIndices[meshIndex][subMeshIndex];
-					if (_useMtl)
-					{
-						texture = _textureList[subMeshDiffuseTextureIndex];
-					}
+					D3DTexture* texture = _textureList[getSubMeshTextureIndex(meshIndex, subMeshIndex)];
 
 					ID3D11ShaderResourceView* shaderResourceViews[1] = { texture->getShaderResourceView() };
 					direct3dContext->PSSetShaderResources(0, 1, shaderResourceViews);
 
-					direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(meshIndex, subMeshIndex), DXGI_FORMAT_R16_UINT, 0);
-					direct3dContext->DrawIndexed(_indicesList[meshIndex][subMeshIndex].size(), 0, 0);
+					direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(meshIndex, subMeshIndex), _model->getIndicesList()[meshIndex][subMeshIndex].getDXGIFormat(), 0);
+					direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), 0, 0);
 				}
 			}
 		}
@@ -1117,97 +976,69 @@ void Sprite3D::renderGBuffer()
 
 			// bV͂ЂƂ
 			direct3dContext->IASetVertexBuffers(0, _d3dProgramForGBuffer.getVertexBuffers(0).size(), _d3dProgramForGBuffer.getVertexBuffers(0).data(), strides, offsets);
-			direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(0, 0), DXGI_FORMAT_R16_UINT, 0);
-			direct3dContext->DrawIndexed(_indicesList[0][0].size(), 0, 0);
+			direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(0, 0), _model->getIndicesList()[0][0].getDXGIFormat(), 0);
+			direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[0][0].getNumIndices()), 0, 0);
 		}
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForGBuffer.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform3f(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
+		glUniform3f(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f);
 		GLProgram::checkGLError();
 
 		// s̐ݒ
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
 		Mat4 normalMatrix = Mat4::createNormalMatrix(getModelMatrix());
-		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UNIFORM_NAME_NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
-
-		// _̐ݒ
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_WEIGHT);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_INDEX);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
-		GLProgram::checkGLError();
+		glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
 
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].position);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].normal);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].textureCoordinate);
-				GLProgram::checkGLError();
+				_glVertexArrays[meshIndex]->bind();
 
 				glActiveTexture(GL_TEXTURE0);
 
-				GLuint textureId = _textureList[0]->getTextureId();
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					int subMeshDiffuseTextureIndex = _diffuseTextureIndices[meshIndex][subMeshIndex];
-					if (_useMtl)
-					{
-						textureId = _textureList[subMeshDiffuseTextureIndex]->getTextureId();
-					}
+					GLuint textureId = _textureList[getSubMeshTextureIndex(meshIndex, subMeshIndex)]->getTextureId();
 
 					glBindTexture(GL_TEXTURE_2D, textureId);
 					GLProgram::checkGLError();
 
-					const std::vector<unsigned short>& subMeshIndices = _indicesList[meshIndex][subMeshIndex];
-					glDrawElements(GL_TRIANGLES, subMeshIndices.size(), GL_UNSIGNED_SHORT, subMeshIndices.data());
+					glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), _model->getIndicesList()[meshIndex][subMeshIndex].getGLType(), reinterpret_cast<const GLvoid*>(_model->getSubMeshIndexOffsets()[meshIndex][subMeshIndex]));
 					GLProgram::checkGLError();
 				}
 
 				glBindTexture(GL_TEXTURE_2D, 0);
 			}
+
+			GLVertexArray::unbind();
 		}
 		else if (_isC3b)
 		{
 			// TODO:obj邢c3t/c3bŃbVf[^͈łO
-			C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-			for (size_t i = 0, offset = 0; i < meshData->numAttribute; ++i)
+			_glVertexArrays[0]->bind();
+
+			if (!_useCpuSkinning)
 			{
-				const C3bLoader::MeshVertexAttribute& attrib = meshData->attributes[i];
-				glVertexAttribPointer((GLuint)attrib.location, attrib.size, attrib.type, GL_FALSE, _perVertexByteSize, (GLvoid*)&meshData->vertices[offset]);
+				Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
+				glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation(GLProgram::UniformID::MATRIX_PALETTE), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette.data()));
 				GLProgram::checkGLError();
-				offset += attrib.size;
 			}
 
-			Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
-			glUniformMatrix4fv(_glProgramForGBuffer.getUniformLocation("u_matrixPalette"), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette.data()));
-			GLProgram::checkGLError();
-
 			glBindTexture(GL_TEXTURE_2D, _textureList[0]->getTextureId());
 			GLProgram::checkGLError();
 
-			glDrawElements(GL_TRIANGLES, _indicesList[0][0].size(), GL_UNSIGNED_SHORT, _indicesList[0][0].data());
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[0][0].getNumIndices()), _model->getIndicesList()[0][0].getGLType(), nullptr);
 			GLProgram::checkGLError();
+			GLVertexArray::unbind();
 			glBindTexture(GL_TEXTURE_2D, 0);
 		}
 #endif
@@ -1229,61 +1060,23 @@ void Sprite3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightViewMatrix.transpose(); // Direct3Dł͓]uԂœ
-		CopyMemory(mappedResource.pData, &lightViewMatrix.m, sizeof(lightViewMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &lightViewMatrix.m, sizeof(lightViewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightProjectionMatrix = Mat4::CHIRARITY_CONVERTER * lightProjectionMatrix; // nϊs̓vWFNVsɍŏ炩Ă
 		lightProjectionMatrix.transpose();
-		CopyMemory(mappedResource.pData, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
 
-		if (_isC3b)
+		if (_isC3b && !_useCpuSkinning)
 		{
 			// WCg}gbNXpbg̃}bv
-			result = direct3dContext->Map(
-				_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
-			direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE), 0);
+			_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
 		}
 
 		size_t stride = 0;
@@ -1303,20 +1096,21 @@ void Sprite3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForShadowMap.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForShadowMap.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForShadowMap, direct3dContext);
 
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
 				direct3dContext->IASetVertexBuffers(0, _d3dProgramForShadowMap.getVertexBuffers(meshIndex).size(), _d3dProgramForShadowMap.getVertexBuffers(meshIndex).data(), strides, offsets);
 
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(meshIndex, subMeshIndex), DXGI_FORMAT_R16_UINT, 0);
-					direct3dContext->DrawIndexed(_indicesList[meshIndex][subMeshIndex].size(), 0, 0);
+					direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(meshIndex, subMeshIndex), _model->getIndicesList()[meshIndex][subMeshIndex].getDXGIFormat(), 0);
+					setShadowMapAlphaTestTexture(getSubMeshTextureIndex(meshIndex, subMeshIndex));
+					direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), 0, 0);
 				}
 			}
 		}
@@ -1324,18 +1118,19 @@ void Sprite3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 		{
 			// bV͂ЂƂ
 			direct3dContext->IASetVertexBuffers(0, _d3dProgramForShadowMap.getVertexBuffers(0).size(), _d3dProgramForShadowMap.getVertexBuffers(0).data(), strides, offsets);
-			direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(0, 0), DXGI_FORMAT_R16_UINT, 0);
-			direct3dContext->DrawIndexed(_indicesList[0][0].size(), 0, 0);
+			direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(0, 0), _model->getIndicesList()[0][0].getDXGIFormat(), 0);
+			setShadowMapAlphaTestTexture(0);
+			direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[0][0].getNumIndices()), 0, 0);
 		}
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForShadowMap.getShaderProgram());
 		GLProgram::checkGLError();
 
 		// s̐ݒ
-		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightViewMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_VIEW_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightViewMatrix.m
@@ -1343,63 +1138,48 @@ void Sprite3D::renderDirectionalLightShadowMap(const DirectionalLight* light)
 		GLProgram::checkGLError();
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightProjectionMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_PROJECTION_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightProjectionMatrix.m
 		);
 		GLProgram::checkGLError();
 
-		// _̐ݒ
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_WEIGHT);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_INDEX);
-		GLProgram::checkGLError();
-
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].position);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].normal);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].textureCoordinate);
-				GLProgram::checkGLError();
+				_glVertexArrays[meshIndex]->bind();
 
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					const std::vector<unsigned short>& subMeshIndices = _indicesList[meshIndex][subMeshIndex];
-					glDrawElements(GL_TRIANGLES, subMeshIndices.size(), GL_UNSIGNED_SHORT, subMeshIndices.data());
+					setShadowMapAlphaTestTexture(getSubMeshTextureIndex(meshIndex, subMeshIndex));
+					glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), _model->getIndicesList()[meshIndex][subMeshIndex].getGLType(), reinterpret_cast<const GLvoid*>(_model->getSubMeshIndexOffsets()[meshIndex][subMeshIndex]));
 					GLProgram::checkGLError();
 				}
 			}
+
+			GLVertexArray::unbind();
 		}
 		else if (_isC3b)
 		{
 			// TODO:c3t/c3bŃbVf[^͈łO
-			C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-			for (size_t i = 0, offset = 0; i < meshData->numAttribute; ++i)
+			_glVertexArrays[0]->bind();
+
+			if (!_useCpuSkinning)
 			{
-				const C3bLoader::MeshVertexAttribute& attrib = meshData->attributes[i];
-				glVertexAttribPointer((GLuint)attrib.location, attrib.size, attrib.type, GL_FALSE, _perVertexByteSize, (GLvoid*)&meshData->vertices[offset]);
+				// XLjÕ}gbNXpbg̐ݒ
+				Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
+				glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MATRIX_PALETTE), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette[0].m));
 				GLProgram::checkGLError();
-				offset += attrib.size;
 			}
 
-			// XLjÕ}gbNXpbg̐ݒ
-			Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
-			glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation("u_matrixPalette"), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette[0].m));
-			GLProgram::checkGLError();
-
-			glDrawElements(GL_TRIANGLES, _indicesList[0][0].size(), GL_UNSIGNED_SHORT, _indicesList[0][0].data());
+			setShadowMapAlphaTestTexture(0);
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[0][0].getNumIndices()), _model->getIndicesList()[0][0].getGLType(), nullptr);
 			GLProgram::checkGLError();
+			GLVertexArray::unbind();
 		}
 #endif
 	});
@@ -1417,46 +1197,17 @@ void Sprite3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		(void)face;
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForPointLightShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[sƃvWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		CopyMemory(mappedResource.pData, light->getConstantBufferDataPointer(), sizeof(PointLight::ConstantBufferData));
-		direct3dContext->Unmap(_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER), 0);
+		_d3dProgramForPointLightShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, light->getConstantBufferDataPointer(), sizeof(PointLight::ConstantBufferData));
 
-		if (_isC3b)
+		if (_isC3b && !_useCpuSkinning)
 		{
 			// WCg}gbNXpbg̃}bv
-			result = direct3dContext->Map(
-				_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
-			direct3dContext->Unmap(_d3dProgramForPointLightShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE), 0);
+			_d3dProgramForPointLightShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
 		}
 
 		size_t stride = 0;
@@ -1476,20 +1227,21 @@ void Sprite3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForPointLightShadowMap.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForPointLightShadowMap.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForPointLightShadowMap, direct3dContext);
 
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
 				direct3dContext->IASetVertexBuffers(0, _d3dProgramForPointLightShadowMap.getVertexBuffers(meshIndex).size(), _d3dProgramForPointLightShadowMap.getVertexBuffers(meshIndex).data(), strides, offsets);
 
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					direct3dContext->IASetIndexBuffer(_d3dProgramForPointLightShadowMap.getIndexBuffer(meshIndex, subMeshIndex), DXGI_FORMAT_R16_UINT, 0);
-					direct3dContext->DrawIndexed(_indicesList[meshIndex][subMeshIndex].size(), 0, 0);
+					direct3dContext->IASetIndexBuffer(_d3dProgramForPointLightShadowMap.getIndexBuffer(meshIndex, subMeshIndex), _model->getIndicesList()[meshIndex][subMeshIndex].getDXGIFormat(), 0);
+					setShadowMapAlphaTestTexture(getSubMeshTextureIndex(meshIndex, subMeshIndex));
+					direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), 0, 0);
 				}
 			}
 		}
@@ -1497,19 +1249,20 @@ void Sprite3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 		{
 			// bV͂ЂƂ
 			direct3dContext->IASetVertexBuffers(0, _d3dProgramForPointLightShadowMap.getVertexBuffers(0).size(), _d3dProgramForPointLightShadowMap.getVertexBuffers(0).data(), strides, offsets);
-			direct3dContext->IASetIndexBuffer(_d3dProgramForPointLightShadowMap.getIndexBuffer(0, 0), DXGI_FORMAT_R16_UINT, 0);
-			direct3dContext->DrawIndexed(_indicesList[0][0].size(), 0, 0);
+			direct3dContext->IASetIndexBuffer(_d3dProgramForPointLightShadowMap.getIndexBuffer(0, 0), _model->getIndicesList()[0][0].getDXGIFormat(), 0);
+			setShadowMapAlphaTestTexture(0);
+			direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[0][0].getNumIndices()), 0, 0);
 		}
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForShadowMap.getShaderProgram());
 		GLProgram::checkGLError();
 
 		// s̐ݒ
-		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
 
 		const Mat4& lightViewMatrix = light->getShadowMapData().viewMatrices[(int)face];
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightViewMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_VIEW_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightViewMatrix.m
@@ -1518,64 +1271,49 @@ void Sprite3D::renderPointLightShadowMap(size_t index, const PointLight* light,
 
 		const Mat4& lightProjectionMatrix = light->getShadowMapData().projectionMatrix;
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightProjectionMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_PROJECTION_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightProjectionMatrix.m
 		);
 		GLProgram::checkGLError();
 
-		// _̐ݒ
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_WEIGHT);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_INDEX);
-		GLProgram::checkGLError();
-
 		// TODO:obj邢c3t/c3bŃbVf[^͈łO
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].position);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].normal);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].textureCoordinate);
-				GLProgram::checkGLError();
+				_glVertexArrays[meshIndex]->bind();
 
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					const std::vector<unsigned short>& subMeshIndices = _indicesList[meshIndex][subMeshIndex];
-					glDrawElements(GL_TRIANGLES, subMeshIndices.size(), GL_UNSIGNED_SHORT, subMeshIndices.data());
+					setShadowMapAlphaTestTexture(getSubMeshTextureIndex(meshIndex, subMeshIndex));
+					glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), _model->getIndicesList()[meshIndex][subMeshIndex].getGLType(), reinterpret_cast<const GLvoid*>(_model->getSubMeshIndexOffsets()[meshIndex][subMeshIndex]));
 					GLProgram::checkGLError();
 				}
 			}
+
+			GLVertexArray::unbind();
 		}
 		else if (_isC3b)
 		{
 			// TODO:obj邢c3t/c3bŃbVf[^͈łO
-			C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-			for (size_t i = 0, offset = 0; i < meshData->numAttribute; ++i)
+			_glVertexArrays[0]->bind();
+
+			if (!_useCpuSkinning)
 			{
-				const C3bLoader::MeshVertexAttribute& attrib = meshData->attributes[i];
-				glVertexAttribPointer((GLuint)attrib.location, attrib.size, attrib.type, GL_FALSE, _perVertexByteSize, (GLvoid*)&meshData->vertices[offset]);
+				// XLjÕ}gbNXpbg̐ݒ
+				Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
+				glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MATRIX_PALETTE), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette[0].m));
 				GLProgram::checkGLError();
-				offset += attrib.size;
 			}
 
-			// XLjÕ}gbNXpbg̐ݒ
-			Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
-			glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation("u_matrixPalette"), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette[0].m));
-			GLProgram::checkGLError();
-
-			glDrawElements(GL_TRIANGLES, _indicesList[0][0].size(), GL_UNSIGNED_SHORT, _indicesList[0][0].data());
+			setShadowMapAlphaTestTexture(0);
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[0][0].getNumIndices()), _model->getIndicesList()[0][0].getGLType(), nullptr);
 			GLProgram::checkGLError();
+			GLVertexArray::unbind();
 		}
 #endif
 	});
@@ -1595,61 +1333,23 @@ void Sprite3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// fs̃}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightViewMatrix.transpose(); // Direct3Dł͓]uԂœ
-		CopyMemory(mappedResource.pData, &lightViewMatrix.m, sizeof(lightViewMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &lightViewMatrix.m, sizeof(lightViewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		lightProjectionMatrix = Mat4::CHIRARITY_CONVERTER * lightProjectionMatrix; // nϊs̓vWFNVsɍŏ炩Ă
 		lightProjectionMatrix.transpose();
-		CopyMemory(mappedResource.pData, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &lightProjectionMatrix.m, sizeof(lightProjectionMatrix));
 
-		if (_isC3b)
+		if (_isC3b && !_useCpuSkinning)
 		{
 			// WCg}gbNXpbg̃}bv
-			result = direct3dContext->Map(
-				_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
-			direct3dContext->Unmap(_d3dProgramForShadowMap.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE), 0);
+			_d3dProgramForShadowMap.setConstantBufferData(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
 		}
 
 		size_t stride = 0;
@@ -1669,20 +1369,21 @@ void Sprite3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForShadowMap.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForShadowMap.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForShadowMap, direct3dContext);
 
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
 				direct3dContext->IASetVertexBuffers(0, _d3dProgramForShadowMap.getVertexBuffers(meshIndex).size(), _d3dProgramForShadowMap.getVertexBuffers(meshIndex).data(), strides, offsets);
 
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(meshIndex, subMeshIndex), DXGI_FORMAT_R16_UINT, 0);
-					direct3dContext->DrawIndexed(_indicesList[meshIndex][subMeshIndex].size(), 0, 0);
+					direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(meshIndex, subMeshIndex), _model->getIndicesList()[meshIndex][subMeshIndex].getDXGIFormat(), 0);
+					setShadowMapAlphaTestTexture(getSubMeshTextureIndex(meshIndex, subMeshIndex));
+					direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), 0, 0);
 				}
 			}
 		}
@@ -1690,18 +1391,19 @@ void Sprite3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 		{
 			// bV͂ЂƂ
 			direct3dContext->IASetVertexBuffers(0, _d3dProgramForShadowMap.getVertexBuffers(0).size(), _d3dProgramForShadowMap.getVertexBuffers(0).data(), strides, offsets);
-			direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(0, 0), DXGI_FORMAT_R16_UINT, 0);
-			direct3dContext->DrawIndexed(_indicesList[0][0].size(), 0, 0);
+			direct3dContext->IASetIndexBuffer(_d3dProgramForShadowMap.getIndexBuffer(0, 0), _model->getIndicesList()[0][0].getDXGIFormat(), 0);
+			setShadowMapAlphaTestTexture(0);
+			direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[0][0].getNumIndices()), 0, 0);
 		}
 #elif defined(MGRRENDERER_USE_OPENGL)
 		glUseProgram(_glProgramForShadowMap.getShaderProgram());
 		GLProgram::checkGLError();
 
 		// s̐ݒ
-		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightViewMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_VIEW_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightViewMatrix.m
@@ -1709,64 +1411,49 @@ void Sprite3D::renderSpotLightShadowMap(size_t index, const SpotLight* light)
 		GLProgram::checkGLError();
 
 		glUniformMatrix4fv(
-			_glProgramForShadowMap.getUniformLocation("u_lightProjectionMatrix"),
+			_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::LIGHT_PROJECTION_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)lightProjectionMatrix.m
 		);
 		GLProgram::checkGLError();
 
-		// _̐ݒ
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_WEIGHT);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_INDEX);
-		GLProgram::checkGLError();
-
 		// TODO:obj邢c3t/c3bŃbVf[^͈łO
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].position);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].normal);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].textureCoordinate);
-				GLProgram::checkGLError();
+				_glVertexArrays[meshIndex]->bind();
 
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					const std::vector<unsigned short>& subMeshIndices = _indicesList[meshIndex][subMeshIndex];
-					glDrawElements(GL_TRIANGLES, subMeshIndices.size(), GL_UNSIGNED_SHORT, subMeshIndices.data());
+					setShadowMapAlphaTestTexture(getSubMeshTextureIndex(meshIndex, subMeshIndex));
+					glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), _model->getIndicesList()[meshIndex][subMeshIndex].getGLType(), reinterpret_cast<const GLvoid*>(_model->getSubMeshIndexOffsets()[meshIndex][subMeshIndex]));
 					GLProgram::checkGLError();
 				}
 			}
+
+			GLVertexArray::unbind();
 		}
 		else if (_isC3b)
 		{
 			// TODO:obj邢c3t/c3bŃbVf[^͈łO
-			C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-			for (size_t i = 0, offset = 0; i < meshData->numAttribute; ++i)
+			_glVertexArrays[0]->bind();
+
+			if (!_useCpuSkinning)
 			{
-				const C3bLoader::MeshVertexAttribute& attrib = meshData->attributes[i];
-				glVertexAttribPointer((GLuint)attrib.location, attrib.size, attrib.type, GL_FALSE, _perVertexByteSize, (GLvoid*)&meshData->vertices[offset]);
+				// XLjÕ}gbNXpbg̐ݒ
+				Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
+				glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation(GLProgram::UniformID::MATRIX_PALETTE), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette[0].m));
 				GLProgram::checkGLError();
-				offset += attrib.size;
 			}
 
-			// XLjÕ}gbNXpbg̐ݒ
-			Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
-			glUniformMatrix4fv(_glProgramForShadowMap.getUniformLocation("u_matrixPalette"), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette[0].m));
-			GLProgram::checkGLError();
-
-			glDrawElements(GL_TRIANGLES, _indicesList[0][0].size(), GL_UNSIGNED_SHORT, _indicesList[0][0].data());
+			setShadowMapAlphaTestTexture(0);
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[0][0].getNumIndices()), _model->getIndicesList()[0][0].getGLType(), nullptr);
 			GLProgram::checkGLError();
+			GLVertexArray::unbind();
 		}
 #endif
 	});
@@ -1782,114 +1469,40 @@ void Sprite3D::renderForward()
 		ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
 		// TODO:ւ񋤒ʉȁBB
-		D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 		// render modẽ}bv
-		HRESULT result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Renderer::RenderMode renderMode = Director::getRenderer().getRenderMode();
-		CopyMemory(mappedResource.pData, &renderMode, sizeof(renderMode));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::RENDER_MODE, &renderMode, sizeof(renderMode));
 
 		// fs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 modelMatrix = getModelMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &modelMatrix.m, sizeof(modelMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MODEL_MATRIX, &modelMatrix.m, sizeof(modelMatrix));
 
 		// r[s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 viewMatrix = Director::getCamera().getViewMatrix().createTranspose();
-		CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 		// vWFNVs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-		CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
 
 		// fvXoCAXs̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 depthBiasMatrix = (Mat4::TEXTURE_COORDINATE_CONVERTER * Mat4::createScale(Vec3(0.5f, 0.5f, 1.0f)) * Mat4::createTranslation(Vec3(1.0f, -1.0f, 0.0f))).transpose(); //TODO: Mat4Qƌ^ɂƒlȂĂ܂
-		CopyMemory(mappedResource.pData, &depthBiasMatrix.m, sizeof(depthBiasMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, &depthBiasMatrix.m, sizeof(depthBiasMatrix));
 
 		// m[}s̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		Mat4 normalMatrix = Mat4::CHIRARITY_CONVERTER * Mat4::createNormalMatrix(getModelMatrix());
 		normalMatrix.transpose();
-		CopyMemory(mappedResource.pData, &normalMatrix.m, sizeof(normalMatrix));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::NORMAL_MATRIX, &normalMatrix.m, sizeof(normalMatrix));
 
 		// ZF̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 		const Color4F& multiplyColor = Color4F(Color3B(getColor().r, getColor().g, getColor().b), getOpacity());
-		CopyMemory(mappedResource.pData, &multiplyColor , sizeof(multiplyColor));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::MULTIPLY_COLOR, &multiplyColor, sizeof(multiplyColor));
 
 
-		if (_isC3b)
+		if (_isC3b && !_useCpuSkinning)
 		{
 			// WCg}gbNXpbg̃}bv
-			result = direct3dContext->Map(
-				_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
-			direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE), 0);
+			_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::JOINT_MATRIX_PALLETE, _matrixPalette.data(), sizeof(Mat4) * _matrixPalette.size());
 		}
 
 
@@ -1898,16 +1511,7 @@ void Sprite3D::renderForward()
 		const AmbientLight* ambientLight = scene.getAmbientLight();
 		Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 		// ArGgCgJ[̃}bv
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		CopyMemory(mappedResource.pData, ambientLight->getConstantBufferDataPointer(), sizeof(AmbientLight::ConstantBufferData));
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER), 0);
+		_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, ambientLight->getConstantBufferDataPointer(), sizeof(AmbientLight::ConstantBufferData));
 
 
 		// fBNViCg
@@ -1922,16 +1526,7 @@ void Sprite3D::renderForward()
 				direct3dContext->PSSetShaderResources(0, 1, shaderResouceView);
 			}
 
-			result = direct3dContext->Map(
-				_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER),
-				0,
-				D3D11_MAP_WRITE_DISCARD,
-				0,
-				&mappedResource
-			);
-			Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-			CopyMemory(mappedResource.pData, directionalLight->getConstantBufferDataPointer(), sizeof(DirectionalLight::ConstantBufferData));
-			direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER), 0);
+			_d3dProgramForForwardRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, directionalLight->getConstantBufferDataPointer(), sizeof(DirectionalLight::ConstantBufferData));
 
 			dirLightShadowMapResourceView = directionalLight->getShadowMapData().depthTexture->getShaderResourceView();
 		}
@@ -1950,17 +1545,8 @@ void Sprite3D::renderForward()
 			}
 		}
 
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-
-		PointLight::ConstantBufferData* pointLightConstBufData = static_cast<PointLight::ConstantBufferData*>(mappedResource.pData);
-		ZeroMemory(pointLightConstBufData, sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM);
+		// mۂ̈̓[NAĂ
+		PointLight::ConstantBufferData* pointLightConstBufData = static_cast<PointLight::ConstantBufferData*>(_d3dProgramForForwardRendering.allocateConstantBufferData(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM));
 
 		size_t numPointLight = scene.getNumPointLight();
 		for (size_t i = 0; i < numPointLight; i++)
@@ -1972,8 +1558,6 @@ void Sprite3D::renderForward()
 			}
 		}
 
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER), 0);
-
 
 		// X|bgCg̈ʒuW̋t̃}bv
 		std::array<ID3D11ShaderResourceView*, SpotLight::MAX_NUM> spotLightShadowMapResourceView;
@@ -1989,17 +1573,8 @@ void Sprite3D::renderForward()
 		}
 
 
-		result = direct3dContext->Map(
-			_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-
-		SpotLight::ConstantBufferData* spotLightConstBufData = static_cast<SpotLight::ConstantBufferData*>(mappedResource.pData);
-		ZeroMemory(spotLightConstBufData, sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM);
+		// mۂ̈̓[NAĂ
+		SpotLight::ConstantBufferData* spotLightConstBufData = static_cast<SpotLight::ConstantBufferData*>(_d3dProgramForForwardRendering.allocateConstantBufferData(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM));
 
 		size_t numSpotLight = scene.getNumSpotLight();
 		for (size_t i = 0; i < numSpotLight; i++)
@@ -2011,8 +1586,6 @@ void Sprite3D::renderForward()
 			}
 		}
 
-		direct3dContext->Unmap(_d3dProgramForForwardRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER), 0);
-
 
 		size_t stride = 0;
 		if (_isObj)
@@ -2030,7 +1603,7 @@ void Sprite3D::renderForward()
 		direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
 		_d3dProgramForForwardRendering.setShadersToDirect3DContext(direct3dContext);
-		_d3dProgramForForwardRendering.setConstantBuffersToDirect3DContext(direct3dContext);
+		Director::getRenderer().getConstantRingBuffer().bind(_d3dProgramForForwardRendering, direct3dContext);
 
 		direct3dContext->PSSetShaderResources(2, pointLightShadowCubeMapResourceView.size(), pointLightShadowCubeMapResourceView.data());
 
@@ -2042,19 +1615,14 @@ void Sprite3D::renderForward()
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
 				direct3dContext->IASetVertexBuffers(0, _d3dProgramForForwardRendering.getVertexBuffers(meshIndex).size(), _d3dProgramForForwardRendering.getVertexBuffers(meshIndex).data(), strides, offsets);
 
-				D3DTexture* texture = _textureList[0];
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					int subMeshDiffuseTextureIndex = _diffuseTextureIndices[meshIndex][subMeshIndex];
-					if (_useMtl)
-					{
-						texture = _textureList[subMeshDiffuseTextureIndex];
-					}
+					D3DTexture* texture = _textureList[getSubMeshTextureIndex(meshIndex, subMeshIndex)];
 
 					ID3D11ShaderResourceView* shaderResourceViews[2] = {
 						texture->getShaderResourceView(),
@@ -2062,8 +1630,8 @@ void Sprite3D::renderForward()
 					};
 					direct3dContext->PSSetShaderResources(0, 2, shaderResourceViews);
 
-					direct3dContext->IASetIndexBuffer(_d3dProgramForForwardRendering.getIndexBuffer(meshIndex, subMeshIndex), DXGI_FORMAT_R16_UINT, 0);
-					direct3dContext->DrawIndexed(_indicesList[meshIndex][subMeshIndex].size(), 0, 0);
+					direct3dContext->IASetIndexBuffer(_d3dProgramForForwardRendering.getIndexBuffer(meshIndex, subMeshIndex), _model->getIndicesList()[meshIndex][subMeshIndex].getDXGIFormat(), 0);
+					direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), 0, 0);
 				}
 			}
 		}
@@ -2077,31 +1645,31 @@ void Sprite3D::renderForward()
 
 			// bV͂ЂƂ
 			direct3dContext->IASetVertexBuffers(0, _d3dProgramForForwardRendering.getVertexBuffers(0).size(), _d3dProgramForForwardRendering.getVertexBuffers(0).data(), strides, offsets);
-			direct3dContext->IASetIndexBuffer(_d3dProgramForForwardRendering.getIndexBuffer(0, 0), DXGI_FORMAT_R16_UINT, 0);
-			direct3dContext->DrawIndexed(_indicesList[0][0].size(), 0, 0);
+			direct3dContext->IASetIndexBuffer(_d3dProgramForForwardRendering.getIndexBuffer(0, 0), _model->getIndicesList()[0][0].getDXGIFormat(), 0);
+			direct3dContext->DrawIndexed(static_cast<UINT>(_model->getIndicesList()[0][0].getNumIndices()), 0, 0);
 		}
 #elif defined(MGRRENDERER_USE_OPENGL)
 		// cocos2d-xTriangleCommandsĂ`ȁBBeNX`oChTexture2DłĂ̂ɑvH
 		glUseProgram(_glProgramForForwardRendering.getShaderProgram());
 		GLProgram::checkGLError();
 
-		glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_RENDER_MODE), (GLint)Director::getRenderer().getRenderMode());
+		glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::RENDER_MODE), (GLint)Director::getRenderer().getRenderMode());
 
-		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
+		glUniform4f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MULTIPLE_COLOR), getColor().r / 255.0f, getColor().g / 255.0f, getColor().b / 255.0f, getOpacity());
 		GLProgram::checkGLError();
 
 		// s̐ݒ
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MODEL_MATRIX), 1, GL_FALSE, (GLfloat*)getModelMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getViewMatrix().m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 		GLProgram::checkGLError();
 
 		Mat4 normalMatrix = Mat4::createNormalMatrix(getModelMatrix());
-		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UNIFORM_NAME_NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
+		glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::NORMAL_MATRIX), 1, GL_FALSE, (GLfloat*)&normalMatrix.m);
 
 		static const Mat4& depthBiasMatrix = Mat4::createScale(Vec3(0.5f, 0.5f, 0.5f)) * Mat4::createTranslation(Vec3(1.0f, 1.0f, 1.0f));
 		glUniformMatrix4fv(
-			_glProgramForForwardRendering.getUniformLocation("u_depthBiasMatrix"),
+			_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DEPTH_BIAS_MATRIX),
 			1,
 			GL_FALSE,
 			(GLfloat*)depthBiasMatrix.m
@@ -2114,7 +1682,7 @@ void Sprite3D::renderForward()
 		Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 		Color3B lightColor = ambientLight->getColor();
 		float intensity = ambientLight->getIntensity();
-		glUniform3f(_glProgramForForwardRendering.getUniformLocation("u_ambientLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+		glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::AMBIENT_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 		GLProgram::checkGLError();
 
 
@@ -2124,41 +1692,41 @@ void Sprite3D::renderForward()
 		if (directionalLight != nullptr)
 		{
 			glUniform1i(
-				_glProgramForForwardRendering.getUniformLocation("u_directionalLightIsValid"),
+				_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_IS_VALID),
 				1
 			);
 			GLProgram::checkGLError();
 
 			lightColor = directionalLight->getColor();
 			intensity = directionalLight->getIntensity();
-			glUniform3f(_glProgramForForwardRendering.getUniformLocation("u_directionalLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 			GLProgram::checkGLError();
 
 			Vec3 direction = directionalLight->getDirection();
 			direction.normalize();
-			glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_directionalLightDirection"), 1, (GLfloat*)&direction);
+			glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_DIRECTION), 1, (GLfloat*)&direction);
 			GLProgram::checkGLError();
 
 			if (directionalLight->hasShadowMap())
 			{
 				glUniformMatrix4fv(
-					_glProgramForForwardRendering.getUniformLocation("u_directionalLightViewMatrix"),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_VIEW_MATRIX),
 					1,
 					GL_FALSE,
 					(GLfloat*)directionalLight->getShadowMapData().viewMatrix.m
 				);
 
 				glUniformMatrix4fv(
-					_glProgramForForwardRendering.getUniformLocation("u_directionalLightProjectionMatrix"),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_PROJECTION_MATRIX),
 					1,
 					GL_FALSE,
 					(GLfloat*)directionalLight->getShadowMapData().projectionMatrix.m
 				);
 
-				glActiveTexture(GL_TEXTURE1);
+				glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_DIRECTIONAL_LIGHT_SHADOW_MAP);
 				GLuint textureId = directionalLight->getShadowMapData().getDepthTexture()->getTextureId();
 				glBindTexture(GL_TEXTURE_2D, textureId);
-				glUniform1i(_glProgramForForwardRendering.getUniformLocation("u_directionalLightShadowMap"), 0);
+				glActiveTexture(GL_TEXTURE0);
 			}
 		}
 
@@ -2168,54 +1736,52 @@ void Sprite3D::renderForward()
 			const PointLight* pointLight = scene.getPointLight(i);
 			if (pointLight != nullptr)
 			{
-				glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_IS_VALID, i), 1);
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 				GLProgram::checkGLError();
 
 				lightColor = pointLight->getColor();
 				intensity = pointLight->getIntensity();
-				glUniform3f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 
 				GLProgram::checkGLError();
 
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / pointLight->getRange());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 				GLProgram::checkGLError();
 
 				glUniform1i(
-					glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 					pointLight->hasShadowMap()
 				);
 				//glUniform1i(
-				//	_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 				//	pointLight->hasShadowMap()
 				//);
 
 				if (pointLight->hasShadowMap())
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 					//);
 
-					glActiveTexture(GL_TEXTURE2 + i);
+					glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP + i);
 					GLuint textureId = pointLight->getShadowMapData().getDepthTexture()->getTextureId();
 					glBindTexture(GL_TEXTURE_CUBE_MAP, textureId);
-					glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")).c_str()), 1 + i);
-					//glUniform1i(_glProgramForForwardRendering.getUniformLocation(std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")), 5 + i);
 					glActiveTexture(GL_TEXTURE0);
 				}
 			}
@@ -2227,175 +1793,145 @@ void Sprite3D::renderForward()
 			const SpotLight* spotLight = scene.getSpotLight(i);
 			if (spotLight != nullptr)
 			{
-				glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
+				glUniform1i(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_IS_VALID, i), 1);
 				GLProgram::checkGLError();
 
 				lightColor = spotLight->getColor();
 				intensity = spotLight->getIntensity();
-				glUniform3f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+				//glUniform3f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 				GLProgram::checkGLError();
 
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&spotLight->getPosition());
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&spotLight->getPosition());
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
 				GLProgram::checkGLError();
 
 				Vec3 direction = spotLight->getDirection();
 				direction.normalize();
-				glUniform3fv(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&direction);
-				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&direction);
+				glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
+				//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / spotLight->getRange());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / spotLight->getRange());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getInnerAngleCos());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getInnerAngleCos());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
 				GLProgram::checkGLError();
 
-				glUniform1f(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getOuterAngleCos());
-				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getOuterAngleCos());
+				glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
+				//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
 				GLProgram::checkGLError();
 
 				glUniform1i(
-					glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 					spotLight->hasShadowMap()
 				);
 				//glUniform1i(
-				//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 				//	spotLight->hasShadowMap()
 				//);
 
 				if (spotLight->hasShadowMap())
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 					//);
 
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 					);
 					//glUniformMatrix4fv(
-					//	_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+					//	_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 					//	1,
 					//	GL_FALSE,
 					//	(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 					//);
 
-					glActiveTexture(GL_TEXTURE6 + i);
+					glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP + i);
 					GLuint textureId = spotLight->getShadowMapData().getDepthTexture()->getTextureId();
 					glBindTexture(GL_TEXTURE_2D, textureId);
-					glUniform1i(glGetUniformLocation(_glProgramForForwardRendering.getShaderProgram(), (std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")).c_str()), 5 + i);
-					//glUniform1i(_glProgramForForwardRendering.getUniformLocation(std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")), 9 + i);
 					glActiveTexture(GL_TEXTURE0);
 				}
 			}
 		}
 
-		// _̐ݒ
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::NORMAL);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_WEIGHT);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::BLEND_INDEX);
-		GLProgram::checkGLError();
-
-		glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
-		GLProgram::checkGLError();
-
 		if (_isObj)
 		{
 			// bṼ[v
-			for (size_t meshIndex = 0; meshIndex < _verticesList.size(); ++meshIndex)
+			for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
 			{
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].position);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::NORMAL, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].normal);
-				GLProgram::checkGLError();
-				glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position3DNormalTextureCoordinates), (GLvoid*)&_verticesList[meshIndex][0].textureCoordinate);
-				GLProgram::checkGLError();
+				_glVertexArrays[meshIndex]->bind();
 
 				glActiveTexture(GL_TEXTURE0);
 
-				GLuint textureId = _textureList[0]->getTextureId();
-				size_t numSubMesh = _indicesList[meshIndex].size();
+				size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
 				for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
 				{
-					int subMeshDiffuseTextureIndex = _diffuseTextureIndices[meshIndex][subMeshIndex];
-					if (_useMtl)
-					{
-						textureId = _textureList[subMeshDiffuseTextureIndex]->getTextureId();
-					}
+					GLuint textureId = _textureList[getSubMeshTextureIndex(meshIndex, subMeshIndex)]->getTextureId();
 
 					glBindTexture(GL_TEXTURE_2D, textureId);
 					GLProgram::checkGLError();
 
-					const std::vector<unsigned short>& subMeshIndices = _indicesList[meshIndex][subMeshIndex];
-					glDrawElements(GL_TRIANGLES, subMeshIndices.size(), GL_UNSIGNED_SHORT, subMeshIndices.data());
+					glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[meshIndex][subMeshIndex].getNumIndices()), _model->getIndicesList()[meshIndex][subMeshIndex].getGLType(), reinterpret_cast<const GLvoid*>(_model->getSubMeshIndexOffsets()[meshIndex][subMeshIndex]));
 					GLProgram::checkGLError();
 				}
 
 				glBindTexture(GL_TEXTURE_2D, 0);
 			}
+
+			GLVertexArray::unbind();
 		}
 		else if (_isC3b)
 		{
 			// TODO:obj邢c3t/c3bŃbVf[^͈łO
-			C3bLoader::MeshData* meshData = _meshDatas->meshDatas[0];
-			for (size_t i = 0, offset = 0; i < meshData->numAttribute; ++i)
+			_glVertexArrays[0]->bind();
+
+			if (!_useCpuSkinning)
 			{
-				const C3bLoader::MeshVertexAttribute& attrib = meshData->attributes[i];
-				glVertexAttribPointer((GLuint)attrib.location, attrib.size, attrib.type, GL_FALSE, _perVertexByteSize, (GLvoid*)&meshData->vertices[offset]);
+				// XLjÕ}gbNXpbg̐ݒ
+				Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
+				glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MATRIX_PALETTE), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette.data()));
 				GLProgram::checkGLError();
-				offset += attrib.size;
 			}
 
-			// XLjÕ}gbNXpbg̐ݒ
-			Logger::logAssert(_matrixPalette.size() > 0, "}gbNXpbg0łȂO");
-			glUniformMatrix4fv(_glProgramForForwardRendering.getUniformLocation("u_matrixPalette"), _matrixPalette.size(), GL_FALSE, (GLfloat*)(_matrixPalette.data()));
-			GLProgram::checkGLError();
-
 			glBindTexture(GL_TEXTURE_2D, _textureList[0]->getTextureId());
 			GLProgram::checkGLError();
 
-			glDrawElements(GL_TRIANGLES, _indicesList[0][0].size(), GL_UNSIGNED_SHORT, _indicesList[0][0].data());
+			glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(_model->getIndicesList()[0][0].getNumIndices()), _model->getIndicesList()[0][0].getGLType(), nullptr);
 			GLProgram::checkGLError();
+			GLVertexArray::unbind();
 			glBindTexture(GL_TEXTURE_2D, 0);
 		}
 
 		// TODO:monguri:
 		if (_isC3b) {
-			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_cameraPosition"), 1, (GLfloat*)&Director::getCamera().getPosition());
+			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::CAMERA_POSITION), 1, (GLfloat*)&Director::getCamera().getPosition());
 			//GLProgram::checkGLError();
 
-			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_materialAmbient"), 1, (GLfloat*)&_ambient);
+			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MATERIAL_AMBIENT), 1, (GLfloat*)&_ambient);
 			//GLProgram::checkGLError();
 
-			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_materialDiffuse"), 1, (GLfloat*)&_diffuse);
+			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MATERIAL_DIFFUSE), 1, (GLfloat*)&_diffuse);
 			//GLProgram::checkGLError();
 
-			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation("u_materialSpecular"), 1, (GLfloat*)&_specular);
+			//glUniform3fv(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MATERIAL_SPECULAR), 1, (GLfloat*)&_specular);
 			//GLProgram::checkGLError();
 
-			//glUniform1f(_glProgramForForwardRendering.getUniformLocation("u_materialShininess"), _shininess);
+			//glUniform1f(_glProgramForForwardRendering.getUniformLocation(GLProgram::UniformID::MATERIAL_SHININESS), _shininess);
 			//GLProgram::checkGLError();
 
 			//glUniform3fv(_glProgramForForwardRendering.uniformMaterialEmissive, 1, (GLfloat*)&_emissive);
@@ -2410,4 +1946,59 @@ void Sprite3D::renderForward()
 	Director::getRenderer().addCommand(&_renderForwardCommand);
 }
 
+void Sprite3D::renderSoftware(SoftwareDeferredRenderer& renderer)
+{
+	// Gobt@̃VF[_ƓAeNX`̐FɏZF̂Fɂ
+	const Color3F multiplyColor(getColor());
+	bool isAlphaTestEnabled = _model->needsAlphaTest();
+
+	if (_isObj)
+	{
+		for (size_t meshIndex = 0; meshIndex < _model->getNumMeshes(); ++meshIndex)
+		{
+			size_t verticesIndex = renderer.addVertices(getModelMatrix(), _model->getObjVertices(meshIndex), _model->getNumObjVertices(meshIndex));
+
+			size_t numSubMesh = _model->getIndicesList()[meshIndex].size();
+			for (size_t subMeshIndex = 0; subMeshIndex < numSubMesh; ++subMeshIndex)
+			{
+				size_t textureIndex = getSubMeshTextureIndex(meshIndex, subMeshIndex);
+				const std::string& textureFilePath = (textureIndex < _textureFilePathList.size()) ? _textureFilePathList[textureIndex] : std::string();
+				renderer.addMesh(verticesIndex, &_model->getIndicesList()[meshIndex][subMeshIndex], textureFilePath, multiplyColor, isAlphaTestEnabled);
+			}
+		}
+	}
+	else if (_isC3b)
+	{
+		if (!_useCpuSkinning)
+		{
+			// GPUŃXLjOCX^X̓LbVĂȂ̂ŁA߂CPUŕ`Ƃɍ
+			if (_skinnedVertexCache.getSkinnedVertices().empty())
+			{
+				if (!_skinnedVertexCache.initWithVertices(_model->getVertexAttributes(), _model->getC3bVertices(), _model->getNumC3bVertices(), _model->getSkeleton().getNumSkinBones()))
+				{
+					return;
+				}
+			}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+			// Direct3Dł̓VF[_ɓn߂Ƀpbg]uĂ̂Ŗ߂
+			std::vector<Mat4> matrixPalette(_matrixPalette.size());
+			for (size_t i = 0; i < _matrixPalette.size(); i++)
+			{
+				matrixPalette[i] = _matrixPalette[i].createTranspose();
+			}
+			_skinnedVertexCache.skin(matrixPalette);
+#elif defined(MGRRENDERER_USE_OPENGL)
+			_skinnedVertexCache.skin(_matrixPalette);
+#endif
+		}
+
+		// TODO:c3t/c3bŃbVf[^͈łO
+		const std::vector<Position3DNormalTextureCoordinates>& vertices = _skinnedVertexCache.getSkinnedVertices();
+		size_t verticesIndex = renderer.addVertices(getModelMatrix(), vertices.data(), vertices.size());
+		const std::string& textureFilePath = _textureFilePathList.empty() ? std::string() : _textureFilePathList[0];
+		renderer.addMesh(verticesIndex, &_model->getIndicesList()[0][0], textureFilePath, multiplyColor, isAlphaTestEnabled);
+	}
+}
+
 } // namespace mgrrenderer
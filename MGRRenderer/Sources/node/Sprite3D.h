@@ -5,11 +5,14 @@
 #include "Node.h"
 #include "Light.h"
 #include "renderer/CustomRenderCommand.h"
-#include "loader/C3bLoader.h"
+#include "animation/AnimationClip.h"
+#include "animation/AnimationBlender.h"
+#include "animation/SkinnedVertexCache.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "renderer/D3DProgram.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "renderer/GLProgram.h"
+#include "renderer/GLVertexArray.h"
 #endif
 
 namespace mgrrenderer
@@ -19,15 +22,26 @@ namespace mgrrenderer
 #elif defined(MGRRENDERER_USE_OPENGL)
 	class GLTexture;
 #endif
+	class ModelAsset;
 
 	class Sprite3D :
 		public Node
 	{
 	public:
 		Sprite3D();
-		bool initWithModel(const std::string& filePath, bool useMtl = true);
+		// useCpuSkinningc3t/c3b̂ݗLBt[ɈxCPUŃXLjO_SpXŋLAVhE}bṽpXƂɃXLjOȂ
+		bool initWithModel(const std::string& filePath, bool useMtl = true, bool useCpuSkinning = false);
+		// ǉeNX``ɂ͎gAAt@eXg邩initWithModelŃf̃}eA猈߂
 		void addTexture(const std::string& filePath);
+		// initWithModelgVhE}bvGobt@̃VF[_oG[VSăRpCAShaderCachẽfBXNLbVɓĂ
+		// ߂ēǂݍރf̕`JnɃRpCȂ悤ɂ邽߂̂́BRpCłVF[_Ԃ
+		static size_t precompileShaderPermutations();
 		void startAnimation(const std::string& animationName, bool loop = false);
+		// Đ̃Aj[VdurationbĐ؂ւBZC[͂̂܂܎c
+		void crossFadeAnimation(const std::string& animationName, float duration, bool loop = false);
+		// Đ̃Aj[Vɏd˂BNORMALȂd݂ŕςAADDITIVEȂNbv̐擪̎p̍𑫂
+		void addAnimationLayer(const std::string& animationName, float weight, bool loop = false, AnimationBlender::BlendMode mode = AnimationBlender::BlendMode::NORMAL);
+		void setAnimationWeight(const std::string& animationName, float weight);
 		void stopAnimation();
 
 	private:
@@ -39,6 +53,7 @@ namespace mgrrenderer
 		bool _isC3b;
 
 		bool _useMtl;
+		bool _useCpuSkinning;
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 		D3DProgram _d3dProgramForForwardRendering;
@@ -47,13 +62,22 @@ namespace mgrrenderer
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 		D3DProgram _d3dProgramForGBuffer;
 #endif // defined(MGRRENDERER_DEFERRED_RENDERING)
+		// `ɎgeNX`BModelAsset̃eNX`̌addTextureŒǉ̂
 		std::vector<D3DTexture*> _textureList;
+		std::vector<D3DTexture*> _addedTextureList;
 #elif defined(MGRRENDERER_USE_OPENGL)
 		GLProgram _glProgramForGBuffer;
 		GLProgram _glProgramForForwardRendering;
 		GLProgram _glProgramForShadowMap;
+		// `ɎgeNX`BModelAsset̃eNX`̌addTextureŒǉ̂
 		std::vector<GLTexture*> _textureList;
+		std::vector<GLTexture*> _addedTextureList;
+		// bVƂVAOBModelAsset̂̂ACPUŃXLjOƂ͂̃CX^X_skinnedVertexArray
+		std::vector<const GLVertexArray*> _glVertexArrays;
+		GLVertexArray* _skinnedVertexArray;
 #endif
+		// _textureListƓɕ񂾃eNX`̃t@CpXBCPUŃfBt@[h̃pX`ƂɎg
+		std::vector<std::string> _textureFilePathList;
 		CustomRenderCommand _renderGBufferCommand;
 		CustomRenderCommand _renderDirectionalLightShadowMapCommand;
 		std::array<std::array<CustomRenderCommand, (size_t)CubeMapFace::NUM_CUBEMAP_FACE>, PointLight::MAX_NUM> _renderPointLightShadowMapCommandList;
@@ -68,25 +92,51 @@ namespace mgrrenderer
 		//Color3F _emissive;
 		//float _opacity;
 
-		// TODO:obĵ݂ɎgĂBI/FObjLoaderC3bLoaderō킹悤
-		// std::vectoȓKẃAMeshDataƁBMeshDatã}eAIDƂ
-		std::vector<std::vector<Position3DNormalTextureCoordinates>> _verticesList;
-		std::vector<std::vector<std::vector<unsigned short>>> _indicesList;
-		std::vector<std::vector<int>> _diffuseTextureIndices;
-
+		// WIgAXPgAAj[V͓ft@C̃CX^XԂŋLB牺̓CX^XƂ̏
+		const ModelAsset* _model;
 		// TODO:c3t/c3b݂̂ɎgĂBI/FObjLoaderC3bLoaderō킹悤
-		C3bLoader::MeshDatas* _meshDatas;
-		C3bLoader::NodeDatas* _nodeDatas;
 		size_t _perVertexByteSize;
-		C3bLoader::AnimationDatas* _animationDatas;
-		C3bLoader::AnimationData* _currentAnimation;
-		bool _loopAnimation;
-		float _elapsedTime;
+		AnimationBlender _animationBlender;
+		float _lastDeltaTime;
+		// t[̎pvZp̍Ɨ̈B[hɃWCgmۂĂAupdateł̓mۂȂ
+		std::vector<Mat4> _localPoses;
+		std::vector<Mat4> _modelPoses;
+		// AnimationSchedulerp̌vZԈĂԂ́A_previousMatrixPalette_nextMatrixPalette֕Ԃ̂_matrixPaletteɓĕ`Ɏg
+		std::vector<Mat4> _previousMatrixPalette;
+		std::vector<Mat4> _nextMatrixPalette;
 		std::vector<Mat4> _matrixPalette;
+		float _matrixPaletteBlendRatio;
+		float _matrixPaletteBlendStep;
+		bool _isMatrixPaletteDirty;
+		// ɌvZpbgԂɂ̂܂܎gBAj[V̊JnƎ̊O߂Ƃ
+		bool _snapMatrixPalette;
+		unsigned int _framesSinceAnimationEvaluation;
+		SkinnedVertexCache _skinnedVertexCache;
+
+		friend class AnimationScheduler;
 
 		~Sprite3D();
 		void update(float dt) override;
-		C3bLoader::NodeData* findJointByName(const std::string& jointName, const std::vector<C3bLoader::NodeData*> children);
+		const AnimationClip* findAnimationClip(const std::string& animationName) const;
+		// TubV`eNX`_textureListł̔ԍBmtlgȂƂAeNX`̂ȂTubV͐擪̃eNX`ŕ`
+		size_t getSubMeshTextureIndex(size_t meshIndex, size_t subMeshIndex) const;
+		// At@eXg郂fł́AVhE}bv̕`łTubṼeNX`Ŕ̂Őݒ肷BȂfł͉Ȃ
+		void setShadowMapAlphaTestTexture(size_t textureIndex) const;
+		// ̎lookAheadTimeb̎pvZ_nextMatrixPaletteɓBmaxJointDepth[WCg̓oCh|[Ŷ܂܂ɂ
+		void evaluateMatrixPalette(float lookAheadTime, unsigned int maxJointDepth);
+		// updateIntervalt[̎pvZA\Ăpbg炻܂ŕԂn߂
+		void evaluateAnimation(unsigned int updateInterval, unsigned int maxJointDepth);
+		// Ԃ1t[i߂_matrixPalette߂BωȂfalseԂ
+		// evaluateAnimationblendMatrixPalette͂̃CX^X̏ԂȂ̂ŁACX^XƂɕʂ̃XbhĂł悢
+		bool blendMatrixPalette();
+		// XLjÔJobSchedulerŕɍŝŁAWu̒͌Ă΂Ȃ
+		void skinVertices();
+		void updateMatrixPalette();
+		void uploadSkinnedVertices();
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		void addVertexBufferToPrograms(ID3D11Buffer* vertexBuffer);
+		void addIndexBuffersToPrograms(const std::vector<ID3D11Buffer*>& indexBufferList);
+#endif
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 		void renderGBuffer() override;
 #endif
@@ -94,6 +144,7 @@ namespace mgrrenderer
 		void renderPointLightShadowMap(size_t index, const PointLight* light, CubeMapFace face = CubeMapFace::X_POSITIVE) override;
 		void renderSpotLightShadowMap(size_t index, const SpotLight* light) override;
 		void renderForward() override;
+		void renderSoftware(SoftwareDeferredRenderer& renderer) override;
 	};
 
 } // namespace mgrrenderer
@@ -3,10 +3,10 @@
 #include "Config.h"
 
 #if defined(MGRRENDERER_USE_OPENGL)
-#define GLEW_STATIC
-#include <glew/include/glew.h>
+#include "GLHeader.h"
 #endif
 #include <math.h> // fabsfmodg
+#include <string.h> // memcpymemsetg
 #include <string>
 #include <vector>
 #include "utility/Logger.h"
@@ -1217,6 +1217,25 @@ struct Position3DTextureCoordinates
 	{}
 };
 
+struct Position3DTextureCoordinatesColor
+{
+	Vec3 position;
+	Vec2 textureCoordinate;
+	Color4B color;
+
+	Position3DTextureCoordinatesColor() :
+	position(Vec3()),
+	textureCoordinate(Vec2()),
+	color(Color4B(255, 255, 255, 255))
+	{}
+
+	Position3DTextureCoordinatesColor(const Vec3& pos, const Vec2& texCoord, const Color4B& col) :
+	position(pos),
+	textureCoordinate(texCoord),
+	color(col)
+	{}
+};
+
 struct Position3DNormalTextureCoordinates
 {
 	Vec3 position;
@@ -0,0 +1,179 @@
+#include "ConstantRingBuffer.h"
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "D3DProgram.h"
+#include "utility/Logger.h"
+#include <algorithm>
+
+namespace mgrrenderer
+{
+
+static size_t alignConstantBufferSize(size_t size)
+{
+	return (size + ConstantRingBuffer::ALIGNMENT - 1) / ConstantRingBuffer::ALIGNMENT * ConstantRingBuffer::ALIGNMENT;
+}
+
+ConstantRingBuffer::ConstantRingBuffer() :
+_buffer(nullptr),
+_context1(nullptr),
+_size(0),
+_head(0),
+_needsDiscard(true)
+{
+}
+
+ConstantRingBuffer::~ConstantRingBuffer()
+{
+	if (_context1 != nullptr)
+	{
+		_context1->Release();
+		_context1 = nullptr;
+	}
+
+	if (_buffer != nullptr)
+	{
+		_buffer->Release();
+		_buffer = nullptr;
+	}
+}
+
+bool ConstantRingBuffer::init(ID3D11Device* device, ID3D11DeviceContext* context, size_t size)
+{
+	// 萔obt@̃ItZbgwƁA萔obt@ւWRITE_NO_OVERWRITE͂ǂDirect3D11.1̋@\
+	D3D11_FEATURE_DATA_D3D11_OPTIONS options;
+	ZeroMemory(&options, sizeof(options));
+	HRESULT result = device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &options, sizeof(options));
+	if (FAILED(result) || !options.ConstantBufferOffsetting || !options.MapNoOverwriteOnDynamicConstantBuffer)
+	{
+		Logger::log("萔obt@̃ItZbgw肪gȂ̂ŃOobt@͎gȂB");
+		return false;
+	}
+
+	result = context->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&_context1));
+	if (FAILED(result))
+	{
+		Logger::log("ID3D11DeviceContext1擾łȂ̂ŃOobt@͎gȂB");
+		_context1 = nullptr;
+		return false;
+	}
+
+	D3D11_BUFFER_DESC bufferDesc;
+	bufferDesc.ByteWidth = static_cast<UINT>(size);
+	bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+	bufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	bufferDesc.MiscFlags = 0;
+	bufferDesc.StructureByteStride = 0;
+
+	result = device->CreateBuffer(&bufferDesc, nullptr, &_buffer);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+		_buffer = nullptr;
+		return false;
+	}
+
+	_size = size;
+	beginFrame();
+	return true;
+}
+
+void ConstantRingBuffer::beginFrame()
+{
+	_head = 0;
+	_needsDiscard = true;
+}
+
+void ConstantRingBuffer::bind(const D3DProgram& program, ID3D11DeviceContext* context)
+{
+	if (!isEnabled())
+	{
+		bindWithoutRingBuffer(program, context);
+		return;
+	}
+
+	const std::vector<ID3D11Buffer*>& constantBuffers = program.getConstantBuffers();
+	size_t numConstantBuffer = constantBuffers.size();
+	Logger::logAssert(numConstantBuffer <= D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT, "萔obt@̐Bnum=%d", static_cast<int>(numConstantBuffer));
+
+	size_t totalSize = 0;
+	for (size_t i = 0; i < numConstantBuffer; i++)
+	{
+		// VF[_̒萔obt@̃TCY菬͈͂oChȂ悤ɁA̒萔obt@̃TCYȏ͊mۂ
+		totalSize += alignConstantBufferSize((std::max)(program.getConstantBufferData(i).size(), program.getConstantBufferByteWidth(i)));
+	}
+
+	Logger::logAssert(totalSize <= _size, "Oobt@̃TCY1h[̒萔̗ʂ菬BtotalSize=%d", static_cast<int>(totalSize));
+	if (_head + totalSize > _size)
+	{
+		// 1AGPUǂł邩Ȃ̈㏑Ȃ悤Ɏ̂ĂĐV̈ɂĂ炤
+		_head = 0;
+		_needsDiscard = true;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE mappedResource;
+	HRESULT result = context->Map(_buffer, 0, _needsDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedResource);
+	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
+
+	ID3D11Buffer* buffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+	UINT firstConstants[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+	UINT numConstants[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+
+	size_t offset = _head;
+	for (size_t i = 0; i < numConstantBuffer; i++)
+	{
+		const std::vector<unsigned char>& data = program.getConstantBufferData(i);
+		size_t alignedSize = alignConstantBufferSize((std::max)(data.size(), program.getConstantBufferByteWidth(i)));
+
+		unsigned char* dst = static_cast<unsigned char*>(mappedResource.pData) + offset;
+		if (!data.empty())
+		{
+			CopyMemory(dst, data.data(), data.size());
+		}
+		ZeroMemory(dst + data.size(), alignedSize - data.size());
+
+		buffers[i] = _buffer;
+		firstConstants[i] = static_cast<UINT>(offset / 16);
+		numConstants[i] = static_cast<UINT>(alignedSize / 16);
+		offset += alignedSize;
+	}
+
+	context->Unmap(_buffer, 0);
+	_head = offset;
+	_needsDiscard = false;
+
+	UINT numSlot = static_cast<UINT>(numConstantBuffer);
+	_context1->VSSetConstantBuffers1(0, numSlot, buffers, firstConstants, numConstants);
+	_context1->GSSetConstantBuffers1(0, numSlot, buffers, firstConstants, numConstants);
+	_context1->PSSetConstantBuffers1(0, numSlot, buffers, firstConstants, numConstants);
+}
+
+void ConstantRingBuffer::bindWithoutRingBuffer(const D3DProgram& program, ID3D11DeviceContext* context)
+{
+	const std::vector<ID3D11Buffer*>& constantBuffers = program.getConstantBuffers();
+	size_t numConstantBuffer = constantBuffers.size();
+
+	D3D11_MAPPED_SUBRESOURCE mappedResource;
+	for (size_t i = 0; i < numConstantBuffer; i++)
+	{
+		const std::vector<unsigned char>& data = program.getConstantBufferData(i);
+		if (data.empty())
+		{
+			continue;
+		}
+
+		HRESULT result = context->Map(constantBuffers[i], 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
+		CopyMemory(mappedResource.pData, data.data(), data.size());
+		context->Unmap(constantBuffers[i], 0);
+	}
+
+	ID3D11Buffer* const* constantBufferPointer = constantBuffers.data();
+	context->VSSetConstantBuffers(0, numConstantBuffer, constantBufferPointer);
+	context->GSSetConstantBuffers(0, numConstantBuffer, constantBufferPointer);
+	context->PSSetConstantBuffers(0, numConstantBuffer, constantBufferPointer);
+}
+
+} // namespace mgrrenderer
+
+#endif
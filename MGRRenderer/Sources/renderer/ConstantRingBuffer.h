@@ -0,0 +1,48 @@
+#pragma once
+#include "Config.h"
+
+// OpenGLɂ͂̃Oobt@͂ȂBGL̃VF[_compatibilityvt@CŌʂuniformϐgĂāA
+// uniformubNɂ܂Ƃ߂glBindBufferRangeŃItZbgw肷`ɂɂ͑SVF[_ƑSm[huniformݒKv邽
+// GLł̓h[Ƃ̒萔glUniform*őA_f[^̃Xg[~OStreamingBufferōs
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11_1.h>
+
+namespace mgrrenderer
+{
+
+class D3DProgram;
+
+// t[PʂŎg񂷑傫Ȓ萔obt@Bh[Ƃ̒萔͂؂oď݁AItZbgwŃoCh
+// WRITE_DISCARD̓t[̍ŏbind1ƂŁAȊOWRITE_NO_OVERWRITEőÕh[ǂޗ̈̌ɏ
+// Direct3D11łMap܂܂̃\[Xh[ŎgAh[̌WRITE_DISCARDƃh[ǂޓe͍ւȂ̂ŁA
+// Map̓h[ƂɕKvɂȂB1t[1Mapɂ܂Ƃ߂ɂ͑Sm[h̒萔h[̔sOɊm肳Kv
+class ConstantRingBuffer final
+{
+public:
+	// Direct3D11.1VSSetConstantBuffers1̃ItZbg16萔=256oCgP
+	static const size_t ALIGNMENT = 256;
+	static const size_t DEFAULT_SIZE = 4 * 1024 * 1024;
+
+	ConstantRingBuffer();
+	~ConstantRingBuffer();
+	bool init(ID3D11Device* device, ID3D11DeviceContext* context, size_t size);
+	// ID3D11DeviceContext1gȂłfalseɂȂAbind͏]ʂvOƂ̒萔obt@ɏ
+	bool isEnabled() const { return _buffer != nullptr; }
+	void beginFrame();
+	// programsetConstantBufferDataŐݒ肵e1Mapŏ݁ASVF[_Xe[WɃoCh
+	void bind(const D3DProgram& program, ID3D11DeviceContext* context);
+
+private:
+	ID3D11Buffer* _buffer;
+	ID3D11DeviceContext1* _context1;
+	size_t _size;
+	size_t _head;
+	bool _needsDiscard;
+
+	void bindWithoutRingBuffer(const D3DProgram& program, ID3D11DeviceContext* context);
+};
+
+} // namespace mgrrenderer
+
+#endif
@@ -1,9 +1,8 @@
 #include "D3DProgram.h"
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
-#include "utility/FileUtility.h"
-#include "Director.h"
-#include <d3dcompiler.h>
+#include "utility/Logger.h"
+#include "ShaderCache.h"
 
 namespace mgrrenderer
 {
@@ -17,19 +16,6 @@ const std::string D3DProgram::SEMANTIC_NORMAL = "NORMAL";
 const std::string D3DProgram::SEMANTIC_BLEND_WEIGHT = "BLEND_WEIGHT";
 const std::string D3DProgram::SEMANTIC_BLEND_INDEX = "BLEND_INDEX";
 
-const std::string D3DProgram::CONSTANT_BUFFER_RENDER_MODE ="CONSTANT_BUFFER_RENDER_MODE";
-const std::string D3DProgram::CONSTANT_BUFFER_MODEL_MATRIX ="CONSTANT_BUFFER_MODEL_MATRIX";
-const std::string D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX ="CONSTANT_BUFFER_VIEW_MATRIX";
-const std::string D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX ="CONSTANT_BUFFER_PROJECTION_MATRIX";
-const std::string D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX ="CONSTANT_BUFFER_DEPTH_BIAS_MATRIX";
-const std::string D3DProgram::CONSTANT_BUFFER_NORMAL_MATRIX ="CONSTANT_BUFFER_NORMAL_MATRIX";
-const std::string D3DProgram::CONSTANT_BUFFER_MULTIPLY_COLOR ="CONSTANT_BUFFER_MULTIPLY_COLOR";
-const std::string D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER ="CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER";
-const std::string D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER ="CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER";
-const std::string D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER ="CONSTANT_BUFFER_POINT_LIGHT_PARAMETER";
-const std::string D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER ="CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER";
-const std::string D3DProgram::CONSTANT_BUFFER_JOINT_MATRIX_PALLETE ="CONSTANT_BUFFER_JOINT_MATRIX_PALLETE";
-
 D3DProgram::D3DProgram() :
 _vertexShader(nullptr),
 _vertexShaderBlob(nullptr),
@@ -37,6 +23,7 @@ _geometryShader(nullptr),
 _pixelShader(nullptr),
 _inputLayout(nullptr)
 {
+	_constantBufferIndices.fill(-1);
 }
 
 D3DProgram::~D3DProgram()
@@ -93,121 +80,36 @@ D3DProgram::~D3DProgram()
 	}
 }
 
-void D3DProgram::initWithShaderFile(const std::string & path, bool depthTestEnable, const std::string& vertexShaderFunctionName, const std::string& geometryShaderFunctionName, const std::string& pixelShaderFunctionName)
+void D3DProgram::initWithShaderFile(const std::string & path, bool depthTestEnable, const std::string& vertexShaderFunctionName, const std::string& geometryShaderFunctionName, const std::string& pixelShaderFunctionName, unsigned int features /* = 0 */)
 {
 	(void)depthTestEnable; //gpϐx}
 
-	WCHAR wPath[FileUtility::MAX_PATH_LENGTH] = { 0 };
-	FileUtility::convertWCHARFilePath(path, wPath, FileUtility::MAX_PATH_LENGTH);
-
-	ID3DBlob* errMsg = nullptr;
-	HRESULT result = E_FAIL;
-	ID3D11Device* direct3dDevice = Director::getRenderer().getDirect3dDevice(); // TODO:Directorˑ܂̌ȁ[
+	// VF[_ShaderCacheŋLBԂĂVF[_͎QƃJEg𑝂₵Ă̂ŃfXgN^ReleaseĂ悢
+	ShaderCache* shaderCache = ShaderCache::getInstance();
 
 	if (!vertexShaderFunctionName.empty())
 	{
-		// _VF[_̃R[hRpC
-		result = D3DCompileFromFile(
-			wPath,
-			nullptr,
-			D3D_COMPILE_STANDARD_FILE_INCLUDE,
-			vertexShaderFunctionName.c_str(),
-			"vs_4_0",
-			D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_PACK_MATRIX_COLUMN_MAJOR,
-			0,
-			&_vertexShaderBlob,
-			&errMsg
-		);
-		if (FAILED(result))
-		{
-			Logger::logAssert(false, "D3DX11CompileFromFile failed. result=%d. error message=%s", result, errMsg->GetBufferPointer());
-			return;
-		}
-
-		// _VF[_̍쐬
-		result = direct3dDevice->CreateVertexShader(
-			_vertexShaderBlob->GetBufferPointer(),
-			_vertexShaderBlob->GetBufferSize(),
-			nullptr,
-			&_vertexShader
-		);
-		if (FAILED(result))
+		_vertexShader = shaderCache->getVertexShader(path, vertexShaderFunctionName, features, &_vertexShaderBlob);
+		if (_vertexShader == nullptr)
 		{
-			Logger::logAssert(false, "CreateVertexShader failed. result=%d", result);
 			return;
 		}
 	}
 
-	// WIgVF[_̃RpC
 	if (!geometryShaderFunctionName.empty())
 	{
-		ID3DBlob* blobGS = nullptr;
-		result = D3DCompileFromFile(
-			wPath,
-			nullptr,
-			D3D_COMPILE_STANDARD_FILE_INCLUDE,
-			geometryShaderFunctionName.c_str(),
-			"gs_4_0",
-			D3D10_SHADER_DEBUG | D3D10_SHADER_SKIP_OPTIMIZATION | D3D10_SHADER_ENABLE_STRICTNESS | D3D10_SHADER_PACK_MATRIX_COLUMN_MAJOR,
-			0,
-			&blobGS,
-			&errMsg
-		);
-		if (FAILED(result))
+		_geometryShader = shaderCache->getGeometryShader(path, geometryShaderFunctionName, features);
+		if (_geometryShader == nullptr)
 		{
-			Logger::logAssert(false, "D3DX11CompileFromFile failed. result=%d. error message=%s", result, errMsg->GetBufferPointer());
-			return;
-		}
-
-		// WIgVF[_̍쐬
-		result = direct3dDevice->CreateGeometryShader(
-			blobGS->GetBufferPointer(),
-			blobGS->GetBufferSize(),
-			nullptr,
-			&_geometryShader
-		);
-		blobGS->Release();
-		blobGS = nullptr;
-		if (FAILED(result))
-		{
-			Logger::logAssert(false, "CreateVertexShader failed. result=%d", result);
 			return;
 		}
 	}
 
-	// sNZVF[_̃RpC
 	if (!pixelShaderFunctionName.empty())
 	{
-		ID3DBlob* blobPS = nullptr;
-		result = D3DCompileFromFile(
-			wPath,
-			nullptr,
-			D3D_COMPILE_STANDARD_FILE_INCLUDE,
-			pixelShaderFunctionName.c_str(),
-			"ps_4_0",
-			D3D10_SHADER_DEBUG | D3D10_SHADER_SKIP_OPTIMIZATION | D3D10_SHADER_ENABLE_STRICTNESS | D3D10_SHADER_PACK_MATRIX_COLUMN_MAJOR,
-			0,
-			&blobPS,
-			&errMsg
-		);
-		if (FAILED(result))
-		{
-			Logger::logAssert(false, "D3DX11CompileFromFile failed. result=%d. error message=%s", result, errMsg->GetBufferPointer());
-			return;
-		}
-
-		// sNZVF[_̍쐬
-		result = direct3dDevice->CreatePixelShader(
-			blobPS->GetBufferPointer(),
-			blobPS->GetBufferSize(),
-			nullptr,
-			&_pixelShader
-		);
-		blobPS->Release();
-		blobPS = nullptr;
-		if (FAILED(result))
+		_pixelShader = shaderCache->getPixelShader(path, pixelShaderFunctionName, features);
+		if (_pixelShader == nullptr)
 		{
-			Logger::logAssert(false, "CreatePixelShader failed. result=%d", result);
 			return;
 		}
 	}
@@ -265,20 +167,39 @@ void D3DProgram::setShadersToDirect3DContext(ID3D11DeviceContext* context)
 	context->PSSetShader(_pixelShader, nullptr, 0);
 }
 
-void D3DProgram::addConstantBuffer(const std::string& keyStr, ID3D11Buffer* constantBuffer)
+void D3DProgram::addConstantBuffer(ConstantBufferID key, ID3D11Buffer* constantBuffer)
 {
-	_constantBufferIndices[keyStr] = _constantBuffers.size();
+	Logger::logAssert(_constantBufferIndices[static_cast<size_t>(key)] < 0, "萔obt@dɒǉBkey=%d", static_cast<int>(key));
+	_constantBufferIndices[static_cast<size_t>(key)] = static_cast<int>(_constantBuffers.size());
 	_constantBuffers.push_back(constantBuffer);
+	_constantBufferDatas.push_back(std::vector<unsigned char>());
+
+	D3D11_BUFFER_DESC desc;
+	constantBuffer->GetDesc(&desc);
+	_constantBufferByteWidths.push_back(desc.ByteWidth);
 }
 
-void D3DProgram::setConstantBuffersToDirect3DContext(ID3D11DeviceContext* context)
+void D3DProgram::setConstantBufferData(ConstantBufferID key, const void* data, size_t size)
 {
-	size_t numConstantBuffer = _constantBuffers.size();
-	ID3D11Buffer* const* constantBufferPointer = _constantBuffers.data();
-	context->VSSetConstantBuffers(0, numConstantBuffer, constantBufferPointer);
-	context->GSSetConstantBuffers(0, numConstantBuffer, constantBufferPointer);
-	context->PSSetConstantBuffers(0, numConstantBuffer, constantBufferPointer);
+	std::vector<unsigned char>& constantBufferData = _constantBufferDatas[getConstantBufferIndex(key)];
+	constantBufferData.resize(size);
+	CopyMemory(constantBufferData.data(), data, size);
 }
+
+void* D3DProgram::allocateConstantBufferData(ConstantBufferID key, size_t size)
+{
+	std::vector<unsigned char>& constantBufferData = _constantBufferDatas[getConstantBufferIndex(key)];
+	constantBufferData.assign(size, 0);
+	return constantBufferData.data();
+}
+
+size_t D3DProgram::getConstantBufferIndex(ConstantBufferID key) const
+{
+	int index = _constantBufferIndices[static_cast<size_t>(key)];
+	Logger::logAssert(index >= 0, "ǉĂȂ萔obt@ւ̃ANZXBkey=%d", static_cast<int>(key));
+	return static_cast<size_t>(index);
+}
+
 } // namespace mgrrenderer
 
 #endif
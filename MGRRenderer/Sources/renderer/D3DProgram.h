@@ -4,7 +4,7 @@
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include <string>
 #include <vector>
-#include <map>
+#include <array>
 #include <d3d11.h>
 
 namespace mgrrenderer
@@ -24,25 +24,35 @@ public:
 	static const std::string SEMANTIC_BLEND_WEIGHT;
 	static const std::string SEMANTIC_BLEND_INDEX;
 
-	static const std::string CONSTANT_BUFFER_RENDER_MODE;
-	static const std::string CONSTANT_BUFFER_MODEL_MATRIX;
-	static const std::string CONSTANT_BUFFER_VIEW_MATRIX;
-	static const std::string CONSTANT_BUFFER_PROJECTION_MATRIX;
-	static const std::string CONSTANT_BUFFER_DEPTH_BIAS_MATRIX;
-	static const std::string CONSTANT_BUFFER_NORMAL_MATRIX;
-	static const std::string CONSTANT_BUFFER_MULTIPLY_COLOR;
-	static const std::string CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER;
-	static const std::string CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER;
-	static const std::string CONSTANT_BUFFER_POINT_LIGHT_PARAMETER;
-	static const std::string CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER;
-	static const std::string CONSTANT_BUFFER_JOINT_MATRIX_PALLETE;
+	// 萔obt@̈ӖIDB`掞̒萔obt@̌𕶎łȂz̓Yōs
+	enum class ConstantBufferID : int
+	{
+		RENDER_MODE,
+		MODEL_MATRIX,
+		VIEW_MATRIX,
+		PROJECTION_MATRIX,
+		DEPTH_BIAS_MATRIX,
+		NORMAL_MATRIX,
+		MULTIPLY_COLOR,
+		AMBIENT_LIGHT_PARAMETER,
+		DIRECTIONAL_LIGHT_PARAMETER,
+		POINT_LIGHT_PARAMETER,
+		SPOT_LIGHT_PARAMETER,
+		JOINT_MATRIX_PALLETE,
+		// Sprite2D̃fvXeNX`\pBjAfvXɖ߂̂3DJ̃vWFNVs񂪕KvȂ̂ŁA2DJp̃vWFNVsƋʂĂ
+		DEPTH_TEXTURE_PARAMETER,
+		DEPTH_TEXTURE_PROJECTION_MATRIX,
+
+		NUM_CONSTANT_BUFFER_IDS,
+	};
 
 	D3DProgram();
 	~D3DProgram();
 
 	//void initWithShaderString(const std::string& shaderStr, bool depthTestEnable); // STRINGFYŕ񈵂ႤGPUfobOłȂȂ̂ŃVF[_̓t@Cň
 	// VF[_֐󕶎ɂꍇ͂̃VF[_͂ȂňBsetShadersToDirect3DContextłSetShaderɂnullptrZbg
-	void initWithShaderFile(const std::string& path, bool depthTestEnable, const std::string& vertexShaderFunctionName, const std::string& geometryShaderFunctionName, const std::string& pixelShaderFunctionName);
+	// featuresShaderPermutation::Featurẽrbg}XNnƁAΉ}N`oG[Vg
+	void initWithShaderFile(const std::string& path, bool depthTestEnable, const std::string& vertexShaderFunctionName, const std::string& geometryShaderFunctionName, const std::string& pixelShaderFunctionName, unsigned int features = 0);
 	ID3D11VertexShader* getVertexShader() const { return _vertexShader; }
 	ID3DBlob* getVertexShaderBlob() const { return _vertexShaderBlob; };
 	ID3D11GeometryShader* getGeometryShader() const { return _geometryShader; }
@@ -53,12 +63,18 @@ public:
 	void addIndexBuffers(const std::vector<ID3D11Buffer*>& indexBuffers) { _indexBuffers.push_back(indexBuffers); }
 	ID3D11InputLayout* getInputLayout() const { return _inputLayout; }
 	void setInputLayout(ID3D11InputLayout* inputLayout) { _inputLayout = inputLayout; }
-	ID3D11Buffer* getConstantBuffer(const std::string& keyStr) const { return _constantBuffers[_constantBufferIndices.at(keyStr)]; }
-	void addConstantBuffer(const std::string& keyStr, ID3D11Buffer* constantBuffer);
+	ID3D11Buffer* getConstantBuffer(ConstantBufferID key) const { return _constantBuffers[getConstantBufferIndex(key)]; }
+	void addConstantBuffer(ConstantBufferID key, ID3D11Buffer* constantBuffer);
+	const std::vector<ID3D11Buffer*>& getConstantBuffers() const { return _constantBuffers; }
+	// 萔obt@ɏeCPUɕێĂAConstantRingBuffer::bindł܂Ƃ߂GPUɑ
+	void setConstantBufferData(ConstantBufferID key, const void* data, size_t size);
+	// z̈ꕔޏꍇȂǁAڏ݂ƂɎgBe̓[NAԂŕԂ
+	void* allocateConstantBufferData(ConstantBufferID key, size_t size);
+	const std::vector<unsigned char>& getConstantBufferData(size_t index) const { return _constantBufferDatas[index]; }
+	size_t getConstantBufferByteWidth(size_t index) const { return _constantBufferByteWidths[index]; }
 	static DXGI_FORMAT getDxgiFormat(const std::string& semantic);
 
 	void setShadersToDirect3DContext(ID3D11DeviceContext* context);
-	void setConstantBuffersToDirect3DContext(ID3D11DeviceContext* context);
 
 private:
 	ID3D11VertexShader* _vertexShader;
@@ -71,8 +87,13 @@ private:
 	// Kw͈̃ft@C̒̕bVAKẃA̒ł̃}eAƂ̃TubV
 	std::vector<std::vector<ID3D11Buffer*>> _indexBuffers;
 	ID3D11InputLayout* _inputLayout;
-	std::map<std::string, size_t> _constantBufferIndices;
+	// ConstantBufferIDƂ_constantBuffers̓YBǉĂȂ̂-1
+	std::array<int, static_cast<size_t>(ConstantBufferID::NUM_CONSTANT_BUFFER_IDS)> _constantBufferIndices;
 	std::vector<ID3D11Buffer*> _constantBuffers;
+	std::vector<std::vector<unsigned char>> _constantBufferDatas;
+	std::vector<size_t> _constantBufferByteWidths;
+
+	size_t getConstantBufferIndex(ConstantBufferID key) const;
 };
 
 } // namespace mgrrenderer
@@ -5,6 +5,7 @@
 #include "Image.h"
 #include "Director.h" // TODO:DirectorɈˑĂĂǂȂ񂾂BB
 #include <directxtex/include/DirectXTex.h>
+#include <vector>
 
 namespace mgrrenderer
 {
@@ -285,6 +286,79 @@ bool D3DTexture::initRenderTexture(const SizeUint& size, DXGI_FORMAT textureForm
 	return true;
 }
 
+bool D3DTexture::initWithSize(const SizeUint& size)
+{
+	_contentSize = size;
+
+	ID3D11Device* device = Director::getRenderer().getDirect3dDevice();
+
+	// eNX`BIɏ̂UpdateSubresourcegDEFAULTɂ
+	D3D11_TEXTURE2D_DESC texDesc;
+	texDesc.Width = size.width;
+	texDesc.Height = size.height;
+	texDesc.MipLevels = 1;
+	texDesc.ArraySize = 1;
+	texDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+	texDesc.SampleDesc.Count = 1;
+	texDesc.SampleDesc.Quality = 0;
+	texDesc.Usage = D3D11_USAGE_DEFAULT;
+	texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+	texDesc.CPUAccessFlags = 0;
+	texDesc.MiscFlags = 0;
+
+	// gp̗̈悪slɂȂȂ悤0Ŗ߂
+	std::vector<unsigned char> initialData(size.width * size.height * 4, 0);
+	D3D11_SUBRESOURCE_DATA subData;
+	subData.pSysMem = initialData.data();
+	subData.SysMemPitch = size.width * 4;
+	subData.SysMemSlicePitch = 0;
+
+	ID3D11Texture2D* texture = nullptr;
+	HRESULT result = device->CreateTexture2D(&texDesc, &subData, &texture);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateTexture2D failed. result=%d", result);
+		return false;
+	}
+
+	// VF[_\[Xr[
+	D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
+	srvDesc.Format = texDesc.Format;
+	srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+	srvDesc.Texture2D.MipLevels = 1;
+	srvDesc.Texture2D.MostDetailedMip = 0;
+
+	result = device->CreateShaderResourceView(texture, &srvDesc, &_shaderResourceView);
+	texture->Release(); // VF[_\[Xr[QƂ
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateShaderResourceView failed. result=%d", result);
+		return false;
+	}
+
+	return true;
+}
+
+void D3DTexture::updateSubImage(unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned char* rgbaData)
+{
+	Logger::logAssert(_shaderResourceView != nullptr, "initWithSizeŏĂȂeNX`ɏƂB");
+	Logger::logAssert(x + width <= _contentSize.width && y + height <= _contentSize.height, "eNX`͈̔͊OɏƂB");
+
+	ID3D11Resource* resource = nullptr;
+	_shaderResourceView->GetResource(&resource);
+
+	D3D11_BOX box;
+	box.left = x;
+	box.top = y;
+	box.front = 0;
+	box.right = x + width;
+	box.bottom = y + height;
+	box.back = 1;
+
+	Director::getRenderer().getDirect3dContext()->UpdateSubresource(resource, 0, &box, rgbaData, width * 4, 0);
+	resource->Release();
+}
+
 } // namespace mgrrenderer
 
 #endif
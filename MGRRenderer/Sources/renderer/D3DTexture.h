@@ -17,6 +17,9 @@ public:
 	bool initDepthStencilTexture(const SizeUint& size);
 	bool initDepthStencilCubeMapTexture(unsigned int size);
 	bool initRenderTexture(const SizeUint& size, DXGI_FORMAT textureFormat);
+	// gRGBA8888̃eNX`Bg͌ォupdateSubImageŕIɏ
+	bool initWithSize(const SizeUint& size);
+	void updateSubImage(unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned char* rgbaData);
 
 	// fvXeNX`⃌_[^[QbgȂǕ`ɂ菑݂Ƃɂ̂ݎg
 	ID3D11DepthStencilView* getDepthStencilView() const { return _depthStencilView; }
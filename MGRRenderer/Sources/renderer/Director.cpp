@@ -1,12 +1,18 @@
 #include "Director.h"
 #include "Image.h"
 #include "TextureUtility.h"
+#include "TextureAtlas.h"
 #include "embeddata/FPSFontImage.h"
 #include "node/LabelAtlas.h"
 #include "node/Sprite2D.h"
-#if defined(MGRRENDERER_USE_OPENGL)
+#include "utility/Profiler.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "D3DTexture.h"
+#elif defined(MGRRENDERER_USE_OPENGL)
 #include "GLTexture.h"
 #endif
+#include <algorithm>
+#include <stdio.h>
 
 namespace mgrrenderer
 {
@@ -14,18 +20,19 @@ namespace mgrrenderer
 Director* Director::_instance = nullptr;
 
 Director::Director() :
-#if defined(MGRRENDERER_DEFERRED_RENDERING)
-_displayGBuffer(false),
-_gBufferDepthStencil(nullptr),
-_gBufferColorSpecularIntensitySprite(nullptr),
-_gBufferNormal(nullptr),
-_gBufferSpecularPower(nullptr),
-#endif // defined(MGRRENDERER_DEFERRED_RENDERING)
+_nearClip(0.0f),
+_farClip(0.0f),
+_fixedDeltaTime(0.0f),
 _displayStats(false),
 _accumulatedDeltaTime(0.0f),
-_FPSLabel(nullptr),
-_nearClip(0.0f),
-_farClip(0.0f)
+_FPSLabel(nullptr)
+#if defined(MGRRENDERER_DEFERRED_RENDERING)
+,_displayGBuffer(false)
+,_gBufferDepthStencil(nullptr)
+,_gBufferColorSpecularIntensitySprite(nullptr)
+,_gBufferNormal(nullptr)
+,_gBufferSpecularPower(nullptr)
+#endif // defined(MGRRENDERER_DEFERRED_RENDERING)
 {
 }
 
@@ -57,6 +64,11 @@ Director* Director::getInstance()
 void Director::destroy()
 {
 	delete _instance;
+	_instance = nullptr;
+
+	// AgX̃y[W̃eNX`Renderer̃fXgN^ŉς݁B
+	// V[̃m[hAgẌ̗ԂIȂ̂ŁAŃVOĝj
+	TextureAtlas::destroy();
 }
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
@@ -102,33 +114,74 @@ void Director::setScene(const Scene& scene)
 	// Scene̓TCY̑傫std::vector܂ނ̂ŃRs[RXgNgȂ̂moveB
 	_scene = std::move(scene);
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	// Gobt@̃fvX̃vWFNVs̓V[ɐݒ肵J̐ݒɈˑ̂łGobt@
-	initGBufferSprite();
+	// Gobt@̃fvX̃vWFNVs̓V[ɐݒ肵J̐ݒɈˑ̂ō蒼B
+	// Gobt@̎̂̓t[Ot蓖Ă̂ŁÂ͍ŏɕ`悷Ƃ
+	clearGBufferSprite();
 #endif
 }
 
 void Director::update()
 {
+	MGRRENDERER_PROFILE_SCOPE("Director::update");
+
 	float dt = calculateDeltaTime();
 
 	_scene.update(dt);
 
-	// AfobO\2Dm[hȂ̂ŁAScene:update̍ŌɕKvȐݒ͍ςł
+	// AfobO\2Dm[hȂ̂ŁAV[̃pX̌ɒǉ΂悢
+	FrameGraph& frameGraph = _scene.getFrameGraph();
+	FrameGraph::ResourceHandle backBuffer = _scene.getBackBufferHandle();
+
 	if (_displayStats)
 	{
 		updateStats(dt);
+
+		frameGraph.addPass("Stats",
+			[=](FrameGraph::PassBuilder& builder)
+			{
+				builder.write(backBuffer);
+				builder.setSideEffect();
+			},
+			[=]
+			{
+				renderStats();
+			}
+		);
 	}
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
-	if (_displayGBuffer)
-	{
-		renderGBufferSprite();
-	}
+	// \ȂƂ̓pXƃJO
+	frameGraph.addPass("GBufferDebug",
+		[=](FrameGraph::PassBuilder& builder)
+		{
+			builder.read(_scene.getGBufferHandle());
+			builder.write(backBuffer);
+			if (_displayGBuffer)
+			{
+				builder.setSideEffect();
+			}
+		},
+		[=]
+		{
+			renderGBufferSprite();
+		}
+	);
 #endif
 
+	_scene.render();
 	_renderer.render();
 }
 
+void Director::updateSoftware(SoftwareDeferredRenderer& renderer)
+{
+	MGRRENDERER_PROFILE_SCOPE("Director::updateSoftware");
+
+	float dt = calculateDeltaTime();
+
+	_scene.update(dt);
+	_scene.renderSoftware(renderer);
+}
+
 Renderer& Director::getRenderer()
 {
 	return getInstance()->_renderer;
@@ -144,24 +197,19 @@ const Camera& Director::getCameraFor2D()
 	return getInstance()->getScene().getCameraFor2D();
 }
 
-struct timeval Director::getCurrentTimeOfDay()
-{
-	LARGE_INTEGER freq, count;
-	QueryPerformanceFrequency(&freq);
-	QueryPerformanceCounter(&count);
-
-	struct timeval ret;
-	ret.tv_sec = static_cast<long>(count.QuadPart / freq.QuadPart);
-	ret.tv_usec = static_cast<long>(count.QuadPart * 1000000 / freq.QuadPart - ret.tv_sec * 1000000);
-	return ret;
-}
-
 float Director::calculateDeltaTime()
 {
-	const struct timeval& now = getCurrentTimeOfDay();
-	float ret = now.tv_sec - _lastUpdateTime.tv_sec + (now.tv_usec - _lastUpdateTime.tv_usec) / 1000000.0f;
+	// steady_clockWindowsłQueryPerformanceCounterŎĂ̂Őx͕ςȂ
+	const std::chrono::steady_clock::time_point& now = std::chrono::steady_clock::now();
+	float ret = std::chrono::duration<float>(now - _lastUpdateTime).count();
 	_lastUpdateTime = now;
-	return max(0.0f, ret);
+
+	if (_fixedDeltaTime > 0.0f)
+	{
+		return _fixedDeltaTime;
+	}
+
+	return std::max(0.0f, ret);
 }
 
 void Director::createStatsLabel()
@@ -176,15 +224,17 @@ void Director::createStatsLabel()
 	bool success = image.initWithImageData(FPSFontImage::PNG_DATA, FPSFontImage::getPngDataSize());
 	Logger::logAssert(success, "ImagȅɎs");
 
-#if defined(MGRRENDERER_USE_OPENGL)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	D3DTexture* texture = new (std::nothrow) D3DTexture(); // TextureGPŨgĂ̂ŉƍ̂Ńq[vɂƂ
+#elif defined(MGRRENDERER_USE_OPENGL)
 	GLTexture* texture = new (std::nothrow) GLTexture(); // TextureGPŨgĂ̂ŉƍ̂Ńq[vɂƂ
+#endif
 	success = texture->initWithImage(image, TextureUtility::PixelFormat::RGBA4444);
 	Logger::logAssert(success, "TexturȅɎs");
 
 	_FPSLabel->init("", texture,
 		12, 32, '.'); // ̏́AłɃeNX`̏mĂ邱Ƃ̌ߑł
 	_FPSLabel->setPosition(Vec3(0, 0, 0));
-#endif
 }
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
@@ -192,17 +242,10 @@ void Director::initGBufferSprite()
 {
 	clearGBufferSprite();
 
-	if (_renderer.getGBufferDepthStencil() != nullptr) // fvXXeVɂ̓_[obt@găeNX`gȂꍇ͕\Ȃ
-	{
-		_gBufferDepthStencil = new Sprite2D();
-		_gBufferDepthStencil->initWithDepthStencilTexture(_renderer.getGBufferDepthStencil(), Sprite2D::RenderBufferType::DEPTH_TEXTURE, getNearClip(), getFarClip(), getCamera().getProjectionMatrix());
-	}
-
-	if (_gBufferDepthStencil != nullptr)
-	{
-		_gBufferDepthStencil->setScale(1 / 5.0f);
-		_gBufferDepthStencil->setPosition(Vec3(0.0f, 0.0f, 0.0f));
-	}
+	_gBufferDepthStencil = new Sprite2D();
+	_gBufferDepthStencil->initWithDepthStencilTexture(_renderer.getGBufferDepthStencil(), Sprite2D::RenderBufferType::DEPTH_TEXTURE, getNearClip(), getFarClip(), getCamera().getProjectionMatrix());
+	_gBufferDepthStencil->setScale(1 / 5.0f);
+	_gBufferDepthStencil->setPosition(Vec3(0.0f, 0.0f, 0.0f));
 
 	_gBufferColorSpecularIntensitySprite = new Sprite2D();
 	_gBufferColorSpecularIntensitySprite->initWithRenderBuffer(_renderer.getGBufferColorSpecularIntensity(), Sprite2D::RenderBufferType::GBUFFER_COLOR_SPECULAR_INTENSITY);
@@ -249,19 +292,24 @@ void Director::clearGBufferSprite()
 
 void Director::renderGBufferSprite()
 {
-	// addChildĂȂ̂Œڕ`悷
-	if (_gBufferDepthStencil != nullptr)
+	// ̃pX̎sɂGobt@̎̂RendererɓnĂ
+	if (_gBufferDepthStencil == nullptr)
 	{
-		_gBufferDepthStencil->prepareRendering();
+		initGBufferSprite();
 	}
+
+	_gBufferDepthStencil->setRenderBufferTexture(_renderer.getGBufferDepthStencil());
+	_gBufferColorSpecularIntensitySprite->setRenderBufferTexture(_renderer.getGBufferColorSpecularIntensity());
+	_gBufferNormal->setRenderBufferTexture(_renderer.getGBufferNormal());
+	_gBufferSpecularPower->setRenderBufferTexture(_renderer.getGBufferSpecularPower());
+
+	// addChildĂȂ̂Œڕ`悷
+	_gBufferDepthStencil->prepareRendering();
 	_gBufferColorSpecularIntensitySprite->prepareRendering();
 	_gBufferNormal->prepareRendering();
 	_gBufferSpecularPower->prepareRendering();
 
-	if (_gBufferDepthStencil != nullptr)
-	{
-		_gBufferDepthStencil->renderForward();
-	}
+	_gBufferDepthStencil->renderForward();
 	_gBufferColorSpecularIntensitySprite->renderForward();
 	_gBufferNormal->renderForward();
 	_gBufferSpecularPower->renderForward();
@@ -287,10 +335,8 @@ void Director::updateStats(float dt)
 		{
 			char buffer[30]; // 30cocosshowStats̐^
 
-			sprintf_s(buffer, "%.1f / %.3f", fps, avgDeltaTime);
-#if defined(MGRRENDERER_USE_OPENGL)
+			snprintf(buffer, sizeof(buffer), "%.1f / %.3f", fps, avgDeltaTime);
 			_FPSLabel->setString(buffer);
-#endif
 		}
 
 		//Logger::log("%.1f / %.3f", fps, avgDeltaTime);
@@ -299,10 +345,17 @@ void Director::updateStats(float dt)
 
 	if (_FPSLabel != nullptr)
 	{
-		// FPSx͂ǂɂaddChildȂ̂łvisitĂŕ`悷
-		// e͊֌WȂ̂ňCɑSpX`悵Ă܂
+		// FPSx͂ǂɂaddChildȂ̂łvisitĂ
 		_FPSLabel->update(dt);
 		_FPSLabel->prepareRendering();
+	}
+}
+
+void Director::renderStats()
+{
+	if (_FPSLabel != nullptr)
+	{
+		// e͊֌WȂ̂ŃtH[h̃pX`悷
 		_FPSLabel->renderForward();
 	}
 }
@@ -5,7 +5,7 @@
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include <d3d11.h>
 #endif
-#include <ShlObj.h> // timeval̂
+#include <chrono>
 
 namespace mgrrenderer
 {
@@ -13,6 +13,7 @@ class Camera;
 class LabelAtlas;
 class Sprite2D;
 class Light;
+class SoftwareDeferredRenderer;
 
 class Director
 {
@@ -31,11 +32,15 @@ public:
 	Scene& getScene() { return _scene; }
 	void setScene(const Scene& scene);
 	void update();
+	// update()̑ɌĂԂƁARendererg킸ɃfBt@[h̃pXCPUŕ`BvGobt@̃fobO\Ȃ
+	void updateSoftware(SoftwareDeferredRenderer& renderer);
 	static Renderer& getRenderer();
 	static Camera& getCamera();
 	static const Camera& getCameraFor2D();
 
 	void setDisplayStats(bool displayStats) { _displayStats = displayStats; }
+	// 0傫lݒ肷ƁAoߎԂv炸ɖt[̒ldtƂĎgBItXN[ł̌v摜rŃt[̓eČ\ɂ邽
+	void setFixedDeltaTime(float fixedDeltaTime) { _fixedDeltaTime = fixedDeltaTime; }
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 	void setDisplayGBuffer(bool displayGBuffer) { _displayGBuffer = displayGBuffer; }
 #endif
@@ -47,7 +52,8 @@ private:
 	SizeUint _windowSize;
 	float _nearClip;
 	float _farClip;
-	struct timeval _lastUpdateTime;
+	std::chrono::steady_clock::time_point _lastUpdateTime;
+	float _fixedDeltaTime;
 	bool _displayStats;
 	float _accumulatedDeltaTime;
 	LabelAtlas* _FPSLabel;
@@ -62,9 +68,9 @@ private:
 
 	Director();
 	~Director();
-	struct timeval getCurrentTimeOfDay();
 	float calculateDeltaTime();
 	void updateStats(float dt);
+	void renderStats();
 	void createStatsLabel();
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 	void initGBufferSprite();
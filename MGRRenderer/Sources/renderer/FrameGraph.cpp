@@ -0,0 +1,505 @@
+#include "FrameGraph.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "D3DTexture.h"
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLFrameBuffer.h"
+#include "GLTexture.h"
+#endif
+#include "utility/Profiler.h"
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stack>
+
+namespace mgrrenderer
+{
+
+// std::array::fillȂǎQƂŎ󂯎ӏ̂ŁANXOɂ`vBȂGCC̍œKȂ̃rhŃNG[ɂȂ
+const FrameGraph::ResourceHandle FrameGraph::INVALID_HANDLE;
+
+FrameGraph::ResourceHandle FrameGraph::PassBuilder::createTexture(const std::string& name, const ResourceDesc& desc)
+{
+	Logger::logAssert(desc.format != ResourceFormat::NONE, "ꎞ\[X̃tH[}bgwBname=%s", name.c_str());
+
+	Resource resource;
+	resource.name = name;
+	resource.desc = desc;
+	resource.isImported = false;
+	resource.refCount = 0;
+	resource.firstUse = INVALID_HANDLE;
+	resource.lastUse = INVALID_HANDLE;
+	resource.physicalIndex = INVALID_HANDLE;
+	_graph._resources.push_back(resource);
+
+	return write(_graph._resources.size() - 1);
+}
+
+FrameGraph::ResourceHandle FrameGraph::PassBuilder::read(ResourceHandle handle)
+{
+	Logger::logAssert(handle < _graph._resources.size(), "sȃ\[XnhBhandle=%d", static_cast<int>(handle));
+	Logger::logAssert(_graph._resources[handle].isImported || !_graph._resources[handle].writerPassIndices.empty(), "܂ǂ̃pXłȂꎞ\[XǂƂBname=%s", _graph._resources[handle].name.c_str());
+
+	_graph._passes[_passIndex].reads.push_back(handle);
+	return handle;
+}
+
+FrameGraph::ResourceHandle FrameGraph::PassBuilder::write(ResourceHandle handle)
+{
+	Logger::logAssert(handle < _graph._resources.size(), "sȃ\[XnhBhandle=%d", static_cast<int>(handle));
+
+	_graph._passes[_passIndex].writes.push_back(handle);
+	_graph._resources[handle].writerPassIndices.push_back(_passIndex);
+	return handle;
+}
+
+FrameGraph::FrameGraph() : _isCompiled(false)
+{
+}
+
+FrameGraph::~FrameGraph()
+{
+	for (PhysicalResource& physical : _physicalResources)
+	{
+		destroyPhysicalResource(physical);
+	}
+}
+
+void FrameGraph::reset()
+{
+	// ̂_physicalResources͎̃t[łg񂷂̂ŏȂ
+	_resources.clear();
+	_passes.clear();
+	_executionOrder.clear();
+	_isCompiled = false;
+}
+
+FrameGraph::ResourceHandle FrameGraph::importResource(const std::string& name)
+{
+	Resource resource;
+	resource.name = name;
+	resource.isImported = true;
+	resource.refCount = 0;
+	resource.firstUse = INVALID_HANDLE;
+	resource.lastUse = INVALID_HANDLE;
+	resource.physicalIndex = INVALID_HANDLE;
+	_resources.push_back(resource);
+	return _resources.size() - 1;
+}
+
+void FrameGraph::addPass(const char* name, const std::function<void(PassBuilder&)>& setup, const std::function<void()>& execute)
+{
+	Logger::logAssert(!_isCompiled, "compile()ɃpXǉ悤ƂBname=%s", name);
+
+	Pass pass;
+	pass.name = name;
+	pass.execute = execute;
+	pass.hasSideEffect = false;
+	pass.refCount = 0;
+	pass.isCulled = false;
+	_passes.push_back(pass);
+
+	PassBuilder builder(*this, _passes.size() - 1);
+	setup(builder);
+}
+
+void FrameGraph::compile()
+{
+	cullPasses();
+	sortPasses();
+	calculateLifetimes();
+	assignPhysicalResources();
+	_isCompiled = true;
+}
+
+void FrameGraph::execute()
+{
+	Logger::logAssert(_isCompiled, "compile()Oexecute()Ă񂾁B");
+
+	for (size_t passIndex : _executionOrder)
+	{
+		const Pass& pass = _passes[passIndex];
+#if defined(MGRRENDERER_ENABLE_PROFILER)
+		ProfileScope profileScope(pass.name);
+#endif
+		pass.execute();
+	}
+}
+
+bool FrameGraph::isPassCulled(const std::string& name) const
+{
+	for (const Pass& pass : _passes)
+	{
+		if (pass.name == name)
+		{
+			return pass.isCulled;
+		}
+	}
+
+	return true; // o^ĂȂpX͎sȂ̂ŃJOꂽ̂ƂĈ
+}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+D3DTexture* FrameGraph::getTexture(ResourceHandle handle) const
+{
+	return getTextures(handle)[0];
+}
+
+const std::vector<D3DTexture*>& FrameGraph::getTextures(ResourceHandle handle) const
+{
+	Logger::logAssert(handle < _resources.size() && !_resources[handle].isImported, "ꎞ\[XłȂnh̎̂擾悤ƂB");
+	Logger::logAssert(_resources[handle].physicalIndex != INVALID_HANDLE, "̂蓖ĂĂȂBname=%s", _resources[handle].name.c_str());
+	return _physicalResources[_resources[handle].physicalIndex].textures;
+}
+#elif defined(MGRRENDERER_USE_OPENGL)
+GLFrameBuffer* FrameGraph::getFrameBuffer(ResourceHandle handle) const
+{
+	Logger::logAssert(handle < _resources.size() && !_resources[handle].isImported, "ꎞ\[XłȂnh̎̂擾悤ƂB");
+	Logger::logAssert(_resources[handle].physicalIndex != INVALID_HANDLE, "̂蓖ĂĂȂBname=%s", _resources[handle].name.c_str());
+	return _physicalResources[_resources[handle].physicalIndex].frameBuffer;
+}
+
+GLTexture* FrameGraph::getTexture(ResourceHandle handle) const
+{
+	return getFrameBuffer(handle)->getTextures()[0];
+}
+#endif
+
+void FrameGraph::cullPasses()
+{
+	// QƃJEgɂJOBNɂǂ܂Ȃ\[X珑ݑ̃pXǂA
+	// 񂾃\[XSĕsvɂȂpX́Aǂł郊\[X̎QƃJEg炷
+	for (Pass& pass : _passes)
+	{
+		pass.refCount = pass.writes.size();
+		pass.isCulled = false;
+
+		for (ResourceHandle handle : pass.reads)
+		{
+			_resources[handle].refCount++;
+		}
+	}
+
+	std::stack<ResourceHandle> unreferencedResources;
+	for (size_t i = 0; i < _resources.size(); i++)
+	{
+		if (_resources[i].refCount == 0)
+		{
+			unreferencedResources.push(i);
+		}
+	}
+
+	while (!unreferencedResources.empty())
+	{
+		const Resource& resource = _resources[unreferencedResources.top()];
+		unreferencedResources.pop();
+
+		for (size_t passIndex : resource.writerPassIndices)
+		{
+			Pass& writer = _passes[passIndex];
+			Logger::logAssert(writer.refCount > 0, "pX̎QƃJEgsBpass=%s", writer.name);
+			writer.refCount--;
+
+			if (writer.refCount > 0 || writer.hasSideEffect || writer.isCulled)
+			{
+				continue;
+			}
+
+			writer.isCulled = true;
+
+			for (ResourceHandle handle : writer.reads)
+			{
+				Resource& readResource = _resources[handle];
+				Logger::logAssert(readResource.refCount > 0, "\[X̎QƃJEgsBresource=%s", readResource.name.c_str());
+				readResource.refCount--;
+				if (readResource.refCount == 0)
+				{
+					unreferencedResources.push(handle);
+				}
+			}
+		}
+	}
+
+	// ܂ȂpX͎QƃJEgł͏Ȃ̂ŁApȂȂ炱ŏ
+	for (Pass& pass : _passes)
+	{
+		if (pass.writes.empty() && !pass.hasSideEffect)
+		{
+			pass.isCulled = true;
+		}
+	}
+}
+
+void FrameGraph::sortPasses()
+{
+	// \[XɏpXm͓o^ɁApX炻̃\[XǂރpX֕ӂ𒣂
+	// ǂł珑pX́ApXm̓o^̕ӂőOオ܂̂ŁAǂޑ̕ӂ͒Ȃ
+	std::vector<std::vector<size_t>> successors(_passes.size());
+	std::vector<size_t> numPredecessors(_passes.size(), 0);
+	std::vector<std::vector<size_t>> readerPassIndices(_resources.size());
+	for (size_t passIndex = 0; passIndex < _passes.size(); passIndex++)
+	{
+		if (_passes[passIndex].isCulled)
+		{
+			continue;
+		}
+
+		for (ResourceHandle handle : _passes[passIndex].reads)
+		{
+			readerPassIndices[handle].push_back(passIndex);
+		}
+	}
+
+	for (size_t handle = 0; handle < _resources.size(); handle++)
+	{
+		const std::vector<size_t>& writers = _resources[handle].writerPassIndices;
+		size_t previousWriter = INVALID_HANDLE;
+		for (size_t writer : writers)
+		{
+			if (_passes[writer].isCulled)
+			{
+				continue;
+			}
+
+			if (previousWriter != INVALID_HANDLE && previousWriter != writer)
+			{
+				successors[previousWriter].push_back(writer);
+				numPredecessors[writer]++;
+			}
+			previousWriter = writer;
+
+			for (size_t reader : readerPassIndices[handle])
+			{
+				if (std::find(writers.begin(), writers.end(), reader) == writers.end())
+				{
+					successors[writer].push_back(reader);
+					numPredecessors[reader]++;
+				}
+			}
+		}
+	}
+
+	// słpX̂o^̑̂ôŁAˑ̂ȂpXm͓o^̂܂܂ɂȂ
+	std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> readyPasses;
+	size_t numLivePasses = 0;
+	for (size_t passIndex = 0; passIndex < _passes.size(); passIndex++)
+	{
+		if (_passes[passIndex].isCulled)
+		{
+			continue;
+		}
+
+		numLivePasses++;
+		if (numPredecessors[passIndex] == 0)
+		{
+			readyPasses.push(passIndex);
+		}
+	}
+
+	_executionOrder.clear();
+	while (!readyPasses.empty())
+	{
+		size_t passIndex = readyPasses.top();
+		readyPasses.pop();
+		_executionOrder.push_back(passIndex);
+
+		for (size_t successor : successors[passIndex])
+		{
+			numPredecessors[successor]--;
+			if (numPredecessors[successor] == 0)
+			{
+				readyPasses.push(successor);
+			}
+		}
+	}
+
+	Logger::logAssert(_executionOrder.size() == numLivePasses, "pX̓ǂݏ̈ˑzĂB");
+}
+
+void FrameGraph::calculateLifetimes()
+{
+	for (Resource& resource : _resources)
+	{
+		resource.firstUse = INVALID_HANDLE;
+		resource.lastUse = INVALID_HANDLE;
+	}
+
+	// sɌĂ̂ŁAŏɌʒu̎n܂AŌɌʒuIɂȂ
+	for (size_t order = 0; order < _executionOrder.size(); order++)
+	{
+		const Pass& pass = _passes[_executionOrder[order]];
+		for (const std::vector<ResourceHandle>* handles : {&pass.reads, &pass.writes})
+		{
+			for (ResourceHandle handle : *handles)
+			{
+				Resource& resource = _resources[handle];
+				if (resource.isImported)
+				{
+					continue;
+				}
+
+				if (resource.firstUse == INVALID_HANDLE)
+				{
+					resource.firstUse = order;
+				}
+				resource.lastUse = order;
+			}
+		}
+	}
+}
+
+void FrameGraph::assignPhysicalResources()
+{
+	for (PhysicalResource& physical : _physicalResources)
+	{
+		physical.lastUse = INVALID_HANDLE;
+	}
+
+	// ̎n܂鏇ɁȀÎ×~Ɋ蓖Ă
+	std::vector<size_t> liveResources;
+	for (size_t handle = 0; handle < _resources.size(); handle++)
+	{
+		if (!_resources[handle].isImported && _resources[handle].firstUse != INVALID_HANDLE)
+		{
+			liveResources.push_back(handle);
+		}
+	}
+
+	std::stable_sort(liveResources.begin(), liveResources.end(), [this](size_t a, size_t b)
+	{
+		return _resources[a].firstUse < _resources[b].firstUse;
+	});
+
+	for (size_t handle : liveResources)
+	{
+		Resource& resource = _resources[handle];
+
+		size_t physicalIndex = INVALID_HANDLE;
+		for (size_t i = 0; i < _physicalResources.size(); i++)
+		{
+			const PhysicalResource& physical = _physicalResources[i];
+			if (physical.desc == resource.desc && (physical.lastUse == INVALID_HANDLE || physical.lastUse < resource.firstUse))
+			{
+				physicalIndex = i;
+				break;
+			}
+		}
+
+		if (physicalIndex == INVALID_HANDLE)
+		{
+			PhysicalResource physical;
+			physical.desc = resource.desc;
+			createPhysicalResource(physical);
+			_physicalResources.push_back(physical);
+			physicalIndex = _physicalResources.size() - 1;
+		}
+
+		_physicalResources[physicalIndex].lastUse = resource.lastUse;
+		resource.physicalIndex = physicalIndex;
+	}
+
+	// ̃t[Ŋ蓖ĂȂ͉̂BEBhETCYςƌÂTCY̎̂͂vȂ̂ŁAō蒼ɂȂ
+	std::vector<size_t> newPhysicalIndices(_physicalResources.size(), INVALID_HANDLE);
+	size_t numUsedPhysicals = 0;
+	for (size_t i = 0; i < _physicalResources.size(); i++)
+	{
+		if (_physicalResources[i].lastUse == INVALID_HANDLE)
+		{
+			destroyPhysicalResource(_physicalResources[i]);
+			continue;
+		}
+
+		newPhysicalIndices[i] = numUsedPhysicals;
+		_physicalResources[numUsedPhysicals] = _physicalResources[i];
+		numUsedPhysicals++;
+	}
+	_physicalResources.resize(numUsedPhysicals);
+
+	for (size_t handle : liveResources)
+	{
+		_resources[handle].physicalIndex = newPhysicalIndices[_resources[handle].physicalIndex];
+	}
+}
+
+void FrameGraph::createPhysicalResource(PhysicalResource& physical)
+{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	physical.textures.resize(physical.desc.format == ResourceFormat::GBUFFER ? NUM_GBUFFER_TEXTURES : 1);
+	for (D3DTexture*& texture : physical.textures)
+	{
+		texture = new (std::nothrow) D3DTexture();
+	}
+
+	bool success = false;
+	switch (physical.desc.format)
+	{
+	case ResourceFormat::RGBA8:
+		success = physical.textures[0]->initRenderTexture(physical.desc.size, DXGI_FORMAT_R8G8B8A8_UNORM);
+		break;
+	case ResourceFormat::DEPTH_STENCIL:
+		success = physical.textures[0]->initDepthStencilTexture(physical.desc.size);
+		break;
+	case ResourceFormat::DEPTH_STENCIL_CUBEMAP:
+		success = physical.textures[0]->initDepthStencilCubeMapTexture(physical.desc.size.width);
+		break;
+	case ResourceFormat::GBUFFER:
+		success = physical.textures[0]->initDepthStencilTexture(physical.desc.size)
+			&& physical.textures[1]->initRenderTexture(physical.desc.size, DXGI_FORMAT_R8G8B8A8_UNORM)
+			&& physical.textures[2]->initRenderTexture(physical.desc.size, DXGI_FORMAT_R11G11B10_FLOAT)
+			&& physical.textures[3]->initRenderTexture(physical.desc.size, DXGI_FORMAT_R8G8B8A8_UNORM);
+		break;
+	default:
+		Logger::logAssert(false, "zÕtH[}bgBformat=%d", static_cast<int>(physical.desc.format));
+		break;
+	}
+	Logger::logAssert(success, "ꎞ\[X̍쐬Ɏs");
+#elif defined(MGRRENDERER_USE_OPENGL)
+	physical.frameBuffer = new (std::nothrow) GLFrameBuffer();
+
+	std::vector<GLenum> drawBuffers;
+	std::vector<GLenum> pixelFormats;
+	bool isCubeMap = false;
+	switch (physical.desc.format)
+	{
+	case ResourceFormat::RGBA8:
+		drawBuffers.push_back(GL_COLOR_ATTACHMENT0);
+		pixelFormats.push_back(GL_RGBA);
+		break;
+	case ResourceFormat::DEPTH_STENCIL_CUBEMAP:
+		isCubeMap = true;
+		// fall through
+	case ResourceFormat::DEPTH_STENCIL:
+		drawBuffers.push_back(GL_NONE);
+		pixelFormats.push_back(GL_DEPTH_COMPONENT);
+		break;
+	case ResourceFormat::GBUFFER:
+		drawBuffers = {GL_NONE, GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2};
+		pixelFormats = {GL_DEPTH_COMPONENT, GL_RGBA, GL_RGBA, GL_RGBA};
+		break;
+	default:
+		Logger::logAssert(false, "zÕtH[}bgBformat=%d", static_cast<int>(physical.desc.format));
+		break;
+	}
+
+	bool success = physical.frameBuffer->initWithTextureParams(drawBuffers, pixelFormats, false, isCubeMap, physical.desc.size);
+	Logger::logAssert(success, "ꎞ\[X̍쐬Ɏs");
+#endif
+}
+
+void FrameGraph::destroyPhysicalResource(PhysicalResource& physical)
+{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	for (D3DTexture* texture : physical.textures)
+	{
+		delete texture;
+	}
+	physical.textures.clear();
+#elif defined(MGRRENDERER_USE_OPENGL)
+	if (physical.frameBuffer != nullptr)
+	{
+		delete physical.frameBuffer;
+		physical.frameBuffer = nullptr;
+	}
+#endif
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,151 @@
+#pragma once
+#include "BasicDataTypes.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11.h>
+#endif
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+class D3DTexture;
+#elif defined(MGRRENDERER_USE_OPENGL)
+class GLFrameBuffer;
+class GLTexture;
+#endif
+
+// pXǂݏ郊\[X錾AƂɃpX̎sAsvpX̃JOA
+// ꎞ_[^[Qbg̃GCAVO߂B
+// s͓ǂݏ̕ӂg|WJ\[gČ߂B\[XɏpXm͓o^ɎsA
+// \[XǂރpX͂̃\[XɏSẴpX̌ɎsBˑ̂ȂpXm͓o^ɂȂB
+// t[reset()ăpXo^Acompile()Aexecute()̏ɌĂԁB
+// epXexecute͏]ʂRenderCommandςނŁAGPUւ̔sRenderer::render()ōsB
+class FrameGraph final
+{
+public:
+	typedef size_t ResourceHandle;
+	static const ResourceHandle INVALID_HANDLE = static_cast<ResourceHandle>(-1);
+
+	enum class ResourceFormat : int
+	{
+		NONE = -1,
+		RGBA8,
+		DEPTH_STENCIL,
+		DEPTH_STENCIL_CUBEMAP, // L[u}bv̂Ƃsize.widthgȂ̂Œ
+		GBUFFER, // Gobt@̃}`_[^[QbgꎮBfvXAJ[ƃXyLxA@AXyLp[̏
+	};
+
+	// GBUFFER̎̂̃eNX`
+	static const size_t NUM_GBUFFER_TEXTURES = 4;
+
+	struct ResourceDesc
+	{
+		SizeUint size;
+		ResourceFormat format;
+
+		ResourceDesc() : format(ResourceFormat::NONE) {}
+		ResourceDesc(const SizeUint& size_, ResourceFormat format_) : size(size_), format(format_) {}
+		bool operator==(const ResourceDesc& desc) const { return size.width == desc.size.width && size.height == desc.size.height && format == desc.format; }
+	};
+
+	// pX̃ZbgAbv֐ɓnApXg\[X錾
+	class PassBuilder
+	{
+	public:
+		// ̃pXŏ߂ď܂ꎞ\[XB̂compile()ŃGCAVOlĊ蓖Ă
+		ResourceHandle createTexture(const std::string& name, const ResourceDesc& desc);
+		ResourceHandle read(ResourceHandle handle);
+		ResourceHandle write(ResourceHandle handle);
+		// 񂾃\[XNǂ܂ȂĂJOȂBʂւ̕`ȂǊOϑ錋ʂpXɎg
+		void setSideEffect() { _graph._passes[_passIndex].hasSideEffect = true; }
+
+	private:
+		friend class FrameGraph;
+		FrameGraph& _graph;
+		size_t _passIndex;
+
+		PassBuilder(FrameGraph& graph, size_t passIndex) : _graph(graph), _passIndex(passIndex) {}
+		PassBuilder& operator=(const PassBuilder&) = delete;
+	};
+
+	FrameGraph();
+	~FrameGraph();
+
+	void reset();
+	// obNobt@̂悤Ɏt[Ot̊OŊǗĂ郊\[Xo^
+	ResourceHandle importResource(const std::string& name);
+	// scompile()œǂݏ̈ˑ猈܂
+	// name̓vt@Cɂ̂܂ܓn̂ŁA񃊃eProfiler::internName()œ̂ɂ邱ƁB
+	// t[Ă΂̂ŁAsɍ閼O̓ZbgAbvɈxinternĎg
+	void addPass(const char* name, const std::function<void(PassBuilder&)>& setup, const std::function<void()>& execute);
+	void compile();
+	void execute();
+
+	bool isPassCulled(const std::string& name) const;
+	size_t getNumPhysicalResources() const { return _physicalResources.size(); }
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	D3DTexture* getTexture(ResourceHandle handle) const;
+	// GBUFFER̂悤ɕ̃eNX`̗p
+	const std::vector<D3DTexture*>& getTextures(ResourceHandle handle) const;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	GLFrameBuffer* getFrameBuffer(ResourceHandle handle) const;
+	GLTexture* getTexture(ResourceHandle handle) const;
+#endif
+
+private:
+	struct Resource
+	{
+		std::string name;
+		ResourceDesc desc;
+		bool isImported;
+		size_t refCount; // ǂރpX̐
+		// ŏƍŌɎgpX́A_executionOrderł̈ʒuBJOĒNgȂINVALID_HANDLE
+		size_t firstUse;
+		size_t lastUse;
+		size_t physicalIndex;
+		std::vector<size_t> writerPassIndices;
+	};
+
+	struct Pass
+	{
+		const char* name;
+		std::function<void()> execute;
+		std::vector<ResourceHandle> reads;
+		std::vector<ResourceHandle> writes;
+		bool hasSideEffect;
+		size_t refCount; // ރ\[X̂A܂Nɓǂ܂Ă̂̐
+		bool isCulled;
+	};
+
+	// ꎞ\[X̎́Bt[܂ōėpAdescvĂdȂȂ\[XmŋL
+	// EBhETCY̕ύX⃉Cg̍폜ł̃t[Ɋ蓖ĂȂ͉̂
+	struct PhysicalResource
+	{
+		ResourceDesc desc;
+		size_t lastUse; // compile()ɁA̎̂ŌɎgpX_executionOrderł̈ʒu
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		std::vector<D3DTexture*> textures;
+#elif defined(MGRRENDERER_USE_OPENGL)
+		GLFrameBuffer* frameBuffer;
+#endif
+	};
+
+	std::vector<Resource> _resources;
+	std::vector<Pass> _passes;
+	std::vector<PhysicalResource> _physicalResources;
+	// JOȂpX̃CfbNXsɕׂ
+	std::vector<size_t> _executionOrder;
+	bool _isCompiled;
+
+	void cullPasses();
+	void sortPasses();
+	void calculateLifetimes();
+	void assignPhysicalResources();
+	void createPhysicalResource(PhysicalResource& physical);
+	void destroyPhysicalResource(PhysicalResource& physical);
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,149 @@
+#pragma once
+#include <cstddef>
+
+namespace mgrrenderer
+{
+
+// GLCommandRecorderŏoAMGRReplayōĐOpenGĽĂяõt@C`
+// 擪HeaderAFrameEntry̕\ABlobEntry̕\AR}hAuũf[^̏ɕ
+// R}hCommandHeadernumWords4oCg̈ȂBO(eNX`obt@ID)͋L^Ƃ̒l̂܂܂ŁAĐőΉ
+// obt@eNX`̃f[^AVF[_̃\[XȂǉϒ̂̂̓uu̔ԍŎQƂBuu͓ẽnbVŏdĂ
+// jtH[̒l͏̂ŃR}ḧɒړ
+// ItZbg͑Săt@C擪̃oCgBo}VƓGfBAłǂ߂Ȃ
+namespace GLCaptureFormat
+{
+	static const char MAGIC[4] = {'M', 'G', 'R', 'C'};
+	// `ςグBo[ẄႤt@C͍ĐȂ
+	static const unsigned int VERSION = 1;
+	static const size_t DATA_ALIGNMENT = 16;
+	static const char* const EXTENSION = ".mgrc";
+	// uuȂR}h̃uuԍBglBufferDataglTexImage2DnullptrnƂȂ
+	static const unsigned int NO_BLOB = 0xffffffff;
+
+	// ̕т͊eR}h̃RĝƂB64bit̒l͉ʁAʂ̏2[hg
+	// (T)eNX`A(B)obt@A(V)_zA(F)t[obt@A(R)_[obt@A(S)VF[_A(P)vO̖OA(Y)tFX̔ԍ
+	enum class Opcode : unsigned short
+	{
+		// n, O(T/B/V/F/R)n
+		GEN_TEXTURES,
+		GEN_BUFFERS,
+		GEN_VERTEX_ARRAYS,
+		GEN_FRAMEBUFFERS,
+		GEN_RENDERBUFFERS,
+		DELETE_TEXTURES,
+		DELETE_BUFFERS,
+		DELETE_VERTEX_ARRAYS,
+		DELETE_FRAMEBUFFERS,
+		DELETE_RENDERBUFFERS,
+		CREATE_SHADER, // type, S
+		CREATE_PROGRAM, // P
+		DELETE_SHADER, // S
+		DELETE_PROGRAM, // P
+		FENCE_SYNC, // condition, flags, Y
+		CLIENT_WAIT_SYNC, // Y, flags, timeout(64bit)
+		DELETE_SYNC, // Y
+
+		BIND_TEXTURE, // target, T
+		BIND_BUFFER, // target, B
+		BIND_VERTEX_ARRAY, // V
+		BIND_FRAMEBUFFER, // target, F
+		BIND_RENDERBUFFER, // target, R
+		USE_PROGRAM, // P
+		ACTIVE_TEXTURE, // texture
+		ENABLE, // cap
+		DISABLE, // cap
+		CULL_FACE, // mode
+		BLEND_FUNC, // sfactor, dfactor
+		POLYGON_MODE, // face, mode
+		LINE_WIDTH, // width(float)
+		VIEWPORT, // x, y, width, height
+		CLEAR, // mask
+		CLEAR_COLOR, // red, green, blue, alpha(float)
+		CLEAR_DEPTH, // depth(double)
+		PIXEL_STOREI, // pname, param
+		TEX_PARAMETERI, // target, pname, param
+		TEX_PARAMETERFV, // target, pname, count, params(float)count
+		DRAW_BUFFER, // mode
+		READ_BUFFER, // mode
+		DRAW_BUFFERS, // n, bufsn
+		ENABLE_VERTEX_ATTRIB_ARRAY, // index
+		DISABLE_VERTEX_ATTRIB_ARRAY, // index
+		VERTEX_ATTRIB_POINTER, // index, size, type, normalized, stride, obt@擪̃ItZbg(64bit)
+		RENDERBUFFER_STORAGE, // target, internalformat, width, height
+		FRAMEBUFFER_TEXTURE_2D, // target, attachment, textarget, T, level
+		FRAMEBUFFER_RENDERBUFFER, // target, attachment, renderbuffertarget, R
+		BLIT_FRAMEBUFFER, // srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter
+		DRAW_ARRAYS, // mode, first, count
+		DRAW_ELEMENTS, // mode, count, type, obt@擪̃ItZbg(64bit)
+		FINISH,
+
+		SHADER_SOURCE, // S, \[X̃uu
+		COMPILE_SHADER, // S
+		ATTACH_SHADER, // P, S
+		BIND_ATTRIB_LOCATION, // P, index, ϐ̃uu
+		PROGRAM_PARAMETERI, // P, pname, value
+		LINK_PROGRAM, // P
+		PROGRAM_BINARY, // P, binaryFormat, oCĩuu
+		// L^ƂɕԂP[VĐ̃P[VƑΉÂ邽߂̂́B-1ԂƂ͋L^Ȃ
+		GET_UNIFORM_LOCATION, // P, ϐ̃uu, location
+
+		// locationGET_UNIFORM_LOCATIONŋL^̂ŁAOUSE_PROGRAM̃vÔ
+		UNIFORM_1I, // location, v0
+		UNIFORM_1F, // location, v0(float)
+		UNIFORM_3F, // location, v0, v1, v2(float)
+		UNIFORM_4F, // location, v0, v1, v2, v3(float)
+		UNIFORM_3FV, // location, count, value(float)count * 3
+		UNIFORM_MATRIX_4FV, // location, count, transpose, value(float)count * 16
+
+		BUFFER_DATA, // target, size(64bit), usage, f[^̃uu
+		BUFFER_SUB_DATA, // target, offset(64bit), f[^̃uu
+		BUFFER_STORAGE, // target, size(64bit), flags, f[^̃uu
+		MAP_BUFFER_RANGE, // target, B, offset(64bit), length(64bit), access
+		UNMAP_BUFFER, // target, B
+		// }bv̈ւCPȔ݁BGĽĂяoł͂ȂAĐłʒuɏ܂Ȃƕ`悪ς
+		MAPPED_WRITE, // B, }bv͈͂̐擪̃ItZbg(64bit), f[^̃uu
+		TEX_IMAGE_2D, // target, level, internalformat, width, height, border, format, type, f[^̃uu
+		TEX_SUB_IMAGE_2D, // target, level, xoffset, yoffset, width, height, format, type, f[^̃uu
+
+		NUM_OPCODES
+	};
+
+	struct Header
+	{
+		char magic[4];
+		unsigned int version;
+		// L^Ƃ̃ftHgt[obt@̃TCY
+		unsigned int width;
+		unsigned int height;
+		unsigned int numFrames;
+		unsigned int frameTableOffset;
+		unsigned int numBlobs;
+		unsigned int blobTableOffset;
+		unsigned int commandDataOffset;
+		unsigned int commandDataByteSize;
+	};
+
+	// 1t[̃R}hBŏ̃t[ɂ͋L^n߂Ă̏̌ĂяoĂ
+	struct FrameEntry
+	{
+		// Header::commandDataOffset̃oCg
+		unsigned int commandOffset;
+		unsigned int commandByteSize;
+		unsigned int numCommands;
+	};
+
+	struct BlobEntry
+	{
+		unsigned long long hash;
+		unsigned int dataOffset;
+		unsigned int byteSize;
+	};
+
+	struct CommandHeader
+	{
+		Opcode opcode;
+		unsigned short numWords;
+	};
+} // namespace GLCaptureFormat
+
+} // namespace mgrrenderer
@@ -0,0 +1,1161 @@
+// L^鑤glXXXGLCommandRecorderɌɁAۂOpenGL̊֐Ă
+#define MGRRENDERER_CALL_GL_DIRECTLY
+#include "GLCommandRecorder.h"
+
+#if defined(MGRRENDERER_ENABLE_GL_CAPTURE)
+#include "GLCaptureFormat.h"
+#include "utility/Logger.h"
+#include <fstream>
+#include <string.h>
+#include <unordered_map>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+namespace GLCommandRecorder
+{
+	using GLCaptureFormat::Opcode;
+
+	// 64bit̒l2[hŋL^邽߂̌^BGLintptrȂǂ32bitłGLintƓ^ɂȂ̂ŁAI[o[[hŋʂł悤ɂ̌^ɕ
+	struct Word64
+	{
+		unsigned long long value;
+	};
+
+	// glMapBufferRangeŃ}bv͈
+	struct Mapping
+	{
+		const unsigned char* data;
+		size_t length;
+		GLuint buffer;
+	};
+
+	struct State
+	{
+		bool isRecording;
+		unsigned int width;
+		unsigned int height;
+		// St[̃R}hA
+		std::vector<unsigned int> commandWords;
+		size_t commandBeginWord;
+		std::vector<GLCaptureFormat::FrameEntry> frames;
+		size_t frameBeginWord;
+		unsigned int numFrameCommands;
+		std::vector<std::vector<unsigned char>> blobs;
+		std::vector<unsigned long long> blobHashes;
+		// ẽnbVuu̔ԍBnbVՓ˂Ăeׂĕʂ̃uuɂ
+		std::unordered_multimap<unsigned long long, unsigned int> blobIndices;
+		std::unordered_map<GLsync, unsigned int> syncIds;
+		unsigned int nextSyncId;
+		std::vector<Mapping> mappings;
+		// eNX`̃f[^̃TCYvZ邽߂ɁAL^ĂȂƂǂĂ
+		GLint unpackAlignment;
+
+		State() : isRecording(false), width(0), height(0), commandBeginWord(0), frameBeginWord(0), numFrameCommands(0), nextSyncId(1), unpackAlignment(4) {}
+	};
+
+	static State s_state;
+
+	static const unsigned long long HASH_OFFSET_BASIS = 14695981039346656037ULL;
+	static const unsigned long long HASH_PRIME = 1099511628211ULL;
+
+	static unsigned long long hashBytes(const void* data, size_t size)
+	{
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		unsigned long long hash = HASH_OFFSET_BASIS;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= HASH_PRIME;
+		}
+		return hash;
+	}
+
+	static unsigned int addBlob(const void* data, size_t size)
+	{
+		if (data == nullptr)
+		{
+			return GLCaptureFormat::NO_BLOB;
+		}
+
+		unsigned long long hash = hashBytes(data, size);
+		typedef std::unordered_multimap<unsigned long long, unsigned int>::const_iterator BlobIterator;
+		std::pair<BlobIterator, BlobIterator> range = s_state.blobIndices.equal_range(hash);
+		for (BlobIterator it = range.first; it != range.second; ++it)
+		{
+			const std::vector<unsigned char>& blob = s_state.blobs[it->second];
+			if (blob.size() == size && (size == 0 || memcmp(blob.data(), data, size) == 0))
+			{
+				return it->second;
+			}
+		}
+
+		unsigned int ret = static_cast<unsigned int>(s_state.blobs.size());
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		s_state.blobs.push_back(std::vector<unsigned char>(bytes, bytes + size));
+		s_state.blobHashes.push_back(hash);
+		s_state.blobIndices.insert(std::make_pair(hash, ret));
+		return ret;
+	}
+
+	static void beginCommand(Opcode opcode)
+	{
+		s_state.commandBeginWord = s_state.commandWords.size();
+
+		GLCaptureFormat::CommandHeader header;
+		header.opcode = opcode;
+		header.numWords = 0;
+		unsigned int word;
+		memcpy(&word, &header, sizeof(word));
+		s_state.commandWords.push_back(word);
+	}
+
+	static void endCommand()
+	{
+		size_t numWords = s_state.commandWords.size() - s_state.commandBeginWord - 1;
+		Logger::logAssert(numWords <= 0xffff, "1R}ḧBnumWords=%d", static_cast<int>(numWords));
+
+		GLCaptureFormat::CommandHeader header;
+		memcpy(&header, &s_state.commandWords[s_state.commandBeginWord], sizeof(header));
+		header.numWords = static_cast<unsigned short>(numWords);
+		memcpy(&s_state.commandWords[s_state.commandBeginWord], &header, sizeof(header));
+
+		s_state.numFrameCommands++;
+	}
+
+	static void pushArgument(unsigned int value)
+	{
+		s_state.commandWords.push_back(value);
+	}
+
+	static void pushArgument(int value)
+	{
+		s_state.commandWords.push_back(static_cast<unsigned int>(value));
+	}
+
+	static void pushArgument(float value)
+	{
+		unsigned int word;
+		memcpy(&word, &value, sizeof(word));
+		s_state.commandWords.push_back(word);
+	}
+
+	static void pushArgument(Word64 value)
+	{
+		s_state.commandWords.push_back(static_cast<unsigned int>(value.value & 0xffffffffULL));
+		s_state.commandWords.push_back(static_cast<unsigned int>(value.value >> 32));
+	}
+
+	static void pushArgument(double value)
+	{
+		unsigned long long bits;
+		memcpy(&bits, &value, sizeof(bits));
+		pushArgument(Word64{bits});
+	}
+
+	static void pushFloats(const GLfloat* values, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			pushArgument(values[i]);
+		}
+	}
+
+	template<typename... Args>
+	static void recordCommand(Opcode opcode, Args... args)
+	{
+		beginCommand(opcode);
+		int expander[] = {0, (pushArgument(args), 0)...};
+		(void)expander;
+		endCommand();
+	}
+
+	static void recordNames(Opcode opcode, GLsizei n, const GLuint* names)
+	{
+		beginCommand(opcode);
+		pushArgument(n);
+		for (GLsizei i = 0; i < n; i++)
+		{
+			pushArgument(names[i]);
+		}
+		endCommand();
+	}
+
+	static Word64 toWord64(const void* pointer)
+	{
+		return Word64{static_cast<unsigned long long>(reinterpret_cast<size_t>(pointer))};
+	}
+
+	static Word64 toWord64(long long value)
+	{
+		return Word64{static_cast<unsigned long long>(value)};
+	}
+
+	static size_t calculateImageByteSize(GLsizei width, GLsizei height, GLenum format, GLenum type)
+	{
+		size_t numComponents = 0;
+		switch (format)
+		{
+		case GL_RED:
+		case GL_ALPHA:
+		case GL_LUMINANCE:
+		case GL_DEPTH_COMPONENT:
+			numComponents = 1;
+			break;
+		case GL_RG:
+		case GL_LUMINANCE_ALPHA:
+		case GL_DEPTH_STENCIL:
+			numComponents = 2;
+			break;
+		case GL_RGB:
+		case GL_BGR:
+			numComponents = 3;
+			break;
+		case GL_RGBA:
+		case GL_BGRA:
+			numComponents = 4;
+			break;
+		default:
+			Logger::logAssert(false, "L^ɑΉĂȂeNX`̃tH[}bgBformat=0x%x", format);
+			return 0;
+		}
+
+		size_t pixelSize = 0;
+		switch (type)
+		{
+		case GL_UNSIGNED_BYTE:
+		case GL_BYTE:
+			pixelSize = numComponents;
+			break;
+		case GL_UNSIGNED_SHORT:
+		case GL_SHORT:
+		case GL_HALF_FLOAT:
+			pixelSize = numComponents * 2;
+			break;
+		case GL_UNSIGNED_INT:
+		case GL_INT:
+		case GL_FLOAT:
+			pixelSize = numComponents * 4;
+			break;
+		case GL_UNSIGNED_SHORT_5_6_5:
+		case GL_UNSIGNED_SHORT_4_4_4_4:
+		case GL_UNSIGNED_SHORT_5_5_5_1:
+			pixelSize = 2;
+			break;
+		case GL_UNSIGNED_INT_8_8_8_8:
+		case GL_UNSIGNED_INT_24_8:
+			pixelSize = 4;
+			break;
+		default:
+			Logger::logAssert(false, "L^ɑΉĂȂeNX`̌^Btype=0x%x", type);
+			return 0;
+		}
+
+		if (width <= 0 || height <= 0)
+		{
+			return 0;
+		}
+
+		// s̐擪GL_UNPACK_ALIGNMENTɂ낦ēǂ܂BŌ̍š͓ǂ܂Ȃ̂Ŋ܂߂Ȃ
+		size_t alignment = static_cast<size_t>(s_state.unpackAlignment);
+		size_t rowSize = static_cast<size_t>(width) * pixelSize;
+		size_t alignedRowSize = (rowSize + alignment - 1) / alignment * alignment;
+		return alignedRowSize * (static_cast<size_t>(height) - 1) + rowSize;
+	}
+
+	static GLuint getBoundBuffer(GLenum target)
+	{
+		GLenum binding = 0;
+		switch (target)
+		{
+		case GL_ARRAY_BUFFER:
+			binding = GL_ARRAY_BUFFER_BINDING;
+			break;
+		case GL_ELEMENT_ARRAY_BUFFER:
+			binding = GL_ELEMENT_ARRAY_BUFFER_BINDING;
+			break;
+		default:
+			Logger::logAssert(false, "L^ɑΉĂȂobt@̃^[QbgBtarget=0x%x", target);
+			return 0;
+		}
+
+		GLint ret = 0;
+		glGetIntegerv(binding, &ret);
+		return static_cast<GLuint>(ret);
+	}
+
+	void begin(unsigned int width, unsigned int height)
+	{
+		Logger::logAssert(!s_state.isRecording, "ɋL^B");
+		GLint unpackAlignment = s_state.unpackAlignment;
+		s_state = State();
+		s_state.unpackAlignment = unpackAlignment;
+		s_state.isRecording = true;
+		s_state.width = width;
+		s_state.height = height;
+	}
+
+	bool isRecording()
+	{
+		return s_state.isRecording;
+	}
+
+	void endFrame()
+	{
+		if (!s_state.isRecording)
+		{
+			return;
+		}
+
+		GLCaptureFormat::FrameEntry frame;
+		frame.commandOffset = static_cast<unsigned int>(s_state.frameBeginWord * sizeof(unsigned int));
+		frame.commandByteSize = static_cast<unsigned int>((s_state.commandWords.size() - s_state.frameBeginWord) * sizeof(unsigned int));
+		frame.numCommands = s_state.numFrameCommands;
+		s_state.frames.push_back(frame);
+
+		s_state.frameBeginWord = s_state.commandWords.size();
+		s_state.numFrameCommands = 0;
+	}
+
+	static size_t alignOffset(size_t offset)
+	{
+		return (offset + GLCaptureFormat::DATA_ALIGNMENT - 1) / GLCaptureFormat::DATA_ALIGNMENT * GLCaptureFormat::DATA_ALIGNMENT;
+	}
+
+	static void writePadding(std::ofstream& file, size_t currentOffset, size_t alignedOffset)
+	{
+		static const char PADDING[GLCaptureFormat::DATA_ALIGNMENT] = {0};
+		file.write(PADDING, static_cast<std::streamsize>(alignedOffset - currentOffset));
+	}
+
+	bool end(const std::string& filePath)
+	{
+		Logger::logAssert(s_state.isRecording, "L^ĂȂ̂endĂ΂ꂽB");
+		s_state.isRecording = false;
+
+		if (s_state.numFrameCommands > 0)
+		{
+			// endFrameŋ؂ĂȂĂяóAt[̓ȑԂɂȂ̂ōĐȂ
+			Logger::log("ŌendFrame%d̃R}h͏oȂB", static_cast<int>(s_state.numFrameCommands));
+		}
+
+		if (s_state.frames.empty())
+		{
+			Logger::log("L^t[ȂB");
+			return false;
+		}
+
+		// t@C̔zuɌ߂
+		size_t commandDataByteSize = s_state.frameBeginWord * sizeof(unsigned int);
+		size_t frameTableOffset = sizeof(GLCaptureFormat::Header);
+		size_t blobTableOffset = frameTableOffset + s_state.frames.size() * sizeof(GLCaptureFormat::FrameEntry);
+		size_t commandDataOffset = alignOffset(blobTableOffset + s_state.blobs.size() * sizeof(GLCaptureFormat::BlobEntry));
+
+		std::vector<GLCaptureFormat::BlobEntry> blobTable(s_state.blobs.size());
+		size_t offset = commandDataOffset + commandDataByteSize;
+		for (size_t i = 0; i < s_state.blobs.size(); i++)
+		{
+			offset = alignOffset(offset);
+			blobTable[i].hash = s_state.blobHashes[i];
+			blobTable[i].dataOffset = static_cast<unsigned int>(offset);
+			blobTable[i].byteSize = static_cast<unsigned int>(s_state.blobs[i].size());
+			offset += s_state.blobs[i].size();
+		}
+
+		if (offset > 0xffffffffULL)
+		{
+			Logger::log("L^f[^4GB𒴂̂ŏoȂBsize=%llu", static_cast<unsigned long long>(offset));
+			return false;
+		}
+
+		GLCaptureFormat::Header header;
+		memcpy(header.magic, GLCaptureFormat::MAGIC, sizeof(header.magic));
+		header.version = GLCaptureFormat::VERSION;
+		header.width = s_state.width;
+		header.height = s_state.height;
+		header.numFrames = static_cast<unsigned int>(s_state.frames.size());
+		header.frameTableOffset = static_cast<unsigned int>(frameTableOffset);
+		header.numBlobs = static_cast<unsigned int>(s_state.blobs.size());
+		header.blobTableOffset = static_cast<unsigned int>(blobTableOffset);
+		header.commandDataOffset = static_cast<unsigned int>(commandDataOffset);
+		header.commandDataByteSize = static_cast<unsigned int>(commandDataByteSize);
+
+		std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			Logger::log("Lv`̃t@CJȂBfilePath=%s", filePath.c_str());
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(s_state.frames.data()), static_cast<std::streamsize>(s_state.frames.size() * sizeof(GLCaptureFormat::FrameEntry)));
+		file.write(reinterpret_cast<const char*>(blobTable.data()), static_cast<std::streamsize>(blobTable.size() * sizeof(GLCaptureFormat::BlobEntry)));
+		writePadding(file, blobTableOffset + blobTable.size() * sizeof(GLCaptureFormat::BlobEntry), commandDataOffset);
+		file.write(reinterpret_cast<const char*>(s_state.commandWords.data()), static_cast<std::streamsize>(commandDataByteSize));
+
+		offset = commandDataOffset + commandDataByteSize;
+		for (size_t i = 0; i < s_state.blobs.size(); i++)
+		{
+			writePadding(file, offset, blobTable[i].dataOffset);
+			file.write(reinterpret_cast<const char*>(s_state.blobs[i].data()), static_cast<std::streamsize>(s_state.blobs[i].size()));
+			offset = blobTable[i].dataOffset + s_state.blobs[i].size();
+		}
+
+		if (!file)
+		{
+			Logger::log("Lv`݂̏ɎsBfilePath=%s", filePath.c_str());
+			return false;
+		}
+
+		Logger::log("Lv`o: frames=%d blobs=%d size=%.1fMB file=%s",
+			static_cast<int>(s_state.frames.size()),
+			static_cast<int>(s_state.blobs.size()),
+			offset / (1024.0 * 1024.0),
+			filePath.c_str());
+
+		GLint unpackAlignment = s_state.unpackAlignment;
+		s_state = State();
+		s_state.unpackAlignment = unpackAlignment;
+		return true;
+	}
+
+	void recordMappedWrite(const void* data, size_t size)
+	{
+		if (!s_state.isRecording)
+		{
+			return;
+		}
+
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		for (const Mapping& mapping : s_state.mappings)
+		{
+			if (mapping.data <= bytes && bytes + size <= mapping.data + mapping.length)
+			{
+				beginCommand(Opcode::MAPPED_WRITE);
+				pushArgument(mapping.buffer);
+				pushArgument(Word64{static_cast<unsigned long long>(bytes - mapping.data)});
+				pushArgument(addBlob(data, size));
+				endCommand();
+				return;
+			}
+		}
+
+		Logger::logAssert(false, "}bv͈͂̊Oւ݂̏L^悤ƂB");
+	}
+
+	void genTextures(GLsizei n, GLuint* textures)
+	{
+		glGenTextures(n, textures);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::GEN_TEXTURES, n, textures);
+		}
+	}
+
+	void genBuffers(GLsizei n, GLuint* buffers)
+	{
+		glGenBuffers(n, buffers);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::GEN_BUFFERS, n, buffers);
+		}
+	}
+
+	void genVertexArrays(GLsizei n, GLuint* arrays)
+	{
+		glGenVertexArrays(n, arrays);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::GEN_VERTEX_ARRAYS, n, arrays);
+		}
+	}
+
+	void genFramebuffers(GLsizei n, GLuint* framebuffers)
+	{
+		glGenFramebuffers(n, framebuffers);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::GEN_FRAMEBUFFERS, n, framebuffers);
+		}
+	}
+
+	void genRenderbuffers(GLsizei n, GLuint* renderbuffers)
+	{
+		glGenRenderbuffers(n, renderbuffers);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::GEN_RENDERBUFFERS, n, renderbuffers);
+		}
+	}
+
+	void deleteTextures(GLsizei n, const GLuint* textures)
+	{
+		glDeleteTextures(n, textures);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::DELETE_TEXTURES, n, textures);
+		}
+	}
+
+	void deleteBuffers(GLsizei n, const GLuint* buffers)
+	{
+		glDeleteBuffers(n, buffers);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::DELETE_BUFFERS, n, buffers);
+		}
+	}
+
+	void deleteVertexArrays(GLsizei n, const GLuint* arrays)
+	{
+		glDeleteVertexArrays(n, arrays);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::DELETE_VERTEX_ARRAYS, n, arrays);
+		}
+	}
+
+	void deleteFramebuffers(GLsizei n, const GLuint* framebuffers)
+	{
+		glDeleteFramebuffers(n, framebuffers);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::DELETE_FRAMEBUFFERS, n, framebuffers);
+		}
+	}
+
+	void deleteRenderbuffers(GLsizei n, const GLuint* renderbuffers)
+	{
+		glDeleteRenderbuffers(n, renderbuffers);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::DELETE_RENDERBUFFERS, n, renderbuffers);
+		}
+	}
+
+	GLuint createShader(GLenum type)
+	{
+		GLuint ret = glCreateShader(type);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::CREATE_SHADER, type, ret);
+		}
+		return ret;
+	}
+
+	GLuint createProgram()
+	{
+		GLuint ret = glCreateProgram();
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::CREATE_PROGRAM, ret);
+		}
+		return ret;
+	}
+
+	void deleteShader(GLuint shader)
+	{
+		glDeleteShader(shader);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::DELETE_SHADER, shader);
+		}
+	}
+
+	void deleteProgram(GLuint program)
+	{
+		glDeleteProgram(program);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::DELETE_PROGRAM, program);
+		}
+	}
+
+	GLsync fenceSync(GLenum condition, GLbitfield flags)
+	{
+		GLsync ret = glFenceSync(condition, flags);
+		if (s_state.isRecording)
+		{
+			// GLsync̓|C^Ȃ̂ŁAt@Cɂ͋L^n߂Ă̒ʂԍŏ
+			unsigned int syncId = s_state.nextSyncId++;
+			s_state.syncIds[ret] = syncId;
+			recordCommand(Opcode::FENCE_SYNC, condition, flags, syncId);
+		}
+		return ret;
+	}
+
+	GLenum clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+	{
+		GLenum ret = glClientWaitSync(sync, flags, timeout);
+		if (s_state.isRecording)
+		{
+			std::unordered_map<GLsync, unsigned int>::const_iterator it = s_state.syncIds.find(sync);
+			if (it != s_state.syncIds.end())
+			{
+				recordCommand(Opcode::CLIENT_WAIT_SYNC, it->second, flags, Word64{static_cast<unsigned long long>(timeout)});
+			}
+		}
+		return ret;
+	}
+
+	void deleteSync(GLsync sync)
+	{
+		glDeleteSync(sync);
+		if (s_state.isRecording)
+		{
+			std::unordered_map<GLsync, unsigned int>::const_iterator it = s_state.syncIds.find(sync);
+			if (it != s_state.syncIds.end())
+			{
+				recordCommand(Opcode::DELETE_SYNC, it->second);
+				s_state.syncIds.erase(it);
+			}
+		}
+	}
+
+	void bindTexture(GLenum target, GLuint texture)
+	{
+		glBindTexture(target, texture);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BIND_TEXTURE, target, texture);
+		}
+	}
+
+	void bindBuffer(GLenum target, GLuint buffer)
+	{
+		glBindBuffer(target, buffer);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BIND_BUFFER, target, buffer);
+		}
+	}
+
+	void bindVertexArray(GLuint array)
+	{
+		glBindVertexArray(array);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BIND_VERTEX_ARRAY, array);
+		}
+	}
+
+	void bindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		glBindFramebuffer(target, framebuffer);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BIND_FRAMEBUFFER, target, framebuffer);
+		}
+	}
+
+	void bindRenderbuffer(GLenum target, GLuint renderbuffer)
+	{
+		glBindRenderbuffer(target, renderbuffer);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BIND_RENDERBUFFER, target, renderbuffer);
+		}
+	}
+
+	void useProgram(GLuint program)
+	{
+		glUseProgram(program);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::USE_PROGRAM, program);
+		}
+	}
+
+	void activeTexture(GLenum texture)
+	{
+		glActiveTexture(texture);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::ACTIVE_TEXTURE, texture);
+		}
+	}
+
+	void enable(GLenum cap)
+	{
+		glEnable(cap);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::ENABLE, cap);
+		}
+	}
+
+	void disable(GLenum cap)
+	{
+		glDisable(cap);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::DISABLE, cap);
+		}
+	}
+
+	void cullFace(GLenum mode)
+	{
+		glCullFace(mode);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::CULL_FACE, mode);
+		}
+	}
+
+	void blendFunc(GLenum sfactor, GLenum dfactor)
+	{
+		glBlendFunc(sfactor, dfactor);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BLEND_FUNC, sfactor, dfactor);
+		}
+	}
+
+	void polygonMode(GLenum face, GLenum mode)
+	{
+		glPolygonMode(face, mode);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::POLYGON_MODE, face, mode);
+		}
+	}
+
+	void lineWidth(GLfloat width)
+	{
+		glLineWidth(width);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::LINE_WIDTH, width);
+		}
+	}
+
+	void viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		glViewport(x, y, width, height);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::VIEWPORT, x, y, width, height);
+		}
+	}
+
+	void clear(GLbitfield mask)
+	{
+		glClear(mask);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::CLEAR, mask);
+		}
+	}
+
+	void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+	{
+		glClearColor(red, green, blue, alpha);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::CLEAR_COLOR, red, green, blue, alpha);
+		}
+	}
+
+	void clearDepth(GLdouble depth)
+	{
+		glClearDepth(depth);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::CLEAR_DEPTH, depth);
+		}
+	}
+
+	void pixelStorei(GLenum pname, GLint param)
+	{
+		glPixelStorei(pname, param);
+		if (pname == GL_UNPACK_ALIGNMENT)
+		{
+			s_state.unpackAlignment = param;
+		}
+
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::PIXEL_STOREI, pname, param);
+		}
+	}
+
+	void texParameteri(GLenum target, GLenum pname, GLint param)
+	{
+		glTexParameteri(target, pname, param);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::TEX_PARAMETERI, target, pname, param);
+		}
+	}
+
+	void texParameterfv(GLenum target, GLenum pname, const GLfloat* params)
+	{
+		glTexParameterfv(target, pname, params);
+		if (s_state.isRecording)
+		{
+			unsigned int count = (pname == GL_TEXTURE_BORDER_COLOR) ? 4 : 1;
+			beginCommand(Opcode::TEX_PARAMETERFV);
+			pushArgument(target);
+			pushArgument(pname);
+			pushArgument(count);
+			pushFloats(params, count);
+			endCommand();
+		}
+	}
+
+	void drawBuffer(GLenum mode)
+	{
+		glDrawBuffer(mode);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::DRAW_BUFFER, mode);
+		}
+	}
+
+	void readBuffer(GLenum mode)
+	{
+		glReadBuffer(mode);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::READ_BUFFER, mode);
+		}
+	}
+
+	void drawBuffers(GLsizei n, const GLenum* bufs)
+	{
+		glDrawBuffers(n, bufs);
+		if (s_state.isRecording)
+		{
+			recordNames(Opcode::DRAW_BUFFERS, n, bufs);
+		}
+	}
+
+	void enableVertexAttribArray(GLuint index)
+	{
+		glEnableVertexAttribArray(index);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::ENABLE_VERTEX_ATTRIB_ARRAY, index);
+		}
+	}
+
+	void disableVertexAttribArray(GLuint index)
+	{
+		glDisableVertexAttribArray(index);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::DISABLE_VERTEX_ATTRIB_ARRAY, index);
+		}
+	}
+
+	void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+	{
+		glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+		if (s_state.isRecording)
+		{
+			// _GPŨobt@ɒuĂ̂ŁApointer̓oChobt@̐擪̃ItZbg
+			recordCommand(Opcode::VERTEX_ATTRIB_POINTER, index, size, type, static_cast<GLuint>(normalized), stride, toWord64(pointer));
+		}
+	}
+
+	void renderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+	{
+		glRenderbufferStorage(target, internalformat, width, height);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::RENDERBUFFER_STORAGE, target, internalformat, width, height);
+		}
+	}
+
+	void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+	{
+		glFramebufferTexture2D(target, attachment, textarget, texture, level);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::FRAMEBUFFER_TEXTURE_2D, target, attachment, textarget, texture, level);
+		}
+	}
+
+	void framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+	{
+		glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::FRAMEBUFFER_RENDERBUFFER, target, attachment, renderbuffertarget, renderbuffer);
+		}
+	}
+
+	void blitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+	{
+		glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BLIT_FRAMEBUFFER, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		}
+	}
+
+	void drawArrays(GLenum mode, GLint first, GLsizei count)
+	{
+		glDrawArrays(mode, first, count);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::DRAW_ARRAYS, mode, first, count);
+		}
+	}
+
+	void drawElements(GLenum mode, GLsizei count, GLenum type, const void* indices)
+	{
+		glDrawElements(mode, count, type, indices);
+		if (s_state.isRecording)
+		{
+			// CfbNXGPŨobt@ɒuĂ̂ŁAindices̓oChobt@̐擪̃ItZbg
+			recordCommand(Opcode::DRAW_ELEMENTS, mode, count, type, toWord64(indices));
+		}
+	}
+
+	void finish()
+	{
+		glFinish();
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::FINISH);
+		}
+	}
+
+	void shaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length)
+	{
+		glShaderSource(shader, count, string, length);
+		if (s_state.isRecording)
+		{
+			// ēnꂽ\[X͘A1̃uuɂ
+			std::string source;
+			for (GLsizei i = 0; i < count; i++)
+			{
+				if (length != nullptr && length[i] >= 0)
+				{
+					source.append(string[i], static_cast<size_t>(length[i]));
+				}
+				else
+				{
+					source.append(string[i]);
+				}
+			}
+
+			recordCommand(Opcode::SHADER_SOURCE, shader, addBlob(source.c_str(), source.size() + 1));
+		}
+	}
+
+	void compileShader(GLuint shader)
+	{
+		glCompileShader(shader);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::COMPILE_SHADER, shader);
+		}
+	}
+
+	void attachShader(GLuint program, GLuint shader)
+	{
+		glAttachShader(program, shader);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::ATTACH_SHADER, program, shader);
+		}
+	}
+
+	void bindAttribLocation(GLuint program, GLuint index, const GLchar* name)
+	{
+		glBindAttribLocation(program, index, name);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BIND_ATTRIB_LOCATION, program, index, addBlob(name, strlen(name) + 1));
+		}
+	}
+
+	void programParameteri(GLuint program, GLenum pname, GLint value)
+	{
+		glProgramParameteri(program, pname, value);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::PROGRAM_PARAMETERI, program, pname, value);
+		}
+	}
+
+	void linkProgram(GLuint program)
+	{
+		glLinkProgram(program);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::LINK_PROGRAM, program);
+		}
+	}
+
+	void programBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length)
+	{
+		glProgramBinary(program, binaryFormat, binary, length);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::PROGRAM_BINARY, program, binaryFormat, addBlob(binary, static_cast<size_t>(length)));
+		}
+	}
+
+	GLint getUniformLocation(GLuint program, const GLchar* name)
+	{
+		GLint ret = glGetUniformLocation(program, name);
+		if (s_state.isRecording && ret >= 0)
+		{
+			recordCommand(Opcode::GET_UNIFORM_LOCATION, program, addBlob(name, strlen(name) + 1), ret);
+		}
+		return ret;
+	}
+
+	void uniform1i(GLint location, GLint v0)
+	{
+		glUniform1i(location, v0);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::UNIFORM_1I, location, v0);
+		}
+	}
+
+	void uniform1f(GLint location, GLfloat v0)
+	{
+		glUniform1f(location, v0);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::UNIFORM_1F, location, v0);
+		}
+	}
+
+	void uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+	{
+		glUniform3f(location, v0, v1, v2);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::UNIFORM_3F, location, v0, v1, v2);
+		}
+	}
+
+	void uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+	{
+		glUniform4f(location, v0, v1, v2, v3);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::UNIFORM_4F, location, v0, v1, v2, v3);
+		}
+	}
+
+	void uniform3fv(GLint location, GLsizei count, const GLfloat* value)
+	{
+		glUniform3fv(location, count, value);
+		if (s_state.isRecording)
+		{
+			beginCommand(Opcode::UNIFORM_3FV);
+			pushArgument(location);
+			pushArgument(count);
+			pushFloats(value, static_cast<size_t>(count) * 3);
+			endCommand();
+		}
+	}
+
+	void uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+	{
+		glUniformMatrix4fv(location, count, transpose, value);
+		if (s_state.isRecording)
+		{
+			beginCommand(Opcode::UNIFORM_MATRIX_4FV);
+			pushArgument(location);
+			pushArgument(count);
+			pushArgument(static_cast<GLuint>(transpose));
+			pushFloats(value, static_cast<size_t>(count) * 16);
+			endCommand();
+		}
+	}
+
+	void bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		glBufferData(target, size, data, usage);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BUFFER_DATA, target, toWord64(size), usage, addBlob(data, static_cast<size_t>(size)));
+		}
+	}
+
+	void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		glBufferSubData(target, offset, size, data);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BUFFER_SUB_DATA, target, toWord64(offset), addBlob(data, static_cast<size_t>(size)));
+		}
+	}
+
+	void bufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+	{
+		glBufferStorage(target, size, data, flags);
+		if (s_state.isRecording)
+		{
+			recordCommand(Opcode::BUFFER_STORAGE, target, toWord64(size), flags, addBlob(data, static_cast<size_t>(size)));
+		}
+	}
+
+	void* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		void* ret = glMapBufferRange(target, offset, length, access);
+		if (s_state.isRecording && ret != nullptr)
+		{
+			Mapping mapping;
+			mapping.data = static_cast<const unsigned char*>(ret);
+			mapping.length = static_cast<size_t>(length);
+			mapping.buffer = getBoundBuffer(target);
+			s_state.mappings.push_back(mapping);
+
+			recordCommand(Opcode::MAP_BUFFER_RANGE, target, mapping.buffer, toWord64(offset), toWord64(length), access);
+		}
+		return ret;
+	}
+
+	GLboolean unmapBuffer(GLenum target)
+	{
+		GLuint buffer = s_state.isRecording ? getBoundBuffer(target) : 0;
+		GLboolean ret = glUnmapBuffer(target);
+		if (s_state.isRecording)
+		{
+			for (std::vector<Mapping>::iterator it = s_state.mappings.begin(); it != s_state.mappings.end(); ++it)
+			{
+				if (it->buffer == buffer)
+				{
+					s_state.mappings.erase(it);
+					break;
+				}
+			}
+
+			recordCommand(Opcode::UNMAP_BUFFER, target, buffer);
+		}
+		return ret;
+	}
+
+	void texImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels)
+	{
+		glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		if (s_state.isRecording)
+		{
+			unsigned int blob = addBlob(pixels, calculateImageByteSize(width, height, format, type));
+			recordCommand(Opcode::TEX_IMAGE_2D, target, level, internalformat, width, height, border, format, type, blob);
+		}
+	}
+
+	void texSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels)
+	{
+		glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+		if (s_state.isRecording)
+		{
+			unsigned int blob = addBlob(pixels, calculateImageByteSize(width, height, format, type));
+			recordCommand(Opcode::TEX_SUB_IMAGE_2D, target, level, xoffset, yoffset, width, height, format, type, blob);
+		}
+	}
+} // namespace GLCommandRecorder
+
+} // namespace mgrrenderer
+#endif // defined(MGRRENDERER_ENABLE_GL_CAPTURE)
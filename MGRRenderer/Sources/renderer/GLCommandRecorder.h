@@ -0,0 +1,256 @@
+#pragma once
+#include "GLHeader.h"
+#include <string>
+
+#if defined(MGRRENDERER_ENABLE_GL_CAPTURE)
+namespace mgrrenderer
+{
+
+// `ŎgOpenGĽĂяo肵āAGLCaptureFormať`ŋL^BMGRReplayœǂݍŁAScenȅ܂ɓĂяoĐ
+// CustomRenderCommand̃_̓m[h̏Ԃ𒼐ڎQƂĂĒlƂĕۑłȂ̂ŁǍʂƂĔsGĽĂяo̕L^
+// L^ĂȂƂ͌ĂяoƂɃtO1񌩂邾
+// rL^n߂ƁA܂łɍeNX`obt@ĐōȂ̂ŁAOpenGL̃IuWFNgObeginĂԂ
+// static\bhȂ̂ŃNXĂȂ
+namespace GLCommandRecorder
+{
+	// width, height̓ftHgt[obt@̃TCYBĐœTCỸReLXg
+	void begin(unsigned int width, unsigned int height);
+	bool isRecording();
+	// 1t[̌Ăяo؂BĐł͍Ō̃t[JԂŝŁAt[̕`悪SIɌĂ
+	void endFrame();
+	// L^~߂āAendFrameŋ؂t[filePathɏo
+	bool end(const std::string& filePath);
+	// glMapBufferRangeŃ}bv̈CPU珑񂾂ƂL^Bdata̓}bv̈̒wĂ邱
+	void recordMappedWrite(const void* data, size_t size);
+
+	void genTextures(GLsizei n, GLuint* textures);
+	void genBuffers(GLsizei n, GLuint* buffers);
+	void genVertexArrays(GLsizei n, GLuint* arrays);
+	void genFramebuffers(GLsizei n, GLuint* framebuffers);
+	void genRenderbuffers(GLsizei n, GLuint* renderbuffers);
+	void deleteTextures(GLsizei n, const GLuint* textures);
+	void deleteBuffers(GLsizei n, const GLuint* buffers);
+	void deleteVertexArrays(GLsizei n, const GLuint* arrays);
+	void deleteFramebuffers(GLsizei n, const GLuint* framebuffers);
+	void deleteRenderbuffers(GLsizei n, const GLuint* renderbuffers);
+	GLuint createShader(GLenum type);
+	GLuint createProgram();
+	void deleteShader(GLuint shader);
+	void deleteProgram(GLuint program);
+	GLsync fenceSync(GLenum condition, GLbitfield flags);
+	GLenum clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout);
+	void deleteSync(GLsync sync);
+
+	void bindTexture(GLenum target, GLuint texture);
+	void bindBuffer(GLenum target, GLuint buffer);
+	void bindVertexArray(GLuint array);
+	void bindFramebuffer(GLenum target, GLuint framebuffer);
+	void bindRenderbuffer(GLenum target, GLuint renderbuffer);
+	void useProgram(GLuint program);
+	void activeTexture(GLenum texture);
+	void enable(GLenum cap);
+	void disable(GLenum cap);
+	void cullFace(GLenum mode);
+	void blendFunc(GLenum sfactor, GLenum dfactor);
+	void polygonMode(GLenum face, GLenum mode);
+	void lineWidth(GLfloat width);
+	void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+	void clear(GLbitfield mask);
+	void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+	void clearDepth(GLdouble depth);
+	void pixelStorei(GLenum pname, GLint param);
+	void texParameteri(GLenum target, GLenum pname, GLint param);
+	void texParameterfv(GLenum target, GLenum pname, const GLfloat* params);
+	void drawBuffer(GLenum mode);
+	void readBuffer(GLenum mode);
+	void drawBuffers(GLsizei n, const GLenum* bufs);
+	void enableVertexAttribArray(GLuint index);
+	void disableVertexAttribArray(GLuint index);
+	void vertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer);
+	void renderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height);
+	void framebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+	void framebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer);
+	void blitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter);
+	void drawArrays(GLenum mode, GLint first, GLsizei count);
+	void drawElements(GLenum mode, GLsizei count, GLenum type, const void* indices);
+	void finish();
+
+	void shaderSource(GLuint shader, GLsizei count, const GLchar* const* string, const GLint* length);
+	void compileShader(GLuint shader);
+	void attachShader(GLuint program, GLuint shader);
+	void bindAttribLocation(GLuint program, GLuint index, const GLchar* name);
+	void programParameteri(GLuint program, GLenum pname, GLint value);
+	void linkProgram(GLuint program);
+	void programBinary(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+	GLint getUniformLocation(GLuint program, const GLchar* name);
+
+	void uniform1i(GLint location, GLint v0);
+	void uniform1f(GLint location, GLfloat v0);
+	void uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+	void uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+	void uniform3fv(GLint location, GLsizei count, const GLfloat* value);
+	void uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+
+	void bufferData(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+	void bufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data);
+	void bufferStorage(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+	void* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+	GLboolean unmapBuffer(GLenum target);
+	void texImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void* pixels);
+	void texSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void* pixels);
+} // namespace GLCommandRecorder
+
+} // namespace mgrrenderer
+
+// ȍ~glXXX̌ĂяoGLCommandRecorderɌBGLEWłglXXX}NȂ̂ňxĂ`
+// GLCommandRecordergƁAL^GL𒼐ڌĂMGRReplayMGRRENDERER_CALL_GL_DIRECTLY`ČȂ悤ɂ
+// glGetXXX̂悤Ȗ₢킹͕`̏ԂςȂ̂ŋL^Ȃ
+#if !defined(MGRRENDERER_CALL_GL_DIRECTLY)
+#undef glGenTextures
+#define glGenTextures ::mgrrenderer::GLCommandRecorder::genTextures
+#undef glGenBuffers
+#define glGenBuffers ::mgrrenderer::GLCommandRecorder::genBuffers
+#undef glGenVertexArrays
+#define glGenVertexArrays ::mgrrenderer::GLCommandRecorder::genVertexArrays
+#undef glGenFramebuffers
+#define glGenFramebuffers ::mgrrenderer::GLCommandRecorder::genFramebuffers
+#undef glGenRenderbuffers
+#define glGenRenderbuffers ::mgrrenderer::GLCommandRecorder::genRenderbuffers
+#undef glDeleteTextures
+#define glDeleteTextures ::mgrrenderer::GLCommandRecorder::deleteTextures
+#undef glDeleteBuffers
+#define glDeleteBuffers ::mgrrenderer::GLCommandRecorder::deleteBuffers
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays ::mgrrenderer::GLCommandRecorder::deleteVertexArrays
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers ::mgrrenderer::GLCommandRecorder::deleteFramebuffers
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers ::mgrrenderer::GLCommandRecorder::deleteRenderbuffers
+#undef glCreateShader
+#define glCreateShader ::mgrrenderer::GLCommandRecorder::createShader
+#undef glCreateProgram
+#define glCreateProgram ::mgrrenderer::GLCommandRecorder::createProgram
+#undef glDeleteShader
+#define glDeleteShader ::mgrrenderer::GLCommandRecorder::deleteShader
+#undef glDeleteProgram
+#define glDeleteProgram ::mgrrenderer::GLCommandRecorder::deleteProgram
+#undef glFenceSync
+#define glFenceSync ::mgrrenderer::GLCommandRecorder::fenceSync
+#undef glClientWaitSync
+#define glClientWaitSync ::mgrrenderer::GLCommandRecorder::clientWaitSync
+#undef glDeleteSync
+#define glDeleteSync ::mgrrenderer::GLCommandRecorder::deleteSync
+
+#undef glBindTexture
+#define glBindTexture ::mgrrenderer::GLCommandRecorder::bindTexture
+#undef glBindBuffer
+#define glBindBuffer ::mgrrenderer::GLCommandRecorder::bindBuffer
+#undef glBindVertexArray
+#define glBindVertexArray ::mgrrenderer::GLCommandRecorder::bindVertexArray
+#undef glBindFramebuffer
+#define glBindFramebuffer ::mgrrenderer::GLCommandRecorder::bindFramebuffer
+#undef glBindRenderbuffer
+#define glBindRenderbuffer ::mgrrenderer::GLCommandRecorder::bindRenderbuffer
+#undef glUseProgram
+#define glUseProgram ::mgrrenderer::GLCommandRecorder::useProgram
+#undef glActiveTexture
+#define glActiveTexture ::mgrrenderer::GLCommandRecorder::activeTexture
+#undef glEnable
+#define glEnable ::mgrrenderer::GLCommandRecorder::enable
+#undef glDisable
+#define glDisable ::mgrrenderer::GLCommandRecorder::disable
+#undef glCullFace
+#define glCullFace ::mgrrenderer::GLCommandRecorder::cullFace
+#undef glBlendFunc
+#define glBlendFunc ::mgrrenderer::GLCommandRecorder::blendFunc
+#undef glPolygonMode
+#define glPolygonMode ::mgrrenderer::GLCommandRecorder::polygonMode
+#undef glLineWidth
+#define glLineWidth ::mgrrenderer::GLCommandRecorder::lineWidth
+#undef glViewport
+#define glViewport ::mgrrenderer::GLCommandRecorder::viewport
+#undef glClear
+#define glClear ::mgrrenderer::GLCommandRecorder::clear
+#undef glClearColor
+#define glClearColor ::mgrrenderer::GLCommandRecorder::clearColor
+#undef glClearDepth
+#define glClearDepth ::mgrrenderer::GLCommandRecorder::clearDepth
+#undef glPixelStorei
+#define glPixelStorei ::mgrrenderer::GLCommandRecorder::pixelStorei
+#undef glTexParameteri
+#define glTexParameteri ::mgrrenderer::GLCommandRecorder::texParameteri
+#undef glTexParameterfv
+#define glTexParameterfv ::mgrrenderer::GLCommandRecorder::texParameterfv
+#undef glDrawBuffer
+#define glDrawBuffer ::mgrrenderer::GLCommandRecorder::drawBuffer
+#undef glReadBuffer
+#define glReadBuffer ::mgrrenderer::GLCommandRecorder::readBuffer
+#undef glDrawBuffers
+#define glDrawBuffers ::mgrrenderer::GLCommandRecorder::drawBuffers
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray ::mgrrenderer::GLCommandRecorder::enableVertexAttribArray
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray ::mgrrenderer::GLCommandRecorder::disableVertexAttribArray
+#undef glVertexAttribPointer
+#define glVertexAttribPointer ::mgrrenderer::GLCommandRecorder::vertexAttribPointer
+#undef glRenderbufferStorage
+#define glRenderbufferStorage ::mgrrenderer::GLCommandRecorder::renderbufferStorage
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D ::mgrrenderer::GLCommandRecorder::framebufferTexture2D
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer ::mgrrenderer::GLCommandRecorder::framebufferRenderbuffer
+#undef glBlitFramebuffer
+#define glBlitFramebuffer ::mgrrenderer::GLCommandRecorder::blitFramebuffer
+#undef glDrawArrays
+#define glDrawArrays ::mgrrenderer::GLCommandRecorder::drawArrays
+#undef glDrawElements
+#define glDrawElements ::mgrrenderer::GLCommandRecorder::drawElements
+#undef glFinish
+#define glFinish ::mgrrenderer::GLCommandRecorder::finish
+
+#undef glShaderSource
+#define glShaderSource ::mgrrenderer::GLCommandRecorder::shaderSource
+#undef glCompileShader
+#define glCompileShader ::mgrrenderer::GLCommandRecorder::compileShader
+#undef glAttachShader
+#define glAttachShader ::mgrrenderer::GLCommandRecorder::attachShader
+#undef glBindAttribLocation
+#define glBindAttribLocation ::mgrrenderer::GLCommandRecorder::bindAttribLocation
+#undef glProgramParameteri
+#define glProgramParameteri ::mgrrenderer::GLCommandRecorder::programParameteri
+#undef glLinkProgram
+#define glLinkProgram ::mgrrenderer::GLCommandRecorder::linkProgram
+#undef glProgramBinary
+#define glProgramBinary ::mgrrenderer::GLCommandRecorder::programBinary
+#undef glGetUniformLocation
+#define glGetUniformLocation ::mgrrenderer::GLCommandRecorder::getUniformLocation
+
+#undef glUniform1i
+#define glUniform1i ::mgrrenderer::GLCommandRecorder::uniform1i
+#undef glUniform1f
+#define glUniform1f ::mgrrenderer::GLCommandRecorder::uniform1f
+#undef glUniform3f
+#define glUniform3f ::mgrrenderer::GLCommandRecorder::uniform3f
+#undef glUniform4f
+#define glUniform4f ::mgrrenderer::GLCommandRecorder::uniform4f
+#undef glUniform3fv
+#define glUniform3fv ::mgrrenderer::GLCommandRecorder::uniform3fv
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv ::mgrrenderer::GLCommandRecorder::uniformMatrix4fv
+
+#undef glBufferData
+#define glBufferData ::mgrrenderer::GLCommandRecorder::bufferData
+#undef glBufferSubData
+#define glBufferSubData ::mgrrenderer::GLCommandRecorder::bufferSubData
+#undef glBufferStorage
+#define glBufferStorage ::mgrrenderer::GLCommandRecorder::bufferStorage
+#undef glMapBufferRange
+#define glMapBufferRange ::mgrrenderer::GLCommandRecorder::mapBufferRange
+#undef glUnmapBuffer
+#define glUnmapBuffer ::mgrrenderer::GLCommandRecorder::unmapBuffer
+#undef glTexImage2D
+#define glTexImage2D ::mgrrenderer::GLCommandRecorder::texImage2D
+#undef glTexSubImage2D
+#define glTexSubImage2D ::mgrrenderer::GLCommandRecorder::texSubImage2D
+#endif // !defined(MGRRENDERER_CALL_GL_DIRECTLY)
+#endif // defined(MGRRENDERER_ENABLE_GL_CAPTURE)
@@ -3,8 +3,7 @@
 #include "Config.h"
 #include <vector>
 #if defined(MGRRENDERER_USE_OPENGL)
-#define GLEW_STATIC
-#include <glew/include/glew.h>
+#include "GLHeader.h"
 #include "BasicDataTypes.h"
 
 namespace mgrrenderer
@@ -0,0 +1,18 @@
+#pragma once
+#include "Config.h"
+
+#if defined(MGRRENDERER_USE_OPENGL)
+// WindowsłGLEWŊg֐ǂݍށBȊOłlibGL(MesaȂ)JĂvg^Cv̂܂܎g
+#if defined(_WIN32)
+#define GLEW_STATIC
+#include <glew/include/glew.h>
+#else
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#endif
+
+#if defined(MGRRENDERER_ENABLE_GL_CAPTURE)
+#include "GLCommandRecorder.h"
+#endif
+#endif // defined(MGRRENDERER_USE_OPENGL)
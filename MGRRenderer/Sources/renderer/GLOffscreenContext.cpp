@@ -0,0 +1,150 @@
+#include "GLOffscreenContext.h"
+
+#if defined(MGRRENDERER_USE_OPENGL) && !defined(_WIN32)
+#include "utility/Logger.h"
+#include <EGL/eglext.h>
+
+namespace mgrrenderer
+{
+
+GLOffscreenContext::GLOffscreenContext() :
+_display(EGL_NO_DISPLAY),
+_surface(EGL_NO_SURFACE),
+_context(EGL_NO_CONTEXT)
+{
+}
+
+GLOffscreenContext::~GLOffscreenContext()
+{
+	destroy();
+}
+
+bool GLOffscreenContext::init(const SizeUint& size)
+{
+	destroy();
+
+	// surfacelessvbgtH[ȂX11Wayland̃fBXvCT[oȂĂgBgȂ΃ftHg̃fBXvCŎ
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+	if (getPlatformDisplay != nullptr)
+	{
+		_display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+	}
+
+	if (_display == EGL_NO_DISPLAY)
+	{
+		_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+
+	if (_display == EGL_NO_DISPLAY)
+	{
+		Logger::log("EGLfBXvC̎擾Ɏs");
+		return false;
+	}
+
+	EGLint majorVersion = 0;
+	EGLint minorVersion = 0;
+	if (eglInitialize(_display, &majorVersion, &minorVersion) == EGL_FALSE)
+	{
+		Logger::log("EGL̏Ɏs eglGetError()=0x%x", eglGetError());
+		_display = EGL_NO_DISPLAY;
+		return false;
+	}
+
+	Logger::log("EGL version:%d.%d vendor:%s", majorVersion, minorVersion, eglQueryString(_display, EGL_VENDOR));
+
+	// Windowsł̃EBhẼftHgt[obt@Ɠ\ɂ
+	const EGLint configAttributes[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8,
+		EGL_GREEN_SIZE, 8,
+		EGL_BLUE_SIZE, 8,
+		EGL_ALPHA_SIZE, 8,
+		EGL_DEPTH_SIZE, 24,
+		EGL_STENCIL_SIZE, 8,
+		EGL_NONE,
+	};
+
+	EGLConfig config = nullptr;
+	EGLint numConfigs = 0;
+	if (eglChooseConfig(_display, configAttributes, &config, 1, &numConfigs) == EGL_FALSE || numConfigs == 0)
+	{
+		Logger::log("EGL̃RtBOȂ eglGetError()=0x%x", eglGetError());
+		destroy();
+		return false;
+	}
+
+	const EGLint surfaceAttributes[] = {
+		EGL_WIDTH, static_cast<EGLint>(size.width),
+		EGL_HEIGHT, static_cast<EGLint>(size.height),
+		EGL_NONE,
+	};
+
+	_surface = eglCreatePbufferSurface(_display, config, surfaceAttributes);
+	if (_surface == EGL_NO_SURFACE)
+	{
+		Logger::log("pbuffer̍쐬Ɏs eglGetError()=0x%x", eglGetError());
+		destroy();
+		return false;
+	}
+
+	if (eglBindAPI(EGL_OPENGL_API) == EGL_FALSE)
+	{
+		Logger::log("OpenGL APIoChłȂ eglGetError()=0x%x", eglGetError());
+		destroy();
+		return false;
+	}
+
+	// VF[_#version 430 compatibilityŏĂ̂ŁA4.3ȏ̃Rp`reBvt@CvBWindowsłGLFW̃ftHg
+	const EGLint contextAttributes[] = {
+		EGL_CONTEXT_MAJOR_VERSION, 4,
+		EGL_CONTEXT_MINOR_VERSION, 3,
+		EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT,
+		EGL_NONE,
+	};
+
+	_context = eglCreateContext(_display, config, EGL_NO_CONTEXT, contextAttributes);
+	if (_context == EGL_NO_CONTEXT)
+	{
+		Logger::log("OpenGLReLXg̍쐬Ɏs eglGetError()=0x%x", eglGetError());
+		destroy();
+		return false;
+	}
+
+	if (eglMakeCurrent(_display, _surface, _surface, _context) == EGL_FALSE)
+	{
+		Logger::log("OpenGLReLXgJgɂłȂ eglGetError()=0x%x", eglGetError());
+		destroy();
+		return false;
+	}
+
+	return true;
+}
+
+void GLOffscreenContext::destroy()
+{
+	if (_display == EGL_NO_DISPLAY)
+	{
+		return;
+	}
+
+	eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+	if (_context != EGL_NO_CONTEXT)
+	{
+		eglDestroyContext(_display, _context);
+		_context = EGL_NO_CONTEXT;
+	}
+
+	if (_surface != EGL_NO_SURFACE)
+	{
+		eglDestroySurface(_display, _surface);
+		_surface = EGL_NO_SURFACE;
+	}
+
+	eglTerminate(_display);
+	_display = EGL_NO_DISPLAY;
+}
+
+} // namespace mgrrenderer
+#endif // defined(MGRRENDERER_USE_OPENGL) && !defined(_WIN32)
@@ -0,0 +1,30 @@
+#pragma once
+#include "Config.h"
+
+#if defined(MGRRENDERER_USE_OPENGL) && !defined(_WIN32)
+#include "BasicDataTypes.h"
+#include <EGL/egl.h>
+
+namespace mgrrenderer
+{
+
+// EBhE炸OpenGL̃ReLXgBGPÛȂLinuxT[ołMesallvmpipeŎۂOpenGL̕`pX𓮂Av摜r邽
+// EGLsurfacelessvbgtH[ŏAEBhETCYpbufferftHgt[obt@ƂĎg
+class GLOffscreenContext final
+{
+public:
+	GLOffscreenContext();
+	~GLOffscreenContext();
+	// ƃReLXgĂяoXbhŃJgɂ
+	bool init(const SizeUint& size);
+
+private:
+	EGLDisplay _display;
+	EGLSurface _surface;
+	EGLContext _context;
+
+	void destroy();
+};
+
+} // namespace mgrrenderer
+#endif // defined(MGRRENDERER_USE_OPENGL) && !defined(_WIN32)
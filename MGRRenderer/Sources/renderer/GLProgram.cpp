@@ -2,11 +2,18 @@
 #if defined(MGRRENDERER_USE_OPENGL)
 #include "utility/Logger.h"
 #include "utility/FileUtility.h"
+#include "node/Light.h"
+#include "ShaderCache.h"
+#include "ShaderPermutation.h"
+#include <stdio.h>
+#include <string.h>
 #include <string>
 
 namespace mgrrenderer
 {
 
+static_assert(GLProgram::TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP + PointLight::MAX_NUM <= GLProgram::TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP, "|CgCg̃VhE}bṽjbgX|bgCĝ̂ƏdȂĂB");
+
 // TODO:ɒû܂肢Ƃ͎vȂƂ肠
 static const std::string ATTRIBUTE_NAME_POSITION = "a_position";
 static const std::string ATTRIBUTE_NAME_COLOR = "a_color";
@@ -18,18 +25,77 @@ static const std::string ATTRIBUTE_NAME_NORMAL = "a_normal";
 static const std::string ATTRIBUTE_NAME_BLEND_WEIGHT = "a_blendWeight";
 static const std::string ATTRIBUTE_NAME_BLEND_INDEX = "a_blendIndex";
 
-const std::string GLProgram::UNIFORM_NAME_RENDER_MODE = "u_renderMode";
-const std::string GLProgram::UNIFORM_NAME_MULTIPLE_COLOR = "u_multipleColor";
-const std::string GLProgram::UNIFORM_NAME_TEXTURE_SAMPLER = "u_texture";
-const std::string GLProgram::UNIFORM_NAME_MODEL_MATRIX = "u_modelMatrix";
-const std::string GLProgram::UNIFORM_NAME_VIEW_MATRIX = "u_viewMatrix";
-const std::string GLProgram::UNIFORM_NAME_NORMAL_MATRIX = "u_normalMatrix";
-const std::string GLProgram::UNIFORM_NAME_PROJECTION_MATRIX = "u_projectionMatrix";
-const std::string GLProgram::UNIFORM_NAME_CUBEMAP_FACE = "u_cubeMapFace";
+static const std::string ATTRIBUTE_NAME_POINT_SIZE = "a_pointSize";
+static const std::string ATTRIBUTE_NAME_INIT_VELOCITY = "a_initVelocity";
+static const std::string ATTRIBUTE_NAME_ELAPSED_TIME = "a_elapsedTime";
+
+// UniformID̏ɕׂBz^̕ϐ͗vfA2z2ڂ̓Y̗vfw肷
+static const struct UniformDesc {
+	const char* name;
+	size_t numElements0;
+	size_t numElements1;
+} UNIFORM_DESCS[] =
+{
+	{"u_renderMode", 1, 1},
+	{"u_multipleColor", 1, 1},
+	{"u_texture", 1, 1},
+	{"u_modelMatrix", 1, 1},
+	{"u_viewMatrix", 1, 1},
+	{"u_normalMatrix", 1, 1},
+	{"u_projectionMatrix", 1, 1},
+	{"u_cubeMapFace", 1, 1},
+	{"u_depthBiasMatrix", 1, 1},
+	{"u_viewInverse", 1, 1},
+	{"u_cameraPosition", 1, 1},
+	{"u_nearClipZ", 1, 1},
+	{"u_farClipZ", 1, 1},
+	{"u_lightViewMatrix", 1, 1},
+	{"u_lightProjectionMatrix", 1, 1},
+	{"u_depthTextureProjection", 1, 1},
+	{"u_depthTextureProjectionMatrix", 1, 1},
+	{"u_matrixPalette", 1, 1},
+	{"u_materialAmbient", 1, 1},
+	{"u_materialDiffuse", 1, 1},
+	{"u_materialSpecular", 1, 1},
+	{"u_materialShininess", 1, 1},
+	{"u_gBufferColorSpecularIntensity", 1, 1},
+	{"u_gBufferNormal", 1, 1},
+	{"u_gBufferSpecularPower", 1, 1},
+	{"u_gBufferDepthStencil", 1, 1},
+	{"u_ambientLightColor", 1, 1},
+	{"u_directionalLightIsValid", 1, 1},
+	{"u_directionalLightColor", 1, 1},
+	{"u_directionalLightDirection", 1, 1},
+	{"u_directionalLightHasShadowMap", 1, 1},
+	{"u_directionalLightViewMatrix", 1, 1},
+	{"u_directionalLightProjectionMatrix", 1, 1},
+	{"u_directionalLightShadowMap", 1, 1},
+	{"u_pointLightIsValid", PointLight::MAX_NUM, 1},
+	{"u_pointLightColor", PointLight::MAX_NUM, 1},
+	{"u_pointLightPosition", PointLight::MAX_NUM, 1},
+	{"u_pointLightRangeInverse", PointLight::MAX_NUM, 1},
+	{"u_pointLightHasShadowMap", PointLight::MAX_NUM, 1},
+	{"u_pointLightViewMatrices", (size_t)CubeMapFace::NUM_CUBEMAP_FACE, PointLight::MAX_NUM},
+	{"u_pointLightProjectionMatrix", PointLight::MAX_NUM, 1},
+	{"u_pointLightShadowCubeMap", PointLight::MAX_NUM, 1},
+	{"u_spotLightIsValid", SpotLight::MAX_NUM, 1},
+	{"u_spotLightColor", SpotLight::MAX_NUM, 1},
+	{"u_spotLightPosition", SpotLight::MAX_NUM, 1},
+	{"u_spotLightDirection", SpotLight::MAX_NUM, 1},
+	{"u_spotLightRangeInverse", SpotLight::MAX_NUM, 1},
+	{"u_spotLightInnerAngleCos", SpotLight::MAX_NUM, 1},
+	{"u_spotLightOuterAngleCos", SpotLight::MAX_NUM, 1},
+	{"u_spotLightHasShadowMap", SpotLight::MAX_NUM, 1},
+	{"u_spotLightViewMatrix", SpotLight::MAX_NUM, 1},
+	{"u_spotLightProjectionMatrix", SpotLight::MAX_NUM, 1},
+	{"u_spotLightShadowMap", SpotLight::MAX_NUM, 1},
+	{"u_pointSize", 1, 1},
+	{"u_lifeTime", 1, 1},
+	{"u_gravity", 1, 1},
+};
+static_assert(sizeof(UNIFORM_DESCS) / sizeof(UNIFORM_DESCS[0]) == static_cast<size_t>(GLProgram::UniformID::NUM_UNIFORM_IDS), "UNIFORM_DESCSUniformID̐svB");
 
 GLProgram::GLProgram() :
-_vertexShader(0),
-_fragmentShader(0),
 _shaderProgram(0)
 {
 }
@@ -41,19 +107,7 @@ GLProgram::~GLProgram()
 
 	if (_shaderProgram > 0)
 	{
-		glDeleteProgram(_shaderProgram);
-		GLProgram::checkGLError();
-	}
-
-	if (_vertexShader > 0)
-	{
-		glDeleteShader(_vertexShader);
-		GLProgram::checkGLError();
-	}
-
-	if (_fragmentShader > 0)
-	{
-		glDeleteShader(_fragmentShader);
+		ShaderCache::getInstance()->releaseProgram(_shaderProgram);
 		GLProgram::checkGLError();
 	}
 }
@@ -66,40 +120,65 @@ void GLProgram::checkGLError()
 	Logger::logAssert(_glError == GL_NO_ERROR, "OpenGLŃG[ glGetError()=%d", _glError);
 }
 
+bool GLProgram::isExtensionSupported(const char* extensionName)
+{
+#if defined(_WIN32)
+	return glewIsSupported(extensionName) != GL_FALSE;
+#else
+	GLint numExtensions = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+	for (GLint i = 0; i < numExtensions; i++)
+	{
+		if (strcmp(reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i))), extensionName) == 0)
+		{
+			return true;
+		}
+	}
+
+	return false;
+#endif
+}
+
 void GLProgram::initWithShaderString(const GLchar* vertexShaderStr, const GLchar* fragmentShaderStr)
 {
-	_vertexShader = createVertexShader(vertexShaderStr);
-	_fragmentShader = createFragmentShader(fragmentShaderStr);
-	_shaderProgram = createShaderProgram(_vertexShader, _fragmentShader);
+	// \[X̃vOShaderCacheŋL
+	_shaderProgram = ShaderCache::getInstance()->getProgram(vertexShaderStr, fragmentShaderStr);
+
+	// P[V̓NăvOłȂƎ擾s
+	parseUniforms(_shaderProgram);
+	bindShadowMapTextureUnits(_shaderProgram);
+}
+
+GLuint GLProgram::createShaderProgram(const GLchar* vertexShaderStr, const GLchar* fragmentShaderStr)
+{
+	GLuint vertexShader = createVertexShader(vertexShaderStr);
+	GLuint fragmentShader = createFragmentShader(fragmentShaderStr);
+	GLuint ret = linkShaderProgram(vertexShader, fragmentShader);
 
 	// ̎_Ńo[ebNXVF[_ƃtOgVF[_IuWFNg͉
-	if (_vertexShader > 0)
+	if (vertexShader > 0)
 	{
-		glDeleteShader(_vertexShader);
+		glDeleteShader(vertexShader);
 		GLProgram::checkGLError();
 	}
 
-	if (_fragmentShader > 0)
+	if (fragmentShader > 0)
 	{
-		glDeleteShader(_fragmentShader);
+		glDeleteShader(fragmentShader);
 		GLProgram::checkGLError();
 	}
 
-	_vertexShader = _fragmentShader = 0;
-
-	// GL_ACTIVE_XXn̓NăvOłȂƎ擾s
-	parseAttributes(_shaderProgram);
-	parseUniforms(_shaderProgram);
+	return ret;
 }
 
-void GLProgram::initWithShaderFile(const std::string& vertexShaderFile, const std::string& fragmentShaderFile)
+void GLProgram::initWithShaderFile(const std::string& vertexShaderFile, const std::string& fragmentShaderFile, unsigned int features /* = 0 */)
 {
-	const std::string& vertexShaderStr = FileUtility::getInstance()->getStringFromFile(vertexShaderFile);
-	const std::string& fragmentShaderStr = FileUtility::getInstance()->getStringFromFile(fragmentShaderFile);
+	const std::string& vertexShaderStr = ShaderPermutation::createGLSLSource(FileUtility::getInstance()->getStringFromFile(vertexShaderFile), features);
+	const std::string& fragmentShaderStr = ShaderPermutation::createGLSLSource(FileUtility::getInstance()->getStringFromFile(fragmentShaderFile), features);
 	return initWithShaderString(vertexShaderStr.c_str(), fragmentShaderStr.c_str());
 }
 
-GLuint GLProgram::createVertexShader(const GLchar* source) const
+GLuint GLProgram::createVertexShader(const GLchar* source)
 {
 	GLuint ret = glCreateShader(GL_VERTEX_SHADER);
 	Logger::logAssert(ret != 0, "VF[_쐬s");
@@ -119,7 +198,7 @@ GLuint GLProgram::createVertexShader(const GLchar* source) const
 	return ret;
 }
 
-GLuint GLProgram::createFragmentShader(const GLchar* source) const
+GLuint GLProgram::createFragmentShader(const GLchar* source)
 {
 	GLuint ret = glCreateShader(GL_FRAGMENT_SHADER);
 	Logger::logAssert(ret != 0, "VF[_vO쐬sB");
@@ -139,7 +218,7 @@ GLuint GLProgram::createFragmentShader(const GLchar* source) const
 	return ret;
 }
 
-GLint GLProgram::compileShader(GLuint shader, const GLchar* source) const
+GLint GLProgram::compileShader(GLuint shader, const GLchar* source)
 {
 	glShaderSource(shader, 1, &source, nullptr);
 	glCompileShader(shader);
@@ -166,7 +245,7 @@ GLint GLProgram::compileShader(GLuint shader, const GLchar* source) const
 	return compileResult;
 }
 
-GLuint GLProgram::createShaderProgram(const GLuint vertexShader, const GLuint fragmentShader)
+GLuint GLProgram::linkShaderProgram(const GLuint vertexShader, const GLuint fragmentShader)
 {
 	GLuint ret = glCreateProgram();
 	Logger::logAssert(ret != 0, "VF[_vOs");
@@ -196,6 +275,9 @@ GLuint GLProgram::createShaderProgram(const GLuint vertexShader, const GLuint fr
 		{ATTRIBUTE_NAME_NORMAL, AttributeLocation::NORMAL},
 		{ATTRIBUTE_NAME_BLEND_WEIGHT, AttributeLocation::BLEND_WEIGHT},
 		{ATTRIBUTE_NAME_BLEND_INDEX, AttributeLocation::BLEND_INDEX},
+		{ATTRIBUTE_NAME_POINT_SIZE, AttributeLocation::POINT_SIZE},
+		{ATTRIBUTE_NAME_INIT_VELOCITY, AttributeLocation::INIT_VELOCITY},
+		{ATTRIBUTE_NAME_ELAPSED_TIME, AttributeLocation::ELAPSED_TIME},
 	};
 
 	for (const Attribute& attribute : attributes)
@@ -203,6 +285,11 @@ GLuint GLProgram::createShaderProgram(const GLuint vertexShader, const GLuint fr
 		glBindAttribLocation(ret, (GLuint)attribute.location, attribute.name.c_str());
 	}
 
+	if (isExtensionSupported("GL_ARB_get_program_binary"))
+	{
+		// ShaderCachefBXNɕۑł悤ɂ
+		glProgramParameteri(ret, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	}
 
 	glLinkProgram(ret);
 
@@ -233,114 +320,85 @@ GLuint GLProgram::createShaderProgram(const GLuint vertexShader, const GLuint fr
 	return ret;
 }
 
-void GLProgram::parseAttributes(GLuint shaderProgram)
+void GLProgram::parseUniforms(GLuint shaderProgram)
 {
-	_attributeList.clear();
-	GLint numAttribute;
-	glGetProgramiv(shaderProgram, GL_ACTIVE_ATTRIBUTES, &numAttribute);
+	size_t numLocations = 0;
+	for (size_t i = 0; i < static_cast<size_t>(UniformID::NUM_UNIFORM_IDS); i++)
+	{
+		_uniformLocationOffsets[i] = numLocations;
+		numLocations += UNIFORM_DESCS[i].numElements0 * UNIFORM_DESCS[i].numElements1;
+	}
+
+	_uniformLocations.assign(numLocations, -1);
 
-	if (numAttribute > 0)
+	char elementName[128];
+	for (size_t i = 0; i < static_cast<size_t>(UniformID::NUM_UNIFORM_IDS); i++)
 	{
-		GLint maxLength;
-		glGetProgramiv(shaderProgram, GL_ACTIVE_ATTRIBUTE_MAX_LENGTH, &maxLength);
+		const UniformDesc& desc = UNIFORM_DESCS[i];
+		GLint* locations = &_uniformLocations[_uniformLocationOffsets[i]];
 
-		if (maxLength > 0)
+		if (desc.numElements0 == 1 && desc.numElements1 == 1)
 		{
-			GLchar* attributeName = (GLchar*)alloca(maxLength + 1);
-
-			for (int i = 0; i < numAttribute; ++i)
+			// z1glUniform*vł܂Ƃ߂Đݒ肷悤ȕϐAϐŐ擪vf̃P[V
+			locations[0] = glGetUniformLocation(shaderProgram, desc.name);
+		}
+		else if (desc.numElements1 == 1)
+		{
+			for (size_t j = 0; j < desc.numElements0; j++)
 			{
-				GLint size;
-				GLenum type;
-				GLsizei length;
-				glGetActiveAttrib(shaderProgram, i, maxLength, &length, &size, &type, attributeName);
-				attributeName[length] = '\0';
-
-				GLint location = glGetAttribLocation(shaderProgram, attributeName);
-				GLProgram::checkGLError();
-				_attributeList[attributeName] = location;
+				snprintf(elementName, sizeof(elementName), "%s[%d]", desc.name, static_cast<int>(j));
+				locations[j] = glGetUniformLocation(shaderProgram, elementName);
 			}
 		}
-	}
-	else
-	{
-		GLchar errorLog[1024];
-		glGetProgramInfoLog(shaderProgram, sizeof(errorLog), nullptr, errorLog);
-		Logger::log("ANeBuȃAgr[gϐ擾łBerrorMsg=%s", errorLog);
-	}
-}
-
-void GLProgram::parseUniforms(GLuint shaderProgram)
-{
-	_uniformList.clear();
-	GLint numUniform;
-	glGetProgramiv(shaderProgram, GL_ACTIVE_UNIFORMS, &numUniform);
-
-	if (numUniform > 0)
-	{
-		GLint maxLength;
-		glGetProgramiv(shaderProgram, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
-
-		if (maxLength > 0)
+		else
 		{
-			GLchar* uniformName = (GLchar*)alloca(maxLength + 1);
-
-			for (int i = 0; i < numUniform; ++i)
+			for (size_t j = 0; j < desc.numElements0; j++)
 			{
-				GLint size;
-				GLenum type;
-				GLsizei length;
-				glGetActiveUniform(shaderProgram, i, maxLength, &length, &size, &type, uniformName);
-				uniformName[length] = '\0';
-
-				if (length > 3)
+				for (size_t k = 0; k < desc.numElements1; k++)
 				{
-					// z^ϐ[]ȑO̕ϐp
-					char* c = strrchr(uniformName, '[');
-					if (c != nullptr)
-					{
-						*c = '\0';
-					}
+					snprintf(elementName, sizeof(elementName), "%s[%d][%d]", desc.name, static_cast<int>(j), static_cast<int>(k));
+					locations[j * desc.numElements1 + k] = glGetUniformLocation(shaderProgram, elementName);
 				}
-
-				GLint location = glGetUniformLocation(shaderProgram, uniformName);
-				GLProgram::checkGLError();
-				_uniformList[uniformName] = location;
 			}
 		}
 	}
-	else
-	{
-		GLchar errorLog[1024];
-		glGetProgramInfoLog(shaderProgram, sizeof(errorLog), nullptr, errorLog);
-		Logger::log("ANeBuȃjtH[ϐ擾łBerrorMsg=%s", errorLog);
-	}
+
+	GLProgram::checkGLError();
 }
 
-GLuint GLProgram::getAttributeLocation(const std::string& attributeName) const
+void GLProgram::bindShadowMapTextureUnits(GLuint shaderProgram)
 {
-	try
+	// Tv[̒l̓vOɎĉŁA`悲Ƃł͂Ȃňxݒ肷
+	// ݒ肵ȂƂǂ̃Tv[jbg0ɂȂAVhE}bvgĂȂCg̕u_textureƂԂ
+	glUseProgram(shaderProgram);
+	glUniform1i(getUniformLocation(UniformID::DIRECTIONAL_LIGHT_SHADOW_MAP), TEXTURE_UNIT_DIRECTIONAL_LIGHT_SHADOW_MAP);
+
+	for (size_t i = 0; i < PointLight::MAX_NUM; i++)
 	{
-		return _attributeList.at(attributeName);
+		glUniform1i(getUniformLocation(UniformID::POINT_LIGHT_SHADOW_CUBE_MAP, i), TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP + static_cast<int>(i));
 	}
-	catch (...)
+
+	for (size_t i = 0; i < SpotLight::MAX_NUM; i++)
 	{
-		Logger::logAssert(false, "݂ȂAgr[gϐւ̃ANZX uniformName=%s", attributeName.c_str());
-		return 0;
+		glUniform1i(getUniformLocation(UniformID::SPOT_LIGHT_SHADOW_MAP, i), TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP + static_cast<int>(i));
 	}
+
+	glUseProgram(0);
+	GLProgram::checkGLError();
 }
 
-GLint GLProgram::getUniformLocation(const std::string& uniformName) const
+GLint GLProgram::getUniformLocation(UniformID uniformID, size_t index) const
 {
-	try
-	{
-		return _uniformList.at(uniformName);
-	}
-	catch (...)
-	{
-		Logger::logAssert(false, "݂ȂjtH[ϐւ̃ANZX uniformName=%s", uniformName.c_str());
-		return -1;
-	}
+	const UniformDesc& desc = UNIFORM_DESCS[static_cast<size_t>(uniformID)];
+	Logger::logAssert(index < desc.numElements0 * desc.numElements1, "jtH[ϐ̔z͈̔͊OANZX uniformName=%s index=%d", desc.name, static_cast<int>(index));
+	return _uniformLocations[_uniformLocationOffsets[static_cast<size_t>(uniformID)] + index];
+}
+
+GLint GLProgram::getUniformLocation(UniformID uniformID, size_t index0, size_t index1) const
+{
+	const UniformDesc& desc = UNIFORM_DESCS[static_cast<size_t>(uniformID)];
+	Logger::logAssert(index0 < desc.numElements0 && index1 < desc.numElements1, "jtH[ϐ̔z͈̔͊OANZX uniformName=%s index0=%d index1=%d", desc.name, static_cast<int>(index0), static_cast<int>(index1));
+	return _uniformLocations[_uniformLocationOffsets[static_cast<size_t>(uniformID)] + index0 * desc.numElements1 + index1];
 }
 
 } // namespace mgrrenderer
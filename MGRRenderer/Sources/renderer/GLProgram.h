@@ -3,9 +3,10 @@
 #include "Config.h"
 
 #if defined(MGRRENDERER_USE_OPENGL)
-#define GLEW_STATIC
-#include <glew/include/glew.h>
-#include <unordered_map>
+#include "GLHeader.h"
+#include <string>
+#include <array>
+#include <vector>
 
 namespace mgrrenderer
 {
@@ -13,15 +14,68 @@ namespace mgrrenderer
 class GLProgram final
 {
 public:
-	// TODO:ɒû܂肢Ƃ͎vȂƂ肠
-	static const std::string GLProgram::UNIFORM_NAME_RENDER_MODE;
-	static const std::string GLProgram::UNIFORM_NAME_MULTIPLE_COLOR;
-	static const std::string GLProgram::UNIFORM_NAME_TEXTURE_SAMPLER;
-	static const std::string GLProgram::UNIFORM_NAME_MODEL_MATRIX;
-	static const std::string GLProgram::UNIFORM_NAME_VIEW_MATRIX;
-	static const std::string GLProgram::UNIFORM_NAME_NORMAL_MATRIX;
-	static const std::string GLProgram::UNIFORM_NAME_PROJECTION_MATRIX;
-	static const std::string GLProgram::UNIFORM_NAME_CUBEMAP_FACE;
+	// VF[_̃jtH[ϐ̈ӖIDBϐ̓NɈxP[VɉA`掞͕gȂ
+	enum class UniformID : int
+	{
+		RENDER_MODE,
+		MULTIPLE_COLOR,
+		TEXTURE,
+		MODEL_MATRIX,
+		VIEW_MATRIX,
+		NORMAL_MATRIX,
+		PROJECTION_MATRIX,
+		CUBE_MAP_FACE,
+		DEPTH_BIAS_MATRIX,
+		VIEW_INVERSE,
+		CAMERA_POSITION,
+		NEAR_CLIP_Z,
+		FAR_CLIP_Z,
+		LIGHT_VIEW_MATRIX,
+		LIGHT_PROJECTION_MATRIX,
+		DEPTH_TEXTURE_PROJECTION,
+		DEPTH_TEXTURE_PROJECTION_MATRIX,
+		MATRIX_PALETTE,
+		MATERIAL_AMBIENT,
+		MATERIAL_DIFFUSE,
+		MATERIAL_SPECULAR,
+		MATERIAL_SHININESS,
+		G_BUFFER_COLOR_SPECULAR_INTENSITY,
+		G_BUFFER_NORMAL,
+		G_BUFFER_SPECULAR_POWER,
+		G_BUFFER_DEPTH_STENCIL,
+		AMBIENT_LIGHT_COLOR,
+		DIRECTIONAL_LIGHT_IS_VALID,
+		DIRECTIONAL_LIGHT_COLOR,
+		DIRECTIONAL_LIGHT_DIRECTION,
+		DIRECTIONAL_LIGHT_HAS_SHADOW_MAP,
+		DIRECTIONAL_LIGHT_VIEW_MATRIX,
+		DIRECTIONAL_LIGHT_PROJECTION_MATRIX,
+		DIRECTIONAL_LIGHT_SHADOW_MAP,
+		POINT_LIGHT_IS_VALID,
+		POINT_LIGHT_COLOR,
+		POINT_LIGHT_POSITION,
+		POINT_LIGHT_RANGE_INVERSE,
+		POINT_LIGHT_HAS_SHADOW_MAP,
+		POINT_LIGHT_VIEW_MATRICES,
+		POINT_LIGHT_PROJECTION_MATRIX,
+		POINT_LIGHT_SHADOW_CUBE_MAP,
+		SPOT_LIGHT_IS_VALID,
+		SPOT_LIGHT_COLOR,
+		SPOT_LIGHT_POSITION,
+		SPOT_LIGHT_DIRECTION,
+		SPOT_LIGHT_RANGE_INVERSE,
+		SPOT_LIGHT_INNER_ANGLE_COS,
+		SPOT_LIGHT_OUTER_ANGLE_COS,
+		SPOT_LIGHT_HAS_SHADOW_MAP,
+		SPOT_LIGHT_VIEW_MATRIX,
+		SPOT_LIGHT_PROJECTION_MATRIX,
+		SPOT_LIGHT_SHADOW_MAP,
+		POINT_SIZE,
+		LIFE_TIME,
+		GRAVITY,
+
+		NUM_UNIFORM_IDS,
+	};
 
 	enum class AttributeLocation : int
 	{
@@ -36,35 +90,53 @@ public:
 		NORMAL,
 		BLEND_WEIGHT,
 		BLEND_INDEX,
+		POINT_SIZE,
+		INIT_VELOCITY,
+		ELAPSED_TIME,
 
 		NUM_ATTRIBUTE_IDS,
 	};
 
+	// ẽTv[̃eNX`jbgBu_textureGobt@̃Tv[0`3ĝŁǍɌŒ肷
+	// ^̈ႤTv[jbgwƕ`悪GL_INVALID_OPERATIONɂȂ̂ŁAǂ̃Cgp̃jbg
+	static const int TEXTURE_UNIT_DIRECTIONAL_LIGHT_SHADOW_MAP = 4;
+	// |CgCg̃L[u}bvƃX|bgCg̃VhE}bv̓Cg̔ԍ𑫂jbgg
+	static const int TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP = 5;
+	static const int TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP = 9;
+
 	GLProgram();
 	~GLProgram();
 	static void checkGLError();
+	// ݂̃ReLXggT|[gĂ邩BGLEW̊gϐWindowsłgȂ̂ŖOŒׂ
+	static bool isExtensionSupported(const char* extensionName);
 	void initWithShaderString(const GLchar* vertexShaderStr, const GLchar* fragmentShaderStr);
-	void initWithShaderFile(const std::string& vertexShaderFile, const std::string& fragmentShaderFile);
-	GLuint getAttributeLocation(const std::string& attributeName) const;
-	GLint getUniformLocation(const std::string& uniformName) const;
+	// featuresShaderPermutation::Featurẽrbg}XNnƁAΉ#define}oG[Vg
+	void initWithShaderFile(const std::string& vertexShaderFile, const std::string& fragmentShaderFile, unsigned int features = 0);
+	// VF[_ŎgĂȂjtH[ϐ-1ԂBglUniformn-1𖳎
+	GLint getUniformLocation(UniformID uniformID) const { return _uniformLocations[_uniformLocationOffsets[static_cast<size_t>(uniformID)]]; }
+	// z^̃jtH[ϐ̗vf̃P[V
+	GLint getUniformLocation(UniformID uniformID, size_t index) const;
+	// 2z^̃jtH[ϐ̗vf̃P[V
+	GLint getUniformLocation(UniformID uniformID, size_t index0, size_t index1) const;
 	GLuint getShaderProgram() { return _shaderProgram; }
+	// RpCƃNsBvŐLShaderCacheŝŁAʏinitWithShaderStringg
+	static GLuint createShaderProgram(const GLchar* vertexShaderStr, const GLchar* fragmentShaderStr);
 
 private:
 	static GLenum _glError;
 
-	GLuint _vertexShader;
-	GLuint _fragmentShader;
 	GLuint _shaderProgram;
 
-	std::unordered_map<std::string, GLuint> _attributeList;
-	std::unordered_map<std::string, GLint> _uniformList;
+	// jtH[ϐƂ_uniformLocations̐擪ʒuBz^̕ϐ͗vf̗̈
+	std::array<size_t, static_cast<size_t>(UniformID::NUM_UNIFORM_IDS)> _uniformLocationOffsets;
+	std::vector<GLint> _uniformLocations;
 
-	GLuint createVertexShader(const GLchar* source) const;
-	GLuint createFragmentShader(const GLchar* source) const;
-	GLuint createShaderProgram(const GLuint vertexShader, const GLuint fragmentShader);
-	GLint compileShader(GLuint shader, const GLchar* source) const;
-	void parseAttributes(GLuint shaderProgram);
+	static GLuint createVertexShader(const GLchar* source);
+	static GLuint createFragmentShader(const GLchar* source);
+	static GLuint linkShaderProgram(const GLuint vertexShader, const GLuint fragmentShader);
+	static GLint compileShader(GLuint shader, const GLchar* source);
 	void parseUniforms(GLuint shaderProgram);
+	void bindShadowMapTextureUnits(GLuint shaderProgram);
 };
 
 } // namespace mgrrenderer
@@ -4,6 +4,7 @@
 #include "Image.h"
 #include "TextureUtility.h"
 #include "GLProgram.h"
+#include <vector>
 
 namespace mgrrenderer
 {
@@ -80,7 +81,12 @@ bool GLTexture::initWithImage(const Image& image, TextureUtility::PixelFormat fo
 	TextureUtility::PixelFormat toFormat = convertDataToFormat(image.getRawData(), image.getRawDataLength(), image.getPixelFormat(), pixelFormat, &convertedData, &convertedDataLen);
 	if (toFormat != pixelFormat)
 	{
-		goto ERR;
+		// ȍ~̕ϐ̏܂ERRgotoƁAMSVCȊÕRpCł̓G[ɂȂ̂łŌn
+		if (convertedData != nullptr && convertedData != image.getRawData())
+		{
+			free(convertedData);
+		}
+		return false;
 	}
 
 	Logger::logAssert(_pixelFormatInfoTable.find(toFormat) != _pixelFormatInfoTable.end(), "sNZtH[}bge[uɂȂtH[}bggp悤ƂĂ");
@@ -234,8 +240,9 @@ bool GLTexture::initDepthCubeMapTexture(GLenum textureUnit, unsigned int size)
 	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
 	GLfloat boarderColor[] = {1.0f, 0.0f, 0.0f, 0.0f};
 	glTexParameterfv(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BORDER_COLOR, boarderColor);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
-	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_COMPARE_FUNC, GL_LESS);
+	// VF[_samplerCubeShadowłȂsamplerCubeŐ[xl̂܂ܓǂŔrĂ̂ŁAr[h͎gȂ
+	// r[h̃eNX`VhEłȂTvœǂނƌʂ`ɂȂAhCoɂĂ̓VF[_̃RpC
+	glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_COMPARE_MODE, GL_NONE);
 
 	// L[u}bv6̃eNX`
 	for (int i = 0; i < (int)CubeMapFace::NUM_CUBEMAP_FACE; i++) {
@@ -311,5 +318,55 @@ bool GLTexture::initRenderTexture(GLenum pixelFormat, const SizeUint& contentSiz
 
 	return true;
 }
+
+bool GLTexture::initWithSize(const SizeUint& contentSize)
+{
+	_contentSize = contentSize;
+
+	GLint maxTextureSize = 0;
+	glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+
+	if ((GLint)contentSize.width > maxTextureSize || (GLint)contentSize.height > maxTextureSize)
+	{	
+		return false;
+	}
+
+	glGenTextures(1, &_textureId);
+	GLProgram::checkGLError();
+	Logger::logAssert(_textureId != 0, "eNX`s");
+
+	glBindTexture(GL_TEXTURE_2D, _textureId);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	// gp̗̈悪slɂȂȂ悤0Ŗ߂
+	std::vector<unsigned char> initialData(contentSize.width * contentSize.height * 4, 0);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, static_cast<GLsizei>(contentSize.width), static_cast<GLsizei>(contentSize.height), 0, GL_RGBA, GL_UNSIGNED_BYTE, initialData.data());
+	GLenum err = glGetError();
+	if (err != GL_NO_ERROR)
+	{
+		Logger::logAssert(false, "OpenGLŃG[ glGetError()=%d", err);
+		glBindTexture(GL_TEXTURE_2D, 0);
+		return false;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, 0);
+	return true;
+}
+
+void GLTexture::updateSubImage(unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned char* rgbaData)
+{
+	Logger::logAssert(_textureId != 0, "initWithSizeŏĂȂeNX`ɏƂB");
+	Logger::logAssert(x + width <= _contentSize.width && y + height <= _contentSize.height, "eNX`͈̔͊OɏƂB");
+
+	glBindTexture(GL_TEXTURE_2D, _textureId);
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, rgbaData);
+	GLProgram::checkGLError();
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
 } // namespace mgrrenderer
 #endif
@@ -17,6 +17,9 @@ public:
 	bool initDepthTexture(GLenum textureUnit, const SizeUint& contentSize);
 	bool initDepthCubeMapTexture(GLenum textureUnit, unsigned int size);
 	bool initRenderTexture(GLenum pixelFormat, const SizeUint& contentSize);
+	// gRGBA8888̃eNX`Bg͌ォupdateSubImageŕIɏ
+	bool initWithSize(const SizeUint& contentSize);
+	void updateSubImage(unsigned int x, unsigned int y, unsigned int width, unsigned int height, const unsigned char* rgbaData);
 
 	GLuint getTextureId() const { return _textureId; }
 
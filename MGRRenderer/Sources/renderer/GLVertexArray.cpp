@@ -0,0 +1,116 @@
+#include "GLVertexArray.h"
+
+#if defined(MGRRENDERER_USE_OPENGL)
+#include "GLProgram.h"
+#include "utility/Logger.h"
+
+namespace mgrrenderer
+{
+
+GLVertexArray::GLVertexArray() : _vertexArrayId(0), _indexBufferId(0)
+{
+}
+
+GLVertexArray::~GLVertexArray()
+{
+	if (_indexBufferId != 0)
+	{
+		glDeleteBuffers(1, &_indexBufferId);
+		_indexBufferId = 0;
+	}
+
+	if (!_vertexBufferIds.empty())
+	{
+		glDeleteBuffers(static_cast<GLsizei>(_vertexBufferIds.size()), _vertexBufferIds.data());
+		_vertexBufferIds.clear();
+	}
+
+	if (_vertexArrayId != 0)
+	{
+		glDeleteVertexArrays(1, &_vertexArrayId);
+		_vertexArrayId = 0;
+	}
+}
+
+void GLVertexArray::init()
+{
+	Logger::logAssert(_vertexArrayId == 0, "GLVertexArray::initdɌĂ΂ꂽB");
+
+	glGenVertexArrays(1, &_vertexArrayId);
+	GLProgram::checkGLError();
+	Logger::logAssert(_vertexArrayId != 0, "VAOs");
+}
+
+size_t GLVertexArray::addVertexBuffer(const void* data, size_t byteSize, GLenum usage)
+{
+	GLuint bufferId = 0;
+	glGenBuffers(1, &bufferId);
+	GLProgram::checkGLError();
+	Logger::logAssert(bufferId != 0, "_obt@s");
+
+	glBindBuffer(GL_ARRAY_BUFFER, bufferId);
+	glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(byteSize), data, usage);
+	GLProgram::checkGLError();
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	_vertexBufferIds.push_back(bufferId);
+	return _vertexBufferIds.size() - 1;
+}
+
+void GLVertexArray::updateVertexBuffer(size_t bufferIndex, const void* data, size_t byteSize)
+{
+	Logger::logAssert(bufferIndex < _vertexBufferIds.size(), "_obt@̃CfbNX͈͊OBindex=%d", static_cast<int>(bufferIndex));
+
+	glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferIds[bufferIndex]);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(byteSize), data);
+	GLProgram::checkGLError();
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GLVertexArray::setIndexBuffer(const void* data, size_t byteSize, GLenum usage)
+{
+	Logger::logAssert(_vertexArrayId != 0, "initOsetIndexBufferĂ΂ꂽB");
+	Logger::logAssert(_indexBufferId == 0, "CfbNXobt@1ĂȂB");
+
+	glGenBuffers(1, &_indexBufferId);
+	GLProgram::checkGLError();
+	Logger::logAssert(_indexBufferId != 0, "CfbNXobt@s");
+
+	// GL_ELEMENT_ARRAY_BUFFER̃oChVAȌԂȂ̂ŁAVAOoChԂŐݒ肷
+	glBindVertexArray(_vertexArrayId);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(byteSize), data, usage);
+	GLProgram::checkGLError();
+	glBindVertexArray(0);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+void GLVertexArray::setVertexAttribute(GLuint location, size_t bufferIndex, GLint size, GLenum type, GLsizei stride, size_t offset)
+{
+	Logger::logAssert(_vertexArrayId != 0, "initOsetVertexAttributeĂ΂ꂽB");
+	Logger::logAssert(bufferIndex < _vertexBufferIds.size(), "_obt@̃CfbNX͈͊OBindex=%d", static_cast<int>(bufferIndex));
+
+	glBindVertexArray(_vertexArrayId);
+	glBindBuffer(GL_ARRAY_BUFFER, _vertexBufferIds[bufferIndex]);
+	glEnableVertexAttribArray(location);
+	glVertexAttribPointer(location, size, type, GL_FALSE, stride, reinterpret_cast<const GLvoid*>(offset));
+	GLProgram::checkGLError();
+	glBindVertexArray(0);
+	// GL_ARRAY_BUFFER̃oChVAȌԂł͂Ȃ̂ŁANCAgzg`̂߂ɖ߂Ă
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void GLVertexArray::bind() const
+{
+	Logger::logAssert(_vertexArrayId != 0, "ĂȂVAOoCh悤ƂB");
+	glBindVertexArray(_vertexArrayId);
+	GLProgram::checkGLError();
+}
+
+void GLVertexArray::unbind()
+{
+	glBindVertexArray(0);
+}
+
+} // namespace mgrrenderer
+#endif
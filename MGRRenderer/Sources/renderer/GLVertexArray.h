@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Config.h"
+
+#if defined(MGRRENDERER_USE_OPENGL)
+#include "GLHeader.h"
+#include <cstddef>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// _obt@ƃCfbNXobt@GPUɎA_̐ݒVAOɂ܂Ƃ߂ĂNX
+// Ɉx]A`掞bind邾ɂăNCAgz̖h[̃Rs[Ȃ
+class GLVertexArray final
+{
+public:
+	GLVertexArray();
+	~GLVertexArray();
+
+	void init();
+	// _obt@ǉÃobt@̃CfbNXԂBt[̂usageGL_DYNAMIC_DRAWɂ
+	size_t addVertexBuffer(const void* data, size_t byteSize, GLenum usage);
+	void updateVertexBuffer(size_t bufferIndex, const void* data, size_t byteSize);
+	void setIndexBuffer(const void* data, size_t byteSize, GLenum usage);
+	// offset͒_obt@擪̃oCg
+	void setVertexAttribute(GLuint location, size_t bufferIndex, GLint size, GLenum type, GLsizei stride, size_t offset);
+
+	bool isInitialized() const { return _vertexArrayId != 0; }
+	void bind() const;
+	// ̃NCAgzg`ɉeȂ悤A`̓ftHgVAOɖ߂
+	static void unbind();
+
+private:
+	GLuint _vertexArrayId;
+	std::vector<GLuint> _vertexBufferIds;
+	GLuint _indexBufferId;
+
+	GLVertexArray(const GLVertexArray&) = delete;
+	GLVertexArray& operator=(const GLVertexArray&) = delete;
+};
+
+} // namespace mgrrenderer
+#endif
@@ -1,5 +1,6 @@
 #pragma once
 #include "RenderCommand.h"
+#include <cstddef>
 #include <functional>
 
 namespace mgrrenderer
@@ -3,6 +3,9 @@
 #include "utility/FileUtility.h"
 #include "utility/Logger.h"
 #include "TextureUtility.h"
+#include <fstream>
+#include <string.h>
+#include <vector>
 
 extern "C"
 {
@@ -26,9 +29,7 @@ _rawData(nullptr),
 _rawDataLen(0),
 _width(0),
 _height(0),
-#if defined(MGRRENDERER_USE_OPENGL)
 _pixelFormat(TextureUtility::PixelFormat::NONE),
-#endif
 _hasPremultipliedAlpha(true),
 _fileFormat(FileFormat::UNKNOWN)
 {
@@ -90,6 +91,42 @@ bool Image::initWithImageData(const unsigned char* data, size_t dataLen)
 	return isSucceeded;
 }
 
+bool Image::initWithRawData(const unsigned char* rawData, size_t rawDataLen, unsigned int width, unsigned int height, TextureUtility::PixelFormat pixelFormat, bool hasPremultipliedAlpha)
+{
+	if (rawData == nullptr || rawDataLen == 0)
+	{
+		return false;
+	}
+
+	// t[̓ǂݖ߂œImageg񂹂悤ɁAÕf[^͉
+	if (_data != nullptr)
+	{
+		free(_data);
+		_data = nullptr;
+		_dataLen = 0;
+	}
+
+	if (_rawData == nullptr || _rawDataLen != rawDataLen)
+	{
+		free(_rawData);
+		_rawData = static_cast<unsigned char*>(malloc(rawDataLen));
+		if (_rawData == nullptr)
+		{
+			_rawDataLen = 0;
+			return false;
+		}
+	}
+
+	memcpy(_rawData, rawData, rawDataLen);
+	_rawDataLen = rawDataLen;
+	_width = width;
+	_height = height;
+	_pixelFormat = pixelFormat;
+	_hasPremultipliedAlpha = hasPremultipliedAlpha;
+	_fileFormat = FileFormat::UNKNOWN;
+	return true;
+}
+
 Image::FileFormat Image::detectFileFormat(const unsigned char * data, size_t dataLen)
 {
 	if (isPng(data, dataLen))
@@ -209,7 +246,7 @@ bool Image::initWithPngData(const unsigned char * data, size_t dataLen)
 	bitDepth = png_get_bit_depth(png, info);
 	colorType = png_get_color_type(png, info);
 
-#if defined(MGRRENDERER_USE_OPENGL)
+	// eNX`AgXւ݂̏łf[^ĝŁADirect3DłtH[}bgݒ肷
 	switch (colorType)
 	{
 	case PNG_COLOR_TYPE_GRAY:
@@ -227,7 +264,6 @@ bool Image::initWithPngData(const unsigned char * data, size_t dataLen)
 	default:
 		break;
 	}
-#endif
 
 	// ss[hăoɊi[
 	png_bytep* rowPointers = static_cast<png_bytep*>(malloc(sizeof(png_bytep) * _height));
@@ -253,6 +289,11 @@ bool Image::initWithPngData(const unsigned char * data, size_t dataLen)
 
 	png_read_end(png, nullptr);
 
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	// Direct3D̃uhXe[g͎OZĂȂAt@OɂĂāAWICœǂރeNX`ȂĂ̂ŁA
+	// eNX`AgXɏސf[^낦ĎOZȂ
+	_hasPremultipliedAlpha = false;
+#elif defined(MGRRENDERER_USE_OPENGL)
 	if (colorType == PNG_COLOR_TYPE_RGB_ALPHA)
 	{
 		premultiplyAlpha();
@@ -261,6 +302,7 @@ bool Image::initWithPngData(const unsigned char * data, size_t dataLen)
 	{
 		_hasPremultipliedAlpha = false;
 	}
+#endif
 
 	if (rowPointers != nullptr)
 	{
@@ -468,9 +510,7 @@ bool Image::initWithTgaData(const unsigned char* data, size_t dataLen)
 
 void Image::premultiplyAlpha()
 {
-#if defined(MGRRENDERER_USE_OPENGL)
 	Logger::logAssert(_pixelFormat == TextureUtility::PixelFormat::RGBA8888, "pngł̓At@̎OZRGBA8888ɂΉĂȂ");
-#endif
 
 	unsigned int* fourBytes = (unsigned int*)_rawData;
 	for (unsigned int i = 0; i < _width * _height; i++)
@@ -483,4 +523,90 @@ void Image::premultiplyAlpha()
 	_hasPremultipliedAlpha = true;
 }
 
+bool Image::saveToPngFile(const std::string& filePath) const
+{
+	if (_rawData == nullptr)
+	{
+		return false;
+	}
+
+	int colorType = 0;
+	size_t bytesPerPixel = 0;
+	switch (_pixelFormat)
+	{
+	case TextureUtility::PixelFormat::I8:
+		colorType = PNG_COLOR_TYPE_GRAY;
+		bytesPerPixel = 1;
+		break;
+	case TextureUtility::PixelFormat::AI88:
+		colorType = PNG_COLOR_TYPE_GRAY_ALPHA;
+		bytesPerPixel = 2;
+		break;
+	case TextureUtility::PixelFormat::RGB888:
+		colorType = PNG_COLOR_TYPE_RGB;
+		bytesPerPixel = 3;
+		break;
+	case TextureUtility::PixelFormat::RGBA8888:
+		colorType = PNG_COLOR_TYPE_RGB_ALPHA;
+		bytesPerPixel = 4;
+		break;
+	default:
+		Logger::log("PNGŏoȂsNZtH[}bgBpixelFormat=%d", static_cast<int>(_pixelFormat));
+		return false;
+	}
+
+	std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		Logger::log("摜t@CJȂBpath=%s", filePath.c_str());
+		return false;
+	}
+
+	png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+	if (png == nullptr)
+	{
+		return false;
+	}
+
+	png_infop info = png_create_info_struct(png);
+	if (info == nullptr)
+	{
+		png_destroy_write_struct(&png, nullptr);
+		return false;
+	}
+
+	std::vector<png_bytep> rowPointers(_height);
+	for (unsigned int i = 0; i < _height; i++)
+	{
+		rowPointers[i] = _rawData + i * _width * bytesPerPixel;
+	}
+
+	if (setjmp(png_jmpbuf(png)))
+	{
+		png_destroy_write_struct(&png, &info);
+		return false;
+	}
+
+	png_set_write_fn(png, &file,
+		[](png_structp png, png_bytep data, png_size_t length) {
+			std::ofstream* file = static_cast<std::ofstream*>(png_get_io_ptr(png));
+			file->write(reinterpret_cast<const char*>(data), length);
+			if (!*file)
+			{
+				png_error(png, "png write callback failed.");
+			}
+		},
+		[](png_structp png) {
+			static_cast<std::ofstream*>(png_get_io_ptr(png))->flush();
+		}
+	);
+
+	png_set_IHDR(png, info, _width, _height, 8, colorType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(png, info);
+	png_write_image(png, rowPointers.data());
+	png_write_end(png, nullptr);
+	png_destroy_write_struct(&png, &info);
+	return true;
+}
+
 } // namespace mgrrenderer
@@ -24,6 +24,10 @@ public:
 	~Image();
 	bool initWithFilePath(const std::string& filePath);
 	bool initWithImageData(const unsigned char* data, size_t dataLen);
+	// t@CoRȂ̉摜f[^ŏBt[obt@̓ǂݖ߂ȂǂɎgBs͍オ_
+	bool initWithRawData(const unsigned char* rawData, size_t rawDataLen, unsigned int width, unsigned int height, TextureUtility::PixelFormat pixelFormat, bool hasPremultipliedAlpha);
+	// ̉摜f[^PNGŏoBAt@͏Zς݂ǂɊւ炸̂܂܏o
+	bool saveToPngFile(const std::string& filePath) const;
 
 	unsigned char* getData() const { return _data; };
 	size_t getDataLength() const { return _dataLen; };
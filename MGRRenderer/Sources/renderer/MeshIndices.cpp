@@ -0,0 +1,49 @@
+#include "MeshIndices.h"
+#include <algorithm>
+
+namespace mgrrenderer
+{
+
+MeshIndices::MeshIndices() : _format(Format::UINT16), _numIndices(0), _externalData(nullptr)
+{
+}
+
+MeshIndices::MeshIndices(const std::vector<unsigned int>& indices) : _format(Format::UINT16), _numIndices(indices.size()), _externalData(nullptr)
+{
+	unsigned int maxIndex = indices.empty() ? 0 : *std::max_element(indices.begin(), indices.end());
+	if (maxIndex < MAX_NUM_VERTICES_FOR_UINT16)
+	{
+		_format = Format::UINT16;
+		_indices16.resize(indices.size());
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			_indices16[i] = static_cast<unsigned short>(indices[i]);
+		}
+	}
+	else
+	{
+		_format = Format::UINT32;
+		_indices32 = indices;
+	}
+}
+
+MeshIndices::MeshIndices(Format format, const void* data, size_t numIndices) : _format(format), _numIndices(numIndices), _externalData(data)
+{
+}
+
+const void* MeshIndices::getData() const
+{
+	if (_numIndices == 0)
+	{
+		return nullptr;
+	}
+
+	if (_externalData != nullptr)
+	{
+		return _externalData;
+	}
+
+	return (_format == Format::UINT16) ? static_cast<const void*>(_indices16.data()) : static_cast<const void*>(_indices32.data());
+}
+
+} // namespace mgrrenderer
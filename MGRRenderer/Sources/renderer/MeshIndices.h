@@ -0,0 +1,56 @@
+#pragma once
+#include "Config.h"
+#include <cstddef>
+#include <vector>
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <dxgiformat.h>
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLHeader.h"
+#endif
+
+namespace mgrrenderer
+{
+
+// `Ɏg1TubṼCfbNXz
+// [_[32bitōAQƂ钸_ԍ̍ől16bitɎ܂̂16bitA܂Ȃ̂32bitŎđш}
+class MeshIndices final
+{
+public:
+	enum class Format : int
+	{
+		UINT16,
+		UINT32,
+	};
+
+	// 16bitŕ\钸_B𒴂钸_QƂTubV32bitɂȂ
+	static const size_t MAX_NUM_VERTICES_FOR_UINT16 = 65536;
+
+	MeshIndices();
+	explicit MeshIndices(const std::vector<unsigned int>& indices);
+	// ÕɂCfbNXRs[ɎQƂBcookedf̃}bvt@C𒼐ڎŵɎg
+	// data͂MeshIndicesgI܂ŉȂ
+	MeshIndices(Format format, const void* data, size_t numIndices);
+
+	Format getFormat() const { return _format; }
+	size_t getNumIndices() const { return _numIndices; }
+	// 1CfbNX̃oCg
+	size_t getStride() const { return (_format == Format::UINT16) ? sizeof(unsigned short) : sizeof(unsigned int); }
+	size_t getByteSize() const { return getStride() * _numIndices; }
+	const void* getData() const;
+	unsigned int getIndex(size_t i) const { return (_format == Format::UINT16) ? static_cast<const unsigned short*>(getData())[i] : static_cast<const unsigned int*>(getData())[i]; }
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	DXGI_FORMAT getDXGIFormat() const { return (_format == Format::UINT16) ? DXGI_FORMAT_R16_UINT : DXGI_FORMAT_R32_UINT; }
+#elif defined(MGRRENDERER_USE_OPENGL)
+	GLenum getGLType() const { return (_format == Format::UINT16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT; }
+#endif
+
+private:
+	Format _format;
+	size_t _numIndices;
+	std::vector<unsigned short> _indices16;
+	std::vector<unsigned int> _indices32;
+	// ÕQƂĂƂ͂̐擪BOŎĂƂnullptr
+	const void* _externalData;
+};
+
+} // namespace mgrrenderer
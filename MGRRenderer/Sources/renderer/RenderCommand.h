@@ -12,6 +12,7 @@ public:
 		GROUP_BEGIN,
 		GROUP_END,
 		CUSTOM,
+		SPRITE_BATCH,
 		NUM_TYPES
 	};
 
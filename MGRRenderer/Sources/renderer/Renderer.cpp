@@ -2,14 +2,22 @@
 #include "Director.h"
 #include "RenderCommand.h"
 #include "GroupBeginRenderCommand.h"
+#include "ShaderCache.h"
+#include "TextureAtlas.h"
 #include "utility/Logger.h"
+#include "utility/Profiler.h"
 #include "node/Light.h"
+#include "node/ModelCache.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "D3DTexture.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "GLFrameBuffer.h"
 #include "GLTexture.h"
 #include "Shaders.h"
+#include "Image.h"
+#include "TextureUtility.h"
+#include <cstddef>
+#include <string.h>
 #endif
 
 namespace mgrrenderer
@@ -56,7 +64,11 @@ _drawWireFrame(false)
 
 Renderer::~Renderer()
 {
-#if defined(MGRRENDERER_DEFERRED_RENDERING)
+	// LbVĂVF[_AgX̃eNX`Af̃obt@̓foCXReLXgɉ
+	ShaderCache::getInstance()->clear();
+	TextureAtlas::getInstance()->clear();
+	ModelCache::getInstance()->clear();
+
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	if (_blendStateTransparent != nullptr)
 	{
@@ -70,30 +82,6 @@ Renderer::~Renderer()
 		_blendState = nullptr;
 	}
 
-	if (_gBufferSpecularPower != nullptr)
-	{
-		delete _gBufferSpecularPower;
-		_gBufferSpecularPower = nullptr;
-	}
-
-	if (_gBufferNormal != nullptr)
-	{
-		delete _gBufferNormal;
-		_gBufferNormal = nullptr;
-	}
-
-	if (_gBufferColorSpecularIntensity != nullptr)
-	{
-		delete _gBufferColorSpecularIntensity;
-		_gBufferColorSpecularIntensity = nullptr;
-	}
-
-	if (_gBufferDepthStencil != nullptr)
-	{
-		delete _gBufferDepthStencil;
-		_gBufferDepthStencil = nullptr;
-	}
-
 	if (_direct3dDepthStencilState2D != nullptr)
 	{
 		_direct3dDepthStencilState2D->Release();
@@ -141,14 +129,7 @@ Renderer::~Renderer()
 		_direct3dSwapChain->Release();
 		_direct3dSwapChain = nullptr;
 	}
-#elif defined(MGRRENDERER_USE_OPENGL)
-	if (_gBufferFrameBuffer != nullptr)
-	{
-		delete _gBufferFrameBuffer;
-		_gBufferFrameBuffer = nullptr;
-	}
 #endif
-#endif // defined(MGRRENDERER_DEFERRED_RENDERING)
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	if (_rasterizeStateWireFrame != nullptr)
@@ -247,6 +228,11 @@ void Renderer::initView(const SizeUint& windowSize)
 		return;
 	}
 
+	// gȂł͏]ʂ̃vOƂ̒萔obt@ɃtH[obN̂ŁAsĂG[ɂ͂Ȃ
+	_constantRingBuffer.init(_direct3dDevice, _direct3dContext, ConstantRingBuffer::DEFAULT_SIZE);
+
+	_streamingVertexBuffer.init(_direct3dDevice, _direct3dContext, StreamingBuffer::Type::VERTEX, StreamingBuffer::DEFAULT_SIZE);
+
 	// XbvE`FCŏ̃obNEobt@擾
 	ID3D11Texture2D* backBuffer = nullptr;
 	result = _direct3dSwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D), (LPVOID*)&backBuffer);
@@ -455,29 +441,25 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBlendState failed. result=%d", result);
 		return;
 	}
+
+	_spriteBatcher.init(_direct3dDevice);
 #elif defined(MGRRENDERER_USE_OPENGL)
 	glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 	glClearDepth(1.0f); // ftHgl͈ԉɂĂ
 	// OpenGLłr[|[gϊ̂߂̃p[^n
 	glViewport(0, 0, static_cast<GLsizei>(windowSize.width), static_cast<GLsizei>(windowSize.height));
 	glBindFramebuffer(GL_FRAMEBUFFER, 0); // ftHg̃t[obt@
+	// Point2DAPoint3DAParticle3D͒_VF[_gl_PointSizeœ_̑傫߂B
+	// LɂȂgl_PointSize1sNZŕ`
+	glEnable(GL_PROGRAM_POINT_SIZE);
+
+	_streamingVertexBuffer.init(StreamingBuffer::Type::VERTEX, StreamingBuffer::DEFAULT_SIZE);
+
+	_spriteBatcher.init();
 #endif
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 #if defined(MGRRENDERER_USE_DIRECT3D)
-	// Gobt@̏
-	_gBufferDepthStencil = new D3DTexture();
-	_gBufferDepthStencil->initDepthStencilTexture(windowSize);
-
-	_gBufferColorSpecularIntensity = new D3DTexture();
-	_gBufferColorSpecularIntensity->initRenderTexture(windowSize, DXGI_FORMAT_R8G8B8A8_UNORM);
-
-	_gBufferNormal = new D3DTexture();
-	_gBufferNormal->initRenderTexture(windowSize, DXGI_FORMAT_R11G11B10_FLOAT);
-
-	_gBufferSpecularPower = new D3DTexture();
-	_gBufferSpecularPower->initRenderTexture(windowSize, DXGI_FORMAT_R8G8B8A8_UNORM);
-
 	//
 	// fBt@[h_Ȍ
 	//
@@ -502,7 +484,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::RENDER_MODE, constantBuffer);
 
 	// Viewsp
 	constantBuffer = nullptr;
@@ -512,7 +494,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
 
 	// Projectionsp
 	constantBuffer = nullptr;
@@ -522,7 +504,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
 
 	// fvXoCAXsp
 	constantBuffer = nullptr;
@@ -532,7 +514,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, constantBuffer);
 
 	// ArGgCgJ[
 	constantBufferDesc.ByteWidth = sizeof(AmbientLight::ConstantBufferData);
@@ -543,7 +525,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, constantBuffer);
 
 	// fBNVigCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(DirectionalLight::ConstantBufferData);
@@ -554,7 +536,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, constantBuffer);
 
 	// |CgCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM;
@@ -565,7 +547,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, constantBuffer);
 
 	// X|bgCgp[^[
 	constantBufferDesc.ByteWidth = sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM;
@@ -576,7 +558,7 @@ void Renderer::initView(const SizeUint& windowSize)
 		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
 		return;
 	}
-	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER, constantBuffer);
+	_d3dProgramForDeferredRendering.addConstantBuffer(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, constantBuffer);
 
 	_quadrangle.bottomLeft.position = Vec2(-1.0f, -1.0f);
 	_quadrangle.bottomLeft.textureCoordinate = Vec2(0.0f, 1.0f);
@@ -634,21 +616,6 @@ void Renderer::initView(const SizeUint& windowSize)
 	}
 	_d3dProgramForDeferredRendering.setInputLayout(inputLayout);
 #elif defined(MGRRENDERER_USE_OPENGL)
-	// Gobt@̏
-	_gBufferFrameBuffer = new GLFrameBuffer();
-	std::vector<GLenum> drawBuffers;
-	drawBuffers.push_back(GL_NONE);
-	drawBuffers.push_back(GL_COLOR_ATTACHMENT0);
-	drawBuffers.push_back(GL_COLOR_ATTACHMENT1);
-	drawBuffers.push_back(GL_COLOR_ATTACHMENT2);
-	std::vector<GLenum> pixelFormats;
-	pixelFormats.push_back(GL_DEPTH_COMPONENT);
-	pixelFormats.push_back(GL_RGBA);
-	pixelFormats.push_back(GL_RGBA);
-	pixelFormats.push_back(GL_RGBA);
-	_gBufferFrameBuffer->initWithTextureParams(drawBuffers, pixelFormats, false, false, windowSize);
-
-
 	//
 	// fBt@[h_Ȍ
 	//
@@ -662,6 +629,11 @@ void Renderer::initView(const SizeUint& windowSize)
 	_quadrangle.topLeft.textureCoordinate = Vec2(0.0f, 1.0f);
 	_quadrangle.topRight.position = Vec2(1.0, 1.0);
 	_quadrangle.topRight.textureCoordinate = Vec2(1.0f, 1.0f);
+
+	_glVertexArrayForDeferredRendering.init();
+	size_t bufferIndex = _glVertexArrayForDeferredRendering.addVertexBuffer(&_quadrangle, sizeof(_quadrangle), GL_STATIC_DRAW);
+	_glVertexArrayForDeferredRendering.setVertexAttribute((GLuint)GLProgram::AttributeLocation::POSITION, bufferIndex, 2, GL_FLOAT, sizeof(Position2DTextureCoordinates), offsetof(Position2DTextureCoordinates, position));
+	_glVertexArrayForDeferredRendering.setVertexAttribute((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, bufferIndex, 2, GL_FLOAT, sizeof(Position2DTextureCoordinates), offsetof(Position2DTextureCoordinates, textureCoordinate));
 #endif
 #endif // defined(MGRRENDERER_DEFERRED_RENDERING)
 }
@@ -700,8 +672,19 @@ void Renderer::addCommand(RenderCommand* command)
 	}
 }
 
+void Renderer::addSpriteQuads(const SpriteBatchRenderCommand::Material& material, const Position2DTextureCoordinates* vertices, size_t numQuads, const Mat4& modelMatrix, const Color4B& color)
+{
+	_spriteBatcher.addQuads(_queueGroup[_groupIndexStack.top()], material, vertices, numQuads, modelMatrix, color);
+}
+
 void Renderer::render()
 {
+	MGRRENDERER_PROFILE_SCOPE("Renderer::render");
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	_constantRingBuffer.beginFrame();
+#endif
+
 	visitRenderQueue(_queueGroup[DEFAULT_RENDER_QUEUE_GROUP_INDEX]);
 
 	Logger::logAssert(_groupIndexStack.size() == 1, "O[vR}hJnōꂽCfbNXX^bN͏IŏĂ͂B_groupIndexStack.size() == %d", _queueGroup.size());
@@ -713,8 +696,36 @@ void Renderer::render()
 	}
 
 	_queueGroup[DEFAULT_RENDER_QUEUE_GROUP_INDEX].clear();
+
+	_spriteBatcher.endFrame();
+	_streamingVertexBuffer.endFrame();
 }
 
+#if defined(MGRRENDERER_USE_OPENGL)
+bool Renderer::readBackBuffer(Image& outImage) const
+{
+	MGRRENDERER_PROFILE_SCOPE("Renderer::readBackBuffer");
+
+	const SizeUint& windowSize = Director::getInstance()->getWindowSize();
+	size_t rowSize = windowSize.width * 4;
+	std::vector<unsigned char> pixels(rowSize * windowSize.height);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, static_cast<GLsizei>(windowSize.width), static_cast<GLsizei>(windowSize.height), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+	GLProgram::checkGLError();
+
+	// OpenGL͍_Ȃ̂ŁAt@CǂImageƓ㌴_̍sɕבւ
+	std::vector<unsigned char> flippedPixels(pixels.size());
+	for (unsigned int y = 0; y < windowSize.height; y++)
+	{
+		memcpy(&flippedPixels[y * rowSize], &pixels[(windowSize.height - 1 - y) * rowSize], rowSize);
+	}
+
+	return outImage.initWithRawData(flippedPixels.data(), flippedPixels.size(), windowSize.width, windowSize.height, TextureUtility::PixelFormat::RGBA8888, false);
+}
+#endif
+
 void Renderer::prepareDefaultRenderTarget()
 {
 #if defined(MGRRENDERER_USE_DIRECT3D)
@@ -745,6 +756,16 @@ void Renderer::prepareDefaultRenderTarget()
 }
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+void Renderer::setGBuffer(D3DTexture* depthStencil, D3DTexture* colorSpecularIntensity, D3DTexture* normal, D3DTexture* specularPower)
+{
+	_gBufferDepthStencil = depthStencil;
+	_gBufferColorSpecularIntensity = colorSpecularIntensity;
+	_gBufferNormal = normal;
+	_gBufferSpecularPower = specularPower;
+}
+#endif
+
 void Renderer::prepareGBufferRendering()
 {
 #if defined(MGRRENDERER_USE_DIRECT3D)
@@ -793,57 +814,19 @@ void Renderer::renderDeferred()
 	ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
 
 	// TODO:ւ񋤒ʉȁBB
-	D3D11_MAPPED_SUBRESOURCE mappedResource;
-
 	// render modẽ}bv
-	HRESULT result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-	CopyMemory(mappedResource.pData, &_renderMode, sizeof(_renderMode));
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_RENDER_MODE), 0);
+	_d3dProgramForDeferredRendering.setConstantBufferData(D3DProgram::ConstantBufferID::RENDER_MODE, &_renderMode, sizeof(_renderMode));
 
 	// r[s̋ts̃}bv
-	result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 	Mat4 viewMatrix = Director::getCamera().getViewMatrix().createInverse().transpose();
-	CopyMemory(mappedResource.pData, &viewMatrix.m, sizeof(viewMatrix));
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_VIEW_MATRIX), 0);
+	_d3dProgramForDeferredRendering.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
 
 	// vWFNVs̋ts̃}bv
-	result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
 	Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * Director::getCamera().getProjectionMatrix()).transpose();
-	CopyMemory(mappedResource.pData, &projectionMatrix.m, sizeof(projectionMatrix));
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_PROJECTION_MATRIX), 0);
-
-	result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
+	_d3dProgramForDeferredRendering.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
+
 	Mat4 depthBiasMatrix = (Mat4::TEXTURE_COORDINATE_CONVERTER * Mat4::createScale(Vec3(0.5f, 0.5f, 1.0f)) * Mat4::createTranslation(Vec3(1.0f, -1.0f, 0.0f))).transpose(); //TODO: Mat4Qƌ^ɂƒlȂĂ܂
-	CopyMemory(mappedResource.pData, &depthBiasMatrix.m, sizeof(depthBiasMatrix));
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DEPTH_BIAS_MATRIX), 0);
+	_d3dProgramForDeferredRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DEPTH_BIAS_MATRIX, &depthBiasMatrix.m, sizeof(depthBiasMatrix));
 
 	// TODO:Ɉł͂ȂȂ
 	const Scene& scene = Director::getInstance()->getScene();
@@ -852,16 +835,7 @@ void Renderer::renderDeferred()
 	Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 
 	// ArGgCgJ[̃}bv
-	result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-	CopyMemory(mappedResource.pData, ambientLight->getConstantBufferDataPointer(), sizeof(AmbientLight::ConstantBufferData));
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_AMBIENT_LIGHT_PARAMETER), 0);
+	_d3dProgramForDeferredRendering.setConstantBufferData(D3DProgram::ConstantBufferID::AMBIENT_LIGHT_PARAMETER, ambientLight->getConstantBufferDataPointer(), sizeof(AmbientLight::ConstantBufferData));
 
 	ID3D11ShaderResourceView* dirLightShadowMapResourceView = nullptr;
 	const DirectionalLight* directionalLight = scene.getDirectionalLight();
@@ -872,16 +846,7 @@ void Renderer::renderDeferred()
 			dirLightShadowMapResourceView = directionalLight->getShadowMapData().depthTexture->getShaderResourceView();
 		}
 
-		result = direct3dContext->Map(
-			_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER),
-			0,
-			D3D11_MAP_WRITE_DISCARD,
-			0,
-			&mappedResource
-		);
-		Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-		CopyMemory(mappedResource.pData, directionalLight->getConstantBufferDataPointer(), sizeof(DirectionalLight::ConstantBufferData));
-		direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_DIRECTIONAL_LIGHT_PARAMETER), 0);
+		_d3dProgramForDeferredRendering.setConstantBufferData(D3DProgram::ConstantBufferID::DIRECTIONAL_LIGHT_PARAMETER, directionalLight->getConstantBufferDataPointer(), sizeof(DirectionalLight::ConstantBufferData));
 	}
 
 
@@ -898,17 +863,8 @@ void Renderer::renderDeferred()
 		}
 	}
 
-	result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-
-	PointLight::ConstantBufferData* pointLightConstBufData = static_cast<PointLight::ConstantBufferData*>(mappedResource.pData);
-	ZeroMemory(pointLightConstBufData, sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM);
+	// mۂ̈̓[NAĂ
+	PointLight::ConstantBufferData* pointLightConstBufData = static_cast<PointLight::ConstantBufferData*>(_d3dProgramForDeferredRendering.allocateConstantBufferData(D3DProgram::ConstantBufferID::POINT_LIGHT_PARAMETER, sizeof(PointLight::ConstantBufferData) * PointLight::MAX_NUM));
 
 	size_t numPointLight = scene.getNumPointLight();
 	for (size_t i = 0; i < numPointLight; i++)
@@ -920,8 +876,6 @@ void Renderer::renderDeferred()
 		}
 	}
 
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_POINT_LIGHT_PARAMETER), 0);
-
 
 	// X|bgCg̈ʒuW̋t̃}bv
 	std::array<ID3D11ShaderResourceView*, SpotLight::MAX_NUM> spotLightShadowMapResourceView;
@@ -936,17 +890,8 @@ void Renderer::renderDeferred()
 		}
 	}
 
-	result = direct3dContext->Map(
-		_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER),
-		0,
-		D3D11_MAP_WRITE_DISCARD,
-		0,
-		&mappedResource
-	);
-	Logger::logAssert(SUCCEEDED(result), "Map failed, result=%d", result);
-
-	SpotLight::ConstantBufferData* spotLightConstBufData = static_cast<SpotLight::ConstantBufferData*>(mappedResource.pData);
-	ZeroMemory(spotLightConstBufData, sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM);
+	// mۂ̈̓[NAĂ
+	SpotLight::ConstantBufferData* spotLightConstBufData = static_cast<SpotLight::ConstantBufferData*>(_d3dProgramForDeferredRendering.allocateConstantBufferData(D3DProgram::ConstantBufferID::SPOT_LIGHT_PARAMETER, sizeof(SpotLight::ConstantBufferData) * SpotLight::MAX_NUM));
 
 	size_t numSpotLight = scene.getNumSpotLight();
 	for (size_t i = 0; i < numSpotLight; i++)
@@ -958,8 +903,6 @@ void Renderer::renderDeferred()
 		}
 	}
 
-	direct3dContext->Unmap(_d3dProgramForDeferredRendering.getConstantBuffer(D3DProgram::CONSTANT_BUFFER_SPOT_LIGHT_PARAMETER), 0);
-
 	// bV͂ЂƂ
 	UINT strides[1] = {sizeof(_quadrangle.topLeft)};
 	UINT offsets[1] = {0};
@@ -969,7 +912,7 @@ void Renderer::renderDeferred()
 	direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
 
 	_d3dProgramForDeferredRendering.setShadersToDirect3DContext(direct3dContext);
-	_d3dProgramForDeferredRendering.setConstantBuffersToDirect3DContext(direct3dContext);
+	_constantRingBuffer.bind(_d3dProgramForDeferredRendering, direct3dContext);
 
 	ID3D11ShaderResourceView* gBufferShaderResourceViews[4] = {
 		getGBufferDepthStencil()->getShaderResourceView(),
@@ -997,17 +940,17 @@ void Renderer::renderDeferred()
 	glUseProgram(_glProgramForDeferredRendering.getShaderProgram());
 	GLProgram::checkGLError();
 
-	glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UNIFORM_NAME_RENDER_MODE), (GLint)_renderMode);
+	glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::RENDER_MODE), (GLint)_renderMode);
 
 	Mat4 viewMatrix = Director::getCamera().getViewMatrix();
 	viewMatrix.inverse();
-	glUniformMatrix4fv(_glProgramForDeferredRendering.getUniformLocation("u_viewInverse"), 1, GL_FALSE, (GLfloat*)viewMatrix.m);
-	glUniformMatrix4fv(_glProgramForDeferredRendering.getUniformLocation("u_depthTextureProjection"), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
+	glUniformMatrix4fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::VIEW_INVERSE), 1, GL_FALSE, (GLfloat*)viewMatrix.m);
+	glUniformMatrix4fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DEPTH_TEXTURE_PROJECTION), 1, GL_FALSE, (GLfloat*)Director::getCamera().getProjectionMatrix().m);
 	GLProgram::checkGLError();
 
 	static const Mat4& depthBiasMatrix = Mat4::createScale(Vec3(0.5f, 0.5f, 0.5f)) * Mat4::createTranslation(Vec3(1.0f, 1.0f, 1.0f));
 	glUniformMatrix4fv(
-		_glProgramForDeferredRendering.getUniformLocation("u_depthBiasMatrix"),
+		_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DEPTH_BIAS_MATRIX),
 		1,
 		GL_FALSE,
 		(GLfloat*)depthBiasMatrix.m
@@ -1016,19 +959,19 @@ void Renderer::renderDeferred()
 
 	glActiveTexture(GL_TEXTURE0);
 	glBindTexture(GL_TEXTURE_2D, getGBufferDepthStencil()->getTextureId());
-	glUniform1i(_glProgramForDeferredRendering.getUniformLocation("u_gBufferDepthStencil"), 0);
+	glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::G_BUFFER_DEPTH_STENCIL), 0);
 
 	glActiveTexture(GL_TEXTURE1);
 	glBindTexture(GL_TEXTURE_2D, getGBufferColorSpecularIntensity()->getTextureId());
-	glUniform1i(_glProgramForDeferredRendering.getUniformLocation("u_gBufferColorSpecularIntensity"), 1);
+	glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::G_BUFFER_COLOR_SPECULAR_INTENSITY), 1);
 
 	glActiveTexture(GL_TEXTURE2);
 	glBindTexture(GL_TEXTURE_2D, getGBufferNormal()->getTextureId());
-	glUniform1i(_glProgramForDeferredRendering.getUniformLocation("u_gBufferNormal"), 2);
+	glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::G_BUFFER_NORMAL), 2);
 
 	glActiveTexture(GL_TEXTURE3);
 	glBindTexture(GL_TEXTURE_2D, getGBufferSpecularPower()->getTextureId());
-	glUniform1i(_glProgramForDeferredRendering.getUniformLocation("u_gBufferSpecularPower"), 3);
+	glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::G_BUFFER_SPECULAR_POWER), 3);
 
 	glActiveTexture(GL_TEXTURE0);
 
@@ -1039,7 +982,7 @@ void Renderer::renderDeferred()
 	Logger::logAssert(ambientLight != nullptr, "V[ɃArGgCgȂB");
 	Color3B lightColor = ambientLight->getColor();
 	float intensity = ambientLight->getIntensity();
-	glUniform3f(_glProgramForDeferredRendering.getUniformLocation("u_ambientLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+	glUniform3f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::AMBIENT_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 	GLProgram::checkGLError();
 
 	// fBNViCg
@@ -1047,46 +990,45 @@ void Renderer::renderDeferred()
 	if (directionalLight != nullptr)
 	{
 		glUniform1i(
-			_glProgramForDeferredRendering.getUniformLocation("u_directionalLightIsValid"),
+			_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_IS_VALID),
 			1
 		);
 		GLProgram::checkGLError();
 
 		lightColor = directionalLight->getColor();
 		intensity = directionalLight->getIntensity();
-		glUniform3f(_glProgramForDeferredRendering.getUniformLocation("u_directionalLightColor"), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+		glUniform3f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_COLOR), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 		GLProgram::checkGLError();
 
 		Vec3 direction = directionalLight->getDirection();
 		direction.normalize();
-		glUniform3fv(_glProgramForDeferredRendering.getUniformLocation("u_directionalLightDirection"), 1, (GLfloat*)&direction);
+		glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_DIRECTION), 1, (GLfloat*)&direction);
 		GLProgram::checkGLError();
 
 		glUniform1i(
-			_glProgramForDeferredRendering.getUniformLocation("u_directionalLightHasShadowMap"),
+			_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_HAS_SHADOW_MAP),
 			directionalLight->hasShadowMap()
 		);
 
 		if (directionalLight->hasShadowMap())
 		{
 			glUniformMatrix4fv(
-				_glProgramForDeferredRendering.getUniformLocation("u_directionalLightViewMatrix"),
+				_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_VIEW_MATRIX),
 				1,
 				GL_FALSE,
 				(GLfloat*)directionalLight->getShadowMapData().viewMatrix.m
 			);
 
 			glUniformMatrix4fv(
-				_glProgramForDeferredRendering.getUniformLocation("u_directionalLightProjectionMatrix"),
+				_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::DIRECTIONAL_LIGHT_PROJECTION_MATRIX),
 				1,
 				GL_FALSE,
 				(GLfloat*)directionalLight->getShadowMapData().projectionMatrix.m
 			);
 
-			glActiveTexture(GL_TEXTURE4);
+			glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_DIRECTIONAL_LIGHT_SHADOW_MAP);
 			GLuint textureId = directionalLight->getShadowMapData().getDepthTexture()->getTextureId();
 			glBindTexture(GL_TEXTURE_2D, textureId);
-			glUniform1i(_glProgramForDeferredRendering.getUniformLocation("u_directionalLightShadowMap"), 4);
 			glActiveTexture(GL_TEXTURE0);
 		}
 	}
@@ -1098,44 +1040,44 @@ void Renderer::renderDeferred()
 		const PointLight* pointLight = scene.getPointLight(i);
 		if (pointLight != nullptr)
 		{
-			glUniform1i(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
-			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+			glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_IS_VALID, i), 1);
+			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 			GLProgram::checkGLError();
 
 			lightColor = pointLight->getColor();
 			intensity = pointLight->getIntensity();
-			glUniform3f(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-			//glUniform3f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			glUniform3f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			//glUniform3f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 
 			GLProgram::checkGLError();
 
-			glUniform3fv(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
-			//glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+			glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
+			//glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_POSITION, i), 1, (GLfloat*)&pointLight->getPosition()); // CgɂĂ̓[JWłȂ[hWłO
 			GLProgram::checkGLError();
 
-			glUniform1f(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / pointLight->getRange());
-			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / pointLight->getRange());
+			glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
+			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_RANGE_INVERSE, i), 1.0f / pointLight->getRange());
 			GLProgram::checkGLError();
 
 			glUniform1i(
-				glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+				_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 				pointLight->hasShadowMap()
 			);
 			//glUniform1i(
-			//	_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+			//	_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_HAS_SHADOW_MAP, i),
 			//	pointLight->hasShadowMap()
 			//);
 
 			if (pointLight->hasShadowMap())
 			{
 				glUniformMatrix4fv(
-					glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 					1,
 					GL_FALSE,
 					(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
 				);
 				//glUniformMatrix4fv(
-				//	_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_PROJECTION_MATRIX, i),
 				//	1,
 				//	GL_FALSE,
 				//	(GLfloat*)pointLight->getShadowMapData().projectionMatrix.m
@@ -1144,18 +1086,16 @@ void Renderer::renderDeferred()
 				for (int j = 0; j < (int)CubeMapFace::NUM_CUBEMAP_FACE; j++)
 				{
 					glUniformMatrix4fv(
-						glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightViewMatrices[") + std::to_string(j) + std::string("][") + std::to_string(i) + std::string("]")).c_str()),
+						_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::POINT_LIGHT_VIEW_MATRICES, j, i),
 						1,
 						GL_FALSE,
 						(GLfloat*)pointLight->getShadowMapData().viewMatrices[j].m
 					);
 				}
 
-				glActiveTexture(GL_TEXTURE5 + i);
+				glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_POINT_LIGHT_SHADOW_CUBE_MAP + i);
 				GLuint textureId = pointLight->getShadowMapData().getDepthTexture()->getTextureId();
 				glBindTexture(GL_TEXTURE_CUBE_MAP, textureId);
-				glUniform1i(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")).c_str()), 5 + i);
-				//glUniform1i(_glProgramForDeferredRendering.getUniformLocation(std::string("u_pointLightShadowCubeMap[") + std::to_string(i) + std::string("]")), 5 + i);
 				glActiveTexture(GL_TEXTURE0);
 			}
 		}
@@ -1167,94 +1107,85 @@ void Renderer::renderDeferred()
 		const SpotLight* spotLight = scene.getSpotLight(i);
 		if (spotLight != nullptr)
 		{
-			glUniform1i(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightIsValid[") + std::to_string(i) + std::string("]")).c_str()), 1);
+			glUniform1i(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_IS_VALID, i), 1);
 			GLProgram::checkGLError();
 
 			lightColor = spotLight->getColor();
 			intensity = spotLight->getIntensity();
-			glUniform3f(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")).c_str()), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
-			//glUniform3f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightColor[") + std::to_string(i) + std::string("]")), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			glUniform3f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
+			//glUniform3f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_COLOR, i), lightColor.r / 255.0f * intensity, lightColor.g / 255.0f * intensity, lightColor.b / 255.0f * intensity);
 			GLProgram::checkGLError();
 
-			glUniform3fv(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&spotLight->getPosition());
-			//glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightPosition[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&spotLight->getPosition());
+			glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
+			//glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_POSITION, i), 1, (GLfloat*)&spotLight->getPosition());
 			GLProgram::checkGLError();
 
 			Vec3 direction = spotLight->getDirection();
 			direction.normalize();
-			glUniform3fv(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")).c_str()), 1, (GLfloat*)&direction);
-			//glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightDirection[") + std::to_string(i) + std::string("]")), 1, (GLfloat*)&direction);
+			glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
+			//glUniform3fv(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_DIRECTION, i), 1, (GLfloat*)&direction);
 			GLProgram::checkGLError();
 
-			glUniform1f(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")).c_str()), 1.0f / spotLight->getRange());
-			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightRangeInverse[") + std::to_string(i) + std::string("]")), 1.0f / spotLight->getRange());
+			glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
+			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_RANGE_INVERSE, i), 1.0f / spotLight->getRange());
 			GLProgram::checkGLError();
 
-			glUniform1f(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getInnerAngleCos());
-			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightInnerAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getInnerAngleCos());
+			glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
+			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_INNER_ANGLE_COS, i), spotLight->getInnerAngleCos());
 			GLProgram::checkGLError();
 
-			glUniform1f(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")).c_str()), spotLight->getOuterAngleCos());
-			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightOuterAngleCos[") + std::to_string(i) + std::string("]")), spotLight->getOuterAngleCos());
+			glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
+			//glUniform1f(_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_OUTER_ANGLE_COS, i), spotLight->getOuterAngleCos());
 			GLProgram::checkGLError();
 
 			glUniform1i(
-				glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")).c_str()),
+				_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 				spotLight->hasShadowMap()
 			);
 			//glUniform1i(
-			//	_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightHasShadowMap[") + std::to_string(i) + std::string("]")),
+			//	_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_HAS_SHADOW_MAP, i),
 			//	spotLight->hasShadowMap()
 			//);
 
 			if (spotLight->hasShadowMap())
 			{
 				glUniformMatrix4fv(
-					glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 					1,
 					GL_FALSE,
 					(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 				);
 				//glUniformMatrix4fv(
-				//	_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightViewMatrix[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_VIEW_MATRIX, i),
 				//	1,
 				//	GL_FALSE,
 				//	(GLfloat*)spotLight->getShadowMapData().viewMatrix.m
 				//);
 
 				glUniformMatrix4fv(
-					glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")).c_str()),
+					_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 					1,
 					GL_FALSE,
 					(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 				);
 				//glUniformMatrix4fv(
-				//	_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightProjectionMatrix[") + std::to_string(i) + std::string("]")),
+				//	_glProgramForDeferredRendering.getUniformLocation(GLProgram::UniformID::SPOT_LIGHT_PROJECTION_MATRIX, i),
 				//	1,
 				//	GL_FALSE,
 				//	(GLfloat*)spotLight->getShadowMapData().projectionMatrix.m
 				//);
 
-				glActiveTexture(GL_TEXTURE9 + i);
+				glActiveTexture(GL_TEXTURE0 + GLProgram::TEXTURE_UNIT_SPOT_LIGHT_SHADOW_MAP + i);
 				GLuint textureId = spotLight->getShadowMapData().getDepthTexture()->getTextureId();
 				glBindTexture(GL_TEXTURE_2D, textureId);
-				glUniform1i(glGetUniformLocation(_glProgramForDeferredRendering.getShaderProgram(), (std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")).c_str()), 9 + i);
-				//glUniform1i(_glProgramForDeferredRendering.getUniformLocation(std::string("u_spotLightShadowMap[") + std::to_string(i) + std::string("]")), 9 + i);
 				glActiveTexture(GL_TEXTURE0);
 			}
 		}
 	}
 
-	glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
-	GLProgram::checkGLError();
-
-	glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
-	GLProgram::checkGLError();
-
-	glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.position);
-	glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position2DTextureCoordinates), (GLvoid*)&_quadrangle.topLeft.textureCoordinate);
-
+	_glVertexArrayForDeferredRendering.bind();
 	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	GLVertexArray::unbind();
 #endif
 }
 #endif // defined(MGRRENDERER_DEFERRED_RENDERING)
@@ -1342,6 +1273,7 @@ void Renderer::executeRenderCommand(RenderCommand* command)
 		}
 		break;
 	case RenderCommand::Type::CUSTOM:
+	case RenderCommand::Type::SPRITE_BATCH:
 		command->execute();
 		break;
 	default:
@@ -2,11 +2,15 @@
 #include "BasicDataTypes.h"
 #if defined(MGRRENDERER_USE_DIRECT3D)
 #include "D3DProgram.h"
+#include "ConstantRingBuffer.h"
 #elif defined(MGRRENDERER_USE_OPENGL)
 #include "GLProgram.h"
 #include "GLFrameBuffer.h"
+#include "GLVertexArray.h"
 #endif
 #include "CustomRenderCommand.h"
+#include "StreamingBuffer.h"
+#include "SpriteBatcher.h"
 #include <vector>
 #include <stack>
 
@@ -14,6 +18,7 @@ namespace mgrrenderer
 {
 
 class D3DTexture;
+class Image;
 class Light;
 
 class Renderer final
@@ -38,6 +43,8 @@ public:
 	void toggleDrawWireFrame() { _drawWireFrame = !_drawWireFrame; }
 	RenderMode getRenderMode() const { return _renderMode; }
 	void setRenderMode(RenderMode mode) { _renderMode = mode; }
+	// CPUŖt[钸_̏ݐ
+	StreamingBuffer& getStreamingVertexBuffer() { return _streamingVertexBuffer; }
 
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	IDXGISwapChain* getDirect3dSwapChain() const { return _direct3dSwapChain; }
@@ -48,15 +55,19 @@ public:
 	ID3D11SamplerState* getLinearSamplerState() const { return _linearSampler; }
 	ID3D11SamplerState* getPCFSamplerState() const { return _pcfSampler; }
 	ID3D11RasterizerState* getRasterizeStateCullFaceNormal() const { return _rasterizeStateNormal; }
+	ConstantRingBuffer& getConstantRingBuffer() { return _constantRingBuffer; }
 #endif
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
+	// Gobt@̎̂Scenẽt[Otꎞ\[XƂĊ蓖Ă̂ŁAt[compile()̌ɓn
 #if defined(MGRRENDERER_USE_DIRECT3D)
+	void setGBuffer(D3DTexture* depthStencil, D3DTexture* colorSpecularIntensity, D3DTexture* normal, D3DTexture* specularPower);
 	D3DTexture* getGBufferDepthStencil() const { return _gBufferDepthStencil; }
 	D3DTexture* getGBufferColorSpecularIntensity() const { return _gBufferColorSpecularIntensity; }
 	D3DTexture* getGBufferNormal() const { return _gBufferNormal; }
 	D3DTexture* getGBufferSpecularPower() const { return _gBufferSpecularPower; }
 #elif defined(MGRRENDERER_USE_OPENGL)
+	void setGBuffer(GLFrameBuffer* frameBuffer) { _gBufferFrameBuffer = frameBuffer; }
 	GLTexture* getGBufferDepthStencil() const { return _gBufferFrameBuffer->getTextures()[0]; }
 	GLTexture* getGBufferColorSpecularIntensity() const { return _gBufferFrameBuffer->getTextures()[1]; }
 	GLTexture* getGBufferNormal() const { return _gBufferFrameBuffer->getTextures()[2]; }
@@ -66,7 +77,13 @@ public:
 
 	// TODO:moveRXgN^gH
 	void addCommand(RenderCommand* command);
+	// lp`݂̃L[SpriteBatchRenderCommandɒǉB}eA̎lp`1̃h[ɂ܂Ƃ߂
+	void addSpriteQuads(const SpriteBatchRenderCommand::Material& material, const Position2DTextureCoordinates* vertices, size_t numQuads, const Mat4& modelMatrix, const Color4B& color);
 	void render();
+#if defined(MGRRENDERER_USE_OPENGL)
+	// ftHgt[obt@̓eRGBA8888outImageɓǂݖ߂BItXN[ł̉摜rɎg
+	bool readBackBuffer(Image& outImage) const;
+#endif
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 	void prepareGBufferRendering();
 	void prepareDeferredRendering();
@@ -86,6 +103,8 @@ private:
 	// CA[t[̂ݕ`悷郂[h
 	bool _drawWireFrame;
 	RenderMode _renderMode;
+	StreamingBuffer _streamingVertexBuffer;
+	SpriteBatcher _spriteBatcher;
 #if defined(MGRRENDERER_USE_DIRECT3D)
 	IDXGISwapChain* _direct3dSwapChain;
 	ID3D11Device* _direct3dDevice;
@@ -103,18 +122,21 @@ private:
 	ID3D11RasterizerState* _rasterizeStateWireFrame;
 	ID3D11BlendState* _blendState;
 	ID3D11BlendState* _blendStateTransparent;
+	ConstantRingBuffer _constantRingBuffer;
 #endif
 
 #if defined(MGRRENDERER_DEFERRED_RENDERING)
 #if defined(MGRRENDERER_USE_DIRECT3D)
+	// Gobt@͏LȂ
 	D3DTexture* _gBufferDepthStencil;
 	D3DTexture* _gBufferColorSpecularIntensity;
 	D3DTexture* _gBufferNormal;
 	D3DTexture* _gBufferSpecularPower;
 	D3DProgram _d3dProgramForDeferredRendering;
 #elif defined(MGRRENDERER_USE_OPENGL)
-	GLFrameBuffer* _gBufferFrameBuffer;
+	GLFrameBuffer* _gBufferFrameBuffer; // LȂ
 	GLProgram _glProgramForDeferredRendering;
+	GLVertexArray _glVertexArrayForDeferredRendering;
 #endif
 #endif // defined(MGRRENDERER_DEFERRED_RENDERING)
 
@@ -0,0 +1,552 @@
+#include "ShaderCache.h"
+#include "utility/Logger.h"
+#include "utility/FileUtility.h"
+#include "ShaderPermutation.h"
+#include <fstream>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "Director.h"
+#include <d3dcompiler.h>
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLProgram.h"
+#endif
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+namespace mgrrenderer
+{
+
+ShaderCache* ShaderCache::_instance = nullptr;
+
+// FNV-1a
+static const unsigned long long HASH_OFFSET_BASIS = 14695981039346656037ULL;
+static const unsigned long long HASH_PRIME = 1099511628211ULL;
+
+static unsigned long long hashBytes(unsigned long long hash, const void* data, size_t size)
+{
+	const unsigned char* bytes = static_cast<const unsigned char*>(data);
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= HASH_PRIME;
+	}
+
+	return hash;
+}
+
+static unsigned long long hashString(unsigned long long hash, const std::string& str)
+{
+	// ؂܂߂āAAʂɂȂʂ̑gݍ킹Ƌʂ
+	return hashBytes(hash, str.c_str(), str.size() + 1);
+}
+
+ShaderCache* ShaderCache::getInstance()
+{
+	if (_instance == nullptr)
+	{
+		_instance = new ShaderCache();
+	}
+
+	return _instance;
+}
+
+void ShaderCache::destroy()
+{
+	delete _instance;
+	_instance = nullptr;
+}
+
+ShaderCache::ShaderCache() : _diskCacheDirectory(findDiskCacheDirectory())
+{
+}
+
+ShaderCache::~ShaderCache()
+{
+	clear();
+}
+
+void ShaderCache::clear()
+{
+	for (std::pair<const unsigned long long, Entry>& entry : _entries)
+	{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		if (entry.second.shader != nullptr)
+		{
+			entry.second.shader->Release();
+		}
+
+		if (entry.second.blob != nullptr)
+		{
+			entry.second.blob->Release();
+		}
+#elif defined(MGRRENDERER_USE_OPENGL)
+		if (entry.second.program > 0)
+		{
+			glDeleteProgram(entry.second.program);
+		}
+#endif
+	}
+
+	_entries.clear();
+}
+
+static std::string getEnvironmentVariable(const char* name)
+{
+#if defined(_WIN32)
+	char* value = nullptr;
+	size_t length = 0;
+	if (_dupenv_s(&value, &length, name) != 0 || value == nullptr)
+	{
+		return std::string();
+	}
+
+	std::string ret(value);
+	free(value);
+	return ret;
+#else
+	const char* value = getenv(name);
+	return (value == nullptr) ? std::string() : std::string(value);
+#endif
+}
+
+std::string ShaderCache::findDiskCacheDirectory()
+{
+#if defined(_WIN32)
+	std::string baseDirectory = getEnvironmentVariable("LOCALAPPDATA");
+#else
+	// XDG Base Directory Specificationɏ]
+	std::string baseDirectory = getEnvironmentVariable("XDG_CACHE_HOME");
+	if (baseDirectory.empty())
+	{
+		std::string homeDirectory = getEnvironmentVariable("HOME");
+		if (!homeDirectory.empty())
+		{
+			baseDirectory = homeDirectory + "/.cache";
+		}
+	}
+#endif
+
+	if (baseDirectory.empty())
+	{
+		// [U[̃LbVfBNg킩Ȃł̓JgfBNgɒuB.gitignoreŏOĂ
+		return "ShaderCache";
+	}
+
+	return baseDirectory + "/MGRRenderer/ShaderCache";
+}
+
+std::string ShaderCache::getDiskCachePath(unsigned long long hash) const
+{
+	char fileName[32];
+	snprintf(fileName, sizeof(fileName), "%016llx", hash);
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	return _diskCacheDirectory + "/" + fileName + ".cso";
+#elif defined(MGRRENDERER_USE_OPENGL)
+	return _diskCacheDirectory + "/" + fileName + ".bin";
+#endif
+}
+
+static bool readFile(const std::string& path, std::vector<char>& outData)
+{
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file)
+	{
+		return false;
+	}
+
+	file.seekg(0, std::ios::end);
+	std::streamoff size = file.tellg();
+	file.seekg(0, std::ios::beg);
+
+	outData.resize(static_cast<size_t>(size));
+	if (size > 0)
+	{
+		file.read(outData.data(), size);
+	}
+
+	return !file.fail();
+}
+
+// r̃fBNg܂߂čBłɂfBNg̍쐬s͖Ă悢
+static void createDirectories(const std::string& path)
+{
+	size_t separatorPos = 0;
+	do
+	{
+		separatorPos = path.find_first_of("/\\", separatorPos + 1);
+		const std::string& directory = path.substr(0, separatorPos);
+#if defined(_WIN32)
+		CreateDirectoryA(directory.c_str(), nullptr);
+#else
+		mkdir(directory.c_str(), 0755);
+#endif
+	} while (separatorPos != std::string::npos);
+}
+
+bool ShaderCache::writeDiskCacheFile(unsigned long long hash, const void* data, size_t size) const
+{
+	createDirectories(_diskCacheDirectory);
+
+	const std::string& path = getDiskCachePath(hash);
+	std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		Logger::log("VF[_LbVt@CJȂBpath=%s", path.c_str());
+		return false;
+	}
+
+	file.write(static_cast<const char*>(data), size);
+	return !file.fail();
+}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+// #includeĂt@C̓enbVɊ܂߂ȂƁACN[ht@CύXƂɌÂLbVgĂ܂
+static unsigned long long hashSourceWithIncludes(unsigned long long hash, const std::string& path, size_t depth)
+{
+	std::vector<char> source;
+	if (!readFile(path, source))
+	{
+		Logger::logAssert(false, "VF[_t@Cǂ߂ȂBpath=%s", path.c_str());
+		return hash;
+	}
+
+	hash = hashBytes(hash, source.data(), source.size());
+
+	if (depth >= 16)
+	{
+		Logger::logAssert(false, "VF[_̃CN[h[Bpath=%s", path.c_str());
+		return hash;
+	}
+
+	std::string directory;
+	size_t slashPos = path.find_last_of("/\\");
+	if (slashPos != std::string::npos)
+	{
+		directory = path.substr(0, slashPos + 1);
+	}
+
+	std::istringstream stream(std::string(source.data(), source.size()));
+	std::string line;
+	while (std::getline(stream, line))
+	{
+		size_t includePos = line.find("#include");
+		if (includePos == std::string::npos)
+		{
+			continue;
+		}
+
+		size_t beginQuote = line.find('"', includePos);
+		size_t endQuote = (beginQuote == std::string::npos) ? std::string::npos : line.find('"', beginQuote + 1);
+		if (endQuote == std::string::npos)
+		{
+			continue;
+		}
+
+		hash = hashSourceWithIncludes(hash, directory + line.substr(beginQuote + 1, endQuote - beginQuote - 1), depth + 1);
+	}
+
+	return hash;
+}
+
+static const unsigned int COMPILE_FLAGS = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION | D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_PACK_MATRIX_COLUMN_MAJOR;
+
+unsigned long long ShaderCache::calculateHash(const std::string& path, const std::string& functionName, unsigned int features, const char* profile, unsigned int flags)
+{
+	unsigned long long hash = HASH_OFFSET_BASIS;
+	hash = hashSourceWithIncludes(hash, path, 0);
+	hash = hashString(hash, functionName);
+	hash = hashBytes(hash, &features, sizeof(features));
+	hash = hashString(hash, profile);
+	hash = hashBytes(hash, &flags, sizeof(flags));
+	return hash;
+}
+
+ID3DBlob* ShaderCache::loadBlob(unsigned long long hash) const
+{
+	std::vector<char> data;
+	if (!readFile(getDiskCachePath(hash), data) || data.empty())
+	{
+		return nullptr;
+	}
+
+	ID3DBlob* ret = nullptr;
+	HRESULT result = D3DCreateBlob(data.size(), &ret);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "D3DCreateBlob failed. result=%d", result);
+		return nullptr;
+	}
+
+	CopyMemory(ret->GetBufferPointer(), data.data(), data.size());
+	return ret;
+}
+
+void ShaderCache::saveBlob(unsigned long long hash, ID3DBlob* blob) const
+{
+	writeDiskCacheFile(hash, blob->GetBufferPointer(), blob->GetBufferSize());
+}
+
+const ShaderCache::Entry* ShaderCache::getEntry(const std::string& path, const std::string& functionName, unsigned int features, Stage stage)
+{
+	static const char* PROFILES[] = {"vs_4_0", "gs_4_0", "ps_4_0"};
+	const char* profile = PROFILES[static_cast<int>(stage)];
+
+	// ̃LbV̓pXƊ֐ƒ`ňB
+	// \[XƃCN[ht@CǂŃnbV̂́AfBXNLbṼLbV~X̂Ƃ
+	unsigned long long key = HASH_OFFSET_BASIS;
+	key = hashString(key, path);
+	key = hashString(key, functionName);
+	key = hashBytes(key, &features, sizeof(features));
+	key = hashString(key, profile);
+
+	std::unordered_map<unsigned long long, Entry>::const_iterator it = _entries.find(key);
+	if (it != _entries.end())
+	{
+		return &it->second;
+	}
+
+	unsigned long long hash = calculateHash(path, functionName, features, profile, COMPILE_FLAGS);
+
+	Entry entry;
+	entry.blob = loadBlob(hash);
+	entry.shader = nullptr;
+
+	if (entry.blob == nullptr)
+	{
+		WCHAR wPath[FileUtility::MAX_PATH_LENGTH] = { 0 };
+		FileUtility::convertWCHARFilePath(path, wPath, FileUtility::MAX_PATH_LENGTH);
+
+		const std::vector<D3D_SHADER_MACRO>& macros = ShaderPermutation::createD3DShaderMacros(features);
+
+		ID3DBlob* errMsg = nullptr;
+		HRESULT result = D3DCompileFromFile(
+			wPath,
+			macros.data(),
+			D3D_COMPILE_STANDARD_FILE_INCLUDE,
+			functionName.c_str(),
+			profile,
+			COMPILE_FLAGS,
+			0,
+			&entry.blob,
+			&errMsg
+		);
+		if (FAILED(result))
+		{
+			Logger::logAssert(false, "D3DX11CompileFromFile failed. result=%d. error message=%s", result, errMsg != nullptr ? errMsg->GetBufferPointer() : "");
+			if (errMsg != nullptr)
+			{
+				errMsg->Release();
+			}
+			return nullptr;
+		}
+
+		if (errMsg != nullptr)
+		{
+			errMsg->Release();
+		}
+
+		saveBlob(hash, entry.blob);
+	}
+
+	ID3D11Device* direct3dDevice = Director::getRenderer().getDirect3dDevice();
+	HRESULT result = E_FAIL;
+	switch (stage)
+	{
+	case Stage::VERTEX:
+		result = direct3dDevice->CreateVertexShader(entry.blob->GetBufferPointer(), entry.blob->GetBufferSize(), nullptr, reinterpret_cast<ID3D11VertexShader**>(&entry.shader));
+		break;
+	case Stage::GEOMETRY:
+		result = direct3dDevice->CreateGeometryShader(entry.blob->GetBufferPointer(), entry.blob->GetBufferSize(), nullptr, reinterpret_cast<ID3D11GeometryShader**>(&entry.shader));
+		break;
+	case Stage::PIXEL:
+		result = direct3dDevice->CreatePixelShader(entry.blob->GetBufferPointer(), entry.blob->GetBufferSize(), nullptr, reinterpret_cast<ID3D11PixelShader**>(&entry.shader));
+		break;
+	default:
+		Logger::logAssert(false, "ΉĂȂVF[_Xe[WB");
+		break;
+	}
+
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "Create shader failed. result=%d", result);
+		entry.blob->Release();
+		return nullptr;
+	}
+
+	return &_entries.insert(std::make_pair(key, entry)).first->second;
+}
+
+ID3D11VertexShader* ShaderCache::getVertexShader(const std::string& path, const std::string& functionName, unsigned int features, ID3DBlob** outBlob)
+{
+	const Entry* entry = getEntry(path, functionName, features, Stage::VERTEX);
+	if (entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	if (outBlob != nullptr)
+	{
+		entry->blob->AddRef();
+		*outBlob = entry->blob;
+	}
+
+	entry->shader->AddRef();
+	return static_cast<ID3D11VertexShader*>(entry->shader);
+}
+
+ID3D11GeometryShader* ShaderCache::getGeometryShader(const std::string& path, const std::string& functionName, unsigned int features)
+{
+	const Entry* entry = getEntry(path, functionName, features, Stage::GEOMETRY);
+	if (entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	entry->shader->AddRef();
+	return static_cast<ID3D11GeometryShader*>(entry->shader);
+}
+
+ID3D11PixelShader* ShaderCache::getPixelShader(const std::string& path, const std::string& functionName, unsigned int features)
+{
+	const Entry* entry = getEntry(path, functionName, features, Stage::PIXEL);
+	if (entry == nullptr)
+	{
+		return nullptr;
+	}
+
+	entry->shader->AddRef();
+	return static_cast<ID3D11PixelShader*>(entry->shader);
+}
+#elif defined(MGRRENDERER_USE_OPENGL)
+// t@C̐擪ɒuvOoCĩtH[}bg
+struct ProgramBinaryHeader
+{
+	GLenum format;
+	GLint length;
+};
+
+GLuint ShaderCache::loadProgramBinary(unsigned long long hash) const
+{
+	if (!GLProgram::isExtensionSupported("GL_ARB_get_program_binary"))
+	{
+		return 0;
+	}
+
+#if defined(MGRRENDERER_ENABLE_GL_CAPTURE)
+	// oCi̓hCoɈˑ̂ŁAL^̓\[XRpCĕʂ̊łĐł悤ɂ
+	if (GLCommandRecorder::isRecording())
+	{
+		return 0;
+	}
+#endif
+
+	std::vector<char> data;
+	if (!readFile(getDiskCachePath(hash), data) || data.size() <= sizeof(ProgramBinaryHeader))
+	{
+		return 0;
+	}
+
+	const ProgramBinaryHeader* header = reinterpret_cast<const ProgramBinaryHeader*>(data.data());
+	if (static_cast<size_t>(header->length) != data.size() - sizeof(ProgramBinaryHeader))
+	{
+		return 0;
+	}
+
+	GLuint ret = glCreateProgram();
+	glProgramBinary(ret, header->format, data.data() + sizeof(ProgramBinaryHeader), header->length);
+
+	// hCoXVƃoCi󂯕tȂȂ̂ŁȀꍇ̓RpC
+	GLint linkResult;
+	glGetProgramiv(ret, GL_LINK_STATUS, &linkResult);
+	if (linkResult == GL_FALSE)
+	{
+		glDeleteProgram(ret);
+		return 0;
+	}
+
+	return ret;
+}
+
+void ShaderCache::saveProgramBinary(unsigned long long hash, GLuint program) const
+{
+	if (!GLProgram::isExtensionSupported("GL_ARB_get_program_binary"))
+	{
+		return;
+	}
+
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+	{
+		return;
+	}
+
+	std::vector<char> data(sizeof(ProgramBinaryHeader) + length);
+	ProgramBinaryHeader* header = reinterpret_cast<ProgramBinaryHeader*>(data.data());
+	glGetProgramBinary(program, length, &header->length, &header->format, data.data() + sizeof(ProgramBinaryHeader));
+	GLProgram::checkGLError();
+
+	// NOGL_PROGRAM_BINARY_RETRIEVABLE_HINT𗧂ĂĂȂƎ擾łȂhCoBGLProgram::createShaderProgramŗĂĂ
+	writeDiskCacheFile(hash, data.data(), sizeof(ProgramBinaryHeader) + header->length);
+}
+
+GLuint ShaderCache::getProgram(const GLchar* vertexShaderStr, const GLchar* fragmentShaderStr)
+{
+	unsigned long long hash = HASH_OFFSET_BASIS;
+	hash = hashString(hash, vertexShaderStr);
+	hash = hashString(hash, fragmentShaderStr);
+
+	std::unordered_map<unsigned long long, Entry>::iterator it = _entries.find(hash);
+	if (it != _entries.end())
+	{
+		it->second.referenceCount++;
+		return it->second.program;
+	}
+
+	Entry entry;
+	entry.program = loadProgramBinary(hash);
+	entry.referenceCount = 1;
+
+	if (entry.program == 0)
+	{
+		entry.program = GLProgram::createShaderProgram(vertexShaderStr, fragmentShaderStr);
+		if (entry.program == 0)
+		{
+			return 0;
+		}
+
+		saveProgramBinary(hash, entry.program);
+	}
+
+	_entries[hash] = entry;
+	return entry.program;
+}
+
+void ShaderCache::releaseProgram(GLuint program)
+{
+	for (std::unordered_map<unsigned long long, Entry>::iterator it = _entries.begin(); it != _entries.end(); ++it)
+	{
+		if (it->second.program != program)
+		{
+			continue;
+		}
+
+		Logger::logAssert(it->second.referenceCount > 0, "QƃJEgsB");
+		it->second.referenceCount--;
+		if (it->second.referenceCount == 0)
+		{
+			glDeleteProgram(it->second.program);
+			_entries.erase(it);
+		}
+		return;
+	}
+
+	// cleařɉꂽvO͂łɍ폜ς
+}
+#endif
+
+} // namespace mgrrenderer
@@ -0,0 +1,84 @@
+#pragma once
+#include "Config.h"
+#include <string>
+#include <unordered_map>
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11.h>
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLHeader.h"
+#endif
+
+namespace mgrrenderer
+{
+
+// vZXŜŋLVF[_̃LbVB\[X̃VF[_͈xRpCAm[hԂŋL
+// RpCʂ̓\[X̃nbVt@CɂăfBXNɂۑAN̓RpCɓǂݍ
+// fBXNLbV̓JgfBNgȂ悤A[U[̃LbVfBNgɒu
+class ShaderCache final
+{
+public:
+	static ShaderCache* getInstance();
+	static void destroy();
+	// LbVĂQƂSĉBfoCXReLXgjOɌĂ
+	void clear();
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	// ԂVF[_AddRefς݂Ȃ̂ŁAĂяoReleaseBoutBlobnꍇ̓oCgR[hAddRefς݂ŕԂ
+	// featuresShaderPermutation::Featurẽrbg}XNŁAΉ}N`ăRpC
+	ID3D11VertexShader* getVertexShader(const std::string& path, const std::string& functionName, unsigned int features, ID3DBlob** outBlob);
+	ID3D11GeometryShader* getGeometryShader(const std::string& path, const std::string& functionName, unsigned int features);
+	ID3D11PixelShader* getPixelShader(const std::string& path, const std::string& functionName, unsigned int features);
+#elif defined(MGRRENDERER_USE_OPENGL)
+	// QƃJEg𑝂₵ăvOԂBsvɂȂreleaseProgramĂ
+	GLuint getProgram(const GLchar* vertexShaderStr, const GLchar* fragmentShaderStr);
+	void releaseProgram(GLuint program);
+#endif
+
+private:
+	static ShaderCache* _instance;
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	struct Entry
+	{
+		ID3DBlob* blob;
+		ID3D11DeviceChild* shader;
+	};
+#elif defined(MGRRENDERER_USE_OPENGL)
+	struct Entry
+	{
+		GLuint program;
+		size_t referenceCount;
+	};
+#endif
+
+	// D3D̓pXƊ֐ƒ`AGL̓\[X񂩂L[ň
+	std::unordered_map<unsigned long long, Entry> _entries;
+	std::string _diskCacheDirectory;
+
+	ShaderCache();
+	~ShaderCache();
+
+	static std::string findDiskCacheDirectory();
+	std::string getDiskCachePath(unsigned long long hash) const;
+	bool writeDiskCacheFile(unsigned long long hash, const void* data, size_t size) const;
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	enum class Stage : int
+	{
+		VERTEX,
+		GEOMETRY,
+		PIXEL,
+	};
+
+	const Entry* getEntry(const std::string& path, const std::string& functionName, unsigned int features, Stage stage);
+	static unsigned long long calculateHash(const std::string& path, const std::string& functionName, unsigned int features, const char* profile, unsigned int flags);
+	ID3DBlob* loadBlob(unsigned long long hash) const;
+	void saveBlob(unsigned long long hash, ID3DBlob* blob) const;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	GLuint loadProgramBinary(unsigned long long hash) const;
+	void saveProgramBinary(unsigned long long hash, GLuint program) const;
+#endif
+};
+
+} // namespace mgrrenderer
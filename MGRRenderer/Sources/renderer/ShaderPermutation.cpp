@@ -0,0 +1,81 @@
+#include "ShaderPermutation.h"
+#include "utility/Logger.h"
+
+namespace mgrrenderer
+{
+
+namespace ShaderPermutation
+{
+	static const char* FEATURE_MACRO_NAMES[NUM_FEATURES] =
+	{
+		"SKINNING",
+		"SHADOW_MAP",
+		"GBUFFER",
+		"ALPHA_TEST",
+	};
+
+	const char* getFeatureMacroName(size_t bitIndex)
+	{
+		Logger::logAssert(bitIndex < NUM_FEATURES, "@\̃rbg͈̔͊OBbitIndex=%d", static_cast<int>(bitIndex));
+		return FEATURE_MACRO_NAMES[bitIndex];
+	}
+
+	std::string createGLSLSource(const std::string& source, unsigned int features)
+	{
+		if (features == FEATURE_NONE)
+		{
+			return source;
+		}
+
+		std::string defines;
+		for (size_t i = 0; i < NUM_FEATURES; i++)
+		{
+			if ((features & (1u << i)) != 0)
+			{
+				defines += std::string("#define ") + FEATURE_MACRO_NAMES[i] + " 1\n";
+			}
+		}
+
+		// #version̓\[X̐擪̃fBNeBułȂ΂ȂȂ̂ŁA̎̍sɑ}
+		size_t versionPos = source.find("#version");
+		if (versionPos == std::string::npos)
+		{
+			return defines + source;
+		}
+
+		size_t lineEndPos = source.find('\n', versionPos);
+		if (lineEndPos == std::string::npos)
+		{
+			return source + "\n" + defines;
+		}
+
+		std::string ret = source;
+		ret.insert(lineEndPos + 1, defines);
+		return ret;
+	}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	std::vector<D3D_SHADER_MACRO> createD3DShaderMacros(unsigned int features)
+	{
+		std::vector<D3D_SHADER_MACRO> ret;
+		for (size_t i = 0; i < NUM_FEATURES; i++)
+		{
+			if ((features & (1u << i)) != 0)
+			{
+				D3D_SHADER_MACRO macro;
+				macro.Name = FEATURE_MACRO_NAMES[i];
+				macro.Definition = "1";
+				ret.push_back(macro);
+			}
+		}
+
+		D3D_SHADER_MACRO terminator;
+		terminator.Name = nullptr;
+		terminator.Definition = nullptr;
+		ret.push_back(terminator);
+		return ret;
+	}
+#endif
+} // namespace ShaderPermutation
+
+} // namespace mgrrenderer
@@ -0,0 +1,39 @@
+#pragma once
+#include "Config.h"
+#include <string>
+#include <vector>
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11.h>
+#endif
+
+namespace mgrrenderer
+{
+
+// 1̃VF[_\[XA@\̃rbg}XNɉ#definetăoG[V
+// oG[VƂ̃RpCʂShaderCache}XÑ݂L[ŃLbV
+// pX̃rbgiSHADOW_MAPAGBUFFERj͕`悷pXASKINNINGALPHA_TEST̓fƃ}eA߂
+// static\bhȂ̂ŃNXĂȂ
+namespace ShaderPermutation
+{
+	enum Feature : unsigned int
+	{
+		FEATURE_NONE = 0,
+		FEATURE_SKINNING = 1 << 0, // WCg}gbNXpbgɂXLjO
+		FEATURE_SHADOW_MAP = 1 << 1, // VhE}bvւ̐[x`
+		FEATURE_GBUFFER = 1 << 2, // fBt@[h_OGobt@ւ̕`
+		FEATURE_ALPHA_TEST = 1 << 3, // eNX`̃At@ŃsNẐĂ
+
+		NUM_FEATURES = 4,
+	};
+
+	// @\̃rbgɑΉ}N
+	const char* getFeatureMacroName(size_t bitIndex);
+	// GLSL#version̎̍sɋ@\}XN#define}\[XԂ
+	std::string createGLSLSource(const std::string& source, unsigned int features);
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	// D3DCompileFromFileɓn}NzBnullptrŏI[Ă
+	std::vector<D3D_SHADER_MACRO> createD3DShaderMacros(unsigned int features);
+#endif
+} // namespace ShaderPermutation
+
+} // namespace mgrrenderer
@@ -1,8 +1,7 @@
 #pragma once
 #include "Config.h"
 #if defined(MGRRENDERER_USE_OPENGL)
-#define GLEW_STATIC
-#include <glew/include/glew.h>
+#include "GLHeader.h"
 
 namespace mgrrenderer
 {
@@ -0,0 +1,694 @@
+#include "SoftwareDeferredRenderer.h"
+#include "Image.h"
+#include "MeshIndices.h"
+#include "TextureUtility.h"
+#include "utility/JobScheduler.h"
+#include "utility/Logger.h"
+#include "utility/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace mgrrenderer
+{
+
+// FragmentShaderDeferredLighting.glslz-fighting邽߂̐[x̃ItZbg
+static const float DIRECTIONAL_LIGHT_SHADOW_DEPTH_OFFSET = 0.005f;
+static const float SPOT_LIGHT_SHADOW_DEPTH_OFFSET = 0.05f;
+// VF[_̓|CgCg̐[x𐳋KfoCXW0.025炵Ă邪Ał͐[x̐xĉeSď̂ŁACg̋̊ł炷
+static const float POINT_LIGHT_SHADOW_DISTANCE_OFFSET_RATIO = 0.025f;
+// rWreBobt@ŉ`ĂȂsNZ̎Op`ԍ
+static const float NO_TRIANGLE_ID = -1.0f;
+// floatŎOp`ԍ덷Ȃ\
+static const size_t MAX_NUM_TRIANGLES = 1 << 24;
+// _̍Wϊ1Wuŏ钸_
+static const size_t NUM_VERTICES_PER_JOB = 1024;
+
+static Vec3 transformPosition(const Mat4& matrix, const Vec3& position)
+{
+	return Vec3(
+		matrix.m[0][0] * position.x + matrix.m[1][0] * position.y + matrix.m[2][0] * position.z + matrix.m[3][0],
+		matrix.m[0][1] * position.x + matrix.m[1][1] * position.y + matrix.m[2][1] * position.z + matrix.m[3][1],
+		matrix.m[0][2] * position.x + matrix.m[1][2] * position.y + matrix.m[2][2] * position.z + matrix.m[3][2]
+	);
+}
+
+// Mat4 * Vec4wvZȂ̂ŁAϊ̓W͂ŋ߂
+static Vec4 transformToClip(const Mat4& matrix, const Vec3& position)
+{
+	return Vec4(
+		matrix.m[0][0] * position.x + matrix.m[1][0] * position.y + matrix.m[2][0] * position.z + matrix.m[3][0],
+		matrix.m[0][1] * position.x + matrix.m[1][1] * position.y + matrix.m[2][1] * position.z + matrix.m[3][1],
+		matrix.m[0][2] * position.x + matrix.m[1][2] * position.y + matrix.m[2][2] * position.z + matrix.m[3][2],
+		matrix.m[0][3] * position.x + matrix.m[1][3] * position.y + matrix.m[2][3] * position.z + matrix.m[3][3]
+	);
+}
+
+// m[}s͕sړ3x3̕g
+static Vec3 transformDirection(const Mat4& matrix, const Vec3& direction)
+{
+	return Vec3(
+		matrix.m[0][0] * direction.x + matrix.m[1][0] * direction.y + matrix.m[2][0] * direction.z,
+		matrix.m[0][1] * direction.x + matrix.m[1][1] * direction.y + matrix.m[2][1] * direction.z,
+		matrix.m[0][2] * direction.x + matrix.m[1][2] * direction.y + matrix.m[2][2] * direction.z
+	);
+}
+
+// GLSLnormalizeƓA0̃xNgłAT[gɂ̂܂ܕԂ
+static Vec3 normalizeOrZero(const Vec3& v)
+{
+	float length = v.length();
+	return (length > 0.0f) ? v / length : v;
+}
+
+static float clamp01(float value)
+{
+	return (std::min)((std::max)(value, 0.0f), 1.0f);
+}
+
+static float smoothstep(float edge0, float edge1, float x)
+{
+	if (edge0 == edge1)
+	{
+		return (x < edge0) ? 0.0f : 1.0f;
+	}
+
+	float t = clamp01((x - edge0) / (edge1 - edge0));
+	return t * t * (3.0f - 2.0f * t);
+}
+
+// OpenGL̃eNX`W(s, t)ł̃VhE}bv̐[xBt͉0Ȃ̂ŁA㌴_̐[xobt@ł͍s𔽓]ēǂ
+// VhE}bṽeNX`ƓGL_CLAMP_TO_EDGEŔ͈͊O͒[̒lg
+static float sampleShadowMapDepth(const SoftwareRasterizer& shadowMap, float s, float t)
+{
+	const SizeUint& size = shadowMap.getSize();
+	int x = static_cast<int>(std::floor(s * size.width));
+	int y = static_cast<int>(std::floor((1.0f - t) * size.height));
+	x = (std::min)((std::max)(x, 0), static_cast<int>(size.width) - 1);
+	y = (std::min)((std::max)(y, 0), static_cast<int>(size.height) - 1);
+	return shadowMap.getDepthBuffer()[static_cast<size_t>(y) * size.width + static_cast<size_t>(x)];
+}
+
+SoftwareDeferredRenderer::SoftwareDeferredRenderer() :
+_numVertexSets(0),
+_numMeshes(0),
+_numTriangles(0),
+_hasDirectionalLight(false)
+{
+}
+
+bool SoftwareDeferredRenderer::init(const SizeUint& size)
+{
+	if (!_gBuffer.init(size))
+	{
+		return false;
+	}
+
+	_colorBuffer.resize(size.width * size.height);
+	return true;
+}
+
+void SoftwareDeferredRenderer::beginFrame(const Mat4& viewMatrix, const Mat4& projectionMatrix)
+{
+	_viewMatrix = viewMatrix;
+	_projectionMatrix = projectionMatrix;
+	_numVertexSets = 0;
+	_numMeshes = 0;
+	_numTriangles = 0;
+	_ambientLightColor = Vec3(0.0f, 0.0f, 0.0f);
+	_hasDirectionalLight = false;
+	_pointLights.clear();
+	_spotLights.clear();
+}
+
+size_t SoftwareDeferredRenderer::addVertices(const Mat4& modelMatrix, const Position3DNormalTextureCoordinates* vertices, size_t numVertices)
+{
+	if (_numVertexSets == _vertexSets.size())
+	{
+		_vertexSets.push_back(VertexSet());
+	}
+
+	VertexSet& vertexSet = _vertexSets[_numVertexSets];
+	vertexSet.modelMatrix = modelMatrix;
+	vertexSet.vertices.assign(vertices, vertices + numVertices);
+	return _numVertexSets++;
+}
+
+size_t SoftwareDeferredRenderer::addVertices(const Mat4& modelMatrix, const Vec3* positions, const Vec3* normals, size_t numVertices)
+{
+	size_t verticesIndex = addVertices(modelMatrix, nullptr, 0);
+	std::vector<Position3DNormalTextureCoordinates>& vertices = _vertexSets[verticesIndex].vertices;
+	vertices.resize(numVertices);
+	for (size_t i = 0; i < numVertices; i++)
+	{
+		vertices[i].position = positions[i];
+		vertices[i].normal = normals[i];
+		vertices[i].textureCoordinate = Vec2(0.0f, 0.0f);
+	}
+
+	return verticesIndex;
+}
+
+void SoftwareDeferredRenderer::addMesh(size_t verticesIndex, const MeshIndices* indices, const std::string& textureFilePath, const Color3F& multiplyColor, bool isAlphaTestEnabled)
+{
+	Logger::logAssert(verticesIndex < _numVertexSets, "addVerticesœo^ĂȂ_̔ԍBverticesIndex=%d", static_cast<int>(verticesIndex));
+
+	if (_numMeshes == _meshes.size())
+	{
+		_meshes.push_back(Mesh());
+	}
+
+	Mesh& mesh = _meshes[_numMeshes];
+	mesh.verticesIndex = verticesIndex;
+	if (indices != nullptr)
+	{
+		mesh.indices.resize(indices->getNumIndices());
+		for (size_t i = 0; i < mesh.indices.size(); i++)
+		{
+			mesh.indices[i] = indices->getIndex(i);
+		}
+	}
+	else
+	{
+		mesh.indices.resize(_vertexSets[verticesIndex].vertices.size());
+		for (size_t i = 0; i < mesh.indices.size(); i++)
+		{
+			mesh.indices[i] = static_cast<unsigned int>(i);
+		}
+	}
+
+	mesh.texture = findTexture(textureFilePath);
+	mesh.multiplyColor = multiplyColor;
+	mesh.isAlphaTestEnabled = isAlphaTestEnabled;
+	mesh.firstTriangleId = _numTriangles;
+	_numTriangles += mesh.indices.size() / 3;
+	Logger::logAssert(_numTriangles <= MAX_NUM_TRIANGLES, "rWreBobt@ŕ\Op`𒴂BnumTriangles=%d", static_cast<int>(_numTriangles));
+	_numMeshes++;
+}
+
+void SoftwareDeferredRenderer::setAmbientLight(const AmbientLight* light)
+{
+	Logger::logAssert(light != nullptr, "CgnullłȂOB");
+	Color3F color(light->getColor());
+	_ambientLightColor = color.color * light->getIntensity();
+}
+
+void SoftwareDeferredRenderer::setDirectionalLight(const DirectionalLight* light)
+{
+	Logger::logAssert(light != nullptr, "CgnullłȂOB");
+	_hasDirectionalLight = true;
+
+	Color3F color(light->getColor());
+	_directionalLight.color = color.color * light->getIntensity();
+	_directionalLight.direction = normalizeOrZero(light->getDirection());
+	_directionalLight.hasShadowMap = light->hasShadowMap();
+	if (_directionalLight.hasShadowMap)
+	{
+		_directionalLight.shadowMapSize = light->getShadowMapData().size;
+		_directionalLight.shadowMapProjectionMatrix = light->getShadowMapData().projectionMatrix;
+		_directionalLight.shadowMapViewMatrices[0] = light->getShadowMapData().viewMatrix;
+	}
+}
+
+void SoftwareDeferredRenderer::addPointLight(const PointLight* light)
+{
+	Logger::logAssert(light != nullptr, "CgnullłȂOB");
+	Logger::logAssert(_pointLights.size() < PointLight::MAX_NUM, "|CgCg̐𒴂B");
+
+	LightParameter parameter;
+	Color3F color(light->getColor());
+	parameter.color = color.color * light->getIntensity();
+	// CgɂĂ̓[JWłȂ[hWłO
+	parameter.position = light->getPosition();
+	parameter.rangeInverse = 1.0f / light->getRange();
+	parameter.hasShadowMap = light->hasShadowMap();
+	if (parameter.hasShadowMap)
+	{
+		parameter.shadowMapSize = light->getShadowMapData().size;
+		parameter.shadowMapProjectionMatrix = light->getShadowMapData().projectionMatrix;
+		for (size_t face = 0; face < (size_t)CubeMapFace::NUM_CUBEMAP_FACE; face++)
+		{
+			parameter.shadowMapViewMatrices[face] = light->getShadowMapData().viewMatrices[face];
+		}
+	}
+
+	_pointLights.push_back(parameter);
+}
+
+void SoftwareDeferredRenderer::addSpotLight(const SpotLight* light)
+{
+	Logger::logAssert(light != nullptr, "CgnullłȂOB");
+	Logger::logAssert(_spotLights.size() < SpotLight::MAX_NUM, "X|bgCg̐𒴂B");
+
+	LightParameter parameter;
+	Color3F color(light->getColor());
+	parameter.color = color.color * light->getIntensity();
+	parameter.position = light->getPosition();
+	parameter.direction = normalizeOrZero(light->getDirection());
+	parameter.rangeInverse = 1.0f / light->getRange();
+	parameter.innerAngleCos = light->getInnerAngleCos();
+	parameter.outerAngleCos = light->getOuterAngleCos();
+	parameter.hasShadowMap = light->hasShadowMap();
+	if (parameter.hasShadowMap)
+	{
+		parameter.shadowMapSize = light->getShadowMapData().size;
+		parameter.shadowMapProjectionMatrix = light->getShadowMapData().projectionMatrix;
+		parameter.shadowMapViewMatrices[0] = light->getShadowMapData().viewMatrix;
+	}
+
+	_spotLights.push_back(parameter);
+}
+
+void SoftwareDeferredRenderer::render()
+{
+	MGRRENDERER_PROFILE_SCOPE("SoftwareDeferredRenderer::render");
+
+	transformVertices();
+
+	{
+		MGRRENDERER_PROFILE_SCOPE("SoftwareDeferredRenderer::renderShadowMaps");
+
+		if (_hasDirectionalLight && _directionalLight.hasShadowMap)
+		{
+			renderShadowMap(_directionalLightShadowMap, _directionalLight.shadowMapSize, _directionalLight.shadowMapProjectionMatrix * _directionalLight.shadowMapViewMatrices[0]);
+		}
+
+		for (size_t i = 0; i < _pointLights.size(); i++)
+		{
+			const LightParameter& light = _pointLights[i];
+			if (!light.hasShadowMap)
+			{
+				continue;
+			}
+
+			// L[u}bvȂ̂widthgȂ
+			const SizeUint size(light.shadowMapSize.width, light.shadowMapSize.width);
+			for (size_t face = 0; face < (size_t)CubeMapFace::NUM_CUBEMAP_FACE; face++)
+			{
+				renderShadowMap(_pointLightShadowMaps[i][face], size, light.shadowMapProjectionMatrix * light.shadowMapViewMatrices[face]);
+			}
+		}
+
+		for (size_t i = 0; i < _spotLights.size(); i++)
+		{
+			const LightParameter& light = _spotLights[i];
+			if (light.hasShadowMap)
+			{
+				renderShadowMap(_spotLightShadowMaps[i], light.shadowMapSize, light.shadowMapProjectionMatrix * light.shadowMapViewMatrices[0]);
+			}
+		}
+	}
+
+	renderGBuffer();
+	renderLighting();
+}
+
+bool SoftwareDeferredRenderer::readColorBuffer(Image& outImage) const
+{
+	const SizeUint& size = getSize();
+	std::vector<unsigned char> pixels(_colorBuffer.size() * 4);
+	for (size_t i = 0; i < _colorBuffer.size(); i++)
+	{
+		const Vec4& color = _colorBuffer[i].color;
+		pixels[i * 4 + 0] = static_cast<unsigned char>(clamp01(color.r) * 255.0f + 0.5f);
+		pixels[i * 4 + 1] = static_cast<unsigned char>(clamp01(color.g) * 255.0f + 0.5f);
+		pixels[i * 4 + 2] = static_cast<unsigned char>(clamp01(color.b) * 255.0f + 0.5f);
+		pixels[i * 4 + 3] = static_cast<unsigned char>(clamp01(color.a) * 255.0f + 0.5f);
+	}
+
+	return outImage.initWithRawData(pixels.data(), pixels.size(), size.width, size.height, TextureUtility::PixelFormat::RGBA8888, false);
+}
+
+const SoftwareDeferredRenderer::SoftwareTexture* SoftwareDeferredRenderer::findTexture(const std::string& filePath)
+{
+	if (filePath.empty())
+	{
+		return nullptr;
+	}
+
+	std::map<std::string, SoftwareTexture>::iterator it = _textureCache.find(filePath);
+	if (it == _textureCache.end())
+	{
+		// ǂݍ߂ȂpX0œo^ĂAt[ǂݒȂ悤ɂ
+		it = _textureCache.insert(std::make_pair(filePath, SoftwareTexture())).first;
+		SoftwareTexture& texture = it->second;
+
+		Image image; // ImageCPŨgĂ̂ł̃XR[vŉĂ悢̂X^bNɎ
+		if (image.initWithFilePath(filePath))
+		{
+			unsigned char* convertedData = nullptr;
+			size_t convertedDataLen = 0;
+			TextureUtility::PixelFormat toFormat = TextureUtility::convertDataToFormat(image.getRawData(), image.getRawDataLength(), image.getPixelFormat(), TextureUtility::PixelFormat::RGBA8888, &convertedData, &convertedDataLen);
+			if (toFormat == TextureUtility::PixelFormat::RGBA8888 && convertedDataLen == static_cast<size_t>(image.getWidth()) * image.getHeight() * 4)
+			{
+				texture.width = image.getWidth();
+				texture.height = image.getHeight();
+				texture.pixels.assign(convertedData, convertedData + convertedDataLen);
+			}
+
+			if (convertedData != nullptr && convertedData != image.getRawData())
+			{
+				free(convertedData);
+			}
+		}
+
+		Logger::logAssert(texture.width > 0, "SoftwareDeferredRendererŃeNX`쐬ɎsBfilePath=%s", filePath.c_str());
+	}
+
+	return (it->second.width > 0) ? &it->second : nullptr;
+}
+
+Vec4 SoftwareDeferredRenderer::sampleTexture(const SoftwareTexture* texture, const Vec2& textureCoordinate)
+{
+	if (texture == nullptr)
+	{
+		return Vec4(1.0f, 1.0f, 1.0f, 1.0f);
+	}
+
+	// objAc3b̎ɍ킹Ē_VF[_v𔽓]ĂBeNX`0sڂ͉摜̈ԏ̍s
+	float x = textureCoordinate.x * texture->width - 0.5f;
+	float y = (1.0f - textureCoordinate.y) * texture->height - 0.5f;
+	float floorX = std::floor(x);
+	float floorY = std::floor(y);
+	float fractionX = x - floorX;
+	float fractionY = y - floorY;
+	int maxX = static_cast<int>(texture->width) - 1;
+	int maxY = static_cast<int>(texture->height) - 1;
+	int x0 = (std::min)((std::max)(static_cast<int>(floorX), 0), maxX);
+	int x1 = (std::min)((std::max)(static_cast<int>(floorX) + 1, 0), maxX);
+	int y0 = (std::min)((std::max)(static_cast<int>(floorY), 0), maxY);
+	int y1 = (std::min)((std::max)(static_cast<int>(floorY) + 1, 0), maxY);
+
+	float weights[4] = {(1.0f - fractionX) * (1.0f - fractionY), fractionX * (1.0f - fractionY), (1.0f - fractionX) * fractionY, fractionX * fractionY};
+	size_t offsets[4] = {
+		(static_cast<size_t>(y0) * texture->width + x0) * 4,
+		(static_cast<size_t>(y0) * texture->width + x1) * 4,
+		(static_cast<size_t>(y1) * texture->width + x0) * 4,
+		(static_cast<size_t>(y1) * texture->width + x1) * 4,
+	};
+
+	float color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	for (size_t i = 0; i < 4; i++)
+	{
+		for (size_t channel = 0; channel < 4; channel++)
+		{
+			color[channel] += texture->pixels[offsets[i] + channel] * weights[i];
+		}
+	}
+
+	return Vec4(color[0] / 255.0f, color[1] / 255.0f, color[2] / 255.0f, color[3] / 255.0f);
+}
+
+void SoftwareDeferredRenderer::transformVertices()
+{
+	MGRRENDERER_PROFILE_SCOPE("SoftwareDeferredRenderer::transformVertices");
+
+	for (size_t i = 0; i < _numVertexSets; i++)
+	{
+		VertexSet& vertexSet = _vertexSets[i];
+		const Mat4& normalMatrix = Mat4::createNormalMatrix(vertexSet.modelMatrix);
+		size_t numVertices = vertexSet.vertices.size();
+		size_t numJobs = (numVertices + NUM_VERTICES_PER_JOB - 1) / NUM_VERTICES_PER_JOB;
+		JobScheduler::getInstance()->parallelFor(numJobs, [&](size_t jobIndex)
+		{
+			size_t end = (std::min)((jobIndex + 1) * NUM_VERTICES_PER_JOB, numVertices);
+			for (size_t j = jobIndex * NUM_VERTICES_PER_JOB; j < end; j++)
+			{
+				Position3DNormalTextureCoordinates& vertex = vertexSet.vertices[j];
+				vertex.position = transformPosition(vertexSet.modelMatrix, vertex.position);
+				// _VF[_Ɠ_ƂɐK
+				vertex.normal = normalizeOrZero(transformDirection(normalMatrix, vertex.normal));
+			}
+		});
+	}
+}
+
+void SoftwareDeferredRenderer::renderShadowMap(SoftwareRasterizer& shadowMap, const SizeUint& size, const Mat4& viewProjectionMatrix)
+{
+	if (shadowMap.getSize().width != size.width || shadowMap.getSize().height != size.height)
+	{
+		if (!shadowMap.init(size))
+		{
+			return;
+		}
+	}
+
+	shadowMap.clear(Color4F(0.0f, 0.0f, 0.0f, 0.0f), 1.0f);
+
+	for (size_t i = 0; i < _numVertexSets; i++)
+	{
+		VertexSet& vertexSet = _vertexSets[i];
+		vertexSet.clipPositions.resize(vertexSet.vertices.size());
+		for (size_t j = 0; j < vertexSet.vertices.size(); j++)
+		{
+			vertexSet.clipPositions[j] = transformToClip(viewProjectionMatrix, vertexSet.vertices[j].position);
+		}
+	}
+
+	for (size_t i = 0; i < _numMeshes; i++)
+	{
+		const Mesh& mesh = _meshes[i];
+		const VertexSet& vertexSet = _vertexSets[mesh.verticesIndex];
+		// [xgȂ̂ŁAAt@eXgȂbV͐FvZȂ
+		SoftwareRasterizer::PixelShader pixelShader;
+		if (mesh.isAlphaTestEnabled)
+		{
+			pixelShader = [&mesh, &vertexSet](size_t triangleIndex, const Vec3& barycentric)
+			{
+				const Vec2& textureCoordinate = vertexSet.vertices[mesh.indices[triangleIndex * 3]].textureCoordinate * barycentric.x
+					+ vertexSet.vertices[mesh.indices[triangleIndex * 3 + 1]].textureCoordinate * barycentric.y
+					+ vertexSet.vertices[mesh.indices[triangleIndex * 3 + 2]].textureCoordinate * barycentric.z;
+				return Color4F(0.0f, 0.0f, 0.0f, sampleTexture(mesh.texture, textureCoordinate).w);
+			};
+		}
+		else
+		{
+			pixelShader = [](size_t, const Vec3&) { return Color4F(0.0f, 0.0f, 0.0f, 1.0f); };
+		}
+
+		shadowMap.drawTriangles(vertexSet.clipPositions, mesh.indices, pixelShader, SoftwareRasterizer::BlendMode::NONE, true, true, mesh.isAlphaTestEnabled);
+	}
+
+	shadowMap.flush();
+}
+
+void SoftwareDeferredRenderer::renderGBuffer()
+{
+	MGRRENDERER_PROFILE_SCOPE("SoftwareDeferredRenderer::renderGBuffer");
+
+	// [xRenderer::prepareGBufferRenderingƓ1ŃNA
+	_gBuffer.clear(Color4F(NO_TRIANGLE_ID, 0.0f, 0.0f, 0.0f), 1.0f);
+
+	const Mat4& viewProjectionMatrix = _projectionMatrix * _viewMatrix;
+	for (size_t i = 0; i < _numVertexSets; i++)
+	{
+		VertexSet& vertexSet = _vertexSets[i];
+		vertexSet.clipPositions.resize(vertexSet.vertices.size());
+		for (size_t j = 0; j < vertexSet.vertices.size(); j++)
+		{
+			vertexSet.clipPositions[j] = transformToClip(viewProjectionMatrix, vertexSet.vertices[j].position);
+		}
+	}
+
+	for (size_t i = 0; i < _numMeshes; i++)
+	{
+		const Mesh& mesh = _meshes[i];
+		const VertexSet& vertexSet = _vertexSets[mesh.verticesIndex];
+		// Op`ԍƏdSW2BAt@̓At@eXgɂg
+		SoftwareRasterizer::PixelShader pixelShader = [&mesh, &vertexSet](size_t triangleIndex, const Vec3& barycentric)
+		{
+			float alpha = 1.0f;
+			if (mesh.isAlphaTestEnabled)
+			{
+				const Vec2& textureCoordinate = vertexSet.vertices[mesh.indices[triangleIndex * 3]].textureCoordinate * barycentric.x
+					+ vertexSet.vertices[mesh.indices[triangleIndex * 3 + 1]].textureCoordinate * barycentric.y
+					+ vertexSet.vertices[mesh.indices[triangleIndex * 3 + 2]].textureCoordinate * barycentric.z;
+				alpha = sampleTexture(mesh.texture, textureCoordinate).w;
+			}
+
+			return Color4F(static_cast<float>(mesh.firstTriangleId + triangleIndex), barycentric.y, barycentric.z, alpha);
+		};
+
+		_gBuffer.drawTriangles(vertexSet.clipPositions, mesh.indices, pixelShader, SoftwareRasterizer::BlendMode::NONE, true, true, mesh.isAlphaTestEnabled);
+	}
+
+	_gBuffer.flush();
+}
+
+void SoftwareDeferredRenderer::renderLighting()
+{
+	MGRRENDERER_PROFILE_SCOPE("SoftwareDeferredRenderer::renderLighting");
+
+	const SizeUint& size = getSize();
+	// sƂɏމfdȂȂ̂ŁAbNȂɕ񉻂ł
+	JobScheduler::getInstance()->parallelFor(size.height, [this, &size](size_t y)
+	{
+		for (size_t x = 0; x < size.width; x++)
+		{
+			size_t pixelIndex = y * size.width + x;
+			_colorBuffer[pixelIndex] = computeLightedColor(pixelIndex);
+		}
+	});
+}
+
+Color4F SoftwareDeferredRenderer::computeLightedColor(size_t pixelIndex) const
+{
+	// Gobt@NAFƐ[xCeBOƍɂȂ
+	const Vec4& visibility = _gBuffer.getColorBuffer()[pixelIndex].color;
+	if (visibility.x == NO_TRIANGLE_ID)
+	{
+		return Color4F(0.0f, 0.0f, 0.0f, 1.0f);
+	}
+
+	// Op`ԍ烁bV񕪒TAGobt@̐FƖ@ƃ[hW𕜌
+	size_t triangleId = static_cast<size_t>(visibility.x);
+	std::vector<Mesh>::const_iterator meshIterator = std::upper_bound(_meshes.begin(), _meshes.begin() + _numMeshes, triangleId, [](size_t id, const Mesh& mesh) { return id < mesh.firstTriangleId; });
+	const Mesh& mesh = *(meshIterator - 1);
+	const VertexSet& vertexSet = _vertexSets[mesh.verticesIndex];
+	size_t triangleIndex = triangleId - mesh.firstTriangleId;
+	const Position3DNormalTextureCoordinates& v0 = vertexSet.vertices[mesh.indices[triangleIndex * 3]];
+	const Position3DNormalTextureCoordinates& v1 = vertexSet.vertices[mesh.indices[triangleIndex * 3 + 1]];
+	const Position3DNormalTextureCoordinates& v2 = vertexSet.vertices[mesh.indices[triangleIndex * 3 + 2]];
+	float b1 = visibility.y;
+	float b2 = visibility.z;
+	float b0 = 1.0f - b1 - b2;
+
+	const Vec3& worldPosition = v0.position * b0 + v1.position * b1 + v2.position * b2;
+	// Gobt@̃sNZVF[_ƓAԂ@𐳋KɎg
+	const Vec3& normal = v0.normal * b0 + v1.normal * b1 + v2.normal * b2;
+	const Vec2& textureCoordinate = v0.textureCoordinate * b0 + v1.textureCoordinate * b1 + v2.textureCoordinate * b2;
+	const Vec4& textureColor = sampleTexture(mesh.texture, textureCoordinate);
+	Vec3 color(textureColor.x * mesh.multiplyColor.color.x, textureColor.y * mesh.multiplyColor.color.y, textureColor.z * mesh.multiplyColor.color.z);
+
+	Vec3 diffuseLightColor(0.0f, 0.0f, 0.0f);
+
+	if (_hasDirectionalLight)
+	{
+		float shadowAttenuation = 1.0f;
+		if (_directionalLight.hasShadowMap)
+		{
+			shadowAttenuation = computeShadowAttenuation(_directionalLightShadowMap, _directionalLight, worldPosition, DIRECTIONAL_LIGHT_SHADOW_DEPTH_OFFSET);
+		}
+
+		float diffuse = (std::max)(normal.dot(-_directionalLight.direction), 0.0f);
+		diffuseLightColor += _directionalLight.color * (diffuse * shadowAttenuation);
+	}
+
+	for (size_t i = 0; i < _pointLights.size(); i++)
+	{
+		const LightParameter& light = _pointLights[i];
+		const Vec3& vertexToLightDirection = light.position - worldPosition;
+		const Vec3& direction = vertexToLightDirection * light.rangeInverse;
+		float attenuation = clamp01(1.0f - direction.dot(direction));
+
+		float shadowAttenuation = 1.0f;
+		if (light.hasShadowMap)
+		{
+			shadowAttenuation = computePointLightShadowAttenuation(i, worldPosition);
+		}
+
+		float diffuse = (std::max)(normal.dot(normalizeOrZero(vertexToLightDirection)), 0.0f);
+		diffuseLightColor += light.color * (diffuse * attenuation * shadowAttenuation);
+	}
+
+	for (size_t i = 0; i < _spotLights.size(); i++)
+	{
+		const LightParameter& light = _spotLights[i];
+		Vec3 vertexToLightDirection = light.position - worldPosition;
+		const Vec3& direction = vertexToLightDirection * light.rangeInverse;
+		float attenuation = clamp01(1.0f - direction.dot(direction));
+		vertexToLightDirection = normalizeOrZero(vertexToLightDirection);
+		float currentAngleCos = light.direction.dot(-vertexToLightDirection);
+		attenuation = clamp01(attenuation * smoothstep(light.outerAngleCos, light.innerAngleCos, currentAngleCos));
+
+		float shadowAttenuation = 1.0f;
+		if (light.hasShadowMap)
+		{
+			shadowAttenuation = computeShadowAttenuation(_spotLightShadowMaps[i], light, worldPosition, SPOT_LIGHT_SHADOW_DEPTH_OFFSET);
+		}
+
+		float diffuse = (std::max)(normal.dot(vertexToLightDirection), 0.0f);
+		diffuseLightColor += light.color * (diffuse * attenuation * shadowAttenuation);
+	}
+
+	// RENDER_MODE_LIGHTING̏o
+	const Vec3& lightColor = diffuseLightColor + _ambientLightColor;
+	return Color4F(color.x * lightColor.x, color.y * lightColor.y, color.z * lightColor.z, 1.0f);
+}
+
+float SoftwareDeferredRenderer::computeShadowAttenuation(const SoftwareRasterizer& shadowMap, const LightParameter& light, const Vec3& worldPosition, float depthOffset) const
+{
+	const Vec4& clipPosition = transformToClip(light.shadowMapProjectionMatrix * light.shadowMapViewMatrices[0], worldPosition);
+	if (clipPosition.w <= 0.0f)
+	{
+		return 1.0f;
+	}
+
+	// u_depthBiasMatrixĂz炵AtextureProjOffsetƓwŊ
+	float inverseW = 1.0f / clipPosition.w;
+	float s = (clipPosition.x + clipPosition.w) * 0.5f * inverseW;
+	float t = (clipPosition.y + clipPosition.w) * 0.5f * inverseW;
+	float reference = ((clipPosition.z + clipPosition.w) * 0.5f - depthOffset) * inverseW;
+
+	// PCFBr֐̓VhE}bṽeNX`ƓGL_LESS
+	const SizeUint& size = shadowMap.getSize();
+	float texelWidth = 1.0f / size.width;
+	float texelHeight = 1.0f / size.height;
+	static const int OFFSETS[4][2] = {{-1, -1}, {-1, 1}, {1, 1}, {1, -1}};
+	float attenuation = 0.0f;
+	for (const int* offset : OFFSETS)
+	{
+		if (reference < sampleShadowMapDepth(shadowMap, s + offset[0] * texelWidth, t + offset[1] * texelHeight))
+		{
+			attenuation += 1.0f;
+		}
+	}
+
+	return attenuation * 0.25f;
+}
+
+float SoftwareDeferredRenderer::computePointLightShadowAttenuation(size_t index, const Vec3& worldPosition) const
+{
+	const LightParameter& light = _pointLights[index];
+
+	// L[u}bv̂ǂ̖ʂ𒲂ׂ邩A3ňԍW傫lT
+	const Vec3& lightToVertexDirection = worldPosition - light.position;
+	float absX = std::abs(lightToVertexDirection.x);
+	float absY = std::abs(lightToVertexDirection.y);
+	float absZ = std::abs(lightToVertexDirection.z);
+	float maxCoordinateVal = (std::max)(absX, (std::max)(absY, absZ));
+
+	CubeMapFace face;
+	if (maxCoordinateVal == absX)
+	{
+		face = (lightToVertexDirection.x > 0.0f) ? CubeMapFace::X_POSITIVE : CubeMapFace::X_NEGATIVE;
+	}
+	else if (maxCoordinateVal == absY)
+	{
+		face = (lightToVertexDirection.y > 0.0f) ? CubeMapFace::Y_POSITIVE : CubeMapFace::Y_NEGATIVE;
+	}
+	else
+	{
+		face = (lightToVertexDirection.z > 0.0f) ? CubeMapFace::Z_POSITIVE : CubeMapFace::Z_NEGATIVE;
+	}
+
+	// VF[_̓L[u}bv𓧎ϊ̍W̌ňĂ邪Ał͑I񂾖ʂ̃VhE}bvɓeĈ
+	const Vec4& clipPosition = transformToClip(light.shadowMapProjectionMatrix * light.shadowMapViewMatrices[(size_t)face], worldPosition);
+	if (clipPosition.w <= 0.0f)
+	{
+		return 1.0f;
+	}
+
+	float inverseW = 1.0f / clipPosition.w;
+	float s = (clipPosition.x * inverseW + 1.0f) * 0.5f;
+	float t = (clipPosition.y * inverseW + 1.0f) * 0.5f;
+	float depth = sampleShadowMapDepth(_pointLightShadowMaps[index][(size_t)face], s, t);
+
+	// [x𐳋KfoCXWɖ߂AvWFNVs񂩂ʂ̌ɉCg̋ɂ
+	const Mat4& projectionMatrix = light.shadowMapProjectionMatrix;
+	float occluderDistance = projectionMatrix.m[3][2] / (depth * 2.0f - 1.0f + projectionMatrix.m[2][2]);
+	// NbvWw͖ʂ̌ɉCg̋
+	return (clipPosition.w * (1.0f - POINT_LIGHT_SHADOW_DISTANCE_OFFSET_RATIO) > occluderDistance) ? 0.0f : 1.0f;
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,134 @@
+#pragma once
+#include "Config.h"
+#include "BasicDataTypes.h"
+#include "SoftwareRasterizer.h"
+#include "node/Light.h"
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+class Image;
+class MeshIndices;
+
+// GPUg킸ɃfBt@[h_ÕpXCPUŕ`悷郌_BSoftwareRasterizerŎOp``
+// Gobt@͎Op`ԍƏdSWrWreBobt@ŎACeBÔƂɃsNZƂɐFƖ@ƃ[hW𕜌
+// CeBOFragmentShaderDeferredLighting.glsl̈ڐABVhE}bvOpenGLƓsƐ[x̃ItZbgŕ`ĎQƂ
+// sȃWIg̃fBt@[h̃pXAtH[hŕ`2D͕`Ȃ
+class SoftwareDeferredRenderer final
+{
+public:
+	SoftwareDeferredRenderer();
+	bool init(const SizeUint& size);
+	const SizeUint& getSize() const { return _gBuffer.getSize(); }
+
+	// t[̍ŏɌĂԁBÕt[œo^WIgƃCĝĂ
+	void beginFrame(const Mat4& viewMatrix, const Mat4& projectionMatrix);
+	// fW̒_o^AaddMeshɓnԍԂB_̓Rs[̂ŁǍĂяo̊ԂLł΂悢
+	size_t addVertices(const Mat4& modelMatrix, const Position3DNormalTextureCoordinates* vertices, size_t numVertices);
+	// eNX`WȂPolygon3Dp
+	size_t addVertices(const Mat4& modelMatrix, const Vec3* positions, const Vec3* normals, size_t numVertices);
+	// addVerticesœo^_CfbNXŎOp`XgƂĕ`BindicesnullptrȂ璸_3g
+	// textureFilePathȂeNX`̐F͔ƂĈBeNX`̓pXƂɈxǂݍ
+	void addMesh(size_t verticesIndex, const MeshIndices* indices, const std::string& textureFilePath, const Color3F& multiplyColor, bool isAlphaTestEnabled);
+	void setAmbientLight(const AmbientLight* light);
+	void setDirectionalLight(const DirectionalLight* light);
+	void addPointLight(const PointLight* light);
+	void addSpotLight(const SpotLight* light);
+	// VhE}bvAGobt@ACeBȌɕ`
+	void render();
+
+	// オ_̍s
+	const std::vector<Color4F>& getColorBuffer() const { return _colorBuffer; }
+	// Renderer::readBackBufferƓARGBA8888ō㌴_Imageɂ
+	bool readColorBuffer(Image& outImage) const;
+
+private:
+	// eNX`RGBA8888ɕϊĎ́Bǂݍ߂Ȃ͕̂0
+	struct SoftwareTexture
+	{
+		unsigned int width;
+		unsigned int height;
+		std::vector<unsigned char> pixels;
+
+		SoftwareTexture() : width(0), height(0) {}
+	};
+
+	struct VertexSet
+	{
+		Mat4 modelMatrix;
+		// addVerticesł̓fWŁArender()̍ŏɃ[hWɕϊ
+		std::vector<Position3DNormalTextureCoordinates> vertices;
+		// `Ăr[ł̃NbvWBr[ƂɌvZ
+		std::vector<Vec4> clipPositions;
+	};
+
+	struct Mesh
+	{
+		size_t verticesIndex;
+		std::vector<unsigned int> indices;
+		// nullptrȂ甒
+		const SoftwareTexture* texture;
+		Color3F multiplyColor;
+		bool isAlphaTestEnabled;
+		// rWreBobt@ɏOp`ԍ͂̃bV̎Op`ԍɂ𑫂
+		size_t firstTriangleId;
+	};
+
+	// CeBOŃsNZƂɎglB_VF[_ɓnjtH[Ɠ̂Cg̓o^ɋ߂Ă
+	struct LightParameter
+	{
+		Vec3 color;
+		Vec3 position;
+		Vec3 direction;
+		float rangeInverse;
+		float innerAngleCos;
+		float outerAngleCos;
+		bool hasShadowMap;
+		SizeUint shadowMapSize;
+		Mat4 shadowMapProjectionMatrix;
+		// VhE}bṽr[sB|CgCgł̓L[u}bv̖ʂƂɎ
+		std::array<Mat4, (size_t)CubeMapFace::NUM_CUBEMAP_FACE> shadowMapViewMatrices;
+	};
+
+	SoftwareRasterizer _gBuffer;
+	std::vector<Color4F> _colorBuffer;
+	Mat4 _viewMatrix;
+	Mat4 _projectionMatrix;
+
+	// t[̃mۂ邽߁Avf͎̂ĂɎg𐔂
+	std::vector<VertexSet> _vertexSets;
+	size_t _numVertexSets;
+	std::vector<Mesh> _meshes;
+	size_t _numMeshes;
+	size_t _numTriangles;
+	std::map<std::string, SoftwareTexture> _textureCache;
+
+	Vec3 _ambientLightColor;
+	bool _hasDirectionalLight;
+	LightParameter _directionalLight;
+	std::vector<LightParameter> _pointLights;
+	std::vector<LightParameter> _spotLights;
+	// VhE}bv̓CgƂɎBOpenGL̃fvXeNX`Ɠ[0, 1]̐[x[xobt@ɓ
+	SoftwareRasterizer _directionalLightShadowMap;
+	std::array<std::array<SoftwareRasterizer, (size_t)CubeMapFace::NUM_CUBEMAP_FACE>, PointLight::MAX_NUM> _pointLightShadowMaps;
+	std::array<SoftwareRasterizer, SpotLight::MAX_NUM> _spotLightShadowMaps;
+
+	const SoftwareTexture* findTexture(const std::string& filePath);
+	// GLTextureƓGL_LINEARGL_CLAMP_TO_EDGEňBeNX`ȂΔԂ
+	static Vec4 sampleTexture(const SoftwareTexture* texture, const Vec2& textureCoordinate);
+	void transformVertices();
+	// SbV̐[xVhE}bvɕ`BAt@eXg郁bV̓eNX`̃At@Ŕ
+	void renderShadowMap(SoftwareRasterizer& shadowMap, const SizeUint& size, const Mat4& viewProjectionMatrix);
+	void renderGBuffer();
+	void renderLighting();
+	Color4F computeLightedColor(size_t pixelIndex) const;
+	// 2D̃VhE}bv4_PCFňA銄BdepthOffset̓VF[_Ɠ[0, 1]ɂWz
+	float computeShadowAttenuation(const SoftwareRasterizer& shadowMap, const LightParameter& light, const Vec3& worldPosition, float depthOffset) const;
+	float computePointLightShadowAttenuation(size_t index, const Vec3& worldPosition) const;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,459 @@
+#include "SoftwareRasterizer.h"
+#include "utility/JobScheduler.h"
+#include "utility/Logger.h"
+#include "utility/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+// SSE2gł4sNZӊ֐]
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define MGRRENDERER_SOFTWARE_RASTERIZER_USE_SSE
+#include <emmintrin.h>
+#endif
+
+namespace mgrrenderer
+{
+
+// ʐς菬Op`͉ʂɉ`Ȃ̂Ŏ̂Ă
+static const float DEGENERATE_AREA = 1.0e-8f;
+// 菬At@̃sNZ̓At@eXgŎ̂Ă
+static const float ALPHA_TEST_THRESHOLD = 0.5f;
+
+SoftwareRasterizer::SoftwareRasterizer() :
+_numTilesX(0),
+_numTilesY(0)
+{
+}
+
+bool SoftwareRasterizer::init(const SizeUint& size)
+{
+	if (size.width == 0 || size.height == 0)
+	{
+		Logger::logAssert(false, "TCY0̃obt@͍ȂB");
+		return false;
+	}
+
+	_size = size;
+	_numTilesX = (size.width + TILE_SIZE - 1) / TILE_SIZE;
+	_numTilesY = (size.height + TILE_SIZE - 1) / TILE_SIZE;
+	_colorBuffer.resize(size.width * size.height);
+	_depthBuffer.resize(size.width * size.height);
+	_tileBins.resize(_numTilesX * _numTilesY);
+	clear(Color4F(0.0f, 0.0f, 0.0f, 0.0f), 1.0f);
+	return true;
+}
+
+void SoftwareRasterizer::clear(const Color4F& color, float depth)
+{
+	// U蕪ς݂̎Op`ォNAʂ㏑Ȃ悤ɁAɕ`Ă
+	flush();
+
+	std::fill(_colorBuffer.begin(), _colorBuffer.end(), color);
+	std::fill(_depthBuffer.begin(), _depthBuffer.end(), depth);
+}
+
+void SoftwareRasterizer::drawTriangles(const std::vector<Vec4>& clipPositions, const std::vector<unsigned int>& indices, const PixelShader& pixelShader, BlendMode blendMode, bool isDepthTestEnabled, bool isDepthWriteEnabled, bool isAlphaTestEnabled)
+{
+	Logger::logAssert(indices.size() % 3 == 0, "Op`Xg̃CfbNX3̔{łȂBnumIndices=%d", static_cast<int>(indices.size()));
+
+	DrawCall drawCall;
+	drawCall.pixelShader = pixelShader;
+	drawCall.blendMode = blendMode;
+	drawCall.isDepthTestEnabled = isDepthTestEnabled;
+	drawCall.isDepthWriteEnabled = isDepthWriteEnabled;
+	drawCall.isAlphaTestEnabled = isAlphaTestEnabled;
+	_drawCalls.push_back(drawCall);
+	size_t drawCallIndex = _drawCalls.size() - 1;
+
+	size_t numTriangles = indices.size() / 3;
+	for (size_t i = 0; i < numTriangles; i++)
+	{
+		ClipVertex vertices[3];
+		for (size_t j = 0; j < 3; j++)
+		{
+			unsigned int index = indices[i * 3 + j];
+			Logger::logAssert(index < clipPositions.size(), "_𒴂CfbNXBindex=%d", index);
+			vertices[j].position = clipPositions[index];
+		}
+
+		vertices[0].barycentric = Vec3(1.0f, 0.0f, 0.0f);
+		vertices[1].barycentric = Vec3(0.0f, 1.0f, 0.0f);
+		vertices[2].barycentric = Vec3(0.0f, 0.0f, 1.0f);
+		clipAndSetupTriangle(vertices[0], vertices[1], vertices[2], drawCallIndex, i);
+	}
+}
+
+void SoftwareRasterizer::flush()
+{
+	if (_triangles.empty())
+	{
+		_drawCalls.clear();
+		return;
+	}
+
+	{
+		MGRRENDERER_PROFILE_SCOPE("SoftwareRasterizer::flush");
+		// ^CԂŏމfdȂȂ̂ŁA^CPʂŃbNȂɕ񉻂ł
+		JobScheduler::getInstance()->parallelFor(_tileBins.size(), [this](size_t tileIndex) { rasterizeTile(static_cast<unsigned int>(tileIndex)); });
+	}
+
+	for (std::vector<unsigned int>& bin : _tileBins)
+	{
+		bin.clear();
+	}
+	_triangles.clear();
+	_drawCalls.clear();
+}
+
+void SoftwareRasterizer::clipAndSetupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, size_t drawCallIndex, size_t triangleIndex)
+{
+	// jA(z + w >= 0)w0ȉɂȂ钸_ôŃNbvB̖ʂ̓oEfBO{bNXʂŐ؂邱Ƃőp
+	const ClipVertex* input[3] = {&v0, &v1, &v2};
+	float distances[3];
+	bool isAllInside = true;
+	bool isAllOutside = true;
+	for (size_t i = 0; i < 3; i++)
+	{
+		distances[i] = input[i]->position.z + input[i]->position.w;
+		isAllInside = isAllInside && distances[i] >= 0.0f;
+		isAllOutside = isAllOutside && distances[i] < 0.0f;
+	}
+
+	if (isAllOutside)
+	{
+		return;
+	}
+
+	if (isAllInside)
+	{
+		setupTriangle(v0, v1, v2, drawCallIndex, triangleIndex);
+		return;
+	}
+
+	// Op`1̕ʂŃNbvƍőŎlp`ɂȂ
+	ClipVertex clipped[4];
+	size_t numClipped = 0;
+	for (size_t i = 0; i < 3; i++)
+	{
+		size_t next = (i + 1) % 3;
+		if (distances[i] >= 0.0f)
+		{
+			clipped[numClipped++] = *input[i];
+		}
+
+		if ((distances[i] >= 0.0f) != (distances[next] >= 0.0f))
+		{
+			float t = distances[i] / (distances[i] - distances[next]);
+			ClipVertex& vertex = clipped[numClipped++];
+			vertex.position = input[i]->position + (input[next]->position - input[i]->position) * t;
+			vertex.barycentric = input[i]->barycentric + (input[next]->barycentric - input[i]->barycentric) * t;
+		}
+	}
+
+	for (size_t i = 1; i + 1 < numClipped; i++)
+	{
+		setupTriangle(clipped[0], clipped[i], clipped[i + 1], drawCallIndex, triangleIndex);
+	}
+}
+
+void SoftwareRasterizer::setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, size_t drawCallIndex, size_t triangleIndex)
+{
+	const ClipVertex* vertices[3] = {&v0, &v1, &v2};
+
+	Triangle triangle;
+	float screenX[3];
+	float screenY[3];
+	for (size_t i = 0; i < 3; i++)
+	{
+		const Vec4& position = vertices[i]->position;
+		if (position.w <= 0.0f)
+		{
+			// jAʂŃNbvς݂Ȃ̂ŁAˉew0ȉɂȂsȓ͂̏ꍇ
+			return;
+		}
+
+		float inverseW = 1.0f / position.w;
+		// ʂ͍オ_y
+		screenX[i] = (position.x * inverseW * 0.5f + 0.5f) * _size.width;
+		screenY[i] = (0.5f - position.y * inverseW * 0.5f) * _size.height;
+		triangle.inverseW[i] = inverseW;
+		triangle.depth[i] = position.z * inverseW * 0.5f + 0.5f;
+		triangle.barycentric[i] = vertices[i]->barycentric;
+	}
+
+	for (size_t i = 0; i < 3; i++)
+	{
+		size_t j = (i + 1) % 3;
+		size_t k = (i + 2) % 3;
+		triangle.edgeA[i] = screenY[j] - screenY[k];
+		triangle.edgeB[i] = screenX[k] - screenX[j];
+		triangle.edgeC[i] = screenX[j] * screenY[k] - screenX[k] * screenY[j];
+	}
+
+	float area = triangle.edgeA[0] * screenX[0] + triangle.edgeB[0] * screenY[0] + triangle.edgeC[0];
+	if (std::abs(area) < DEGENERATE_AREA)
+	{
+		return;
+	}
+
+	// JO͂Ȃ̂ŁAǂ̉łɂȂ悤ɕ낦
+	if (area < 0.0f)
+	{
+		for (size_t i = 0; i < 3; i++)
+		{
+			triangle.edgeA[i] = -triangle.edgeA[i];
+			triangle.edgeB[i] = -triangle.edgeB[i];
+			triangle.edgeC[i] = -triangle.edgeC[i];
+		}
+		area = -area;
+	}
+
+	for (size_t i = 0; i < 3; i++)
+	{
+		// ̖@Eӂ̕ӁAyȂ̂ŐŖ@ӂ̕
+		triangle.isTopLeftEdge[i] = triangle.edgeA[i] > 0.0f || (triangle.edgeA[i] == 0.0f && triangle.edgeB[i] > 0.0f);
+	}
+
+	triangle.inverseArea = 1.0f / area;
+
+	float minX = (std::min)((std::min)(screenX[0], screenX[1]), screenX[2]);
+	float maxX = (std::max)((std::max)(screenX[0], screenX[1]), screenX[2]);
+	float minY = (std::min)((std::min)(screenY[0], screenY[1]), screenY[2]);
+	float maxY = (std::max)((std::max)(screenY[0], screenY[1]), screenY[2]);
+	// ʊŐȍWintӂȂ悤ɁAfloat̂܂܉ʂɐ؂Ăϊ
+	triangle.minX = static_cast<int>(std::floor((std::min)((std::max)(minX, 0.0f), static_cast<float>(_size.width))));
+	triangle.minY = static_cast<int>(std::floor((std::min)((std::max)(minY, 0.0f), static_cast<float>(_size.height))));
+	triangle.maxX = static_cast<int>(std::ceil((std::max)((std::min)(maxX, static_cast<float>(_size.width - 1)), -1.0f)));
+	triangle.maxY = static_cast<int>(std::ceil((std::max)((std::min)(maxY, static_cast<float>(_size.height - 1)), -1.0f)));
+	if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+	{
+		return;
+	}
+
+	triangle.drawCallIndex = drawCallIndex;
+	triangle.triangleIndex = triangleIndex;
+	_triangles.push_back(triangle);
+
+	unsigned int triangleId = static_cast<unsigned int>(_triangles.size() - 1);
+	unsigned int tileMinX = triangle.minX / TILE_SIZE;
+	unsigned int tileMaxX = triangle.maxX / TILE_SIZE;
+	unsigned int tileMinY = triangle.minY / TILE_SIZE;
+	unsigned int tileMaxY = triangle.maxY / TILE_SIZE;
+	for (unsigned int tileY = tileMinY; tileY <= tileMaxY; tileY++)
+	{
+		for (unsigned int tileX = tileMinX; tileX <= tileMaxX; tileX++)
+		{
+			_tileBins[tileY * _numTilesX + tileX].push_back(triangleId);
+		}
+	}
+}
+
+void SoftwareRasterizer::rasterizeTile(unsigned int tileIndex)
+{
+	const std::vector<unsigned int>& bin = _tileBins[tileIndex];
+	if (bin.empty())
+	{
+		return;
+	}
+
+	int tileMinX = static_cast<int>((tileIndex % _numTilesX) * TILE_SIZE);
+	int tileMinY = static_cast<int>((tileIndex / _numTilesX) * TILE_SIZE);
+	int tileMaxX = (std::min)(tileMinX + static_cast<int>(TILE_SIZE), static_cast<int>(_size.width)) - 1;
+	int tileMaxY = (std::min)(tileMinY + static_cast<int>(TILE_SIZE), static_cast<int>(_size.height)) - 1;
+
+	for (unsigned int triangleId : bin)
+	{
+		const Triangle& triangle = _triangles[triangleId];
+		const DrawCall& drawCall = _drawCalls[triangle.drawCallIndex];
+
+		int minX = (std::max)(triangle.minX, tileMinX);
+		int maxX = (std::min)(triangle.maxX, tileMaxX);
+		int minY = (std::max)(triangle.minY, tileMinY);
+		int maxY = (std::min)(triangle.maxY, tileMaxY);
+
+#if defined(MGRRENDERER_SOFTWARE_RASTERIZER_USE_SSE)
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 laneOffset = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+		__m128 edgeA[3];
+		for (size_t i = 0; i < 3; i++)
+		{
+			edgeA[i] = _mm_set1_ps(triangle.edgeA[i]);
+		}
+
+		for (int y = minY; y <= maxY; y++)
+		{
+			float centerY = y + 0.5f;
+			__m128 rowValue[3];
+			for (size_t i = 0; i < 3; i++)
+			{
+				rowValue[i] = _mm_set1_ps(triangle.edgeB[i] * centerY + triangle.edgeC[i]);
+			}
+
+			for (int x = minX; x <= maxX; x += 4)
+			{
+				__m128 centerX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffset);
+				__m128 edgeValue[3];
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (size_t i = 0; i < 3; i++)
+				{
+					edgeValue[i] = _mm_add_ps(_mm_mul_ps(edgeA[i], centerX), rowValue[i]);
+					__m128 isInsideEdge = triangle.isTopLeftEdge[i] ? _mm_cmpge_ps(edgeValue[i], zero) : _mm_cmpgt_ps(edgeValue[i], zero);
+					inside = _mm_and_ps(inside, isInsideEdge);
+				}
+
+				int mask = _mm_movemask_ps(inside);
+				if (mask == 0)
+				{
+					continue;
+				}
+
+				float e0[4];
+				float e1[4];
+				float e2[4];
+				_mm_storeu_ps(e0, edgeValue[0]);
+				_mm_storeu_ps(e1, edgeValue[1]);
+				_mm_storeu_ps(e2, edgeValue[2]);
+				for (int lane = 0; lane < 4 && x + lane <= maxX; lane++)
+				{
+					if ((mask & (1 << lane)) != 0)
+					{
+						shadePixel(triangle, drawCall, x + lane, y, e0[lane], e1[lane], e2[lane]);
+					}
+				}
+			}
+		}
+#else
+		for (int y = minY; y <= maxY; y++)
+		{
+			float centerY = y + 0.5f;
+			for (int x = minX; x <= maxX; x++)
+			{
+				float centerX = x + 0.5f;
+				float edgeValue[3];
+				bool isInside = true;
+				for (size_t i = 0; i < 3; i++)
+				{
+					edgeValue[i] = triangle.edgeA[i] * centerX + triangle.edgeB[i] * centerY + triangle.edgeC[i];
+					isInside = isInside && (triangle.isTopLeftEdge[i] ? edgeValue[i] >= 0.0f : edgeValue[i] > 0.0f);
+				}
+
+				if (isInside)
+				{
+					shadePixel(triangle, drawCall, x, y, edgeValue[0], edgeValue[1], edgeValue[2]);
+				}
+			}
+		}
+#endif
+	}
+}
+
+void SoftwareRasterizer::shadePixel(const Triangle& triangle, const DrawCall& drawCall, int x, int y, float e0, float e1, float e2)
+{
+	// ʏŐ`ȏdSW
+	float l0 = e0 * triangle.inverseArea;
+	float l1 = e1 * triangle.inverseArea;
+	float l2 = e2 * triangle.inverseArea;
+
+	float depth = l0 * triangle.depth[0] + l1 * triangle.depth[1] + l2 * triangle.depth[2];
+	if (depth > 1.0f)
+	{
+		// t@[ʂ艜
+		return;
+	}
+
+	size_t pixelIndex = static_cast<size_t>(y) * _size.width + static_cast<size_t>(x);
+	if (drawCall.isDepthTestEnabled && depth >= _depthBuffer[pixelIndex])
+	{
+		return;
+	}
+
+	// 1/wŊē␳A̎Op`ł̏dSWɖ߂
+	float p0 = l0 * triangle.inverseW[0];
+	float p1 = l1 * triangle.inverseW[1];
+	float p2 = l2 * triangle.inverseW[2];
+	float inverseSum = 1.0f / (p0 + p1 + p2);
+	const Vec3& barycentric = triangle.barycentric[0] * (p0 * inverseSum) + triangle.barycentric[1] * (p1 * inverseSum) + triangle.barycentric[2] * (p2 * inverseSum);
+
+	const Color4F& source = drawCall.pixelShader(triangle.triangleIndex, barycentric);
+	if (drawCall.isAlphaTestEnabled && source.color.a < ALPHA_TEST_THRESHOLD)
+	{
+		return;
+	}
+
+	Color4F& destination = _colorBuffer[pixelIndex];
+	switch (drawCall.blendMode)
+	{
+	case BlendMode::NONE:
+		destination = source;
+		break;
+	case BlendMode::ALPHA:
+	{
+		// GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHAƓ
+		float sourceAlpha = source.color.a;
+		destination.color.r = source.color.r * sourceAlpha + destination.color.r * (1.0f - sourceAlpha);
+		destination.color.g = source.color.g * sourceAlpha + destination.color.g * (1.0f - sourceAlpha);
+		destination.color.b = source.color.b * sourceAlpha + destination.color.b * (1.0f - sourceAlpha);
+		destination.color.a = sourceAlpha + destination.color.a * (1.0f - sourceAlpha);
+	}
+		break;
+	case BlendMode::ADDITIVE:
+	{
+		// GL_SRC_ALPHA, GL_ONEƓ
+		float sourceAlpha = source.color.a;
+		destination.color.r += source.color.r * sourceAlpha;
+		destination.color.g += source.color.g * sourceAlpha;
+		destination.color.b += source.color.b * sourceAlpha;
+		destination.color.a += sourceAlpha;
+	}
+		break;
+	default:
+		break;
+	}
+
+	if (drawCall.isDepthWriteEnabled)
+	{
+		_depthBuffer[pixelIndex] = depth;
+	}
+}
+
+bool SoftwareRasterizer::saveColorBufferToTga(const std::string& filePath) const
+{
+	// `̎Op`c܂܏oȂ悤ɁAĂяoflushĂ
+	Logger::logAssert(_triangles.empty(), "flushĂȂOp`B");
+	Logger::logAssert(_size.width <= 0xffff && _size.height <= 0xffff, "TGAŏoȂTCYB");
+
+	std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file)
+	{
+		Logger::log("t@CJȂBfilePath=%s", filePath.c_str());
+		return false;
+	}
+
+	// 񈳏kgD[J[A32bitA㌴_
+	unsigned char header[18] = {0};
+	header[2] = 2;
+	header[12] = static_cast<unsigned char>(_size.width & 0xff);
+	header[13] = static_cast<unsigned char>((_size.width >> 8) & 0xff);
+	header[14] = static_cast<unsigned char>(_size.height & 0xff);
+	header[15] = static_cast<unsigned char>((_size.height >> 8) & 0xff);
+	header[16] = 32;
+	header[17] = 0x28;
+	file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+	std::vector<unsigned char> pixels(_colorBuffer.size() * 4);
+	for (size_t i = 0; i < _colorBuffer.size(); i++)
+	{
+		const Vec4& color = _colorBuffer[i].color;
+		// TGABGRȀ
+		pixels[i * 4 + 0] = static_cast<unsigned char>((std::min)((std::max)(color.b, 0.0f), 1.0f) * 255.0f + 0.5f);
+		pixels[i * 4 + 1] = static_cast<unsigned char>((std::min)((std::max)(color.g, 0.0f), 1.0f) * 255.0f + 0.5f);
+		pixels[i * 4 + 2] = static_cast<unsigned char>((std::min)((std::max)(color.r, 0.0f), 1.0f) * 255.0f + 0.5f);
+		pixels[i * 4 + 3] = static_cast<unsigned char>((std::min)((std::max)(color.a, 0.0f), 1.0f) * 255.0f + 0.5f);
+	}
+	file.write(reinterpret_cast<const char*>(pixels.data()), pixels.size());
+
+	return file.good();
+}
+
+} // namespace mgrrenderer
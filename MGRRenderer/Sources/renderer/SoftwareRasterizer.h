@@ -0,0 +1,99 @@
+#pragma once
+#include "Config.h"
+#include "BasicDataTypes.h"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// GPUg킸CPUŎOp``悷郉X^CUBGPÛȂT[oł̔rp̊摜̐AX[vbǧvɎg
+// drawTrianglesł͎Op`̃ZbgAbvƃ^Cւ̐U蕪sAflushŃ^CƂJobScheduler̃[J[ŕɃX^CY
+// 1̃^C1̃XbhA^Cł͕`v̏ɏ̂ŁAuh̏GPUƓɂȂ
+class SoftwareRasterizer final
+{
+public:
+	static const unsigned int TILE_SIZE = 64;
+
+	enum class BlendMode : int
+	{
+		NONE,
+		ALPHA,
+		ADDITIVE,
+	};
+
+	// ̎Op`ł̓␳ς݂̏dSWƎOp`ԍsNZ̐FԂB̃Xbh瓯ɌĂ΂
+	typedef std::function<Color4F(size_t triangleIndex, const Vec3& barycentric)> PixelShader;
+
+	SoftwareRasterizer();
+	bool init(const SizeUint& size);
+	const SizeUint& getSize() const { return _size; }
+
+	void clear(const Color4F& color, float depth);
+	// NbvԂ̒_CfbNXŎOp`XgƂĕ`悷B[xOpenGLƓ-ww01ɂĔr
+	// isAlphaTestEnabledȂAsNZVF[_ԂAt@0.5̃sNZ͐F[xȂBALPHA_TEST̃VF[_oG[VƓ臒l
+	void drawTriangles(const std::vector<Vec4>& clipPositions, const std::vector<unsigned int>& indices, const PixelShader& pixelShader, BlendMode blendMode, bool isDepthTestEnabled, bool isDepthWriteEnabled, bool isAlphaTestEnabled = false);
+	// U蕪ς݂̎Op`SăX^CY
+	void flush();
+
+	// オ_̍s
+	const std::vector<Color4F>& getColorBuffer() const { return _colorBuffer; }
+	const std::vector<float>& getDepthBuffer() const { return _depthBuffer; }
+	// 摜ƂĔr₷悤ɁA񈳏k32bit TGAŏo
+	bool saveColorBufferToTga(const std::string& filePath) const;
+
+private:
+	struct DrawCall
+	{
+		PixelShader pixelShader;
+		BlendMode blendMode;
+		bool isDepthTestEnabled;
+		bool isDepthWriteEnabled;
+		bool isAlphaTestEnabled;
+	};
+
+	// jANbv̒_B̎Op`ł̏dSW
+	struct ClipVertex
+	{
+		Vec4 position;
+		Vec3 barycentric;
+	};
+
+	struct Triangle
+	{
+		// i͒_ǐ̕ӁBE(x, y) = edgeA * x + edgeB * y + edgeC ŐɂȂ悤ɕ낦Ă
+		float edgeA[3];
+		float edgeB[3];
+		float edgeC[3];
+		// ӏ̃sNZdɓhȂ߂̃gbvtg[
+		bool isTopLeftEdge[3];
+		float inverseArea;
+		float inverseW[3];
+		float depth[3];
+		Vec3 barycentric[3];
+		int minX;
+		int minY;
+		int maxX;
+		int maxY;
+		size_t drawCallIndex;
+		size_t triangleIndex;
+	};
+
+	SizeUint _size;
+	unsigned int _numTilesX;
+	unsigned int _numTilesY;
+	std::vector<Color4F> _colorBuffer;
+	std::vector<float> _depthBuffer;
+	std::vector<DrawCall> _drawCalls;
+	std::vector<Triangle> _triangles;
+	// ^CƂɁAdȂOp`̔ԍ`v̏Ɏ
+	std::vector<std::vector<unsigned int>> _tileBins;
+
+	void clipAndSetupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, size_t drawCallIndex, size_t triangleIndex);
+	void setupTriangle(const ClipVertex& v0, const ClipVertex& v1, const ClipVertex& v2, size_t drawCallIndex, size_t triangleIndex);
+	void rasterizeTile(unsigned int tileIndex);
+	void shadePixel(const Triangle& triangle, const DrawCall& drawCall, int x, int y, float e0, float e1, float e2);
+};
+
+} // namespace mgrrenderer
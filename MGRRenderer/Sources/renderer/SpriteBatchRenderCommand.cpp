@@ -0,0 +1,60 @@
+#include "SpriteBatchRenderCommand.h"
+#include "SpriteBatcher.h"
+#include <algorithm>
+#include <cfloat>
+
+namespace mgrrenderer
+{
+
+SpriteBatchRenderCommand::SpriteBatchRenderCommand(SpriteBatcher* batcher) :
+_batcher(batcher),
+_isBounded(true)
+{
+}
+
+void SpriteBatchRenderCommand::reset(const Material& material)
+{
+	_material = material;
+	_vertices.clear();
+	_isBounded = true;
+	_boundsMin = Vec2(FLT_MAX, FLT_MAX);
+	_boundsMax = Vec2(-FLT_MAX, -FLT_MAX);
+}
+
+void SpriteBatchRenderCommand::addQuads(const Position3DTextureCoordinatesColor* vertices, size_t numQuads, bool isBounded, const Vec2& boundsMin, const Vec2& boundsMax)
+{
+	_vertices.insert(_vertices.end(), vertices, vertices + numQuads * 4);
+
+	if (!isBounded)
+	{
+		_isBounded = false;
+		return;
+	}
+
+	_boundsMin.x = (std::min)(_boundsMin.x, boundsMin.x);
+	_boundsMin.y = (std::min)(_boundsMin.y, boundsMin.y);
+	_boundsMax.x = (std::max)(_boundsMax.x, boundsMax.x);
+	_boundsMax.y = (std::max)(_boundsMax.y, boundsMax.y);
+}
+
+bool SpriteBatchRenderCommand::intersects(bool isBounded, const Vec2& boundsMin, const Vec2& boundsMax) const
+{
+	if (_vertices.empty())
+	{
+		return false;
+	}
+
+	if (!_isBounded || !isBounded)
+	{
+		return true;
+	}
+
+	return (boundsMin.x <= _boundsMax.x && _boundsMin.x <= boundsMax.x && boundsMin.y <= _boundsMax.y && _boundsMin.y <= boundsMax.y);
+}
+
+void SpriteBatchRenderCommand::execute()
+{
+	_batcher->draw(*this);
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,67 @@
+#pragma once
+#include "RenderCommand.h"
+#include "BasicDataTypes.h"
+#include <vector>
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11.h>
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLHeader.h"
+#endif
+
+namespace mgrrenderer
+{
+
+class Camera;
+class SpriteBatcher;
+
+// eNX`ƃuh[hƃJlp`܂Ƃ߂āA1̃CfbNXth[ŕ`悷R}h
+// SpriteBatcherg܂킷̂ŁAm[hł͍炸Renderer::addSpriteQuadsg
+class SpriteBatchRenderCommand final : public RenderCommand
+{
+public:
+	enum class BlendMode : int
+	{
+		ALPHA,
+		ADDITIVE,
+	};
+
+	// ̒lSĈvlp`𓯂ob`ɂ܂Ƃ߂
+	struct Material
+	{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		ID3D11ShaderResourceView* texture;
+#elif defined(MGRRENDERER_USE_OPENGL)
+		GLuint texture;
+#endif
+		BlendMode blendMode;
+		const Camera* camera;
+
+		bool operator==(const Material& material) const { return (texture == material.texture && blendMode == material.blendMode && camera == material.camera); }
+		bool operator!=(const Material& material) const { return !(*this == material); }
+	};
+
+	SpriteBatchRenderCommand(SpriteBatcher* batcher);
+	~SpriteBatchRenderCommand() override {}
+	RenderCommand::Type getType() override { return RenderCommand::Type::SPRITE_BATCH; };
+	void execute() override;
+
+	void reset(const Material& material);
+	const Material& getMaterial() const { return _material; }
+	size_t getNumQuads() const { return _vertices.size() / 4; }
+	const std::vector<Position3DTextureCoordinatesColor>& getVertices() const { return _vertices; }
+	// vertices͎lp`Ƃ4_BboundsMinAboundsMax͒ǉlp`Ŝ̃NbvԂłxy͈
+	void addQuads(const Position3DTextureCoordinatesColor* vertices, size_t numQuads, bool isBounded, const Vec2& boundsMin, const Vec2& boundsMax);
+	// ̃ob`̎lp`ƃNbvԂŏdȂ邩BdȂꍇ́AÕob`ɂ͎lp`ǉłȂ
+	bool intersects(bool isBounded, const Vec2& boundsMin, const Vec2& boundsMax) const;
+
+private:
+	SpriteBatcher* _batcher;
+	Material _material;
+	std::vector<Position3DTextureCoordinatesColor> _vertices;
+	// J̌ɂ͂ݏo_ăNbvԂł͈̔͂܂ȂꍇfalseɂAɏdȂ̂ƂĈ
+	bool _isBounded;
+	Vec2 _boundsMin;
+	Vec2 _boundsMax;
+};
+
+} // namespace mgrrenderer
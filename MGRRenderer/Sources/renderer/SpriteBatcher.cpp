@@ -0,0 +1,405 @@
+#include "SpriteBatcher.h"
+#include "Director.h"
+#include "StreamingBuffer.h"
+#include "node/Camera.h"
+#include "utility/Logger.h"
+#include <algorithm>
+#include <cfloat>
+#include <cstddef>
+
+namespace mgrrenderer
+{
+
+// std::minɎQƂœn̂ŁANXOɂ`v
+const size_t SpriteBatcher::MAX_QUADS_PER_BATCH;
+
+// Mat4operator*(const Vec4&)wvZȂ̂ŁAˉeϊpw܂ŌvZ
+static Vec4 transformPosition(const Mat4& matrix, const Vec3& position)
+{
+	return Vec4(
+		matrix.m[0][0] * position.x + matrix.m[1][0] * position.y + matrix.m[2][0] * position.z + matrix.m[3][0],
+		matrix.m[0][1] * position.x + matrix.m[1][1] * position.y + matrix.m[2][1] * position.z + matrix.m[3][1],
+		matrix.m[0][2] * position.x + matrix.m[1][2] * position.y + matrix.m[2][2] * position.z + matrix.m[3][2],
+		matrix.m[0][3] * position.x + matrix.m[1][3] * position.y + matrix.m[2][3] * position.z + matrix.m[3][3]
+	);
+}
+
+SpriteBatcher::SpriteBatcher() :
+_numUsedCommands(0)
+#if defined(MGRRENDERER_USE_DIRECT3D)
+,_indexBuffer(nullptr)
+,_blendStateAdditive(nullptr)
+#elif defined(MGRRENDERER_USE_OPENGL)
+,_indexBufferId(0)
+#endif
+{
+}
+
+SpriteBatcher::~SpriteBatcher()
+{
+	for (SpriteBatchRenderCommand* command : _commands)
+	{
+		delete command;
+	}
+	_commands.clear();
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	if (_blendStateAdditive != nullptr)
+	{
+		_blendStateAdditive->Release();
+		_blendStateAdditive = nullptr;
+	}
+
+	if (_indexBuffer != nullptr)
+	{
+		_indexBuffer->Release();
+		_indexBuffer = nullptr;
+	}
+#elif defined(MGRRENDERER_USE_OPENGL)
+	if (_indexBufferId != 0)
+	{
+		glDeleteBuffers(1, &_indexBufferId);
+		_indexBufferId = 0;
+	}
+#endif
+}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+bool SpriteBatcher::init(ID3D11Device* device)
+#elif defined(MGRRENDERER_USE_OPENGL)
+bool SpriteBatcher::init()
+#endif
+{
+	// CfbNX͎lp`̕тŌ܂Sob`ŋʂȂ̂ŁAő吔ŏɍĂ
+	std::vector<unsigned short> indices(MAX_QUADS_PER_BATCH * 6);
+	for (size_t i = 0; i < MAX_QUADS_PER_BATCH; i++)
+	{
+		unsigned short base = static_cast<unsigned short>(4 * i);
+		indices[6 * i] = base;
+		indices[6 * i + 1] = base + 1;
+		indices[6 * i + 2] = base + 2;
+		indices[6 * i + 3] = base + 3;
+		indices[6 * i + 4] = base + 2;
+		indices[6 * i + 5] = base + 1;
+	}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	D3D11_BUFFER_DESC indexBufferDesc;
+	indexBufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+	indexBufferDesc.ByteWidth = static_cast<UINT>(sizeof(unsigned short) * indices.size());
+	indexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+	indexBufferDesc.CPUAccessFlags = 0;
+	indexBufferDesc.MiscFlags = 0;
+	indexBufferDesc.StructureByteStride = 0;
+
+	D3D11_SUBRESOURCE_DATA indexBufferSubData;
+	indexBufferSubData.pSysMem = indices.data();
+	indexBufferSubData.SysMemPitch = 0;
+	indexBufferSubData.SysMemSlicePitch = 0;
+
+	HRESULT result = device->CreateBuffer(&indexBufferDesc, &indexBufferSubData, &_indexBuffer);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+		_indexBuffer = nullptr;
+		return false;
+	}
+
+	bool depthEnable = false;
+	_d3dProgram.initWithShaderFile("Resources/shader/SpriteBatch.hlsl", depthEnable, "VS", "", "PS");
+
+	// ̓CAEgIuWFNg̍쐬
+	D3D11_INPUT_ELEMENT_DESC layout[] = {
+		{D3DProgram::SEMANTIC_POSITION.c_str(), 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, offsetof(Position3DTextureCoordinatesColor, position), D3D11_INPUT_PER_VERTEX_DATA, 0},
+		{D3DProgram::SEMANTIC_TEXTURE_COORDINATE.c_str(), 0, DXGI_FORMAT_R32G32_FLOAT, 0, offsetof(Position3DTextureCoordinatesColor, textureCoordinate), D3D11_INPUT_PER_VERTEX_DATA, 0},
+		{D3DProgram::SEMANTIC_COLOR.c_str(), 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0, offsetof(Position3DTextureCoordinatesColor, color), D3D11_INPUT_PER_VERTEX_DATA, 0},
+	};
+	ID3D11InputLayout* inputLayout = nullptr;
+	result = device->CreateInputLayout(
+		layout,
+		_countof(layout), 
+		_d3dProgram.getVertexShaderBlob()->GetBufferPointer(),
+		_d3dProgram.getVertexShaderBlob()->GetBufferSize(),
+		&inputLayout
+	);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateInputLayout failed. result=%d", result);
+		return false;
+	}
+	_d3dProgram.setInputLayout(inputLayout);
+
+	// 萔obt@̍쐬
+	D3D11_BUFFER_DESC constantBufferDesc;
+	constantBufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+	constantBufferDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+	constantBufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	constantBufferDesc.MiscFlags = 0;
+	constantBufferDesc.StructureByteStride = 0;
+	constantBufferDesc.ByteWidth = sizeof(Mat4);
+
+	// Viewsp
+	ID3D11Buffer* constantBuffer = nullptr;
+	result = device->CreateBuffer(&constantBufferDesc, nullptr, &constantBuffer);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+		return false;
+	}
+	_d3dProgram.addConstantBuffer(D3DProgram::ConstantBufferID::VIEW_MATRIX, constantBuffer);
+
+	// Projectionsp
+	constantBuffer = nullptr;
+	result = device->CreateBuffer(&constantBufferDesc, nullptr, &constantBuffer);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+		return false;
+	}
+	_d3dProgram.addConstantBuffer(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, constantBuffer);
+
+	// ZuhpBAt@uh̓pX̏Őݒ肳Ă̂̂܂܎g
+	D3D11_BLEND_DESC blendDesc;
+	ZeroMemory(&blendDesc, sizeof(blendDesc));
+	blendDesc.AlphaToCoverageEnable = FALSE;
+	blendDesc.IndependentBlendEnable = FALSE;
+	blendDesc.RenderTarget[0].BlendEnable = TRUE;
+	blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+	blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_ONE;
+	blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+	blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+	blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_ZERO;
+	blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+	blendDesc.RenderTarget[0].RenderTargetWriteMask = D3D11_COLOR_WRITE_ENABLE_ALL;
+	result = device->CreateBlendState(&blendDesc, &_blendStateAdditive);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBlendState failed. result=%d", result);
+		_blendStateAdditive = nullptr;
+		return false;
+	}
+#elif defined(MGRRENDERER_USE_OPENGL)
+	glGenBuffers(1, &_indexBufferId);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short) * indices.size(), indices.data(), GL_STATIC_DRAW);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	GLProgram::checkGLError();
+
+	_glProgram.initWithShaderFile("../MGRRenderer/Resources/shader/VertexShaderSpriteBatch.glsl", "../MGRRenderer/Resources/shader/FragmentShaderSpriteBatch.glsl");
+#endif
+
+	return true;
+}
+
+void SpriteBatcher::addQuads(std::vector<RenderCommand*>& queue, const SpriteBatchRenderCommand::Material& material, const Position2DTextureCoordinates* vertices, size_t numQuads, const Mat4& modelMatrix, const Color4B& color)
+{
+	if (numQuads == 0)
+	{
+		return;
+	}
+
+	Logger::logAssert(material.camera != nullptr, "Jw肳ĂȂB");
+
+	// m[hƂɃfs񂪈Ă܂Ƃ߂悤ɁA_͂Ń[hWɂĂ
+	size_t numVertices = numQuads * 4;
+	_transformedVertices.resize(numVertices);
+	for (size_t i = 0; i < numVertices; i++)
+	{
+		const Vec3& worldPosition = modelMatrix * Vec3(vertices[i].position.x, vertices[i].position.y, 0.0f);
+		_transformedVertices[i] = Position3DTextureCoordinatesColor(worldPosition, vertices[i].textureCoordinate, color);
+	}
+
+	const Mat4& viewProjectionMatrix = material.camera->getProjectionMatrix() * material.camera->getViewMatrix();
+
+	// 1̃ob`ɓ肫Ȃ͕Ēǉ
+	for (size_t offset = 0; offset < numQuads; offset += MAX_QUADS_PER_BATCH)
+	{
+		size_t num = (std::min)(numQuads - offset, MAX_QUADS_PER_BATCH);
+		addQuadsWithinLimit(queue, material, &_transformedVertices[offset * 4], num, viewProjectionMatrix);
+	}
+}
+
+void SpriteBatcher::addQuadsWithinLimit(std::vector<RenderCommand*>& queue, const SpriteBatchRenderCommand::Material& material, const Position3DTextureCoordinatesColor* vertices, size_t numQuads, const Mat4& viewProjectionMatrix)
+{
+	// `揇ւĂ悢̔ɎĝŁANbvԂłxy͈͂߂
+	bool isBounded = true;
+	Vec2 boundsMin(FLT_MAX, FLT_MAX);
+	Vec2 boundsMax(-FLT_MAX, -FLT_MAX);
+	for (size_t i = 0; i < numQuads * 4; i++)
+	{
+		const Vec4& clipPosition = transformPosition(viewProjectionMatrix, vertices[i].position);
+		if (clipPosition.w < FLOAT_TOLERANCE)
+		{
+			// J̌ɂ钸_Ɣ͈͂܂Ȃ̂ŁAƂłdȂ̂ƂĈ
+			isBounded = false;
+			break;
+		}
+
+		float x = clipPosition.x / clipPosition.w;
+		float y = clipPosition.y / clipPosition.w;
+		boundsMin.x = (std::min)(boundsMin.x, x);
+		boundsMin.y = (std::min)(boundsMin.y, y);
+		boundsMax.x = (std::max)(boundsMax.x, x);
+		boundsMax.y = (std::max)(boundsMax.y, y);
+	}
+
+	// L[̖ɑob`납炳̂ڂA}eAœ肫ob`T
+	// r̃ob`ƏdȂꍇ́AÕob`ɒǉƕ`揇ςČڂς̂łőł؂
+	SpriteBatchRenderCommand* batch = nullptr;
+	size_t numSearched = 0;
+	for (size_t i = queue.size(); i > 0 && numSearched < MAX_SEARCH_BATCHES; i--, numSearched++)
+	{
+		if (queue[i - 1]->getType() != RenderCommand::Type::SPRITE_BATCH)
+		{
+			break;
+		}
+
+		SpriteBatchRenderCommand* candidate = static_cast<SpriteBatchRenderCommand*>(queue[i - 1]);
+		if (candidate->getMaterial() == material && candidate->getNumQuads() + numQuads <= MAX_QUADS_PER_BATCH)
+		{
+			batch = candidate;
+			break;
+		}
+
+		if (candidate->intersects(isBounded, boundsMin, boundsMax))
+		{
+			break;
+		}
+	}
+
+	if (batch == nullptr)
+	{
+		batch = createCommand(material);
+		queue.push_back(batch);
+	}
+
+	batch->addQuads(vertices, numQuads, isBounded, boundsMin, boundsMax);
+}
+
+SpriteBatchRenderCommand* SpriteBatcher::createCommand(const SpriteBatchRenderCommand::Material& material)
+{
+	if (_numUsedCommands == _commands.size())
+	{
+		_commands.push_back(new SpriteBatchRenderCommand(this));
+	}
+
+	SpriteBatchRenderCommand* command = _commands[_numUsedCommands];
+	_numUsedCommands++;
+	command->reset(material);
+	return command;
+}
+
+void SpriteBatcher::endFrame()
+{
+	_numUsedCommands = 0;
+}
+
+void SpriteBatcher::draw(const SpriteBatchRenderCommand& command)
+{
+	const std::vector<Position3DTextureCoordinatesColor>& vertices = command.getVertices();
+	if (vertices.empty())
+	{
+		return;
+	}
+
+	StreamingBuffer& streamingVertexBuffer = Director::getRenderer().getStreamingVertexBuffer();
+	size_t vertexOffset = streamingVertexBuffer.write(vertices.data(), sizeof(Position3DTextureCoordinatesColor) * vertices.size(), sizeof(Position3DTextureCoordinatesColor));
+	if (vertexOffset == StreamingBuffer::INVALID_OFFSET)
+	{
+		return;
+	}
+
+	const SpriteBatchRenderCommand::Material& material = command.getMaterial();
+	size_t numIndices = command.getNumQuads() * 6;
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	ID3D11DeviceContext* direct3dContext = Director::getRenderer().getDirect3dContext();
+
+	// r[s̃}bv
+	Mat4 viewMatrix = material.camera->getViewMatrix().createTranspose();
+	_d3dProgram.setConstantBufferData(D3DProgram::ConstantBufferID::VIEW_MATRIX, &viewMatrix.m, sizeof(viewMatrix));
+
+	// vWFNVs̃}bv
+	Mat4 projectionMatrix = (Mat4::CHIRARITY_CONVERTER * material.camera->getProjectionMatrix()).transpose();
+	_d3dProgram.setConstantBufferData(D3DProgram::ConstantBufferID::PROJECTION_MATRIX, &projectionMatrix.m, sizeof(projectionMatrix));
+
+	ID3D11Buffer* vertexBuffers[1] = { streamingVertexBuffer.getBuffer() };
+	UINT strides[1] = { sizeof(Position3DTextureCoordinatesColor) };
+	UINT offsets[1] = { static_cast<UINT>(vertexOffset) };
+	direct3dContext->IASetVertexBuffers(0, 1, vertexBuffers, strides, offsets);
+	direct3dContext->IASetIndexBuffer(_indexBuffer, DXGI_FORMAT_R16_UINT, 0);
+	direct3dContext->IASetInputLayout(_d3dProgram.getInputLayout());
+	direct3dContext->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+	_d3dProgram.setShadersToDirect3DContext(direct3dContext);
+	Director::getRenderer().getConstantRingBuffer().bind(_d3dProgram, direct3dContext);
+
+	ID3D11ShaderResourceView* resourceView[1] = { material.texture };
+	direct3dContext->PSSetShaderResources(0, 1, resourceView);
+	ID3D11SamplerState* samplerState[1] = { Director::getRenderer().getLinearSamplerState() };
+	direct3dContext->PSSetSamplers(0, 1, samplerState);
+
+	// ZuĥƂuhXe[gւA`ɃpX̏Őݒ肳ꂽ̂ɖ߂
+	ID3D11BlendState* prevBlendState = nullptr;
+	FLOAT prevBlendFactor[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	UINT prevSampleMask = 0xffffffff;
+	if (material.blendMode == SpriteBatchRenderCommand::BlendMode::ADDITIVE)
+	{
+		direct3dContext->OMGetBlendState(&prevBlendState, prevBlendFactor, &prevSampleMask);
+		FLOAT blendFactor[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+		direct3dContext->OMSetBlendState(_blendStateAdditive, blendFactor, 0xffffffff);
+	}
+
+	direct3dContext->DrawIndexed(static_cast<UINT>(numIndices), 0, 0);
+
+	if (material.blendMode == SpriteBatchRenderCommand::BlendMode::ADDITIVE)
+	{
+		direct3dContext->OMSetBlendState(prevBlendState, prevBlendFactor, prevSampleMask);
+		if (prevBlendState != nullptr)
+		{
+			prevBlendState->Release();
+		}
+	}
+#elif defined(MGRRENDERER_USE_OPENGL)
+	glUseProgram(_glProgram.getShaderProgram());
+	GLProgram::checkGLError();
+
+	glUniformMatrix4fv(_glProgram.getUniformLocation(GLProgram::UniformID::VIEW_MATRIX), 1, GL_FALSE, (GLfloat*)material.camera->getViewMatrix().m);
+	glUniformMatrix4fv(_glProgram.getUniformLocation(GLProgram::UniformID::PROJECTION_MATRIX), 1, GL_FALSE, (GLfloat*)material.camera->getProjectionMatrix().m);
+	GLProgram::checkGLError();
+
+	// ftHgVAOɁAXg[~Oobt@̃ItZbgŒ_ݒ肷
+	glBindBuffer(GL_ARRAY_BUFFER, streamingVertexBuffer.getBufferId());
+	glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::POSITION);
+	glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE);
+	glEnableVertexAttribArray((GLuint)GLProgram::AttributeLocation::COLOR);
+	glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::POSITION, 3, GL_FLOAT, GL_FALSE, sizeof(Position3DTextureCoordinatesColor), reinterpret_cast<const GLvoid*>(vertexOffset + offsetof(Position3DTextureCoordinatesColor, position)));
+	glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::TEXTURE_COORDINATE, 2, GL_FLOAT, GL_FALSE, sizeof(Position3DTextureCoordinatesColor), reinterpret_cast<const GLvoid*>(vertexOffset + offsetof(Position3DTextureCoordinatesColor, textureCoordinate)));
+	glVertexAttribPointer((GLuint)GLProgram::AttributeLocation::COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Position3DTextureCoordinatesColor), reinterpret_cast<const GLvoid*>(vertexOffset + offsetof(Position3DTextureCoordinatesColor, color)));
+	GLProgram::checkGLError();
+
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _indexBufferId);
+	glBindTexture(GL_TEXTURE_2D, material.texture);
+	GLProgram::checkGLError();
+
+	// ZuĥƂuh֐ւA`ɓߕpXŐݒ肵̂ɖ߂
+	if (material.blendMode == SpriteBatchRenderCommand::BlendMode::ADDITIVE)
+	{
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+	}
+
+	glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(numIndices), GL_UNSIGNED_SHORT, nullptr);
+	GLProgram::checkGLError();
+
+	if (material.blendMode == SpriteBatchRenderCommand::BlendMode::ADDITIVE)
+	{
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	}
+
+	glDisableVertexAttribArray((GLuint)GLProgram::AttributeLocation::COLOR);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+#endif
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,58 @@
+#pragma once
+#include "BasicDataTypes.h"
+#include "SpriteBatchRenderCommand.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "D3DProgram.h"
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLProgram.h"
+#endif
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// Sprite2DLabelAtlas̎lp`Am[hƂ̃h[łȂSpriteBatchRenderCommandɂ܂Ƃ߂ĕ`悷
+// _̓L[ɐςގ_Ń[hWɕϊĂA`掞StreamingBufferɏŋʂ̃CfbNXobt@ŕ`悷
+// ǉ͒Õob`łȂAdȂ̂Ȃ͈͂ł̂ڂē}eÃob`T̂ŁAeNX`݂ɕłh[͑Ȃ
+class SpriteBatcher final
+{
+public:
+	// CfbNX16bitɂĂ̂65536 / 4菬
+	static const size_t MAX_QUADS_PER_BATCH = 4096;
+	// }eÃob`TƂɂ̂ڂob`̐
+	static const size_t MAX_SEARCH_BATCHES = 8;
+
+	SpriteBatcher();
+	~SpriteBatcher();
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	bool init(ID3D11Device* device);
+#elif defined(MGRRENDERER_USE_OPENGL)
+	bool init();
+#endif
+	// vertices͎lp`ƂQuadrangle2DƓAAEAȄ4_BqueueɂRendereř݂̃L[n
+	void addQuads(std::vector<RenderCommand*>& queue, const SpriteBatchRenderCommand::Material& material, const Position2DTextureCoordinates* vertices, size_t numQuads, const Mat4& modelMatrix, const Color4B& color);
+	// Renderer̃L[ɂɌĂԁBR}h̃t[Ŏg܂킷
+	void endFrame();
+	void draw(const SpriteBatchRenderCommand& command);
+
+private:
+	std::vector<SpriteBatchRenderCommand*> _commands;
+	size_t _numUsedCommands;
+	std::vector<Position3DTextureCoordinatesColor> _transformedVertices;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	D3DProgram _d3dProgram;
+	ID3D11Buffer* _indexBuffer;
+	ID3D11BlendState* _blendStateAdditive;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	GLProgram _glProgram;
+	GLuint _indexBufferId;
+#endif
+
+	SpriteBatchRenderCommand* createCommand(const SpriteBatchRenderCommand::Material& material);
+	void addQuadsWithinLimit(std::vector<RenderCommand*>& queue, const SpriteBatchRenderCommand::Material& material, const Position3DTextureCoordinatesColor* vertices, size_t numQuads, const Mat4& viewProjectionMatrix);
+
+	SpriteBatcher(const SpriteBatcher&) = delete;
+	SpriteBatcher& operator=(const SpriteBatcher&) = delete;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,290 @@
+#include "StreamingBuffer.h"
+#include "utility/Logger.h"
+#include <string.h>
+
+#if defined(MGRRENDERER_USE_OPENGL)
+#include "GLProgram.h"
+#endif
+
+namespace mgrrenderer
+{
+
+static size_t alignOffset(size_t offset, size_t alignment)
+{
+	if (alignment <= 1)
+	{
+		return offset;
+	}
+
+	return (offset + alignment - 1) / alignment * alignment;
+}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+StreamingBuffer::StreamingBuffer() :
+_size(0),
+_head(0),
+_buffer(nullptr),
+_context(nullptr),
+_needsDiscard(true)
+{
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+	if (_buffer != nullptr)
+	{
+		_buffer->Release();
+		_buffer = nullptr;
+	}
+
+	_context = nullptr;
+}
+
+bool StreamingBuffer::init(ID3D11Device* device, ID3D11DeviceContext* context, Type type, size_t size)
+{
+	D3D11_BUFFER_DESC bufferDesc;
+	bufferDesc.ByteWidth = static_cast<UINT>(size);
+	bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+	bufferDesc.BindFlags = (type == Type::VERTEX) ? D3D11_BIND_VERTEX_BUFFER : D3D11_BIND_INDEX_BUFFER;
+	bufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+	bufferDesc.MiscFlags = 0;
+	bufferDesc.StructureByteStride = 0;
+
+	HRESULT result = device->CreateBuffer(&bufferDesc, nullptr, &_buffer);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "CreateBuffer failed. result=%d", result);
+		_buffer = nullptr;
+		return false;
+	}
+
+	_context = context;
+	_size = size;
+	_head = 0;
+	_needsDiscard = true;
+	return true;
+}
+
+void StreamingBuffer::endFrame()
+{
+	// Direct3DłWRITE_DISCARDƂɃhCoGPU̓ǂݏI҂ɍςނ悤̈ւ̂ŁAt[Pʂł邱Ƃ͂Ȃ
+}
+
+size_t StreamingBuffer::write(const void* data, size_t size, size_t alignment)
+{
+	Logger::logAssert(_buffer != nullptr, "OStreamingBufferɏƂB");
+	if (size > _size)
+	{
+		Logger::logAssert(false, "StreamingBuffer̃TCY傫f[^ƂBsize=%d", static_cast<int>(size));
+		return INVALID_OFFSET;
+	}
+
+	size_t offset = alignOffset(_head, alignment);
+	if (offset + size > _size)
+	{
+		// 1AGPUǂł邩Ȃ̈㏑Ȃ悤Ɏ̂ĂĐV̈ɂĂ炤
+		offset = 0;
+		_needsDiscard = true;
+	}
+
+	D3D11_MAPPED_SUBRESOURCE mappedResource;
+	HRESULT result = _context->Map(_buffer, 0, _needsDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE, 0, &mappedResource);
+	if (FAILED(result))
+	{
+		Logger::logAssert(false, "Map failed, result=%d", result);
+		return INVALID_OFFSET;
+	}
+
+	CopyMemory(static_cast<unsigned char*>(mappedResource.pData) + offset, data, size);
+	_context->Unmap(_buffer, 0);
+
+	_head = offset + size;
+	_needsDiscard = false;
+	return offset;
+}
+#elif defined(MGRRENDERER_USE_OPENGL)
+// ҂̃^CAEgB^CAEgĂ`悪I܂ő҂
+static const GLuint64 FENCE_TIMEOUT_NANOSECONDS = 1000000000;
+
+StreamingBuffer::StreamingBuffer() :
+_size(0),
+_head(0),
+_bufferId(0),
+_target(GL_ARRAY_BUFFER),
+_mappedData(nullptr),
+_frameBegin(0)
+{
+}
+
+StreamingBuffer::~StreamingBuffer()
+{
+	for (const Fence& fence : _fences)
+	{
+		glDeleteSync(fence.sync);
+	}
+	_fences.clear();
+
+	if (_bufferId != 0)
+	{
+		if (_mappedData != nullptr)
+		{
+			glBindBuffer(_target, _bufferId);
+			glUnmapBuffer(_target);
+			glBindBuffer(_target, 0);
+			_mappedData = nullptr;
+		}
+
+		glDeleteBuffers(1, &_bufferId);
+		_bufferId = 0;
+	}
+}
+
+bool StreamingBuffer::init(Type type, size_t size)
+{
+	_target = (type == Type::VERTEX) ? GL_ARRAY_BUFFER : GL_ELEMENT_ARRAY_BUFFER;
+
+	glGenBuffers(1, &_bufferId);
+	GLProgram::checkGLError();
+	if (_bufferId == 0)
+	{
+		Logger::logAssert(false, "obt@s");
+		return false;
+	}
+
+	glBindBuffer(_target, _bufferId);
+	if (GLProgram::isExtensionSupported("GL_ARB_buffer_storage"))
+	{
+		// COHERENTɂĂΏ݌̃tbV͗vȂ
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(_target, static_cast<GLsizeiptr>(size), nullptr, flags);
+		GLProgram::checkGLError();
+		_mappedData = static_cast<unsigned char*>(glMapBufferRange(_target, 0, static_cast<GLsizeiptr>(size), flags));
+		GLProgram::checkGLError();
+		Logger::logAssert(_mappedData != nullptr, "i}bvɎs");
+	}
+	else
+	{
+		Logger::log("GL_ARB_buffer_storagegȂ̂ŉi}bv͎gȂB");
+		glBufferData(_target, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+		GLProgram::checkGLError();
+	}
+	glBindBuffer(_target, 0);
+
+	_size = size;
+	_head = 0;
+	_frameBegin = 0;
+	return true;
+}
+
+void StreamingBuffer::endFrame()
+{
+	if (_head == _frameBegin)
+	{
+		// ̃t[ł͉łȂ
+		return;
+	}
+
+	Fence fence;
+	fence.sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	fence.begin = _frameBegin;
+	fence.end = _head;
+	_fences.push_back(fence);
+
+	_frameBegin = _head;
+}
+
+size_t StreamingBuffer::write(const void* data, size_t size, size_t alignment)
+{
+	Logger::logAssert(_bufferId != 0, "OStreamingBufferɏƂB");
+	if (size > _size)
+	{
+		Logger::logAssert(false, "StreamingBuffer̃TCY傫f[^ƂBsize=%d", static_cast<int>(size));
+		return INVALID_OFFSET;
+	}
+
+	size_t offset = alignOffset(_head, alignment);
+	if (offset + size > _size)
+	{
+		offset = 0;
+	}
+
+	if (isOverlapped(_frameBegin, _head, offset, size))
+	{
+		// 1t[ŏޗʂobt@̃TCY𒴂Ă
+		Logger::logAssert(false, "StreamingBuffer̃TCY1t[̏ݗʂ菬B");
+		return INVALID_OFFSET;
+	}
+
+	waitForRange(offset, size);
+
+	if (_mappedData != nullptr)
+	{
+		memcpy(_mappedData + offset, data, size);
+#if defined(MGRRENDERER_ENABLE_GL_CAPTURE)
+		// GĽĂяooRȂ݂Ȃ̂ŁAĐœ_g悤ɕʓrL^
+		GLCommandRecorder::recordMappedWrite(_mappedData + offset, size);
+#endif
+	}
+	else
+	{
+		glBindBuffer(_target, _bufferId);
+		glBufferSubData(_target, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data);
+		GLProgram::checkGLError();
+		glBindBuffer(_target, 0);
+	}
+
+	_head = offset + size;
+	return offset;
+}
+
+bool StreamingBuffer::isOverlapped(size_t begin, size_t end, size_t offset, size_t size)
+{
+	if (begin == end)
+	{
+		return false;
+	}
+
+	if (begin < end)
+	{
+		return (offset < end && begin < offset + size);
+	}
+
+	// obt@̏I[Ő܂ԂĂ͈
+	return (offset < end || begin < offset + size);
+}
+
+void StreamingBuffer::waitForRange(size_t offset, size_t size)
+{
+	// tFX͌Âɕł̂ŁAޔ͈͂ǂރt[ȂȂ܂ŌÂ҂
+	while (!_fences.empty())
+	{
+		bool overlapped = false;
+		for (const Fence& fence : _fences)
+		{
+			if (isOverlapped(fence.begin, fence.end, offset, size))
+			{
+				overlapped = true;
+				break;
+			}
+		}
+
+		if (!overlapped)
+		{
+			return;
+		}
+
+		const Fence& oldest = _fences.front();
+		GLenum result = GL_TIMEOUT_EXPIRED;
+		while (result == GL_TIMEOUT_EXPIRED)
+		{
+			result = glClientWaitSync(oldest.sync, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NANOSECONDS);
+		}
+		Logger::logAssert(result != GL_WAIT_FAILED, "glClientWaitSync failed.");
+
+		glDeleteSync(oldest.sync);
+		_fences.pop_front();
+	}
+}
+#endif
+
+} // namespace mgrrenderer
@@ -0,0 +1,76 @@
+#pragma once
+#include "Config.h"
+#include <cstddef>
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include <d3d11.h>
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLHeader.h"
+#include <deque>
+#endif
+
+namespace mgrrenderer
+{
+
+// CPUŖt[钸_CfbNXނ߂̃Oobt@Bh[ƂɃobt@NCAgzn肵Ȃ
+// OpenGL͉i}bvobt@ɒڏ݁AGPUǂݏI̓t[Ƃ̃tFXŔ肵ė̈ėp
+// Direct3DWRITE_NO_OVERWRITEŒǋLA1WRITE_DISCARDŐV̈hCoɗpӂĂ炤
+class StreamingBuffer final
+{
+public:
+	enum class Type : int
+	{
+		VERTEX,
+		INDEX,
+	};
+
+	static const size_t DEFAULT_SIZE = 1024 * 1024;
+	// writemۂłȂƂ̖߂l
+	static const size_t INVALID_OFFSET = static_cast<size_t>(-1);
+
+	StreamingBuffer();
+	~StreamingBuffer();
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	bool init(ID3D11Device* device, ID3D11DeviceContext* context, Type type, size_t size);
+	ID3D11Buffer* getBuffer() const { return _buffer; }
+#elif defined(MGRRENDERER_USE_OPENGL)
+	bool init(Type type, size_t size);
+	GLuint getBufferId() const { return _bufferId; }
+#endif
+	// t[̕`悪SIɌĂԁBOpenGLł͂̃t[ɏ񂾗̈ɃtFXu
+	void endFrame();
+	// dataalignmentɑʒuɏ݁Aobt@擪̃oCgItZbgԂ
+	size_t write(const void* data, size_t size, size_t alignment);
+
+private:
+	size_t _size;
+	size_t _head;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	ID3D11Buffer* _buffer;
+	ID3D11DeviceContext* _context;
+	bool _needsDiscard;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	struct Fence
+	{
+		GLsync sync;
+		// tFXut[ŏ񂾔͈́Bbeginend傫Ƃ̓obt@̏I[Ő܂ԂĂ
+		size_t begin;
+		size_t end;
+	};
+
+	GLuint _bufferId;
+	GLenum _target;
+	// GL_ARB_buffer_storagegȂłnullptrŁAglBufferSubDataŏ
+	unsigned char* _mappedData;
+	size_t _frameBegin;
+	std::deque<Fence> _fences;
+
+	static bool isOverlapped(size_t begin, size_t end, size_t offset, size_t size);
+	void waitForRange(size_t offset, size_t size);
+#endif
+
+	StreamingBuffer(const StreamingBuffer&) = delete;
+	StreamingBuffer& operator=(const StreamingBuffer&) = delete;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,390 @@
+#include "TextureAtlas.h"
+#include "Image.h"
+#include "TextureUtility.h"
+#include "utility/Logger.h"
+#if defined(MGRRENDERER_USE_DIRECT3D)
+#include "D3DTexture.h"
+#elif defined(MGRRENDERER_USE_OPENGL)
+#include "GLTexture.h"
+#endif
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+
+namespace mgrrenderer
+{
+
+TextureAtlas* TextureAtlas::_instance = nullptr;
+
+TextureAtlas* TextureAtlas::getInstance()
+{
+	if (_instance == nullptr)
+	{
+		_instance = new TextureAtlas();
+	}
+
+	return _instance;
+}
+
+void TextureAtlas::destroy()
+{
+	delete _instance;
+	_instance = nullptr;
+}
+
+TextureAtlas::TextureAtlas()
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	clear();
+}
+
+void TextureAtlas::clear()
+{
+	for (Page& page : _pages)
+	{
+		delete page.texture;
+		page.texture = nullptr;
+	}
+
+	_pages.clear();
+	_regions.clear();
+}
+
+const TextureAtlas::Region* TextureAtlas::retain(const std::string& filePath)
+{
+	std::unordered_map<std::string, Region>::iterator it = _regions.find(filePath);
+	if (it != _regions.end())
+	{
+		// }ς݂Ȃ摜̃fR[hȂ
+		it->second.referenceCount++;
+		return &it->second;
+	}
+
+	Image image; // ImageCPŨgĂ̂ł̃XR[vŉĂ悢̂X^bNɎ
+	if (!image.initWithFilePath(filePath))
+	{
+		return nullptr;
+	}
+
+	return retain(filePath, image);
+}
+
+const TextureAtlas::Region* TextureAtlas::retain(const std::string& key, const Image& image)
+{
+	std::unordered_map<std::string, Region>::iterator it = _regions.find(key);
+	if (it != _regions.end())
+	{
+		it->second.referenceCount++;
+		return &it->second;
+	}
+
+	unsigned int width = image.getWidth();
+	unsigned int height = image.getHeight();
+	if (image.getRawData() == nullptr || width == 0 || height == 0 || width > MAX_REGION_SIZE || height > MAX_REGION_SIZE)
+	{
+		return nullptr;
+	}
+
+	// y[WRGBA8888Ȃ̂ŁAf[^RGBA8888ɂ낦Ă珑
+	unsigned char* convertedData = nullptr;
+	size_t convertedDataLen = 0;
+	TextureUtility::PixelFormat toFormat = TextureUtility::convertDataToFormat(image.getRawData(), image.getRawDataLength(), image.getPixelFormat(), TextureUtility::PixelFormat::RGBA8888, &convertedData, &convertedDataLen);
+	if (toFormat != TextureUtility::PixelFormat::RGBA8888 || convertedDataLen != width * height * 4)
+	{
+		Logger::log("eNX`AgXɓȂsNZtH[}bgBformat=%d", static_cast<int>(image.getPixelFormat()));
+		if (convertedData != image.getRawData())
+		{
+			free(convertedData);
+		}
+		return nullptr;
+	}
+
+	unsigned int paddedWidth = width + PADDING * 2;
+	unsigned int paddedHeight = height + PADDING * 2;
+
+	// Sy[W̒ōł悭܂ʒuT
+	size_t bestPageIndex = _pages.size();
+	PackRect bestRect;
+	unsigned int bestScore = UINT_MAX;
+	for (size_t i = 0; i < _pages.size(); i++)
+	{
+		PackRect rect;
+		unsigned int score = 0;
+		if (findPosition(_pages[i], paddedWidth, paddedHeight, rect, score) && score < bestScore)
+		{
+			bestPageIndex = i;
+			bestRect = rect;
+			bestScore = score;
+		}
+	}
+
+	if (bestPageIndex == _pages.size())
+	{
+		// ǂ̃y[WɂȂ̂Ńy[Wǉ
+		unsigned int score = 0;
+		if (!addPage() || !findPosition(_pages.back(), paddedWidth, paddedHeight, bestRect, score))
+		{
+			if (convertedData != image.getRawData())
+			{
+				free(convertedData);
+			}
+			return nullptr;
+		}
+	}
+
+	Page& page = _pages[bestPageIndex];
+	placeRect(page, bestRect);
+	page.numRegions++;
+	writeImage(page, bestRect, convertedData, width, height);
+
+	if (convertedData != image.getRawData())
+	{
+		free(convertedData);
+	}
+
+	Region region;
+	region.pageIndex = bestPageIndex;
+	region.x = bestRect.x + PADDING;
+	region.y = bestRect.y + PADDING;
+	region.contentSize = SizeUint(width, height);
+	region.textureCoordinateMin = Vec2(static_cast<float>(region.x) / PAGE_SIZE, static_cast<float>(region.y) / PAGE_SIZE);
+	region.textureCoordinateMax = Vec2(static_cast<float>(region.x + width) / PAGE_SIZE, static_cast<float>(region.y + height) / PAGE_SIZE);
+	region.referenceCount = 1;
+
+	return &_regions.insert(std::make_pair(key, region)).first->second;
+}
+
+void TextureAtlas::release(const std::string& key)
+{
+	// clearɃm[hꂽꍇ͉Ȃ
+	std::unordered_map<std::string, Region>::iterator it = _regions.find(key);
+	if (it == _regions.end())
+	{
+		return;
+	}
+
+	Region& region = it->second;
+	Logger::logAssert(region.referenceCount > 0, "QƃJEg0̗̈悤ƂBkey=%s", key.c_str());
+	region.referenceCount--;
+	if (region.referenceCount > 0)
+	{
+		return;
+	}
+
+	Page& page = _pages[region.pageIndex];
+	freeRect(page, PackRect(region.x - PADDING, region.y - PADDING, region.contentSize.width + PADDING * 2, region.contentSize.height + PADDING * 2));
+	page.numRegions--;
+	if (page.numRegions == 0)
+	{
+		// y[WɂȂ󂫗̈̒fЉȂ߂ɍ蒼BeNX`͎̑}ŏ㏑̂ŎcĂ
+		resetFreeRects(page);
+	}
+
+	_regions.erase(it);
+}
+
+const TextureAtlas::Region* TextureAtlas::getRegion(const std::string& key) const
+{
+	std::unordered_map<std::string, Region>::const_iterator it = _regions.find(key);
+	if (it == _regions.end())
+	{
+		return nullptr;
+	}
+
+	return &it->second;
+}
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+D3DTexture* TextureAtlas::getPageTexture(size_t pageIndex) const
+#elif defined(MGRRENDERER_USE_OPENGL)
+GLTexture* TextureAtlas::getPageTexture(size_t pageIndex) const
+#endif
+{
+	Logger::logAssert(pageIndex < _pages.size(), "݂Ȃy[WQƂBpageIndex=%d", static_cast<int>(pageIndex));
+	return _pages[pageIndex].texture;
+}
+
+bool TextureAtlas::addPage()
+{
+	Page page;
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	page.texture = new D3DTexture();
+#elif defined(MGRRENDERER_USE_OPENGL)
+	page.texture = new GLTexture();
+#endif
+	if (!page.texture->initWithSize(SizeUint(PAGE_SIZE, PAGE_SIZE)))
+	{
+		Logger::logAssert(false, "eNX`AgX̃y[W̐ɎsB");
+		delete page.texture;
+		return false;
+	}
+
+	page.numRegions = 0;
+	resetFreeRects(page);
+	_pages.push_back(page);
+	return true;
+}
+
+void TextureAtlas::resetFreeRects(Page& page)
+{
+	page.freeRects.clear();
+	page.freeRects.push_back(PackRect(0, 0, PAGE_SIZE, PAGE_SIZE));
+}
+
+bool TextureAtlas::findPosition(const Page& page, unsigned int width, unsigned int height, PackRect& outRect, unsigned int& outScore)
+{
+	// Best Short Side FitB]̒ZӂقǁAגgȂԂcɂ
+	bool isFound = false;
+	outScore = UINT_MAX;
+	unsigned int bestLongSideFit = UINT_MAX;
+
+	for (const PackRect& freeRect : page.freeRects)
+	{
+		if (freeRect.width < width || freeRect.height < height)
+		{
+			continue;
+		}
+
+		unsigned int leftoverHorizontal = freeRect.width - width;
+		unsigned int leftoverVertical = freeRect.height - height;
+		unsigned int shortSideFit = (std::min)(leftoverHorizontal, leftoverVertical);
+		unsigned int longSideFit = (std::max)(leftoverHorizontal, leftoverVertical);
+		if (shortSideFit < outScore || (shortSideFit == outScore && longSideFit < bestLongSideFit))
+		{
+			outRect = PackRect(freeRect.x, freeRect.y, width, height);
+			outScore = shortSideFit;
+			bestLongSideFit = longSideFit;
+			isFound = true;
+		}
+	}
+
+	return isFound;
+}
+
+void TextureAtlas::placeRect(Page& page, const PackRect& usedRect)
+{
+	// gp`ƏdȂ󂫗̈AdȂȂő4̋`ɕ
+	std::vector<PackRect> newFreeRects;
+	for (std::vector<PackRect>::iterator it = page.freeRects.begin(); it != page.freeRects.end();)
+	{
+		const PackRect freeRect = *it;
+		if (!freeRect.intersects(usedRect))
+		{
+			++it;
+			continue;
+		}
+
+		if (usedRect.x > freeRect.x)
+		{
+			newFreeRects.push_back(PackRect(freeRect.x, freeRect.y, usedRect.x - freeRect.x, freeRect.height));
+		}
+
+		if (usedRect.x + usedRect.width < freeRect.x + freeRect.width)
+		{
+			newFreeRects.push_back(PackRect(usedRect.x + usedRect.width, freeRect.y, freeRect.x + freeRect.width - (usedRect.x + usedRect.width), freeRect.height));
+		}
+
+		if (usedRect.y > freeRect.y)
+		{
+			newFreeRects.push_back(PackRect(freeRect.x, freeRect.y, freeRect.width, usedRect.y - freeRect.y));
+		}
+
+		if (usedRect.y + usedRect.height < freeRect.y + freeRect.height)
+		{
+			newFreeRects.push_back(PackRect(freeRect.x, usedRect.y + usedRect.height, freeRect.width, freeRect.y + freeRect.height - (usedRect.y + usedRect.height)));
+		}
+
+		it = page.freeRects.erase(it);
+	}
+
+	page.freeRects.insert(page.freeRects.end(), newFreeRects.begin(), newFreeRects.end());
+	pruneFreeRects(page);
+}
+
+void TextureAtlas::freeRect(Page& page, const PackRect& usedRect)
+{
+	PackRect rect = usedRect;
+
+	// ӂL󂫗̈ƂȂāA傫摜悤ɂBȂʂɂȂ邱Ƃ̂ŌJԂ
+	bool isMerged = true;
+	while (isMerged)
+	{
+		isMerged = false;
+		for (std::vector<PackRect>::iterator it = page.freeRects.begin(); it != page.freeRects.end(); ++it)
+		{
+			const PackRect& freeRect = *it;
+			if (freeRect.x == rect.x && freeRect.width == rect.width && (freeRect.y + freeRect.height == rect.y || rect.y + rect.height == freeRect.y))
+			{
+				rect = PackRect(rect.x, (std::min)(rect.y, freeRect.y), rect.width, rect.height + freeRect.height);
+			}
+			else if (freeRect.y == rect.y && freeRect.height == rect.height && (freeRect.x + freeRect.width == rect.x || rect.x + rect.width == freeRect.x))
+			{
+				rect = PackRect((std::min)(rect.x, freeRect.x), rect.y, rect.width + freeRect.width, rect.height);
+			}
+			else
+			{
+				continue;
+			}
+
+			page.freeRects.erase(it);
+			isMerged = true;
+			break;
+		}
+	}
+
+	page.freeRects.push_back(rect);
+	pruneFreeRects(page);
+}
+
+void TextureAtlas::pruneFreeRects(Page& page)
+{
+	// ̋󂫗̈Ɋ܂܂󂫗̈͒T̖ʂȂ̂Ŏ菜
+	std::vector<PackRect>& freeRects = page.freeRects;
+	for (size_t i = 0; i < freeRects.size(); i++)
+	{
+		for (size_t j = i + 1; j < freeRects.size();)
+		{
+			if (freeRects[i].contains(freeRects[j]))
+			{
+				freeRects.erase(freeRects.begin() + j);
+			}
+			else if (freeRects[j].contains(freeRects[i]))
+			{
+				freeRects.erase(freeRects.begin() + i);
+				i--;
+				break;
+			}
+			else
+			{
+				j++;
+			}
+		}
+	}
+}
+
+void TextureAtlas::writeImage(const Page& page, const PackRect& usedRect, const unsigned char* rgbaData, unsigned int width, unsigned int height)
+{
+	// pfBOɂ͉摜̒[̃sNZL΂ď
+	std::vector<unsigned char> paddedData(usedRect.width * usedRect.height * 4);
+	for (unsigned int y = 0; y < usedRect.height; y++)
+	{
+		unsigned int srcY = static_cast<unsigned int>((std::min)((std::max)(static_cast<int>(y) - static_cast<int>(PADDING), 0), static_cast<int>(height) - 1));
+		for (unsigned int x = 0; x < usedRect.width; x++)
+		{
+			unsigned int srcX = static_cast<unsigned int>((std::min)((std::max)(static_cast<int>(x) - static_cast<int>(PADDING), 0), static_cast<int>(width) - 1));
+			const unsigned char* src = rgbaData + (srcY * width + srcX) * 4;
+			unsigned char* dst = paddedData.data() + (y * usedRect.width + x) * 4;
+			dst[0] = src[0];
+			dst[1] = src[1];
+			dst[2] = src[2];
+			dst[3] = src[3];
+		}
+	}
+
+	page.texture->updateSubImage(usedRect.x, usedRect.y, usedRect.width, usedRect.height, paddedData.data());
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,108 @@
+#pragma once
+#include "Config.h"
+#include "BasicDataTypes.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace mgrrenderer
+{
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+class D3DTexture;
+#elif defined(MGRRENDERER_USE_OPENGL)
+class GLTexture;
+#endif
+class Image;
+
+// vZXŜŋLeNX`AgXB摜傫y[WeNX`MaxRects@ŋlߍ݁A
+// y[WQƂXvCgmSpriteBatcherł܂Ƃ߂ĕ`ł悤ɂ
+// ͎̈QƃJEgŊǗAQƂȂȂ󂫗̈ɖ߂ĕʂ̉摜̑}ɍėp
+class TextureAtlas final
+{
+public:
+	static const unsigned int PAGE_SIZE = 2048;
+	// `Ԃŗׂ̗̈̐Fɂ܂Ȃ悤ɁÄ̎͂ɉ摜̒[̃sNZL΂Ė߂镝
+	static const unsigned int PADDING = 2;
+	// 傫摜̓AgXɓĂlߍ݂̌̂Ōʂ̃eNX`ɂ
+	static const unsigned int MAX_REGION_SIZE = 512;
+
+	struct Region
+	{
+		size_t pageIndex;
+		// pfBOA摜܂Ăy[Ẅʒu
+		unsigned int x;
+		unsigned int y;
+		SizeUint contentSize;
+		// 摜̍ƉẼeNX`W
+		Vec2 textureCoordinateMin;
+		Vec2 textureCoordinateMax;
+		size_t referenceCount;
+	};
+
+	static TextureAtlas* getInstance();
+	static void destroy();
+	// y[WeNX`SĉBfoCXReLXgjOɌĂ
+	void clear();
+
+	// t@CpXL[ɂĉ摜}AQƃJEg𑝂₵ė̈ԂBɑ}ς݂Ȃ炻̗̈Ԃ
+	// 摜傫ēȂꍇnullptrԂBsvɂȂreleaseĂ
+	const Region* retain(const std::string& filePath);
+	const Region* retain(const std::string& key, const Image& image);
+	// QƃJEg炵A0ɂȂ̈󂫗̈ɖ߂
+	void release(const std::string& key);
+	const Region* getRegion(const std::string& key) const;
+
+#if defined(MGRRENDERER_USE_DIRECT3D)
+	D3DTexture* getPageTexture(size_t pageIndex) const;
+#elif defined(MGRRENDERER_USE_OPENGL)
+	GLTexture* getPageTexture(size_t pageIndex) const;
+#endif
+	size_t getNumPages() const { return _pages.size(); }
+
+private:
+	// W̋`BBasicDataTypesRectfloatȂ̂ŕʂɎ
+	struct PackRect
+	{
+		unsigned int x;
+		unsigned int y;
+		unsigned int width;
+		unsigned int height;
+
+		PackRect() : x(0), y(0), width(0), height(0) {}
+		PackRect(unsigned int x_, unsigned int y_, unsigned int width_, unsigned int height_) : x(x_), y(y_), width(width_), height(height_) {}
+		bool contains(const PackRect& rect) const { return rect.x >= x && rect.y >= y && rect.x + rect.width <= x + width && rect.y + rect.height <= y + height; }
+		bool intersects(const PackRect& rect) const { return rect.x < x + width && x < rect.x + rect.width && rect.y < y + height && y < rect.y + rect.height; }
+	};
+
+	struct Page
+	{
+#if defined(MGRRENDERER_USE_DIRECT3D)
+		D3DTexture* texture;
+#elif defined(MGRRENDERER_USE_OPENGL)
+		GLTexture* texture;
+#endif
+		// 󂫗̈擯m͏dȂĂĂ悢Agp̗̈Ƃ͏dȂȂ
+		std::vector<PackRect> freeRects;
+		size_t numRegions;
+	};
+
+	static TextureAtlas* _instance;
+
+	std::vector<Page> _pages;
+	std::unordered_map<std::string, Region> _regions;
+
+	TextureAtlas();
+	~TextureAtlas();
+
+	bool addPage();
+	static void resetFreeRects(Page& page);
+	// łZӂ̗]肪Ȃ󂫗̈TBȂfalse
+	static bool findPosition(const Page& page, unsigned int width, unsigned int height, PackRect& outRect, unsigned int& outScore);
+	static void placeRect(Page& page, const PackRect& usedRect);
+	static void freeRect(Page& page, const PackRect& usedRect);
+	static void pruneFreeRects(Page& page);
+	static void writeImage(const Page& page, const PackRect& usedRect, const unsigned char* rgbaData, unsigned int width, unsigned int height);
+};
+
+} // namespace mgrrenderer
@@ -1,6 +1,6 @@
 #include "TextureUtility.h"
 #include "utility/Logger.h"
-#include <ShlObj.h> // malloĉ
+#include <stdlib.h> // malloĉ
 
 namespace mgrrenderer
 {
@@ -0,0 +1,645 @@
+#include "CommandReplayer.h"
+#include "utility/Logger.h"
+#include <string.h>
+
+namespace mgrrenderer
+{
+
+using GLCaptureFormat::Opcode;
+typedef ReplayBackend::ObjectType ObjectType;
+
+// O⃍P[VYɂĔẑŁAꂽt@CŋȔzmۂȂ悤ɏ݂
+static const unsigned int MAX_NAME = 1 << 20;
+static const int VARIABLE_NUM_WORDS = -1;
+static const int NO_BLOB_WORD = -1;
+
+struct OpcodeInfo
+{
+	// ̃[hBϒ̃R}hVARIABLE_NUM_WORDS
+	int numWords;
+	// uu̔ԍĂ̈ʒuBuuȂR}hNO_BLOB_WORD
+	int blobWord;
+};
+
+// GLCaptureFormat::Opcodȅɕׂ
+static const OpcodeInfo OPCODE_INFOS[] = {
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // GEN_TEXTURES
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // GEN_BUFFERS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // GEN_VERTEX_ARRAYS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // GEN_FRAMEBUFFERS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // GEN_RENDERBUFFERS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // DELETE_TEXTURES
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // DELETE_BUFFERS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // DELETE_VERTEX_ARRAYS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // DELETE_FRAMEBUFFERS
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // DELETE_RENDERBUFFERS
+	{2, NO_BLOB_WORD}, // CREATE_SHADER
+	{1, NO_BLOB_WORD}, // CREATE_PROGRAM
+	{1, NO_BLOB_WORD}, // DELETE_SHADER
+	{1, NO_BLOB_WORD}, // DELETE_PROGRAM
+	{3, NO_BLOB_WORD}, // FENCE_SYNC
+	{4, NO_BLOB_WORD}, // CLIENT_WAIT_SYNC
+	{1, NO_BLOB_WORD}, // DELETE_SYNC
+
+	{2, NO_BLOB_WORD}, // BIND_TEXTURE
+	{2, NO_BLOB_WORD}, // BIND_BUFFER
+	{1, NO_BLOB_WORD}, // BIND_VERTEX_ARRAY
+	{2, NO_BLOB_WORD}, // BIND_FRAMEBUFFER
+	{2, NO_BLOB_WORD}, // BIND_RENDERBUFFER
+	{1, NO_BLOB_WORD}, // USE_PROGRAM
+	{1, NO_BLOB_WORD}, // ACTIVE_TEXTURE
+	{1, NO_BLOB_WORD}, // ENABLE
+	{1, NO_BLOB_WORD}, // DISABLE
+	{1, NO_BLOB_WORD}, // CULL_FACE
+	{2, NO_BLOB_WORD}, // BLEND_FUNC
+	{2, NO_BLOB_WORD}, // POLYGON_MODE
+	{1, NO_BLOB_WORD}, // LINE_WIDTH
+	{4, NO_BLOB_WORD}, // VIEWPORT
+	{1, NO_BLOB_WORD}, // CLEAR
+	{4, NO_BLOB_WORD}, // CLEAR_COLOR
+	{2, NO_BLOB_WORD}, // CLEAR_DEPTH
+	{2, NO_BLOB_WORD}, // PIXEL_STOREI
+	{3, NO_BLOB_WORD}, // TEX_PARAMETERI
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // TEX_PARAMETERFV
+	{1, NO_BLOB_WORD}, // DRAW_BUFFER
+	{1, NO_BLOB_WORD}, // READ_BUFFER
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // DRAW_BUFFERS
+	{1, NO_BLOB_WORD}, // ENABLE_VERTEX_ATTRIB_ARRAY
+	{1, NO_BLOB_WORD}, // DISABLE_VERTEX_ATTRIB_ARRAY
+	{7, NO_BLOB_WORD}, // VERTEX_ATTRIB_POINTER
+	{4, NO_BLOB_WORD}, // RENDERBUFFER_STORAGE
+	{5, NO_BLOB_WORD}, // FRAMEBUFFER_TEXTURE_2D
+	{4, NO_BLOB_WORD}, // FRAMEBUFFER_RENDERBUFFER
+	{10, NO_BLOB_WORD}, // BLIT_FRAMEBUFFER
+	{3, NO_BLOB_WORD}, // DRAW_ARRAYS
+	{5, NO_BLOB_WORD}, // DRAW_ELEMENTS
+	{0, NO_BLOB_WORD}, // FINISH
+
+	{2, 1}, // SHADER_SOURCE
+	{1, NO_BLOB_WORD}, // COMPILE_SHADER
+	{2, NO_BLOB_WORD}, // ATTACH_SHADER
+	{3, 2}, // BIND_ATTRIB_LOCATION
+	{3, NO_BLOB_WORD}, // PROGRAM_PARAMETERI
+	{1, NO_BLOB_WORD}, // LINK_PROGRAM
+	{3, 2}, // PROGRAM_BINARY
+	{3, 1}, // GET_UNIFORM_LOCATION
+
+	{2, NO_BLOB_WORD}, // UNIFORM_1I
+	{2, NO_BLOB_WORD}, // UNIFORM_1F
+	{4, NO_BLOB_WORD}, // UNIFORM_3F
+	{5, NO_BLOB_WORD}, // UNIFORM_4F
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // UNIFORM_3FV
+	{VARIABLE_NUM_WORDS, NO_BLOB_WORD}, // UNIFORM_MATRIX_4FV
+
+	{5, 4}, // BUFFER_DATA
+	{4, 3}, // BUFFER_SUB_DATA
+	{5, 4}, // BUFFER_STORAGE
+	{7, NO_BLOB_WORD}, // MAP_BUFFER_RANGE
+	{2, NO_BLOB_WORD}, // UNMAP_BUFFER
+	{4, 3}, // MAPPED_WRITE
+	{9, 8}, // TEX_IMAGE_2D
+	{9, 8}, // TEX_SUB_IMAGE_2D
+};
+
+static_assert(sizeof(OPCODE_INFOS) / sizeof(OPCODE_INFOS[0]) == static_cast<size_t>(Opcode::NUM_OPCODES), "OPCODE_INFOS must have an entry for every opcode.");
+
+static unsigned long long readWord64(const unsigned int* words)
+{
+	return static_cast<unsigned long long>(words[0]) | (static_cast<unsigned long long>(words[1]) << 32);
+}
+
+// ϒ̃R}ḧ̃[hA擪̌vZ
+static size_t calculateVariableNumWords(Opcode opcode, const unsigned int* words, unsigned int numWords)
+{
+	switch (opcode)
+	{
+	case Opcode::GEN_TEXTURES:
+	case Opcode::GEN_BUFFERS:
+	case Opcode::GEN_VERTEX_ARRAYS:
+	case Opcode::GEN_FRAMEBUFFERS:
+	case Opcode::GEN_RENDERBUFFERS:
+	case Opcode::DELETE_TEXTURES:
+	case Opcode::DELETE_BUFFERS:
+	case Opcode::DELETE_VERTEX_ARRAYS:
+	case Opcode::DELETE_FRAMEBUFFERS:
+	case Opcode::DELETE_RENDERBUFFERS:
+	case Opcode::DRAW_BUFFERS:
+		return (numWords < 1) ? 0 : 1 + static_cast<size_t>(words[0]);
+	case Opcode::TEX_PARAMETERFV:
+		return (numWords < 3) ? 0 : 3 + static_cast<size_t>(words[2]);
+	case Opcode::UNIFORM_3FV:
+		return (numWords < 2) ? 0 : 2 + static_cast<size_t>(words[1]) * 3;
+	case Opcode::UNIFORM_MATRIX_4FV:
+		return (numWords < 3) ? 0 : 3 + static_cast<size_t>(words[1]) * 16;
+	default:
+		return 0;
+	}
+}
+
+static ObjectType getGenDeleteObjectType(Opcode opcode)
+{
+	switch (opcode)
+	{
+	case Opcode::GEN_TEXTURES:
+	case Opcode::DELETE_TEXTURES:
+		return ObjectType::TEXTURE;
+	case Opcode::GEN_BUFFERS:
+	case Opcode::DELETE_BUFFERS:
+		return ObjectType::BUFFER;
+	case Opcode::GEN_VERTEX_ARRAYS:
+	case Opcode::DELETE_VERTEX_ARRAYS:
+		return ObjectType::VERTEX_ARRAY;
+	case Opcode::GEN_FRAMEBUFFERS:
+	case Opcode::DELETE_FRAMEBUFFERS:
+		return ObjectType::FRAMEBUFFER;
+	default:
+		return ObjectType::RENDERBUFFER;
+	}
+}
+
+CommandReplayer::CommandReplayer() :
+_data(nullptr),
+_size(0),
+_header(nullptr),
+_currentProgram(0)
+{
+}
+
+bool CommandReplayer::init(const unsigned char* data, size_t size)
+{
+	_data = data;
+	_size = size;
+
+	if (size < sizeof(GLCaptureFormat::Header))
+	{
+		Logger::log("Lv`̃t@CBsize=%d", static_cast<int>(size));
+		return false;
+	}
+
+	_header = reinterpret_cast<const GLCaptureFormat::Header*>(data);
+	if (memcmp(_header->magic, GLCaptureFormat::MAGIC, sizeof(_header->magic)) != 0)
+	{
+		Logger::log("Lv`̃t@Cł͂ȂB");
+		return false;
+	}
+
+	if (_header->version != GLCaptureFormat::VERSION)
+	{
+		Logger::log("Lv`̌`̃o[WႤBfile=%d expected=%dBL^ƁB", _header->version, GLCaptureFormat::VERSION);
+		return false;
+	}
+
+	// \͈̔͂t@CɎ܂Ă邩AMĊmۂOɊm߂
+	if (_header->numFrames == 0
+		|| _header->frameTableOffset > size
+		|| (size - _header->frameTableOffset) / sizeof(GLCaptureFormat::FrameEntry) < _header->numFrames
+		|| _header->blobTableOffset > size
+		|| (size - _header->blobTableOffset) / sizeof(GLCaptureFormat::BlobEntry) < _header->numBlobs
+		|| _header->commandDataOffset > size
+		|| size - _header->commandDataOffset < _header->commandDataByteSize
+		|| _header->commandDataOffset % sizeof(unsigned int) != 0)
+	{
+		Logger::log("Lv`̃wb_ĂB");
+		return false;
+	}
+
+	const GLCaptureFormat::FrameEntry* frames = reinterpret_cast<const GLCaptureFormat::FrameEntry*>(data + _header->frameTableOffset);
+	_frames.assign(frames, frames + _header->numFrames);
+	const GLCaptureFormat::BlobEntry* blobs = reinterpret_cast<const GLCaptureFormat::BlobEntry*>(data + _header->blobTableOffset);
+	_blobs.assign(blobs, blobs + _header->numBlobs);
+
+	for (const GLCaptureFormat::BlobEntry& blob : _blobs)
+	{
+		if (blob.dataOffset > size || size - blob.dataOffset < blob.byteSize)
+		{
+			Logger::log("Lv`̃uut@C̊OwĂB");
+			return false;
+		}
+	}
+
+	for (const GLCaptureFormat::FrameEntry& frame : _frames)
+	{
+		if (!validateCommands(frame))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool CommandReplayer::validateCommands(const GLCaptureFormat::FrameEntry& frame) const
+{
+	if (frame.commandOffset > _header->commandDataByteSize
+		|| _header->commandDataByteSize - frame.commandOffset < frame.commandByteSize
+		|| frame.commandOffset % sizeof(unsigned int) != 0
+		|| frame.commandByteSize % sizeof(unsigned int) != 0)
+	{
+		Logger::log("Lv`̃t[R}h̊OwĂB");
+		return false;
+	}
+
+	const unsigned int* words = reinterpret_cast<const unsigned int*>(_data + _header->commandDataOffset + frame.commandOffset);
+	size_t numWords = frame.commandByteSize / sizeof(unsigned int);
+	size_t position = 0;
+	unsigned int numCommands = 0;
+	while (position < numWords)
+	{
+		GLCaptureFormat::CommandHeader header;
+		memcpy(&header, &words[position], sizeof(header));
+		position++;
+
+		if (header.opcode >= Opcode::NUM_OPCODES || numWords - position < header.numWords)
+		{
+			Logger::log("Lv`̃R}hĂBcommand=%d", static_cast<int>(numCommands));
+			return false;
+		}
+
+		const unsigned int* arguments = &words[position];
+		const OpcodeInfo& info = OPCODE_INFOS[static_cast<int>(header.opcode)];
+		size_t expectedNumWords = (info.numWords == VARIABLE_NUM_WORDS) ? calculateVariableNumWords(header.opcode, arguments, header.numWords) : static_cast<size_t>(info.numWords);
+		if (expectedNumWords != header.numWords)
+		{
+			Logger::log("Lv`̃R}ḧ̐ႤBcommand=%d opcode=%d", static_cast<int>(numCommands), static_cast<int>(header.opcode));
+			return false;
+		}
+
+		if (info.blobWord != NO_BLOB_WORD)
+		{
+			unsigned int blobIndex = arguments[info.blobWord];
+			if (blobIndex != GLCaptureFormat::NO_BLOB && blobIndex >= _blobs.size())
+			{
+				Logger::log("Lv`̃R}h݂ȂuuQƂĂBcommand=%d", static_cast<int>(numCommands));
+				return false;
+			}
+
+			// Ƃēn̂0I[Ă邱
+			if (header.opcode == Opcode::SHADER_SOURCE || header.opcode == Opcode::BIND_ATTRIB_LOCATION || header.opcode == Opcode::GET_UNIFORM_LOCATION)
+			{
+				if (blobIndex == GLCaptureFormat::NO_BLOB
+					|| _blobs[blobIndex].byteSize == 0
+					|| _data[_blobs[blobIndex].dataOffset + _blobs[blobIndex].byteSize - 1] != '\0')
+				{
+					Logger::log("Lv`̃̕uu0I[ĂȂBcommand=%d", static_cast<int>(numCommands));
+					return false;
+				}
+			}
+
+			// obt@̃TCYƃf[^̃TCYȂƁAGLuůOǂ
+			if ((header.opcode == Opcode::BUFFER_DATA || header.opcode == Opcode::BUFFER_STORAGE)
+				&& blobIndex != GLCaptureFormat::NO_BLOB
+				&& readWord64(&arguments[1]) != _blobs[blobIndex].byteSize)
+			{
+				Logger::log("Lv`̃obt@̃TCYf[^ƍȂBcommand=%d", static_cast<int>(numCommands));
+				return false;
+			}
+		}
+
+		// Oԍ͔z̓Yɂ̂Ŕ͈͂m߂
+		bool isValid = true;
+		switch (header.opcode)
+		{
+		case Opcode::GEN_TEXTURES:
+		case Opcode::GEN_BUFFERS:
+		case Opcode::GEN_VERTEX_ARRAYS:
+		case Opcode::GEN_FRAMEBUFFERS:
+		case Opcode::GEN_RENDERBUFFERS:
+		case Opcode::DELETE_TEXTURES:
+		case Opcode::DELETE_BUFFERS:
+		case Opcode::DELETE_VERTEX_ARRAYS:
+		case Opcode::DELETE_FRAMEBUFFERS:
+		case Opcode::DELETE_RENDERBUFFERS:
+			for (unsigned int i = 1; i < header.numWords; i++)
+			{
+				isValid = isValid && arguments[i] < MAX_NAME;
+			}
+			break;
+		case Opcode::CREATE_SHADER:
+			isValid = arguments[1] < MAX_NAME;
+			break;
+		case Opcode::CREATE_PROGRAM:
+			isValid = arguments[0] < MAX_NAME;
+			break;
+		case Opcode::FENCE_SYNC:
+			isValid = arguments[2] < MAX_NAME;
+			break;
+		case Opcode::GET_UNIFORM_LOCATION:
+			isValid = arguments[0] < MAX_NAME && arguments[2] < MAX_NAME;
+			break;
+		case Opcode::MAP_BUFFER_RANGE:
+		case Opcode::UNMAP_BUFFER:
+			isValid = arguments[1] < MAX_NAME;
+			break;
+		default:
+			break;
+		}
+
+		if (!isValid)
+		{
+			Logger::log("Lv`̃R}h̖O傫Bcommand=%d", static_cast<int>(numCommands));
+			return false;
+		}
+
+		position += header.numWords;
+		numCommands++;
+	}
+
+	if (numCommands != frame.numCommands)
+	{
+		Logger::log("Lv`̃t[̃R}hႤB");
+		return false;
+	}
+
+	return true;
+}
+
+const unsigned char* CommandReplayer::getBlob(unsigned int blobIndex, size_t& outSize) const
+{
+	if (blobIndex == GLCaptureFormat::NO_BLOB)
+	{
+		outSize = 0;
+		return nullptr;
+	}
+
+	const GLCaptureFormat::BlobEntry& blob = _blobs[blobIndex];
+	outSize = blob.byteSize;
+	return _data + blob.dataOffset;
+}
+
+GLuint CommandReplayer::createName(ReplayBackend& backend, ObjectType type, GLuint capturedName, GLenum shaderType)
+{
+	std::vector<GLuint>& names = _names[static_cast<int>(type)];
+	if (capturedName >= names.size())
+	{
+		names.resize(capturedName + 1, 0);
+	}
+
+	if (names[capturedName] != 0)
+	{
+		// t[JԂĐƁAt[̒ōO܂cĂ
+		backend.deleteObject(type, names[capturedName]);
+	}
+
+	names[capturedName] = backend.createObject(type, shaderType);
+	return names[capturedName];
+}
+
+void CommandReplayer::deleteName(ReplayBackend& backend, ObjectType type, GLuint capturedName)
+{
+	std::vector<GLuint>& names = _names[static_cast<int>(type)];
+	if (capturedName >= names.size() || names[capturedName] == 0)
+	{
+		return;
+	}
+
+	backend.deleteObject(type, names[capturedName]);
+	names[capturedName] = 0;
+}
+
+GLuint CommandReplayer::findName(ObjectType type, GLuint capturedName) const
+{
+	const std::vector<GLuint>& names = _names[static_cast<int>(type)];
+	return (capturedName < names.size()) ? names[capturedName] : 0;
+}
+
+GLint CommandReplayer::findUniformLocation(GLint capturedLocation) const
+{
+	if (capturedLocation < 0 || _currentProgram >= _uniformLocations.size())
+	{
+		return -1;
+	}
+
+	const std::vector<GLint>& locations = _uniformLocations[_currentProgram];
+	return (static_cast<size_t>(capturedLocation) < locations.size()) ? locations[capturedLocation] : -1;
+}
+
+void CommandReplayer::replayFrame(size_t frameIndex, ReplayBackend& backend)
+{
+	Logger::logAssert(frameIndex < _frames.size(), "݂Ȃt[Đ悤ƂBframeIndex=%d", static_cast<int>(frameIndex));
+
+	const GLCaptureFormat::FrameEntry& frame = _frames[frameIndex];
+	const unsigned int* words = reinterpret_cast<const unsigned int*>(_data + _header->commandDataOffset + frame.commandOffset);
+	size_t numWords = frame.commandByteSize / sizeof(unsigned int);
+
+	// ͈͂initŊm߂Ă
+	size_t position = 0;
+	while (position < numWords)
+	{
+		GLCaptureFormat::CommandHeader header;
+		memcpy(&header, &words[position], sizeof(header));
+		position++;
+
+		executeCommand(header.opcode, &words[position], header.numWords, backend);
+		position += header.numWords;
+	}
+}
+
+void CommandReplayer::executeCommand(Opcode opcode, const unsigned int* words, unsigned int numWords, ReplayBackend& backend)
+{
+	// O肷̂ƁA}bvtFX̂悤ɃobNGhlԂ̂͂ŏ
+	switch (opcode)
+	{
+	case Opcode::GEN_TEXTURES:
+	case Opcode::GEN_BUFFERS:
+	case Opcode::GEN_VERTEX_ARRAYS:
+	case Opcode::GEN_FRAMEBUFFERS:
+	case Opcode::GEN_RENDERBUFFERS:
+		for (unsigned int i = 1; i < numWords; i++)
+		{
+			createName(backend, getGenDeleteObjectType(opcode), words[i], 0);
+		}
+		return;
+	case Opcode::DELETE_TEXTURES:
+	case Opcode::DELETE_BUFFERS:
+	case Opcode::DELETE_VERTEX_ARRAYS:
+	case Opcode::DELETE_FRAMEBUFFERS:
+	case Opcode::DELETE_RENDERBUFFERS:
+		for (unsigned int i = 1; i < numWords; i++)
+		{
+			if (opcode == Opcode::DELETE_BUFFERS && words[i] < _mappedBuffers.size())
+			{
+				_mappedBuffers[words[i]].data = nullptr;
+			}
+			deleteName(backend, getGenDeleteObjectType(opcode), words[i]);
+		}
+		return;
+	case Opcode::CREATE_SHADER:
+		createName(backend, ObjectType::SHADER, words[1], words[0]);
+		return;
+	case Opcode::CREATE_PROGRAM:
+		createName(backend, ObjectType::PROGRAM, words[0], 0);
+		if (words[0] < _uniformLocations.size())
+		{
+			_uniformLocations[words[0]].clear();
+		}
+		return;
+	case Opcode::DELETE_SHADER:
+		deleteName(backend, ObjectType::SHADER, words[0]);
+		return;
+	case Opcode::DELETE_PROGRAM:
+		deleteName(backend, ObjectType::PROGRAM, words[0]);
+		return;
+	case Opcode::FENCE_SYNC:
+		{
+			unsigned int syncId = words[2];
+			if (syncId >= _syncs.size())
+			{
+				_syncs.resize(syncId + 1, nullptr);
+			}
+
+			if (_syncs[syncId] != nullptr)
+			{
+				backend.deleteSync(_syncs[syncId]);
+			}
+			_syncs[syncId] = backend.fenceSync(words[0], words[1]);
+		}
+		return;
+	case Opcode::CLIENT_WAIT_SYNC:
+		if (words[0] < _syncs.size() && _syncs[words[0]] != nullptr)
+		{
+			backend.clientWaitSync(_syncs[words[0]], words[1], readWord64(&words[2]));
+		}
+		return;
+	case Opcode::DELETE_SYNC:
+		if (words[0] < _syncs.size() && _syncs[words[0]] != nullptr)
+		{
+			backend.deleteSync(_syncs[words[0]]);
+			_syncs[words[0]] = nullptr;
+		}
+		return;
+	case Opcode::GET_UNIFORM_LOCATION:
+		{
+			GLuint capturedProgram = words[0];
+			size_t nameSize = 0;
+			const char* name = reinterpret_cast<const char*>(getBlob(words[1], nameSize));
+			GLint capturedLocation = static_cast<GLint>(words[2]);
+
+			if (capturedProgram >= _uniformLocations.size())
+			{
+				_uniformLocations.resize(capturedProgram + 1);
+			}
+
+			std::vector<GLint>& locations = _uniformLocations[capturedProgram];
+			if (static_cast<size_t>(capturedLocation) >= locations.size())
+			{
+				locations.resize(capturedLocation + 1, -1);
+			}
+			locations[capturedLocation] = backend.getUniformLocation(findName(ObjectType::PROGRAM, capturedProgram), name);
+		}
+		return;
+	case Opcode::MAP_BUFFER_RANGE:
+		{
+			GLuint capturedBuffer = words[1];
+			if (capturedBuffer >= _mappedBuffers.size())
+			{
+				_mappedBuffers.resize(capturedBuffer + 1, MappedBuffer{nullptr, 0});
+			}
+
+			GLsizeiptr length = static_cast<GLsizeiptr>(readWord64(&words[4]));
+			_mappedBuffers[capturedBuffer].data = backend.mapBufferRange(words[0], static_cast<GLintptr>(readWord64(&words[2])), length, words[6]);
+			_mappedBuffers[capturedBuffer].length = static_cast<size_t>(length);
+		}
+		return;
+	case Opcode::UNMAP_BUFFER:
+		backend.unmapBuffer(words[0]);
+		if (words[1] < _mappedBuffers.size())
+		{
+			_mappedBuffers[words[1]].data = nullptr;
+		}
+		return;
+	case Opcode::MAPPED_WRITE:
+		{
+			size_t size = 0;
+			const unsigned char* data = getBlob(words[3], size);
+			unsigned long long offset = readWord64(&words[1]);
+			if (words[0] >= _mappedBuffers.size() || _mappedBuffers[words[0]].data == nullptr || data == nullptr)
+			{
+				return;
+			}
+
+			const MappedBuffer& mappedBuffer = _mappedBuffers[words[0]];
+			if (offset > mappedBuffer.length || mappedBuffer.length - offset < size)
+			{
+				Logger::logAssert(false, "}bv͈͂̊OɏƂB");
+				return;
+			}
+
+			memcpy(mappedBuffer.data + offset, data, size);
+		}
+		return;
+	default:
+		break;
+	}
+
+	_words.assign(words, words + numWords);
+
+	switch (opcode)
+	{
+	case Opcode::BIND_TEXTURE:
+		_words[1] = findName(ObjectType::TEXTURE, _words[1]);
+		break;
+	case Opcode::BIND_BUFFER:
+		_words[1] = findName(ObjectType::BUFFER, _words[1]);
+		break;
+	case Opcode::BIND_VERTEX_ARRAY:
+		_words[0] = findName(ObjectType::VERTEX_ARRAY, _words[0]);
+		break;
+	case Opcode::BIND_FRAMEBUFFER:
+		_words[1] = findName(ObjectType::FRAMEBUFFER, _words[1]);
+		break;
+	case Opcode::BIND_RENDERBUFFER:
+		_words[1] = findName(ObjectType::RENDERBUFFER, _words[1]);
+		break;
+	case Opcode::USE_PROGRAM:
+		_currentProgram = _words[0];
+		_words[0] = findName(ObjectType::PROGRAM, _words[0]);
+		break;
+	case Opcode::FRAMEBUFFER_TEXTURE_2D:
+		_words[3] = findName(ObjectType::TEXTURE, _words[3]);
+		break;
+	case Opcode::FRAMEBUFFER_RENDERBUFFER:
+		_words[3] = findName(ObjectType::RENDERBUFFER, _words[3]);
+		break;
+	case Opcode::SHADER_SOURCE:
+	case Opcode::COMPILE_SHADER:
+		_words[0] = findName(ObjectType::SHADER, _words[0]);
+		break;
+	case Opcode::ATTACH_SHADER:
+		_words[0] = findName(ObjectType::PROGRAM, _words[0]);
+		_words[1] = findName(ObjectType::SHADER, _words[1]);
+		break;
+	case Opcode::BIND_ATTRIB_LOCATION:
+	case Opcode::PROGRAM_PARAMETERI:
+	case Opcode::LINK_PROGRAM:
+	case Opcode::PROGRAM_BINARY:
+		_words[0] = findName(ObjectType::PROGRAM, _words[0]);
+		break;
+	case Opcode::UNIFORM_1I:
+	case Opcode::UNIFORM_1F:
+	case Opcode::UNIFORM_3F:
+	case Opcode::UNIFORM_4F:
+	case Opcode::UNIFORM_3FV:
+	case Opcode::UNIFORM_MATRIX_4FV:
+		_words[0] = static_cast<unsigned int>(findUniformLocation(static_cast<GLint>(_words[0])));
+		break;
+	default:
+		break;
+	}
+
+	ReplayBackend::Command command;
+	command.opcode = opcode;
+	command.words = _words.data();
+	command.numWords = numWords;
+	command.blob = nullptr;
+	command.blobSize = 0;
+
+	int blobWord = OPCODE_INFOS[static_cast<int>(opcode)].blobWord;
+	if (blobWord != NO_BLOB_WORD)
+	{
+		command.blob = getBlob(_words[blobWord], command.blobSize);
+	}
+
+	backend.execute(command);
+}
+
+} // namespace mgrrenderer
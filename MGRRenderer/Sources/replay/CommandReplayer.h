@@ -0,0 +1,60 @@
+#pragma once
+#include "ReplayBackend.h"
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// GLCommandRecorderŏot@Cǂ݁At[PʂReplayBackendɗ
+// L^Ƃ̃IuWFNg̖OAtFXAjtH[̃P[VAobNGĥɑΉÂĒu
+// t[JԂĐł悤ɁAL^ƂɊɐĂ閼OxꂽÂĂ
+class CommandReplayer final
+{
+public:
+	CommandReplayer();
+	// data̓t@C̒gŚBCommandReplayergI܂ŕێĂ
+	bool init(const unsigned char* data, size_t size);
+	unsigned int getWidth() const { return _header->width; }
+	unsigned int getHeight() const { return _header->height; }
+	size_t getNumFrames() const { return _frames.size(); }
+	size_t getNumCommands(size_t frameIndex) const { return _frames[frameIndex].numCommands; }
+	void replayFrame(size_t frameIndex, ReplayBackend& backend);
+
+private:
+	static const size_t NUM_OBJECT_TYPES = static_cast<size_t>(ReplayBackend::ObjectType::NUM_OBJECT_TYPES);
+
+	struct MappedBuffer
+	{
+		unsigned char* data;
+		size_t length;
+	};
+
+	const unsigned char* _data;
+	size_t _size;
+	const GLCaptureFormat::Header* _header;
+	std::vector<GLCaptureFormat::FrameEntry> _frames;
+	std::vector<GLCaptureFormat::BlobEntry> _blobs;
+	// L^Ƃ̖OĐ̖OB0͍ĂȂ
+	std::vector<GLuint> _names[NUM_OBJECT_TYPES];
+	std::vector<GLsync> _syncs;
+	// L^Ƃ̃vO̖OƃP[VĐ̃P[V
+	std::vector<std::vector<GLint>> _uniformLocations;
+	// L^Ƃ̃obt@̖OAĐŃ}bv̈
+	std::vector<MappedBuffer> _mappedBuffers;
+	GLuint _currentProgram;
+	// OuR}ḧ̍Ɨ̈
+	std::vector<unsigned int> _words;
+
+	bool validateCommands(const GLCaptureFormat::FrameEntry& frame) const;
+	const unsigned char* getBlob(unsigned int blobIndex, size_t& outSize) const;
+	GLuint createName(ReplayBackend& backend, ReplayBackend::ObjectType type, GLuint capturedName, GLenum shaderType);
+	void deleteName(ReplayBackend& backend, ReplayBackend::ObjectType type, GLuint capturedName);
+	GLuint findName(ReplayBackend::ObjectType type, GLuint capturedName) const;
+	GLint findUniformLocation(GLint capturedLocation) const;
+	void executeCommand(GLCaptureFormat::Opcode opcode, const unsigned int* words, unsigned int numWords, ReplayBackend& backend);
+
+	CommandReplayer(const CommandReplayer&) = delete;
+	CommandReplayer& operator=(const CommandReplayer&) = delete;
+};
+
+} // namespace mgrrenderer
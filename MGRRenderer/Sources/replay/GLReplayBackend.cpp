@@ -0,0 +1,346 @@
+#include "GLReplayBackend.h"
+#include "renderer/Image.h"
+#include "renderer/TextureUtility.h"
+#include "utility/Logger.h"
+#include <string.h>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+using GLCaptureFormat::Opcode;
+
+static float toFloat(unsigned int word)
+{
+	float ret;
+	memcpy(&ret, &word, sizeof(ret));
+	return ret;
+}
+
+static double toDouble(const unsigned int* words)
+{
+	unsigned long long bits = static_cast<unsigned long long>(words[0]) | (static_cast<unsigned long long>(words[1]) << 32);
+	double ret;
+	memcpy(&ret, &bits, sizeof(ret));
+	return ret;
+}
+
+static unsigned long long readWord64(const unsigned int* words)
+{
+	return static_cast<unsigned long long>(words[0]) | (static_cast<unsigned long long>(words[1]) << 32);
+}
+
+static const void* toPointer(const unsigned int* words)
+{
+	return reinterpret_cast<const void*>(static_cast<size_t>(readWord64(words)));
+}
+
+GLuint GLReplayBackend::createObject(ObjectType type, GLenum shaderType)
+{
+	GLuint ret = 0;
+	switch (type)
+	{
+	case ObjectType::TEXTURE:
+		glGenTextures(1, &ret);
+		break;
+	case ObjectType::BUFFER:
+		glGenBuffers(1, &ret);
+		break;
+	case ObjectType::VERTEX_ARRAY:
+		glGenVertexArrays(1, &ret);
+		break;
+	case ObjectType::FRAMEBUFFER:
+		glGenFramebuffers(1, &ret);
+		break;
+	case ObjectType::RENDERBUFFER:
+		glGenRenderbuffers(1, &ret);
+		break;
+	case ObjectType::SHADER:
+		ret = glCreateShader(shaderType);
+		break;
+	case ObjectType::PROGRAM:
+		ret = glCreateProgram();
+		break;
+	default:
+		Logger::logAssert(false, "ΉĂȂIuWFNg̎ށB");
+		break;
+	}
+
+	return ret;
+}
+
+void GLReplayBackend::deleteObject(ObjectType type, GLuint name)
+{
+	switch (type)
+	{
+	case ObjectType::TEXTURE:
+		glDeleteTextures(1, &name);
+		break;
+	case ObjectType::BUFFER:
+		glDeleteBuffers(1, &name);
+		break;
+	case ObjectType::VERTEX_ARRAY:
+		glDeleteVertexArrays(1, &name);
+		break;
+	case ObjectType::FRAMEBUFFER:
+		glDeleteFramebuffers(1, &name);
+		break;
+	case ObjectType::RENDERBUFFER:
+		glDeleteRenderbuffers(1, &name);
+		break;
+	case ObjectType::SHADER:
+		glDeleteShader(name);
+		break;
+	case ObjectType::PROGRAM:
+		glDeleteProgram(name);
+		break;
+	default:
+		Logger::logAssert(false, "ΉĂȂIuWFNg̎ށB");
+		break;
+	}
+}
+
+GLsync GLReplayBackend::fenceSync(GLenum condition, GLbitfield flags)
+{
+	return glFenceSync(condition, flags);
+}
+
+void GLReplayBackend::deleteSync(GLsync sync)
+{
+	glDeleteSync(sync);
+}
+
+void GLReplayBackend::clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	glClientWaitSync(sync, flags, timeout);
+}
+
+GLint GLReplayBackend::getUniformLocation(GLuint program, const char* name)
+{
+	return glGetUniformLocation(program, name);
+}
+
+unsigned char* GLReplayBackend::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	return static_cast<unsigned char*>(glMapBufferRange(target, offset, length, access));
+}
+
+void GLReplayBackend::unmapBuffer(GLenum target)
+{
+	glUnmapBuffer(target);
+}
+
+void GLReplayBackend::execute(const Command& command)
+{
+	const unsigned int* w = command.words;
+
+	switch (command.opcode)
+	{
+	case Opcode::BIND_TEXTURE:
+		glBindTexture(w[0], w[1]);
+		break;
+	case Opcode::BIND_BUFFER:
+		glBindBuffer(w[0], w[1]);
+		break;
+	case Opcode::BIND_VERTEX_ARRAY:
+		glBindVertexArray(w[0]);
+		break;
+	case Opcode::BIND_FRAMEBUFFER:
+		glBindFramebuffer(w[0], w[1]);
+		break;
+	case Opcode::BIND_RENDERBUFFER:
+		glBindRenderbuffer(w[0], w[1]);
+		break;
+	case Opcode::USE_PROGRAM:
+		glUseProgram(w[0]);
+		break;
+	case Opcode::ACTIVE_TEXTURE:
+		glActiveTexture(w[0]);
+		break;
+	case Opcode::ENABLE:
+		glEnable(w[0]);
+		break;
+	case Opcode::DISABLE:
+		glDisable(w[0]);
+		break;
+	case Opcode::CULL_FACE:
+		glCullFace(w[0]);
+		break;
+	case Opcode::BLEND_FUNC:
+		glBlendFunc(w[0], w[1]);
+		break;
+	case Opcode::POLYGON_MODE:
+		glPolygonMode(w[0], w[1]);
+		break;
+	case Opcode::LINE_WIDTH:
+		glLineWidth(toFloat(w[0]));
+		break;
+	case Opcode::VIEWPORT:
+		glViewport(static_cast<GLint>(w[0]), static_cast<GLint>(w[1]), static_cast<GLsizei>(w[2]), static_cast<GLsizei>(w[3]));
+		break;
+	case Opcode::CLEAR:
+		glClear(w[0]);
+		break;
+	case Opcode::CLEAR_COLOR:
+		glClearColor(toFloat(w[0]), toFloat(w[1]), toFloat(w[2]), toFloat(w[3]));
+		break;
+	case Opcode::CLEAR_DEPTH:
+		glClearDepth(toDouble(&w[0]));
+		break;
+	case Opcode::PIXEL_STOREI:
+		glPixelStorei(w[0], static_cast<GLint>(w[1]));
+		break;
+	case Opcode::TEX_PARAMETERI:
+		glTexParameteri(w[0], w[1], static_cast<GLint>(w[2]));
+		break;
+	case Opcode::TEX_PARAMETERFV:
+		{
+			GLfloat params[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+			for (unsigned int i = 0; i < w[2] && i < 4; i++)
+			{
+				params[i] = toFloat(w[3 + i]);
+			}
+			glTexParameterfv(w[0], w[1], params);
+		}
+		break;
+	case Opcode::DRAW_BUFFER:
+		glDrawBuffer(w[0]);
+		break;
+	case Opcode::READ_BUFFER:
+		glReadBuffer(w[0]);
+		break;
+	case Opcode::DRAW_BUFFERS:
+		glDrawBuffers(static_cast<GLsizei>(w[0]), &w[1]);
+		break;
+	case Opcode::ENABLE_VERTEX_ATTRIB_ARRAY:
+		glEnableVertexAttribArray(w[0]);
+		break;
+	case Opcode::DISABLE_VERTEX_ATTRIB_ARRAY:
+		glDisableVertexAttribArray(w[0]);
+		break;
+	case Opcode::VERTEX_ATTRIB_POINTER:
+		glVertexAttribPointer(w[0], static_cast<GLint>(w[1]), w[2], static_cast<GLboolean>(w[3]), static_cast<GLsizei>(w[4]), toPointer(&w[5]));
+		break;
+	case Opcode::RENDERBUFFER_STORAGE:
+		glRenderbufferStorage(w[0], w[1], static_cast<GLsizei>(w[2]), static_cast<GLsizei>(w[3]));
+		break;
+	case Opcode::FRAMEBUFFER_TEXTURE_2D:
+		glFramebufferTexture2D(w[0], w[1], w[2], w[3], static_cast<GLint>(w[4]));
+		break;
+	case Opcode::FRAMEBUFFER_RENDERBUFFER:
+		glFramebufferRenderbuffer(w[0], w[1], w[2], w[3]);
+		break;
+	case Opcode::BLIT_FRAMEBUFFER:
+		glBlitFramebuffer(
+			static_cast<GLint>(w[0]), static_cast<GLint>(w[1]), static_cast<GLint>(w[2]), static_cast<GLint>(w[3]),
+			static_cast<GLint>(w[4]), static_cast<GLint>(w[5]), static_cast<GLint>(w[6]), static_cast<GLint>(w[7]),
+			w[8], w[9]);
+		break;
+	case Opcode::DRAW_ARRAYS:
+		glDrawArrays(w[0], static_cast<GLint>(w[1]), static_cast<GLsizei>(w[2]));
+		break;
+	case Opcode::DRAW_ELEMENTS:
+		glDrawElements(w[0], static_cast<GLsizei>(w[1]), w[2], toPointer(&w[3]));
+		break;
+	case Opcode::FINISH:
+		glFinish();
+		break;
+	case Opcode::SHADER_SOURCE:
+		{
+			const GLchar* source = reinterpret_cast<const GLchar*>(command.blob);
+			glShaderSource(w[0], 1, &source, nullptr);
+		}
+		break;
+	case Opcode::COMPILE_SHADER:
+		glCompileShader(w[0]);
+		break;
+	case Opcode::ATTACH_SHADER:
+		glAttachShader(w[0], w[1]);
+		break;
+	case Opcode::BIND_ATTRIB_LOCATION:
+		glBindAttribLocation(w[0], w[1], reinterpret_cast<const GLchar*>(command.blob));
+		break;
+	case Opcode::PROGRAM_PARAMETERI:
+		glProgramParameteri(w[0], w[1], static_cast<GLint>(w[2]));
+		break;
+	case Opcode::LINK_PROGRAM:
+		{
+			glLinkProgram(w[0]);
+
+			GLint linkResult = GL_FALSE;
+			glGetProgramiv(w[0], GL_LINK_STATUS, &linkResult);
+			Logger::logAssert(linkResult != GL_FALSE, "ĐvÕNɎsBprogram=%d", w[0]);
+		}
+		break;
+	case Opcode::PROGRAM_BINARY:
+		glProgramBinary(w[0], w[1], command.blob, static_cast<GLsizei>(command.blobSize));
+		break;
+	case Opcode::UNIFORM_1I:
+		glUniform1i(static_cast<GLint>(w[0]), static_cast<GLint>(w[1]));
+		break;
+	case Opcode::UNIFORM_1F:
+		glUniform1f(static_cast<GLint>(w[0]), toFloat(w[1]));
+		break;
+	case Opcode::UNIFORM_3F:
+		glUniform3f(static_cast<GLint>(w[0]), toFloat(w[1]), toFloat(w[2]), toFloat(w[3]));
+		break;
+	case Opcode::UNIFORM_4F:
+		glUniform4f(static_cast<GLint>(w[0]), toFloat(w[1]), toFloat(w[2]), toFloat(w[3]), toFloat(w[4]));
+		break;
+	case Opcode::UNIFORM_3FV:
+		// float̓[h̃rbĝ܂ܓĂ
+		glUniform3fv(static_cast<GLint>(w[0]), static_cast<GLsizei>(w[1]), reinterpret_cast<const GLfloat*>(&w[2]));
+		break;
+	case Opcode::UNIFORM_MATRIX_4FV:
+		glUniformMatrix4fv(static_cast<GLint>(w[0]), static_cast<GLsizei>(w[1]), static_cast<GLboolean>(w[2]), reinterpret_cast<const GLfloat*>(&w[3]));
+		break;
+	case Opcode::BUFFER_DATA:
+		glBufferData(w[0], static_cast<GLsizeiptr>(readWord64(&w[1])), command.blob, w[3]);
+		break;
+	case Opcode::BUFFER_SUB_DATA:
+		glBufferSubData(w[0], static_cast<GLintptr>(readWord64(&w[1])), static_cast<GLsizeiptr>(command.blobSize), command.blob);
+		break;
+	case Opcode::BUFFER_STORAGE:
+		glBufferStorage(w[0], static_cast<GLsizeiptr>(readWord64(&w[1])), command.blob, w[3]);
+		break;
+	case Opcode::TEX_IMAGE_2D:
+		glTexImage2D(w[0], static_cast<GLint>(w[1]), static_cast<GLint>(w[2]), static_cast<GLsizei>(w[3]), static_cast<GLsizei>(w[4]), static_cast<GLint>(w[5]), w[6], w[7], command.blob);
+		break;
+	case Opcode::TEX_SUB_IMAGE_2D:
+		glTexSubImage2D(w[0], static_cast<GLint>(w[1]), static_cast<GLint>(w[2]), static_cast<GLint>(w[3]), static_cast<GLsizei>(w[4]), static_cast<GLsizei>(w[5]), w[6], w[7], command.blob);
+		break;
+	default:
+		Logger::logAssert(false, "GLReplayBackendŎsłȂR}hBopcode=%d", static_cast<int>(command.opcode));
+		break;
+	}
+}
+
+void GLReplayBackend::finishFrame()
+{
+	glFinish();
+}
+
+bool GLReplayBackend::readBackBuffer(unsigned int width, unsigned int height, Image& outImage) const
+{
+	size_t rowSize = width * 4;
+	std::vector<unsigned char> pixels(rowSize * height);
+
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+	if (glGetError() != GL_NO_ERROR)
+	{
+		return false;
+	}
+
+	// OpenGL͍_Ȃ̂ŁAt@CǂImageƓ㌴_̍sɕבւ
+	std::vector<unsigned char> flippedPixels(pixels.size());
+	for (unsigned int y = 0; y < height; y++)
+	{
+		memcpy(&flippedPixels[y * rowSize], &pixels[(height - 1 - y) * rowSize], rowSize);
+	}
+
+	return outImage.initWithRawData(flippedPixels.data(), flippedPixels.size(), width, height, TextureUtility::PixelFormat::RGBA8888, false);
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,27 @@
+#pragma once
+#include "ReplayBackend.h"
+
+namespace mgrrenderer
+{
+
+class Image;
+
+// L^R}hۂOpenGLŎsBĂяoXbhŃReLXgJgɂȂĂ邱
+class GLReplayBackend final : public ReplayBackend
+{
+public:
+	GLuint createObject(ObjectType type, GLenum shaderType) override;
+	void deleteObject(ObjectType type, GLuint name) override;
+	GLsync fenceSync(GLenum condition, GLbitfield flags) override;
+	void deleteSync(GLsync sync) override;
+	void clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) override;
+	GLint getUniformLocation(GLuint program, const char* name) override;
+	unsigned char* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) override;
+	void unmapBuffer(GLenum target) override;
+	void execute(const Command& command) override;
+	void finishFrame() override;
+	// ftHgt[obt@̓eRGBA8888outImageɓǂݖ߂BL^AvP[V̏o͂Ɣׂ邽
+	bool readBackBuffer(unsigned int width, unsigned int height, Image& outImage) const;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,73 @@
+#include "NullReplayBackend.h"
+
+namespace mgrrenderer
+{
+
+NullReplayBackend::NullReplayBackend() : _nextName(1)
+{
+}
+
+GLuint NullReplayBackend::createObject(ObjectType type, GLenum shaderType)
+{
+	(void)type;
+	(void)shaderType;
+	return _nextName++;
+}
+
+void NullReplayBackend::deleteObject(ObjectType type, GLuint name)
+{
+	(void)type;
+	(void)name;
+}
+
+GLsync NullReplayBackend::fenceSync(GLenum condition, GLbitfield flags)
+{
+	(void)condition;
+	(void)flags;
+	// CommandReplayernullptrĂȂtFXƂĈ̂ŁA0ȊO̒lԂ
+	return reinterpret_cast<GLsync>(static_cast<size_t>(_nextName++));
+}
+
+void NullReplayBackend::deleteSync(GLsync sync)
+{
+	(void)sync;
+}
+
+void NullReplayBackend::clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout)
+{
+	(void)sync;
+	(void)flags;
+	(void)timeout;
+}
+
+GLint NullReplayBackend::getUniformLocation(GLuint program, const char* name)
+{
+	(void)program;
+	(void)name;
+	return 0;
+}
+
+unsigned char* NullReplayBackend::mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+	(void)target;
+	(void)offset;
+	(void)access;
+	_mappedMemories.push_back(std::vector<unsigned char>(static_cast<size_t>(length)));
+	return _mappedMemories.back().data();
+}
+
+void NullReplayBackend::unmapBuffer(GLenum target)
+{
+	(void)target;
+}
+
+void NullReplayBackend::execute(const Command& command)
+{
+	(void)command;
+}
+
+void NullReplayBackend::finishFrame()
+{
+}
+
+} // namespace mgrrenderer
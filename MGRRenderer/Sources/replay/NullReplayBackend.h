@@ -0,0 +1,31 @@
+#pragma once
+#include "ReplayBackend.h"
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// GPUɉsȂobNGhBt@C̃fR[hƖȎΉÂA}bv̈ւ݂̏ĉŁA
+// GLReplayBackendƂ̍hCoł̃R}hs̃RXgɂȂ
+class NullReplayBackend final : public ReplayBackend
+{
+public:
+	NullReplayBackend();
+	GLuint createObject(ObjectType type, GLenum shaderType) override;
+	void deleteObject(ObjectType type, GLuint name) override;
+	GLsync fenceSync(GLenum condition, GLbitfield flags) override;
+	void deleteSync(GLsync sync) override;
+	void clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) override;
+	GLint getUniformLocation(GLuint program, const char* name) override;
+	unsigned char* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) override;
+	void unmapBuffer(GLenum target) override;
+	void execute(const Command& command) override;
+	void finishFrame() override;
+
+private:
+	GLuint _nextName;
+	// }bv̈̑CPŨԂBĐI܂ŉȂ
+	std::vector<std::vector<unsigned char>> _mappedMemories;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,52 @@
+#pragma once
+#include "renderer/GLCaptureFormat.h"
+#include "renderer/GLHeader.h"
+
+namespace mgrrenderer
+{
+
+// CommandReplayerfR[hR}h󂯎Ďs
+// IuWFNg̖OAtFXAjtH[̃P[V̑ΉÂCommandReplayerŝŁAǂ̃obNGhł̃fR[h̃RXg
+class ReplayBackend
+{
+public:
+	enum class ObjectType : int
+	{
+		TEXTURE,
+		BUFFER,
+		VERTEX_ARRAY,
+		FRAMEBUFFER,
+		RENDERBUFFER,
+		SHADER,
+		PROGRAM,
+		NUM_OBJECT_TYPES
+	};
+
+	// O̍쐬ƍ폜ȊÕR}hBwords̖OƃP[V͍Đ̂̂ɒuĂ
+	struct Command
+	{
+		GLCaptureFormat::Opcode opcode;
+		const unsigned int* words;
+		unsigned int numWords;
+		// uuȂR}hNO_BLOB̂Ƃnullptr
+		const unsigned char* blob;
+		size_t blobSize;
+	};
+
+	virtual ~ReplayBackend() {}
+	// shaderTypeObjectType::SHADER̂Ƃg
+	virtual GLuint createObject(ObjectType type, GLenum shaderType) = 0;
+	virtual void deleteObject(ObjectType type, GLuint name) = 0;
+	virtual GLsync fenceSync(GLenum condition, GLbitfield flags) = 0;
+	virtual void deleteSync(GLsync sync) = 0;
+	virtual void clientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) = 0;
+	virtual GLint getUniformLocation(GLuint program, const char* name) = 0;
+	// ߂lMAPPED_WRITẼf[^
+	virtual unsigned char* mapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) = 0;
+	virtual void unmapBuffer(GLenum target) = 0;
+	virtual void execute(const Command& command) = 0;
+	// t[̍ĐIɌĂсAGPȔ̊҂
+	virtual void finishFrame() = 0;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,140 @@
+#include <iostream>
+#include <cstdlib>
+#include "Config.h"
+#include "CommandReplayer.h"
+#include "GLReplayBackend.h"
+#include "NullReplayBackend.h"
+#include "renderer/GLOffscreenContext.h"
+#include "renderer/Image.h"
+#include "utility/Logger.h"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace mgrrenderer;
+
+// Ō̃t[JԂĐAR}h̔sɂԂv
+// backend.finishFrame()GPŮ҂̂ŁAšv̊OŌĂԁBGL̂Ƃ͑҂܂ł܂߂Ԃo
+static void benchmarkLastFrame(CommandReplayer& replayer, ReplayBackend& backend, int numIterations, double& outAverageSubmitMs, double& outMinSubmitMs, double& outAverageTotalMs)
+{
+	size_t lastFrameIndex = replayer.getNumFrames() - 1;
+	double totalSubmitMs = 0.0;
+	double totalMs = 0.0;
+	double minSubmitMs = DBL_MAX;
+
+	for (int i = 0; i < numIterations; i++)
+	{
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		replayer.replayFrame(lastFrameIndex, backend);
+		std::chrono::steady_clock::time_point submitted = std::chrono::steady_clock::now();
+		backend.finishFrame();
+		std::chrono::steady_clock::time_point finished = std::chrono::steady_clock::now();
+
+		double submitMs = std::chrono::duration<double, std::milli>(submitted - begin).count();
+		totalSubmitMs += submitMs;
+		minSubmitMs = std::min(minSubmitMs, submitMs);
+		totalMs += std::chrono::duration<double, std::milli>(finished - begin).count();
+	}
+
+	outAverageSubmitMs = totalSubmitMs / numIterations;
+	outMinSubmitMs = minSubmitMs;
+	outAverageTotalMs = totalMs / numIterations;
+}
+
+// Ō̃t[O̓\[X̍쐬ƏԂ邽߂ɈxĐ
+static void replayPreviousFrames(CommandReplayer& replayer, ReplayBackend& backend)
+{
+	for (size_t i = 0; i + 1 < replayer.getNumFrames(); i++)
+	{
+		replayer.replayFrame(i, backend);
+		backend.finishFrame();
+	}
+}
+
+// MGRRenderer --captureŏoOpenGĽĂяoAAvP[VSceneɍĐ
+// --nulltGPUɉsȂobNGhōĐAt@C̃fR[hƖO̒ũRXgv
+// g: MGRReplay [--null] Lv`̃pX [] [o͂PNG̃pX]
+int main(int argc, char* argv[])
+{
+	int argIndex = 1;
+	bool usesNullBackend = false;
+	if (argc > argIndex && strcmp(argv[argIndex], "--null") == 0)
+	{
+		usesNullBackend = true;
+		argIndex++;
+	}
+
+	if (argc <= argIndex)
+	{
+		std::cerr << "Usage: MGRReplay [--null] capture_file [iterations] [output_png]" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const char* captureFilePath = argv[argIndex];
+	int numIterations = (argc > argIndex + 1) ? atoi(argv[argIndex + 1]) : 100;
+	const char* outputFilePath = (argc > argIndex + 2) ? argv[argIndex + 2] : nullptr;
+	if (numIterations <= 0)
+	{
+		std::cerr << "Number of iterations must be positive." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::ifstream ifs(captureFilePath, std::ios::in | std::ios::binary);
+	if (!ifs)
+	{
+		std::cerr << "Can't open " << captureFilePath << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::vector<unsigned char> data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+	CommandReplayer replayer;
+	if (!replayer.init(data.data(), data.size()))
+	{
+		std::cerr << "Invalid capture file " << captureFilePath << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	double averageSubmitMs = 0.0;
+	double minSubmitMs = 0.0;
+	double averageTotalMs = 0.0;
+	size_t numCommands = replayer.getNumCommands(replayer.getNumFrames() - 1);
+
+	if (usesNullBackend)
+	{
+		NullReplayBackend backend;
+		replayPreviousFrames(replayer, backend);
+		benchmarkLastFrame(replayer, backend, numIterations, averageSubmitMs, minSubmitMs, averageTotalMs);
+		Logger::log("%s (null): %zu commands, %d iterations, average %.3f ms, min %.3f ms", captureFilePath, numCommands, numIterations, averageSubmitMs, minSubmitMs);
+		return EXIT_SUCCESS;
+	}
+
+	GLOffscreenContext context;
+	if (!context.init(SizeUint(replayer.getWidth(), replayer.getHeight())))
+	{
+		std::cerr << "Can't create offscreen OpenGL context." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	GLReplayBackend backend;
+	replayPreviousFrames(replayer, backend);
+	benchmarkLastFrame(replayer, backend, numIterations, averageSubmitMs, minSubmitMs, averageTotalMs);
+	Logger::log("%s (gl): %zu commands, %d iterations, submit average %.3f ms, min %.3f ms, with gpu average %.3f ms", captureFilePath, numCommands, numIterations, averageSubmitMs, minSubmitMs, averageTotalMs);
+
+	if (outputFilePath == nullptr)
+	{
+		return EXIT_SUCCESS;
+	}
+
+	Image image;
+	bool isSucceeded = backend.readBackBuffer(replayer.getWidth(), replayer.getHeight(), image) && image.saveToPngFile(outputFilePath);
+	if (!isSucceeded)
+	{
+		std::cerr << "Can't save frame to " << outputFilePath << std::endl;
+	}
+
+	return isSucceeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,7 +1,15 @@
 #include "FileUtility.h"
 #include "Logger.h"
+#if defined(_WIN32)
 #include <Shlobj.h>
+#else
+#include <errno.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <cstdlib>
+#include <stdio.h>
+#include <string.h>
 
 namespace mgrrenderer
 {
@@ -20,6 +28,7 @@ FileUtility* FileUtility::getInstance()
 
 FileUtility::FileUtility()
 {
+#if defined(_WIN32)
 	WCHAR* utf16ExePath = nullptr;
 	_get_wpgmptr(&utf16ExePath);
 
@@ -30,6 +39,14 @@ FileUtility::FileUtility()
 	WideCharToMultiByte(CP_UTF8, 0, utf16ExePath, utf16DirEnd - utf16ExePath + 1, utf8ExeDir, sizeof(utf8ExeDir), nullptr, nullptr);
 
 	_resourceRootPath = convertPathFormatToUnixStyle(utf8ExeDir);
+#else
+	// WindowsȊOł͎st@C̏ꏊłȂJgfBNgɂBrhfBNgǂɂĂ\[X̑΃pXςȂ悤
+	char currentDir[MAX_PATH_LENGTH] = { 0 };
+	if (getcwd(currentDir, sizeof(currentDir)) != nullptr)
+	{
+		_resourceRootPath = std::string(currentDir) + "/";
+	}
+#endif
 }
 
 std::string FileUtility::convertPathFormatToUnixStyle(const std::string& path)
@@ -46,10 +63,12 @@ std::string FileUtility::convertPathFormatToUnixStyle(const std::string& path)
 	return ret;
 }
 
+#if defined(_WIN32)
 void FileUtility::convertWCHARFilePath(const std::string& inPath, WCHAR outPath[], size_t size)
 {
 	MultiByteToWideChar(CP_UTF8, 0, inPath.c_str(), -1, outPath, size);
 }
+#endif
 
 std::string FileUtility::getFullPathForFileName(const std::string& fileName) const
 {
@@ -76,9 +95,16 @@ std::string FileUtility::getFullPathForFileName(const std::string& fileName) con
 
 bool FileUtility::isAbsolutePath(const std::string& path)
 {
+#if !defined(_WIN32)
+	if (!path.empty() && path[0] == '/')
+	{
+		return true;
+	}
+#endif
+
 	if (path.length() > 2 &&
-		(((path[0] >= 'a' && path[0] <= 'z') || (path[0] >= 'A' && path[0] <= 'Z')) && path[1] == ':')
-		|| (path[0] == '/' && path[1] == '/')
+		((((path[0] >= 'a' && path[0] <= 'z') || (path[0] >= 'A' && path[0] <= 'Z')) && path[1] == ':')
+		|| (path[0] == '/' && path[1] == '/'))
 		)
 	{
 		return true;
@@ -98,6 +124,7 @@ bool FileUtility::isFileExistInternal(const std::string& path) const
 		strPath.insert(0, _resourceRootPath);
 	}
 
+#if defined(_WIN32)
 	WCHAR utf16buf[MAX_PATH_LENGTH] = {0};
 	convertWCHARFilePath(path, utf16buf, MAX_PATH_LENGTH);
 
@@ -106,6 +133,13 @@ bool FileUtility::isFileExistInternal(const std::string& path) const
 	{
 		return false;
 	}
+#else
+	struct stat status;
+	if (stat(strPath.c_str(), &status) != 0 || S_ISDIR(status.st_mode))
+	{
+		return false;
+	}
+#endif
 
 	return true;
 }
@@ -119,7 +153,8 @@ unsigned char* FileUtility::getFileData(const std::string& fileName, size_t* siz
 
 	// `FbNB_łOfB
 	isValidFileNameAtWindows(fullPath, fileName);
-	
+
+#if defined(_WIN32)
 	WCHAR wcharFullPath[MAX_PATH_LENGTH] = {0};
 	convertWCHARFilePath(fullPath, wcharFullPath, MAX_PATH_LENGTH);
 
@@ -160,6 +195,41 @@ unsigned char* FileUtility::getFileData(const std::string& fileName, size_t* siz
 		msg = msg + fileName + ") failed. error code is " + errCodeStr;
 		Logger::log("%s", msg.c_str());
 	}
+#else
+	FILE* file = fopen(fullPath.c_str(), "rb");
+	if (file != nullptr)
+	{
+		fseek(file, 0, SEEK_END);
+		long fileSize = ftell(file);
+		fseek(file, 0, SEEK_SET);
+
+		if (fileSize >= 0)
+		{
+			*size = static_cast<size_t>(fileSize);
+
+			// 0I[BԂTCY͕ςȂ
+			ret = (unsigned char*)malloc(forString ? *size + 1 : *size);
+			if (forString)
+			{
+				ret[*size] = '\0';
+			}
+
+			if (fread(ret, 1, *size, file) != *size)
+			{
+				free(ret);
+				ret = nullptr;
+			}
+		}
+
+		fclose(file);
+	}
+
+	if (ret == nullptr)
+	{
+		*size = 0;
+		Logger::log("Get data from file(%s) failed. %s", fileName.c_str(), strerror(errno));
+	}
+#endif
 	return ret;
 }
 
@@ -167,6 +237,7 @@ bool FileUtility::isValidFileNameAtWindows(const std::string& fullPath, const st
 {
 	// Windows͑啶ʂȂŃqbgႤAő啶ʂĂYt@C邩`FbN
 	// TODO:FileUtils-win32.cppcheckFileName玝ĂĂ邯Ǐe悭킩
+#if defined(_WIN32)
 
 	std::string path = convertPathFormatToUnixStyle(fullPath);
 	size_t pathLen = path.length();
@@ -208,6 +279,11 @@ bool FileUtility::isValidFileNameAtWindows(const std::string& fullPath, const st
 			path = path.substr(0, path.rfind("/"));
 		} while (path.back() == '.');
 	}
+#else
+	// WindowsȊÕt@CVXe͑啶ʂ̂ŁA_ŖO͈vĂ
+	(void)fullPath;
+	(void)fileName;
+#endif
 
 	return true;
 }
@@ -222,7 +298,8 @@ std::string FileUtility::getStringFromFile(const std::string& fileName) const
 	}
 
 	const std::string& ret = std::string((const char*)data, size);
-	delete data;
+	// getFileDatamallocŊmۂĂ
+	free((void*)data);
 	return ret;
 }
 
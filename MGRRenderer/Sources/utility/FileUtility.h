@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
+#if defined(_WIN32)
 #include <ShlObj.h> // WCHAR̂
+#endif
 
 namespace mgrrenderer
 {
@@ -13,8 +15,10 @@ public:
 
 	static FileUtility* getInstance();
 
+#if defined(_WIN32)
 	// outPathɂ͈Ŝ߃TCYMAX_PATH_LENGTHWCHARz^邱Ƃ𐄏邪A肬̃TCYł삷
 	static void convertWCHARFilePath(const std::string& inPath, WCHAR outPath[], size_t size);
+#endif
 	std::string getFullPathForFileName(const std::string& fileName) const;
 	static bool isAbsolutePath(const std::string& path);
 	bool isFileExistInternal(const std::string& path) const;
@@ -0,0 +1,177 @@
+#include "JobScheduler.h"
+
+namespace mgrrenderer
+{
+
+JobScheduler* JobScheduler::_instance = nullptr;
+
+JobScheduler* JobScheduler::getInstance()
+{
+	if (_instance == nullptr)
+	{
+		_instance = new JobScheduler();
+	}
+
+	return _instance;
+}
+
+void JobScheduler::destroy()
+{
+	delete _instance;
+	_instance = nullptr;
+}
+
+JobScheduler::JobScheduler() :
+_generation(0),
+_isQuitting(false),
+_job(nullptr),
+_numRemainingJobs(0)
+{
+	// ĂяoXbh̃̕[J[BRAȂł̓[J[ȂŒs
+	unsigned int numCores = std::thread::hardware_concurrency();
+	unsigned int numWorkers = numCores > 1 ? numCores - 1 : 0;
+
+	for (unsigned int i = 0; i < numWorkers + 1; i++)
+	{
+		_queues.push_back(std::unique_ptr<JobQueue>(new JobQueue()));
+	}
+
+	for (unsigned int i = 0; i < numWorkers; i++)
+	{
+		_threads.push_back(std::thread(&JobScheduler::workerMain, this, static_cast<size_t>(i + 1)));
+	}
+}
+
+JobScheduler::~JobScheduler()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_isQuitting = true;
+	}
+	_wakeCondition.notify_all();
+
+	for (std::thread& thread : _threads)
+	{
+		thread.join();
+	}
+}
+
+void JobScheduler::parallelFor(size_t count, const std::function<void(size_t index)>& job)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> parallelForLock(_parallelForMutex);
+
+	if (_threads.empty() || count == 1)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			job(i);
+		}
+		return;
+	}
+
+	// ߂ԍ̃Wu͓[J[ď悤ɁAA͈͂ƂɃL[ɓ
+	_job = &job;
+	_numRemainingJobs.store(count);
+	size_t numQueues = _queues.size();
+	for (size_t queueIndex = 0; queueIndex < numQueues; queueIndex++)
+	{
+		size_t begin = count * queueIndex / numQueues;
+		size_t end = count * (queueIndex + 1) / numQueues;
+
+		std::lock_guard<std::mutex> queueLock(_queues[queueIndex]->mutex);
+		for (size_t i = begin; i < end; i++)
+		{
+			_queues[queueIndex]->indices.push_back(i);
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_generation++;
+	}
+	_wakeCondition.notify_all();
+
+	processJobs(0);
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_doneCondition.wait(lock, [this] { return _numRemainingJobs.load() == 0; });
+	}
+
+	_job = nullptr;
+}
+
+void JobScheduler::workerMain(size_t queueIndex)
+{
+	unsigned long long processedGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_wakeCondition.wait(lock, [this, processedGeneration] { return _isQuitting || _generation != processedGeneration; });
+			if (_isQuitting)
+			{
+				return;
+			}
+
+			processedGeneration = _generation;
+		}
+
+		processJobs(queueIndex);
+	}
+}
+
+void JobScheduler::processJobs(size_t queueIndex)
+{
+	size_t index = 0;
+	while (popJob(queueIndex, index))
+	{
+		(*_job)(index);
+
+		if (_numRemainingJobs.fetch_sub(1) == 1)
+		{
+			// Ō̃WuIXbh҂ĂĂяoN
+			std::lock_guard<std::mutex> lock(_mutex);
+			_doneCondition.notify_all();
+		}
+	}
+}
+
+bool JobScheduler::popJob(size_t queueIndex, size_t& outIndex)
+{
+	// ̃L[͌납
+	{
+		JobQueue& queue = *_queues[queueIndex];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.indices.empty())
+		{
+			outIndex = queue.indices.back();
+			queue.indices.pop_back();
+			return true;
+		}
+	}
+
+	// ̃L[ȂÃL[̑O瓐ށBޑ΂Ȃ悤Ɏ̎̃L[珇Ɍ
+	size_t numQueues = _queues.size();
+	for (size_t i = 1; i < numQueues; i++)
+	{
+		JobQueue& queue = *_queues[(queueIndex + i) % numQueues];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (!queue.indices.empty())
+		{
+			outIndex = queue.indices.front();
+			queue.indices.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+} // namespace mgrrenderer
@@ -0,0 +1,58 @@
+#pragma once
+#include "Config.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// [J[XbhœƗɎsXPW[
+// Wu̓[J[Ƃ̃L[ɕzÃL[ɂȂ[J[͑̃L[̐擪瓐ŏ
+class JobScheduler final
+{
+public:
+	static JobScheduler* getInstance();
+	static void destroy();
+
+	// ĂяoXbhɎQ̂ŁA񐔂̓[J[+1ɂȂ
+	unsigned int getNumWorkers() const { return static_cast<unsigned int>(_threads.size()); }
+	// job0count-1̔ԍ1񂸂ĂсASďI܂ő҂Bjob͕̃Xbh瓯ɌĂ΂
+	// jobparallelForĂԓq̌Ăяoɂ͑ΉĂȂB_parallelForMutex܂ܑ҂̂ŃfbhbN
+	void parallelFor(size_t count, const std::function<void(size_t index)>& job);
+
+private:
+	struct JobQueue
+	{
+		std::mutex mutex;
+		std::deque<size_t> indices;
+	};
+
+	static JobScheduler* _instance;
+
+	std::vector<std::thread> _threads;
+	// 0Ԃ͌ĂяoXbhp
+	std::vector<std::unique_ptr<JobQueue>> _queues;
+	std::mutex _mutex;
+	std::condition_variable _wakeCondition;
+	std::condition_variable _doneCondition;
+	unsigned long long _generation;
+	bool _isQuitting;
+	const std::function<void(size_t)>* _job;
+	std::atomic<size_t> _numRemainingJobs;
+	// Xbh̓Ăяo𒼗񉻂Bq̌Ăяo͂̃bNŃfbhbN
+	std::mutex _parallelForMutex;
+
+	JobScheduler();
+	~JobScheduler();
+	void workerMain(size_t queueIndex);
+	void processJobs(size_t queueIndex);
+	bool popJob(size_t queueIndex, size_t& outIndex);
+};
+
+} // namespace mgrrenderer
@@ -1,7 +1,11 @@
 #include "Logger.h"
+#if defined(_WIN32)
 //// TODO:va_listȂǂg߂AƂ܂ȕ@͂ȂȁBB
 #include <ShlObj.h>
+#endif
+#include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 
 namespace mgrrenderer
@@ -12,6 +16,7 @@ namespace Logger
 	static void log(const char* format, va_list args)
 	{
 		char buf[MAX_LOG_LENGTH];
+#if defined(_WIN32)
 		vsnprintf_s(buf, MAX_LOG_LENGTH - 3, format, args); // TODO:Ȃ-3Ȃ̂Bcocoŝ܂܎ĂĂ邪
 		strcat_s(buf, "\n");
 
@@ -22,6 +27,12 @@ namespace Logger
 		WideCharToMultiByte(CP_ACP, 0, wszBuf, -1, buf, sizeof(buf), nullptr, FALSE);
 		printf("%s", buf);
 		//SendLogToWindow(); // Kv킩Ȃ̂łƂ肠RgAEg
+#else
+		vsnprintf(buf, MAX_LOG_LENGTH - 3, format, args);
+		strcat(buf, "\n");
+		// WindowsȊOłUTF-8̒[Oɂ̂܂܏o͂
+		printf("%s", buf);
+#endif
 		fflush(stdout);
 	}
 
@@ -0,0 +1,155 @@
+#include "MappedFile.h"
+#include "FileUtility.h"
+#include "Logger.h"
+#if !defined(_WIN32)
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mgrrenderer
+{
+
+MappedFile::MappedFile() :
+_data(nullptr),
+_size(0),
+_isOpen(false)
+#if defined(_WIN32)
+,_fileHandle(INVALID_HANDLE_VALUE)
+,_mappingHandle(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const std::string& fileName)
+{
+	close();
+
+	const std::string& fullPath = FileUtility::getInstance()->getFullPathForFileName(fileName);
+	if (fullPath.empty())
+	{
+		Logger::log("Map file(%s) failed. File not found.", fileName.c_str());
+		return false;
+	}
+
+#if defined(_WIN32)
+	WCHAR wcharFullPath[FileUtility::MAX_PATH_LENGTH] = {0};
+	FileUtility::convertWCHARFilePath(fullPath, wcharFullPath, FileUtility::MAX_PATH_LENGTH);
+
+	_fileHandle = CreateFileW(wcharFullPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (_fileHandle == INVALID_HANDLE_VALUE)
+	{
+		Logger::log("Map file(%s) failed. error code is %lu", fileName.c_str(), GetLastError());
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(_fileHandle, &fileSize))
+	{
+		Logger::log("Map file(%s) failed. error code is %lu", fileName.c_str(), GetLastError());
+		close();
+		return false;
+	}
+
+	_size = static_cast<size_t>(fileSize.QuadPart);
+	_isOpen = true;
+
+	// ̃t@C̓}bvłȂ̂ŁATCY0ƂĈ
+	if (_size == 0)
+	{
+		return true;
+	}
+
+	_mappingHandle = CreateFileMappingW(_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (_mappingHandle != nullptr)
+	{
+		_data = static_cast<const unsigned char*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	}
+
+	if (_data == nullptr)
+	{
+		Logger::log("Map file(%s) failed. error code is %lu", fileName.c_str(), GetLastError());
+		close();
+		return false;
+	}
+#else
+	int fileDescriptor = ::open(fullPath.c_str(), O_RDONLY);
+	if (fileDescriptor < 0)
+	{
+		Logger::log("Map file(%s) failed. %s", fileName.c_str(), strerror(errno));
+		return false;
+	}
+
+	struct stat status;
+	if (fstat(fileDescriptor, &status) != 0)
+	{
+		Logger::log("Map file(%s) failed. %s", fileName.c_str(), strerror(errno));
+		::close(fileDescriptor);
+		return false;
+	}
+
+	_size = static_cast<size_t>(status.st_size);
+	if (_size > 0)
+	{
+		void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		if (data == MAP_FAILED)
+		{
+			Logger::log("Map file(%s) failed. %s", fileName.c_str(), strerror(errno));
+			::close(fileDescriptor);
+			_size = 0;
+			return false;
+		}
+
+		// 擪珇ɓǂނƂJ[lɓ`Aǂ݂
+		madvise(data, _size, MADV_SEQUENTIAL);
+		_data = static_cast<const unsigned char*>(data);
+	}
+
+	// }bv̓t@CfBXNv^Ă悢
+	::close(fileDescriptor);
+	_isOpen = true;
+#endif
+
+	return true;
+}
+
+void MappedFile::close()
+{
+#if defined(_WIN32)
+	if (_data != nullptr)
+	{
+		UnmapViewOfFile(_data);
+	}
+
+	if (_mappingHandle != nullptr)
+	{
+		CloseHandle(_mappingHandle);
+		_mappingHandle = nullptr;
+	}
+
+	if (_fileHandle != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(_fileHandle);
+		_fileHandle = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (_data != nullptr)
+	{
+		munmap(const_cast<unsigned char*>(_data), _size);
+	}
+#endif
+
+	_data = nullptr;
+	_size = 0;
+	_isOpen = false;
+}
+
+} // namespace mgrrenderer
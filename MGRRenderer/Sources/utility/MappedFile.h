@@ -0,0 +1,39 @@
+#pragma once
+#include "Config.h"
+#include <cstddef>
+#include <string>
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace mgrrenderer
+{
+
+// t@CǂݎpŃɃ}bvBǂݍݗp̃obt@mۂăRs[Ȃ̂ŁA傫ȃt@Ĉ܂܃p[Xł
+// g0I[ĂȂ̂ŁAgetSize͈̔͂ǂނ
+class MappedFile final
+{
+public:
+	MappedFile();
+	~MappedFile();
+	// fileNameFileUtility::getFullPathForFileNameŉ
+	bool open(const std::string& fileName);
+	void close();
+	bool isOpen() const { return _isOpen; }
+	const unsigned char* getData() const { return _data; }
+	size_t getSize() const { return _size; }
+
+private:
+	const unsigned char* _data;
+	size_t _size;
+	bool _isOpen;
+#if defined(_WIN32)
+	HANDLE _fileHandle;
+	HANDLE _mappingHandle;
+#endif
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+};
+
+} // namespace mgrrenderer
@@ -0,0 +1,127 @@
+#include "Profiler.h"
+#include "Logger.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+namespace mgrrenderer
+{
+
+Profiler::Profiler() : _isEnabled(true), _startTimeNs(getCurrentTimeNs())
+{
+}
+
+Profiler::~Profiler()
+{
+	for (ThreadBuffer* buffer : _threadBuffers)
+	{
+		delete buffer;
+	}
+	_threadBuffers.clear();
+}
+
+Profiler* Profiler::getInstance()
+{
+	// XbhŏɌĂ΂ĂSȂ悤Ɋ֐staticō
+	static Profiler instance;
+	return &instance;
+}
+
+unsigned long long Profiler::getCurrentTimeNs()
+{
+	return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+Profiler::ThreadBuffer* Profiler::getThreadBuffer()
+{
+	// eXbh̍ŏ1񂾂bNēo^
+	static thread_local ThreadBuffer* threadBuffer = nullptr;
+	if (threadBuffer != nullptr)
+	{
+		return threadBuffer;
+	}
+
+	ThreadBuffer* buffer = new (std::nothrow) ThreadBuffer();
+	Logger::logAssert(buffer != nullptr, "vt@C̃obt@mۂɎs");
+	buffer->events.resize(RING_BUFFER_SIZE);
+	buffer->numWritten.store(0, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	buffer->threadId = static_cast<unsigned int>(_threadBuffers.size());
+	_threadBuffers.push_back(buffer);
+	threadBuffer = buffer;
+	return threadBuffer;
+}
+
+void Profiler::recordEvent(const char* name, unsigned long long beginNs, unsigned long long endNs)
+{
+	if (!isEnabled())
+	{
+		return;
+	}
+
+	ThreadBuffer* buffer = getThreadBuffer();
+	size_t numWritten = buffer->numWritten.load(std::memory_order_relaxed);
+	Event& event = buffer->events[numWritten % RING_BUFFER_SIZE];
+	event.name = name;
+	event.beginNs = beginNs;
+	event.endNs = endNs;
+	// _vCxg̒gǂ߂悤releaseŌJ
+	buffer->numWritten.store(numWritten + 1, std::memory_order_release);
+}
+
+const char* Profiler::internName(const std::string& name)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	// unordered_set̗vf̓nbVĂړȂ̂ŁAc_str()̃|C^͏܂ŗL
+	return _internedNames.insert(name).first->c_str();
+}
+
+bool Profiler::dumpChromeTrace(const std::string& filePath)
+{
+	std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+	if (!file)
+	{
+		Logger::log("vt@Cʂ̃t@CJȂBfilePath=%s", filePath.c_str());
+		return false;
+	}
+
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool isFirst = true;
+	std::lock_guard<std::mutex> lock(_mutex);
+	for (const ThreadBuffer* buffer : _threadBuffers)
+	{
+		// L^̃XbhĂ~߂Ƀ_vB_vɏ㏑ꂽCxg͉ꂤ邪AvprȂ̂ŋe
+		size_t numWritten = buffer->numWritten.load(std::memory_order_acquire);
+		size_t numEvents = numWritten < RING_BUFFER_SIZE ? numWritten : RING_BUFFER_SIZE;
+		for (size_t i = numWritten - numEvents; i < numWritten; i++)
+		{
+			const Event& event = buffer->events[i % RING_BUFFER_SIZE];
+			if (event.name == nullptr)
+			{
+				continue;
+			}
+
+			// Chrome tracetsdur̓}CNbP
+			char line[128];
+			snprintf(line, sizeof(line), "\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+				buffer->threadId,
+				(event.beginNs - _startTimeNs) / 1000.0,
+				(event.endNs - event.beginNs) / 1000.0);
+
+			if (!isFirst)
+			{
+				file << ",";
+			}
+			file << "\n{\"name\":\"" << event.name << "\"," << line;
+			isFirst = false;
+		}
+	}
+
+	file << "\n]}\n";
+	Logger::log("vt@CʂoBfilePath=%s", filePath.c_str());
+	return true;
+}
+
+} // namespace mgrrenderer
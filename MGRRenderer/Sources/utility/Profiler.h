@@ -0,0 +1,81 @@
+#pragma once
+#include "Config.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace mgrrenderer
+{
+
+// XR[vPʂŏԂvAChromechrome://tracingPerfettoœǂ߂JSONɏovt@C
+// vʂ̓XbhƂ̃Oobt@ɏ̂ŁAL^̓bNȂ
+class Profiler final
+{
+public:
+	// XbhƂɕێCxgBӂꂽÂ̂㏑
+	static const size_t RING_BUFFER_SIZE = 64 * 1024;
+
+	struct Event
+	{
+		const char* name; // 񃊃einternName()œ̂łȂƃ_vɎQƂłȂ̂Œ
+		unsigned long long beginNs;
+		unsigned long long endNs;
+	};
+
+	static Profiler* getInstance();
+	static unsigned long long getCurrentTimeNs();
+
+	bool isEnabled() const { return _isEnabled.load(std::memory_order_relaxed); }
+	void setEnabled(bool enabled) { _isEnabled.store(enabled, std::memory_order_relaxed); }
+	void recordEvent(const char* name, unsigned long long beginNs, unsigned long long endNs);
+	// sɍ閼O̒ɂBbN̂Ńt[ɐx̌ĂяoɂƂǂ߂邱
+	const char* internName(const std::string& name);
+	// SXbh̃Oobt@ɎcĂCxgChrome trace`ŏo
+	bool dumpChromeTrace(const std::string& filePath);
+
+private:
+	struct ThreadBuffer
+	{
+		unsigned int threadId;
+		std::vector<Event> events;
+		std::atomic<size_t> numWritten; // 񂾑BRING_BUFFER_SIZEŊ]肪݈̏ʒu
+	};
+
+	std::atomic<bool> _isEnabled;
+	std::mutex _mutex;
+	std::vector<ThreadBuffer*> _threadBuffers;
+	std::unordered_set<std::string> _internedNames;
+	unsigned long long _startTimeNs;
+
+	Profiler();
+	~Profiler();
+	ThreadBuffer* getThreadBuffer();
+};
+
+class ProfileScope final
+{
+public:
+	ProfileScope(const char* name) : _name(name), _beginNs(Profiler::getCurrentTimeNs()) {}
+	~ProfileScope() { Profiler::getInstance()->recordEvent(_name, _beginNs, Profiler::getCurrentTimeNs()); }
+
+private:
+	const char* _name;
+	unsigned long long _beginNs;
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+} // namespace mgrrenderer
+
+#define MGRRENDERER_PROFILE_CONCAT_INTERNAL(a, b) a##b
+#define MGRRENDERER_PROFILE_CONCAT(a, b) MGRRENDERER_PROFILE_CONCAT_INTERNAL(a, b)
+
+#if defined(MGRRENDERER_ENABLE_PROFILER)
+// nameɂ͕񃊃en
+#define MGRRENDERER_PROFILE_SCOPE(name) ::mgrrenderer::ProfileScope MGRRENDERER_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#else
+#define MGRRENDERER_PROFILE_SCOPE(name)
+#endif